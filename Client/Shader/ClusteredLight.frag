@@ -0,0 +1,168 @@
+#version 460 core
+
+layout(location = 0) in vec3 inWorldPosition;
+layout(location = 1) in vec3 inNormal;
+layout(location = 2) in float inViewDepth;
+
+layout(location = 0) out vec4 outColor;
+
+const uint CLUSTER_COUNT_X = 16;
+const uint CLUSTER_COUNT_Y = 9;
+const uint CLUSTER_COUNT_Z = 24;
+
+const uint LIGHT_TYPE_POINT = 0;
+const uint LIGHT_TYPE_SPOT = 1;
+
+struct Material
+{
+	vec4 ambientShininess; // xyz: ambient, w: shininess
+	vec4 diffuseRGB;
+	vec4 specularRGB;
+};
+
+struct DirectionalLight
+{
+	vec4 direction;
+	vec4 ambientRGB;
+	vec4 diffuseRGB;
+	vec4 specularRGB;
+};
+
+struct Light
+{
+	vec4 positionRange;      // xyz: position, w: range
+	vec4 directionType;      // xyz: direction, w: 0 point, 1 spot
+	vec4 ambientCutOff;      // xyz: ambient, w: cut off (cos value)
+	vec4 diffuseOuterCutOff; // xyz: diffuse, w: outer cut off (cos value)
+	vec4 specularRGB;
+	vec4 attenuation;        // x: constant, y: linear, z: quadratic
+};
+
+#include "FrameData.glsl"
+
+layout(std140, binding = 1) uniform MaterialBuffer
+{
+	Material m;
+};
+
+layout(std140, binding = 2) uniform DirectionalLightBuffer
+{
+	DirectionalLight directionalLight;
+};
+
+struct ClusterEntry
+{
+	uint offset;
+	uint count;
+};
+
+layout(std430, binding = 1) readonly buffer LightBuffer
+{
+	Light lights[];
+};
+
+layout(std430, binding = 2) readonly buffer ClusterBuffer
+{
+	ClusterEntry clusters[];
+};
+
+layout(std430, binding = 3) readonly buffer LightIndexBuffer
+{
+	uint lightIndices[];
+};
+
+vec3 ComputeDirectionalLight(in DirectionalLight light, in Material material, in vec3 normal, in vec3 viewDirection);
+vec3 ComputeClusteredLight(in Light light, in Material material, in vec3 normal, in vec3 worldPosition, in vec3 viewDirection);
+uint ComputeClusterIndex(in vec2 fragCoord, in float viewDepth);
+
+uniform vec2 screenSize;
+uniform float nearZ;
+uniform float farZ;
+
+void main()
+{
+	vec3 norm = normalize(inNormal);
+	vec3 viewDirection = normalize(frame.viewPosition.xyz - inWorldPosition);
+
+	vec3 outputRGB = ComputeDirectionalLight(directionalLight, m, norm, viewDirection);
+
+	ClusterEntry cluster = clusters[ComputeClusterIndex(gl_FragCoord.xy, inViewDepth)];
+	for (uint index = 0; index < cluster.count; ++index)
+	{
+		outputRGB += ComputeClusteredLight(lights[lightIndices[cluster.offset + index]], m, norm, inWorldPosition, viewDirection);
+	}
+
+	outColor = vec4(outputRGB, 1.0f);
+}
+
+vec3 ComputeDirectionalLight(in DirectionalLight light, in Material material, in vec3 normal, in vec3 viewDirection)
+{
+	// ambient
+	vec3 ambientRGB = light.ambientRGB.rgb * material.ambientShininess.rgb;
+
+	// diffuse
+	vec3 lightDirection = normalize(-light.direction.xyz);
+	float diff = max(dot(normal, lightDirection), 0.0f);
+	vec3 diffuseRGB = light.diffuseRGB.rgb * diff * material.diffuseRGB.rgb;
+
+	// specular
+	vec3 halfDirection = normalize(lightDirection + viewDirection);
+	float spec = pow(max(dot(normal, halfDirection), 0.0f), material.ambientShininess.w);
+	vec3 specularRGB = light.specularRGB.rgb * spec * material.specularRGB.rgb;
+
+	return (ambientRGB + diffuseRGB + specularRGB);
+}
+
+vec3 ComputeClusteredLight(in Light light, in Material material, in vec3 normal, in vec3 worldPosition, in vec3 viewDirection)
+{
+	vec3 toLight = light.positionRange.xyz - worldPosition;
+	float dist = length(toLight);
+	if (dist > light.positionRange.w)
+	{
+		return vec3(0.0f);
+	}
+
+	// ambient
+	vec3 ambientRGB = light.ambientCutOff.rgb * material.ambientShininess.rgb;
+
+	// diffuse
+	vec3 lightDirection = toLight / max(dist, 0.0001f);
+	float diff = max(dot(normal, lightDirection), 0.0f);
+	vec3 diffuseRGB = light.diffuseOuterCutOff.rgb * diff * material.diffuseRGB.rgb;
+
+	// specular
+	vec3 halfDirection = normalize(lightDirection + viewDirection);
+	float spec = pow(max(dot(normal, halfDirection), 0.0f), material.ambientShininess.w);
+	vec3 specularRGB = light.specularRGB.rgb * spec * material.specularRGB.rgb;
+
+	// smooth
+	if (uint(light.directionType.w) == LIGHT_TYPE_SPOT)
+	{
+		float theta = dot(lightDirection, normalize(-light.directionType.xyz));
+		float epsilon = light.ambientCutOff.w - light.diffuseOuterCutOff.w;
+		float intensity = clamp((theta - light.diffuseOuterCutOff.w) / epsilon, 0.0f, 1.0f);
+
+		diffuseRGB *= intensity;
+		specularRGB *= intensity;
+	}
+
+	// attenuation
+	float attenuation = 1.0f / (light.attenuation.x + light.attenuation.y * dist + light.attenuation.z * dist * dist);
+
+	ambientRGB *= attenuation;
+	diffuseRGB *= attenuation;
+	specularRGB *= attenuation;
+
+	return (ambientRGB + diffuseRGB + specularRGB);
+}
+
+uint ComputeClusterIndex(in vec2 fragCoord, in float viewDepth)
+{
+	uvec2 tile = uvec2(fragCoord / screenSize * vec2(CLUSTER_COUNT_X, CLUSTER_COUNT_Y));
+	tile = min(tile, uvec2(CLUSTER_COUNT_X - 1, CLUSTER_COUNT_Y - 1));
+
+	float slice = log(max(viewDepth, nearZ) / nearZ) / log(farZ / nearZ) * float(CLUSTER_COUNT_Z);
+	uint z = min(uint(slice), CLUSTER_COUNT_Z - 1);
+
+	return tile.x + tile.y * CLUSTER_COUNT_X + z * CLUSTER_COUNT_X * CLUSTER_COUNT_Y;
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+#version 460 core
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inNormal;
+
+layout(location = 0) out vec3 outWorldPosition;
+layout(location = 1) out vec3 outNormal;
+layout(location = 2) out float outViewDepth;
+
+#include "FrameData.glsl"
+#include "DrawData.glsl"
+
+void main()
+{
+	DrawData draw = draws[gl_BaseInstance];
+
+	vec4 worldPosition = draw.world * vec4(inPosition, 1.0f);
+	vec4 viewPosition = frame.view * worldPosition;
+
+	outWorldPosition = worldPosition.xyz;
+	outNormal = mat3(draw.normal) * inNormal;
+	outViewDepth = -viewPosition.z;
+
+	gl_Position = frame.projection * viewPosition;
+}
\ No newline at end of file
@@ -7,70 +7,41 @@ layout(location = 0) out vec4 outColor;
 
 struct Material
 {
-	vec3 ambientRGB;
-	vec3 diffuseRGB;
-	vec3 specularRGB;
-	float shininess;
+	vec4 ambientShininess; // xyz: ambient, w: shininess
+	vec4 diffuseRGB;
+	vec4 specularRGB;
 };
 
 struct DirectionalLight
 {
-	vec3 position;
-	vec3 direction;
-
-	vec3 ambientRGB;
-	vec3 diffuseRGB;
-	vec3 specularRGB;
+	vec4 direction;
+	vec4 ambientRGB;
+	vec4 diffuseRGB;
+	vec4 specularRGB;
 };
 
-struct PointLight
-{
-	vec3 position;
-
-	vec3 ambientRGB;
-	vec3 diffuseRGB;
-	vec3 specularRGB;
+#include "FrameData.glsl"
 
-	float constant;
-	float linear;
-	float quadratic;
+// uploaded by MaterialPool, one element bound per material
+layout(std140, binding = 1) uniform MaterialBuffer
+{
+	Material m;
 };
 
-struct SpotLight
+// uploaded by RenderManager::SetDirectionalLight
+layout(std140, binding = 2) uniform DirectionalLightBuffer
 {
-	vec3 position;
-	vec3 direction;
-
-	float cutOff;      // Cos Value
-	float outerCutOff; // Cos Value
-
-	vec3 ambientRGB;
-	vec3 diffuseRGB;
-	vec3 specularRGB;
-
-	float constant;
-	float linear;
-	float quadratic;
+	DirectionalLight directionalLight;
 };
 
 vec3 ComputeDirectionalLight(in DirectionalLight light, in Material material, in vec3 normal, in vec3 viewDirection);
-vec3 ComputePointLight(in PointLight light, in Material material, in vec3 normal, in vec3 worldPosition, in vec3 viewDirection);
-vec3 ComputeSpotLight(in SpotLight light, in Material material, in vec3 normal, in vec3 worldPosition, in vec3 viewDirection);
-
-uniform vec3 viewPosition;
-uniform Material m;
-uniform DirectionalLight directionalLight;
-uniform PointLight pointLight;
-uniform SpotLight spotLight;
 
 void main()
 {
 	vec3 norm = normalize(inNormal);
-	vec3 viewDirection = normalize(viewPosition - inWorldPosition);
+	vec3 viewDirection = normalize(frame.viewPosition.xyz - inWorldPosition);
 
 	vec3 outputRGB = ComputeDirectionalLight(directionalLight, m, norm, viewDirection);
-	outputRGB += ComputePointLight(pointLight, m, norm, inWorldPosition, viewDirection);
-	outputRGB += ComputeSpotLight(spotLight, m, norm, inWorldPosition, viewDirection);
 
 	outColor = vec4(outputRGB, 1.0f);
 }
@@ -78,77 +49,17 @@ void main()
 vec3 ComputeDirectionalLight(in DirectionalLight light, in Material material, in vec3 normal, in vec3 viewDirection)
 {
 	// ambient
-	vec3 ambientRGB = light.ambientRGB * material.ambientRGB;
-
-	// diffuse
-	vec3 lightDirection = normalize(-light.direction);
-	float diff = max(dot(normal, lightDirection), 0.0f);
-	vec3 diffuseRGB = light.diffuseRGB * diff * material.diffuseRGB;
-
-	// specular
-	vec3 halfDirection = normalize(lightDirection + viewDirection);
-	float spec = pow(max(dot(normal, halfDirection), 0.0f), material.shininess);
-	vec3 specularRGB = light.specularRGB * spec * material.specularRGB;
-
-	return (ambientRGB + diffuseRGB + specularRGB);
-}
-
-vec3 ComputePointLight(in PointLight light, in Material material, in vec3 normal, in vec3 worldPosition, in vec3 viewDirection)
-{
-	// ambient
-	vec3 ambientRGB = light.ambientRGB * material.ambientRGB;
+	vec3 ambientRGB = light.ambientRGB.rgb * material.ambientShininess.rgb;
 
 	// diffuse
-	vec3 lightDirection = normalize(light.position - worldPosition);
+	vec3 lightDirection = normalize(-light.direction.xyz);
 	float diff = max(dot(normal, lightDirection), 0.0f);
-	vec3 diffuseRGB = light.diffuseRGB * diff * material.diffuseRGB;
+	vec3 diffuseRGB = light.diffuseRGB.rgb * diff * material.diffuseRGB.rgb;
 
 	// specular
 	vec3 halfDirection = normalize(lightDirection + viewDirection);
-	float spec = pow(max(dot(normal, halfDirection), 0.0f), material.shininess);
-	vec3 specularRGB = light.specularRGB * spec * material.specularRGB;
-
-	// attenuation
-	float dist = length(light.position - worldPosition);
-	float attenuation = 1.0f / (light.constant + light.linear * dist + light.quadratic * dist * dist);
-
-	ambientRGB *= attenuation;
-	diffuseRGB *= attenuation;
-	specularRGB *= attenuation;
-
-	return (ambientRGB + diffuseRGB + specularRGB);
-}
-
-vec3 ComputeSpotLight(in SpotLight light, in Material material, in vec3 normal, in vec3 worldPosition, in vec3 viewDirection)
-{
-	// ambient
-	vec3 ambientRGB = light.ambientRGB * material.ambientRGB;
-
-	// diffuse
-	vec3 lightDirection = normalize(light.position - worldPosition);
-	float diff = max(dot(normal, lightDirection), 0.0f);
-	vec3 diffuseRGB = light.diffuseRGB * diff * material.diffuseRGB;
-
-	// specular
-	vec3 halfDirection = normalize(lightDirection + viewDirection);
-	float spec = pow(max(dot(normal, halfDirection), 0.0f), material.shininess);
-	vec3 specularRGB = light.specularRGB * spec * material.specularRGB;
-
-	// smooth
-	float theta = dot(lightDirection, normalize(-light.direction));
-	float epsilon = light.cutOff - light.outerCutOff;
-	float intensity = clamp((theta - light.outerCutOff) / epsilon, 0.0f, 1.0f);
-
-	diffuseRGB *= intensity;
-	specularRGB *= intensity;
-
-	// attenuation
-	float dist = length(light.position - worldPosition);
-	float attenuation = 1.0f / (light.constant + light.linear * dist + light.quadratic * dist * dist);
-
-	ambientRGB *= attenuation;
-	diffuseRGB *= attenuation;
-	specularRGB *= attenuation;
+	float spec = pow(max(dot(normal, halfDirection), 0.0f), material.ambientShininess.w);
+	vec3 specularRGB = light.specularRGB.rgb * spec * material.specularRGB.rgb;
 
 	return (ambientRGB + diffuseRGB + specularRGB);
 }
\ No newline at end of file
@@ -6,14 +6,15 @@ layout(location = 1) in vec3 inNormal;
 layout(location = 0) out vec3 outWorldPosition;
 layout(location = 1) out vec3 outNormal;
 
-uniform mat4 world;
-uniform mat4 view;
-uniform mat4 projection;
+#include "FrameData.glsl"
+#include "DrawData.glsl"
 
 void main()
 {
-	outWorldPosition = vec3(world * vec4(inPosition, 1.0f));
-	outNormal = mat3(transpose(inverse(world))) * inNormal;
+	DrawData draw = draws[gl_BaseInstance];
 
-	gl_Position = projection * view * world * vec4(inPosition, 1.0f);
+	outWorldPosition = vec3(draw.world * vec4(inPosition, 1.0f));
+	outNormal = mat3(draw.normal) * inNormal;
+
+	gl_Position = frame.viewProjection * vec4(outWorldPosition, 1.0f);
 }
\ No newline at end of file
@@ -2,38 +2,127 @@
 
 layout(location = 0) in vec3 inWorldPosition;
 layout(location = 1) in vec3 inNormal;
-layout(location = 2) in vec4 inWorldPositionInLightSpace;
+layout(location = 2) in float inViewDepth;
 
 layout(location = 0) out vec4 outColor;
 
-layout(binding = 0) uniform sampler2D shadowMap;
+layout(binding = 0) uniform sampler2DArrayShadow shadowMap;
+layout(binding = 1) uniform sampler2DArray shadowMoments;
+
+const int MAX_POISSON_TAP_COUNT = 16;
+
+const int SHADOW_FILTER_HARDWARE_PCF = 0;
+const int SHADOW_FILTER_POISSON_PCF = 1;
+const int SHADOW_FILTER_VARIANCE = 2;
+
+const vec2 POISSON_DISK[MAX_POISSON_TAP_COUNT] = vec2[](
+	vec2(-0.94201624f, -0.39906216f), vec2(+0.94558609f, -0.76890725f),
+	vec2(-0.09418410f, -0.92938870f), vec2(+0.34495938f, +0.29387760f),
+	vec2(-0.91588581f, +0.45771432f), vec2(-0.81544232f, -0.87912464f),
+	vec2(-0.38277543f, +0.27676845f), vec2(+0.97484398f, +0.75648379f),
+	vec2(+0.44323325f, -0.97511554f), vec2(+0.53742981f, -0.47373420f),
+	vec2(-0.26496911f, -0.41893023f), vec2(+0.79197514f, +0.19090188f),
+	vec2(-0.24188840f, +0.99706507f), vec2(-0.81409955f, +0.91437590f),
+	vec2(+0.19984126f, +0.78641367f), vec2(+0.14383161f, -0.14100790f)
+);
+
+#include "FrameData.glsl"
 
 uniform vec3 lightPosition;
-uniform vec3 viewPosition;
+uniform int cascadeCount;
+// SHADOW_FILTER selects the filter at compile time; without it the uniform is used
+#ifdef SHADOW_FILTER
+const int shadowFilter = SHADOW_FILTER;
+#else
+uniform int shadowFilter;
+#endif
+uniform int poissonTapCount;
+uniform float poissonRadius;
 
-float ComputeShadow(vec4 worldPositionInLightSpace)
+// hardware pcf : 4 bilinear compare taps one texel apart, each covering 2x2 texels, together cover 4x4 texels
+float ComputeHardwarePCF(vec3 projectionCoords, int cascade, float bias)
 {
-	vec3 projectionCoords = worldPositionInLightSpace.xyz / worldPositionInLightSpace.w;
-	projectionCoords = projectionCoords * 0.5f + 0.5f;
+	vec2 texelSize = 1.0f / vec2(textureSize(shadowMap, 0).xy);
+	float depth = projectionCoords.z - bias;
 
-	float closestDepth = texture(shadowMap, projectionCoords.xy).r;
-	float currentDepth = projectionCoords.z;
+	float lit = 0.0f;
+	lit += texture(shadowMap, vec4(projectionCoords.xy + vec2(-1.0f, -1.0f) * texelSize, float(cascade), depth));
+	lit += texture(shadowMap, vec4(projectionCoords.xy + vec2(+1.0f, -1.0f) * texelSize, float(cascade), depth));
+	lit += texture(shadowMap, vec4(projectionCoords.xy + vec2(-1.0f, +1.0f) * texelSize, float(cascade), depth));
+	lit += texture(shadowMap, vec4(projectionCoords.xy + vec2(+1.0f, +1.0f) * texelSize, float(cascade), depth));
 
-	float shadow = 0.0f;
-	float bias = 0.005;
-	vec2 texelSize = 1.0 / textureSize(shadowMap, 0);
-	for(int x = -2; x <= 2; ++x)
+	return 1.0f - lit / 4.0f;
+}
+
+// rotated poisson disk pcf
+float ComputePoissonPCF(vec3 projectionCoords, int cascade, float bias)
+{
+	vec2 texelSize = 1.0f / vec2(textureSize(shadowMap, 0).xy);
+	float depth = projectionCoords.z - bias;
+
+	float angle = 6.28318530f * fract(sin(dot(gl_FragCoord.xy, vec2(12.9898f, 78.233f))) * 43758.5453f);
+	mat2 rotation = mat2(cos(angle), sin(angle), -sin(angle), cos(angle));
+
+	int tapCount = clamp(poissonTapCount, 1, MAX_POISSON_TAP_COUNT);
+	float lit = 0.0f;
+	for(int index = 0; index < tapCount; ++index)
+	{
+		vec2 offset = rotation * POISSON_DISK[index] * poissonRadius * texelSize;
+		lit += texture(shadowMap, vec4(projectionCoords.xy + offset, float(cascade), depth));
+	}
+
+	return 1.0f - lit / float(tapCount);
+}
+
+// variance shadow map with light bleeding reduction
+float ComputeVariance(vec3 projectionCoords, int cascade)
+{
+	vec2 moments = texture(shadowMoments, vec3(projectionCoords.xy, float(cascade))).rg;
+	if(projectionCoords.z <= moments.x)
 	{
-		for(int y = -2; y <= 2; ++y)
+		return 0.0f;
+	}
+
+	float variance = max(moments.y - moments.x * moments.x, 0.00002f);
+	float delta = projectionCoords.z - moments.x;
+	float maxProbability = variance / (variance + delta * delta);
+	maxProbability = clamp((maxProbability - 0.2f) / 0.8f, 0.0f, 1.0f);
+
+	return 1.0f - maxProbability;
+}
+
+float ComputeShadow(vec3 worldPosition, float viewDepth)
+{
+	int cascade = cascadeCount - 1;
+	for(int index = 0; index < cascadeCount; ++index)
+	{
+		if(viewDepth < frame.lightSplits[index])
 		{
-			float PCFDepth = texture(shadowMap, projectionCoords.xy + vec2(x, y) * texelSize).r;
-			shadow += currentDepth - bias > PCFDepth  ? 1.0 : 0.0;
+			cascade = index;
+			break;
 		}
 	}
 
-	shadow /= 25.0f;
+	vec4 worldPositionInLightSpace = frame.lightViewProjections[cascade] * vec4(worldPosition, 1.0f);
+	vec3 projectionCoords = worldPositionInLightSpace.xyz / worldPositionInLightSpace.w;
+	projectionCoords = projectionCoords * 0.5f + 0.5f;
+
+	if(projectionCoords.z > 1.0f)
+	{
+		return 0.0f;
+	}
+
+	float bias = 0.005;
+	if(shadowFilter == SHADOW_FILTER_POISSON_PCF)
+	{
+		return ComputePoissonPCF(projectionCoords, cascade, bias);
+	}
+	else if(shadowFilter == SHADOW_FILTER_VARIANCE)
+	{
+		return ComputeVariance(projectionCoords, cascade);
+	}
 	
-	return shadow;
+	return ComputeHardwarePCF(projectionCoords, cascade, bias);
 }
 
 void main()
@@ -48,12 +137,12 @@ void main()
 	vec3 diffuseRGB = diff * vec3(0.5f, 0.5f, 0.5f);
 
 	// specular
-	vec3 viewDirection = normalize(viewPosition - inWorldPosition);
+	vec3 viewDirection = normalize(frame.viewPosition.xyz - inWorldPosition);
 	vec3 halfDirection = normalize(lightDirection + viewDirection);
 	float spec = pow(max(dot(norm, halfDirection), 0.0f), 128.0f);
 	vec3 specularRGB = spec * vec3(1.0f, 1.0f, 1.0f);
 
-	float shadow = ComputeShadow(inWorldPositionInLightSpace);
+	float shadow = ComputeShadow(inWorldPosition, inViewDepth);
 
 	vec3 resultRGB = (ambientRGB + (1.0f - shadow) * (diffuseRGB + specularRGB));
 
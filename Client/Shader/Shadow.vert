@@ -5,19 +5,18 @@ layout(location = 1) in vec3 inNormal;
 
 layout(location = 0) out vec3 outWorldPosition;
 layout(location = 1) out vec3 outNormal;
-layout(location = 2) out vec4 outWorldPositionInLightSpace;
+layout(location = 2) out float outViewDepth;
 
-uniform mat4 world;
-uniform mat4 view;
-uniform mat4 projection;
-uniform mat4 lightView;
-uniform mat4 lightProjection;
+#include "FrameData.glsl"
+#include "DrawData.glsl"
 
 void main()
 {
-	outWorldPosition = vec3(world * vec4(inPosition, 1.0f));
-	outNormal = mat3(transpose(inverse(world))) * inNormal;
-	outWorldPositionInLightSpace = lightProjection * lightView * vec4(outWorldPosition, 1.0f);
+	DrawData draw = draws[gl_BaseInstance];
+
+	outWorldPosition = vec3(draw.world * vec4(inPosition, 1.0f));
+	outNormal = mat3(draw.normal) * inNormal;
+	outViewDepth = -(frame.view * vec4(outWorldPosition, 1.0f)).z;
 	
-	gl_Position = projection * view * world * vec4(inPosition, 1.0f);
+	gl_Position = frame.viewProjection * vec4(outWorldPosition, 1.0f);
 }
\ No newline at end of file
@@ -0,0 +1,19 @@
+#version 460 core
+#include "TextureBinding.glsl"
+
+layout(location = 0) in vec3 inNormal;
+layout(location = 1) in vec2 inTexture;
+layout(location = 2) flat in int inTextureSlot;
+
+layout(location = 0) out vec4 outColor;
+
+uniform vec3 lightDirection;
+
+void main()
+{
+	// the slot comes from the draw data of this draw, so it is dynamically uniform
+	vec4 albedo = (inTextureSlot < 0) ? vec4(1.0f) : SampleTextureSlot(inTextureSlot, inTexture);
+
+	float diff = max(dot(normalize(inNormal), normalize(-lightDirection)), 0.0f);
+	outColor = vec4(albedo.rgb * (0.2f + 0.8f * diff), albedo.a);
+}
\ No newline at end of file
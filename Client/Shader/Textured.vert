@@ -0,0 +1,23 @@
+#version 460 core
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inNormal;
+layout(location = 2) in vec2 inTexture;
+
+layout(location = 0) out vec3 outNormal;
+layout(location = 1) out vec2 outTexture;
+layout(location = 2) flat out int outTextureSlot;
+
+#include "FrameData.glsl"
+#include "DrawData.glsl"
+
+void main()
+{
+	DrawData draw = draws[gl_BaseInstance];
+
+	outNormal = mat3(draw.normal) * inNormal;
+	outTexture = inTexture;
+	outTextureSlot = draw.textureSlot;
+
+	gl_Position = frame.viewProjection * draw.world * vec4(inPosition, 1.0f);
+}
\ No newline at end of file
@@ -1,3 +1,5 @@
+#include <cstring>
+
 #include "IApplication.h"
 
 
@@ -55,33 +57,140 @@ public:
 	{
 		Vector3f cameraPosition = Vector3f(1.0f, 5.0f, 10.0f);
 
-		Shader* depthShader = ResourceManager::Get().GetResource<Shader>("ShadowMap");
-
-		Shader* shadowShader = ResourceManager::Get().CreateResource<Shader>("shadow");
-		shadowShader->Initialize(clientPath_ + L"Shader/Shadow.vert", clientPath_ + L"Shader/Shadow.frag");
+		ShaderVariantSet* shadowShaders = ResourceManager::Get().CreateResource<ShaderVariantSet>("shadow");
+		shadowShaders->Initialize(clientPath_ + L"Shader/Shadow.vert", clientPath_ + L"Shader/Shadow.frag");
 
 		std::vector<StaticMesh::Vertex> vertices;
 		std::vector<uint32_t> indices;;
 
+		GeometryPool* geometryPool = ResourceManager::Get().CreateResource<GeometryPool>("geometryPool");
+		geometryPool->Initialize(16 * 1024, 64 * 1024);
+
 		StaticMesh* floor = ResourceManager::Get().CreateResource<StaticMesh>("floor");
 		GeometryGenerator::CreateCube(Vector3f(50.0f, 1.0f, 50.0f), vertices, indices);
 		floor->Initialize(vertices, indices);
+		int32_t floorMeshID = geometryPool->AddMesh(vertices, indices);
 
 		StaticMesh* cube = ResourceManager::Get().CreateResource<StaticMesh>("cube");
 		GeometryGenerator::CreateCube(Vector3f(2.0f, 2.0f, 2.0f), vertices, indices);
 		cube->Initialize(vertices, indices);
+		int32_t cubeMeshID = geometryPool->AddMesh(vertices, indices);
 
 		StaticMesh* sphere = ResourceManager::Get().CreateResource<StaticMesh>("sphere");
 		GeometryGenerator::CreateSphere(0.5f, 30, vertices, indices);
 		sphere->Initialize(vertices, indices);
+		int32_t sphereMeshID = geometryPool->AddMesh(vertices, indices);
+
+		Texture2D* checker = ResourceManager::Get().CreateResource<Texture2D>("checker");
+		checker->InitializeAsync(clientPath_ + L"Resource/Texture/Checker.png");
+
+		Texture2D* stripe = ResourceManager::Get().CreateResource<Texture2D>("stripe");
+		stripe->InitializeAsync(clientPath_ + L"Resource/Texture/Stripe.png");
+
+		TextureBindingTable* textureTable = ResourceManager::Get().CreateResource<TextureBindingTable>("textureTable");
+		textureTable->Initialize();
+
+		int32_t checkerSlot = textureTable->Add(checker);
+		int32_t stripeSlot = textureTable->Add(stripe);
+
+		/** ؽó 迭   ϵ   Ƿ, ε帮   Բ մϴ. */
+		ShaderVariantSet* texturedShaders = ResourceManager::Get().CreateResource<ShaderVariantSet>("textured");
+		texturedShaders->Initialize(clientPath_ + L"Shader/Textured.vert", clientPath_ + L"Shader/Textured.frag");
+		texturedShaders->GetVariant({ "TEXTURE_ARRAY" });
+
+		Shader* texturedShader = texturedShaders->GetVariant({ textureTable->GetShaderDefine() });
+
+		Shader* lightShader = ResourceManager::Get().CreateResource<Shader>("light");
+		lightShader->Initialize(clientPath_ + L"Shader/Light.vert", clientPath_ + L"Shader/Light.frag");
+
+		Material floorMaterial(Vector3f(0.2f, 0.2f, 0.2f), Vector3f(0.6f, 0.6f, 0.6f), Vector3f(0.1f, 0.1f, 0.1f), 8.0f);
+		Material cubeMaterial(Vector3f(0.2f, 0.1f, 0.05f), Vector3f(0.9f, 0.5f, 0.2f), Vector3f(0.5f, 0.5f, 0.5f), 32.0f);
+		Material sphereMaterial(Vector3f(0.05f, 0.1f, 0.2f), Vector3f(0.2f, 0.4f, 0.9f), Vector3f(1.0f, 1.0f, 1.0f), 64.0f);
+
+		MaterialPool* materialPool = ResourceManager::Get().CreateResource<MaterialPool>("materialPool");
+		materialPool->Initialize();
+		materialPool->Add(&floorMaterial);
+		materialPool->Add(&cubeMaterial);
+		materialPool->Add(&sphereMaterial);
+
+		RenderQueue renderQueue;
 
-		const uint32_t SHADOW_WIDTH = 1024;
-		const uint32_t SHADOW_HEIGHT = 1024;
+		ShaderVariantSet* clusteredShaders = ResourceManager::Get().CreateResource<ShaderVariantSet>("clusteredLight");
+		clusteredShaders->Initialize(clientPath_ + L"Shader/ClusteredLight.vert", clientPath_ + L"Shader/ClusteredLight.frag");
 
-		ShadowMap* shadowMap = ResourceManager::Get().CreateResource<ShadowMap>("shadowMap");
-		shadowMap->Initialize(SHADOW_WIDTH, SHADOW_HEIGHT);
+		Shader* clusteredShader = clusteredShaders->GetVariant({});
+
+		ClusteredLightBuffer* clusteredLightBuffer = ResourceManager::Get().CreateResource<ClusteredLightBuffer>("clusteredLightBuffer");
+		clusteredLightBuffer->Initialize();
+
+		LightClusterBuilder clusterBuilder;
+
+		/** ٴ    ٸ Դϴ.   ġ ٲǷ Ŭ͸ Ź ٽ ϴ. */
+		const uint32_t POINT_LIGHT_COUNT = 64;
+		std::vector<PointLight> pointLights(POINT_LIGHT_COUNT);
+		for (uint32_t index = 0; index < POINT_LIGHT_COUNT; ++index)
+		{
+			float hue = static_cast<float>(index) / static_cast<float>(POINT_LIGHT_COUNT);
+			Vector3f color = Vector3f(
+				0.5f + 0.5f * MathUtils::Cos(TwoPi * (hue + 0.00f)),
+				0.5f + 0.5f * MathUtils::Cos(TwoPi * (hue + 0.33f)),
+				0.5f + 0.5f * MathUtils::Cos(TwoPi * (hue + 0.67f))
+			);
+
+			pointLights[index] = PointLight(Vector3f(0.0f, 0.0f, 0.0f), Vector3f(0.0f, 0.0f, 0.0f), color, color, 1.0f, 0.35f, 0.44f);
+		}
+
+		std::vector<SpotLight> spotLights;
+
+		const uint32_t SHADOW_SIZE = 1024;
+		const uint32_t CASCADE_COUNT = 4;
+
+		CascadedShadowMap* shadowMap = ResourceManager::Get().CreateResource<CascadedShadowMap>("shadowMap");
+		shadowMap->Initialize(SHADOW_SIZE, CASCADE_COUNT, true, EShadowFilter::PoissonPCF);
+
+		Shader* depthShader = ResourceManager::Get().GetResource<Shader>((shadowMap->GetFilter() == EShadowFilter::Variance) ? "VarianceShadowMap" : "ShadowMap");
+
+		Shader* shadowShader = shadowShaders->GetVariant({ StringUtils::PrintF("SHADOW_FILTER=%d", static_cast<int32_t>(shadowMap->GetFilter())) });
 
 		Vector3f lightPosition = Vector3f(-4.0f, 4.0f, +0.0f);
+		Vector3f lightDirection = MathUtils::Normalize(Vector3f(0.0f, 0.0f, 0.0f) - lightPosition);
+		std::vector<ShadowCascadeUtils::Cascade> cascades;
+		std::vector<ShadowCascadeUtils::Cascade> prevCascades;
+
+		DirectionalLight directionalLight(lightPosition, lightDirection, Vector3f(0.2f, 0.2f, 0.2f), Vector3f(0.8f, 0.8f, 0.8f), Vector3f(0.5f, 0.5f, 0.5f));
+
+		std::vector<RenderObject> renderObjects =
+		{
+			RenderObject{ floor,  MathUtils::CreateTranslation(Vector3f( 0.0f, -3.0f,  0.0f)), true,  DynamicBoundingVolumeTree::NULL_NODE, floorMeshID,  checkerSlot, &floorMaterial  },
+			RenderObject{ cube,   MathUtils::CreateTranslation(Vector3f( 0.0f, -1.5f, -3.0f)), true,  DynamicBoundingVolumeTree::NULL_NODE, cubeMeshID,   stripeSlot,  &cubeMaterial   },
+			RenderObject{ sphere, MathUtils::CreateTranslation(Vector3f(-1.0f,  1.0f,  0.0f)), false, DynamicBoundingVolumeTree::NULL_NODE, sphereMeshID, checkerSlot, &sphereMaterial },
+			RenderObject{ sphere, MathUtils::CreateTranslation(Vector3f( 0.0f,  1.0f,  0.0f)), false, DynamicBoundingVolumeTree::NULL_NODE, sphereMeshID, stripeSlot,  &sphereMaterial },
+			RenderObject{ sphere, MathUtils::CreateTranslation(Vector3f(+1.0f,  1.0f,  0.0f)), false, DynamicBoundingVolumeTree::NULL_NODE, sphereMeshID, -1,          &sphereMaterial },
+		};
+
+		DynamicBoundingVolumeTree cullingTree;
+		for (uint32_t index = 0; index < static_cast<uint32_t>(renderObjects.size()); ++index)
+		{
+			RenderObject& renderObject = renderObjects[index];
+			renderObject.proxyID = cullingTree.Insert(renderObject.mesh->GetBoundingBox().Transform(renderObject.world), index);
+		}
+
+		std::vector<uint32_t> visibleObjects;
+
+		/**   ̴ ũ ٸ ʵ,  ڵ ̴ غ  ó ׸ ӿ ϴ. */
+		Shader::UniformHandle cascadeCountHandle;
+		Shader::UniformHandle poissonTapCountHandle;
+		Shader::UniformHandle poissonRadiusHandle;
+		Shader::UniformHandle lightPositionHandle;
+		Shader::UniformHandle lightDirectionHandle;
+		Shader::UniformHandle screenSizeHandle;
+		Shader::UniformHandle nearZHandle;
+		Shader::UniformHandle farZHandle;
+		bool bIsShadowHandleReady = false;
+		bool bIsTexturedHandleReady = false;
+		bool bIsClusteredHandleReady = false;
+
+		ERenderPath renderPath = ERenderPath::Shadow;
 
 		timer_.Reset();
 		RenderManager::Get().SetVsyncMode(true);
@@ -90,73 +199,243 @@ public:
 			timer_.Tick();
 			InputManager::Get().Tick();
 
+			if (InputManager::Get().GetVirtualKeyPressState(EVirtualKey::VKEY_TAB) == EPressState::Pressed)
+			{
+				renderPath = static_cast<ERenderPath>((static_cast<int32_t>(renderPath) + 1) % static_cast<int32_t>(ERenderPath::Count));
+			}
+
 			RenderManager::Get().BeginFrame(0.0f, 0.0f, 0.0f, 1.0f);
 
 			float nearPlane = 0.1f;
 			float farPlane = 100.0f;
+			float fov = MathUtils::ToRadian(45.0f);
 			Matrix4x4f view = MathUtils::CreateLookAt(cameraPosition, Vector3f(0.0f, 0.0f, 0.0f), Vector3f(0.0f, 1.0f, 0.0f));
-			Matrix4x4f projection = MathUtils::CreatePerspective(MathUtils::ToRadian(45.0f), window_->GetAspectSize(), 0.1f, 100.0f);
-			Matrix4x4f lightView = MathUtils::CreateLookAt(lightPosition, Vector3f(0.0f, 0.0f, 0.0f), Vector3f(0.0f, 1.0f, 0.0f));
-			Matrix4x4f lightProjection = MathUtils::CreateOrtho(-10.0f, +10.0f, -10.0f, +10.0f, nearPlane, farPlane);
+			Matrix4x4f projection = MathUtils::CreatePerspective(fov, window_->GetAspectSize(), nearPlane, farPlane);
+
+			for (uint32_t index = 0; index < static_cast<uint32_t>(renderObjects.size()); ++index)
 			{
-				depthShader->Bind();
-				depthShader->SetUniform("lightView", lightView);
-				depthShader->SetUniform("lightProjection", lightProjection);
+				RenderObject& renderObject = renderObjects[index];
+				if (!renderObject.bIsStatic)
+				{
+					float height = 1.0f + 0.5f * MathUtils::Sin(timer_.GetTotalSeconds() * 2.0f + static_cast<float>(index));
+					renderObject.world = MathUtils::CreateTranslation(Vector3f(renderObject.world.m[3][0], height, renderObject.world.m[3][2]));
+					cullingTree.Refit(renderObject.proxyID, renderObject.mesh->GetBoundingBox().Transform(renderObject.world));
+				}
+			}
 
-				glViewport(0, 0, SHADOW_WIDTH, SHADOW_HEIGHT);
-				shadowMap->Bind();
-				shadowMap->Clear();
+			prevCascades.swap(cascades);
+			ShadowCascadeUtils::ComputeCascades(view, fov, window_->GetAspectSize(), nearPlane, farPlane, lightDirection, CASCADE_COUNT, 0.75f, SHADOW_SIZE, 20.0f, cascades);
+			for (uint32_t cascade = 0; cascade < CASCADE_COUNT; ++cascade)
+			{
+				if (prevCascades.size() != cascades.size() ||
+					std::memcmp(&prevCascades[cascade].lightView, &cascades[cascade].lightView, sizeof(Matrix4x4f)) != 0 ||
+					std::memcmp(&prevCascades[cascade].lightProjection, &cascades[cascade].lightProjection, sizeof(Matrix4x4f)) != 0)
+				{
+					shadowMap->MarkStaticCacheDirty(cascade);
+				}
+			}
 
-				// 1. 
-				depthShader->SetUniform("world", MathUtils::CreateTranslation(Vector3f(0.0f, -3.0f, 0.0f)));
-				RenderManager::Get().RenderStaticMesh3D(floor);
+			ShaderDataUtils::FrameData frameData;
+			frameData.view = view;
+			frameData.projection = projection;
+			frameData.viewProjection = view * projection;
+			for (uint32_t cascade = 0; cascade < CASCADE_COUNT; ++cascade)
+			{
+				frameData.lightViewProjections[cascade] = cascades[cascade].lightView * cascades[cascade].lightProjection;
+				frameData.lightSplits.data[cascade] = cascades[cascade].splitFar;
+			}
+			frameData.viewPosition = Vector4f(cameraPosition.x, cameraPosition.y, cameraPosition.z, 1.0f);
+			frameData.time = Vector4f(timer_.GetTotalSeconds(), timer_.GetDeltaSeconds(), 0.0f, 0.0f);
+			RenderManager::Get().SetFrameData(frameData);
 
-				// 2.
-				depthShader->SetUniform("world", MathUtils::CreateTranslation(Vector3f(-1.0f, 1.0f, 0.0f)));
-				RenderManager::Get().RenderStaticMesh3D(sphere);
+			/** ũ   ̴ εϸ ũ   ߹Ƿ,   ̴ غ  ׸ ʽϴ. */
+			bool bIsPathReady = true;
+			if (renderPath == ERenderPath::Shadow)
+			{
+				bIsPathReady = depthShader->IsReady() && shadowShader->IsReady();
+				if (bIsPathReady && !bIsShadowHandleReady)
+				{
+					cascadeCountHandle = shadowShader->GetUniformHandle(Shader::GetUniformID("cascadeCount"));
+					poissonTapCountHandle = shadowShader->GetUniformHandle(Shader::GetUniformID("poissonTapCount"));
+					poissonRadiusHandle = shadowShader->GetUniformHandle(Shader::GetUniformID("poissonRadius"));
+					lightPositionHandle = shadowShader->GetUniformHandle(Shader::GetUniformID("lightPosition"));
+					bIsShadowHandleReady = true;
+				}
+			}
+			else if (renderPath == ERenderPath::Textured)
+			{
+				bIsPathReady = texturedShader->IsReady();
+				if (bIsPathReady && !bIsTexturedHandleReady)
+				{
+					lightDirectionHandle = texturedShader->GetUniformHandle(Shader::GetUniformID("lightDirection"));
+					bIsTexturedHandleReady = true;
+				}
+			}
+			else if (renderPath == ERenderPath::Clustered)
+			{
+				bIsPathReady = clusteredShader->IsReady();
+				if (bIsPathReady && !bIsClusteredHandleReady)
+				{
+					screenSizeHandle = clusteredShader->GetUniformHandle(Shader::GetUniformID("screenSize"));
+					nearZHandle = clusteredShader->GetUniformHandle(Shader::GetUniformID("nearZ"));
+					farZHandle = clusteredShader->GetUniformHandle(Shader::GetUniformID("farZ"));
+					bIsClusteredHandleReady = true;
+				}
+			}
 
-				// 3.
-				depthShader->SetUniform("world", MathUtils::CreateTranslation(Vector3f(0.0f, 1.0f, 0.0f)));
-				RenderManager::Get().RenderStaticMesh3D(sphere);
+			if (!bIsPathReady)
+			{
+				RenderManager::Get().SetWindowViewport();
+				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+			}
+			else if (renderPath == ERenderPath::Shadow)
+			{
+				depthShader->Bind();
 
-				// 4.
-				depthShader->SetUniform("world", MathUtils::CreateTranslation(Vector3f(+1.0f, 1.0f, 0.0f)));
-				RenderManager::Get().RenderStaticMesh3D(sphere);
+				for (uint32_t cascade = 0; cascade < CASCADE_COUNT; ++cascade)
+				{
+					RenderManager::Get().SetPassData(cascades[cascade].lightView, cascades[cascade].lightProjection);
+
+					visibleObjects.clear();
+					cullingTree.Query(Frustum::Extract(cascades[cascade].lightView, cascades[cascade].lightProjection), visibleObjects);
+
+					if (shadowMap->IsStaticCacheDirty(cascade))
+					{
+						shadowMap->BindStaticCache(cascade);
+						shadowMap->Clear();
+
+						for (const auto& visibleObject : visibleObjects)
+						{
+							if (renderObjects[visibleObject].bIsStatic)
+							{
+								RenderManager::Get().RenderStaticMesh3D(renderObjects[visibleObject].mesh, renderObjects[visibleObject].world);
+							}
+						}
+					}
+
+					shadowMap->Bind(cascade);
+					shadowMap->RestoreStaticCache(cascade);
+
+					for (const auto& visibleObject : visibleObjects)
+					{
+						if (!renderObjects[visibleObject].bIsStatic)
+						{
+							RenderManager::Get().RenderStaticMesh3D(renderObjects[visibleObject].mesh, renderObjects[visibleObject].world);
+						}
+					}
+				}
 
 				shadowMap->Unbind();
 				depthShader->Unbind();
-			}
-			{
+
 				RenderManager::Get().SetWindowViewport();
 				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
 				shadowShader->Bind();
-				shadowShader->SetUniform("view", view);
-				shadowShader->SetUniform("projection", projection);
-				shadowShader->SetUniform("lightView", lightView);
-				shadowShader->SetUniform("lightProjection", lightProjection);
-				shadowShader->SetUniform("lightPosition", lightPosition);
-				shadowShader->SetUniform("viewPosition", cameraPosition);
+				shadowShader->SetUniform(cascadeCountHandle, static_cast<int32_t>(CASCADE_COUNT));
+				shadowShader->SetUniform(poissonTapCountHandle, 12);
+				shadowShader->SetUniform(poissonRadiusHandle, 1.5f);
+				shadowShader->SetUniform(lightPositionHandle, lightPosition);
 
 				shadowMap->Active(0);
 
-				// 1.
-				shadowShader->SetUniform("world", MathUtils::CreateTranslation(Vector3f(0.0f, -3.0f, 0.0f)));
-				RenderManager::Get().RenderStaticMesh3D(floor);
+				visibleObjects.clear();
+				cullingTree.Query(Frustum::Extract(view, projection), visibleObjects);
 
-				// 2.
-				shadowShader->SetUniform("world", MathUtils::CreateTranslation(Vector3f(-1.0f, 1.0f, 0.0f)));
-				RenderManager::Get().RenderStaticMesh3D(sphere);
+				for (const auto& visibleObject : visibleObjects)
+				{
+					RenderManager::Get().RenderStaticMesh3D(renderObjects[visibleObject].mesh, renderObjects[visibleObject].world);
+				}
 
-				// 3.
-				shadowShader->SetUniform("world", MathUtils::CreateTranslation(Vector3f(0.0f, 1.0f, 0.0f)));
-				RenderManager::Get().RenderStaticMesh3D(sphere);
+				shadowShader->Unbind();
+			}
+			else if (renderPath == ERenderPath::Textured)
+			{
+				RenderManager::Get().SetWindowViewport();
+				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-				// 4.
-				shadowShader->SetUniform("world", MathUtils::CreateTranslation(Vector3f(+1.0f, 1.0f, 0.0f)));
-				RenderManager::Get().RenderStaticMesh3D(sphere);
+				visibleObjects.clear();
+				cullingTree.Query(Frustum::Extract(view, projection), visibleObjects);
 
-				shadowShader->Unbind();
+				geometryPool->ClearDrawCommands();
+				for (const auto& visibleObject : visibleObjects)
+				{
+					const RenderObject& renderObject = renderObjects[visibleObject];
+					geometryPool->AddDrawCommand(renderObject.meshID, renderObject.world, renderObject.textureSlot);
+				}
+
+				textureTable->Bind();
+
+				texturedShader->Bind();
+				texturedShader->SetUniform(lightDirectionHandle, lightDirection);
+
+				RenderManager::Get().RenderGeometryPool3D(geometryPool);
+
+				texturedShader->Unbind();
+			}
+			else if (renderPath == ERenderPath::Forward)
+			{
+				RenderManager::Get().SetWindowViewport();
+				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+				RenderManager::Get().SetDirectionalLight(directionalLight);
+				materialPool->Flush();
+
+				visibleObjects.clear();
+				cullingTree.Query(Frustum::Extract(view, projection), visibleObjects);
+
+				renderQueue.Begin(view, nearPlane, farPlane);
+				for (const auto& visibleObject : visibleObjects)
+				{
+					const RenderObject& renderObject = renderObjects[visibleObject];
+					renderQueue.Submit(ERenderPass::Opaque, lightShader, renderObject.mesh, renderObject.material, renderObject.world);
+				}
+				renderQueue.Sort();
+
+				RenderManager::Get().RenderQueue3D(&renderQueue, [&](Shader*, const Material* material) { materialPool->Bind(material); });
+			}
+			else if (renderPath == ERenderPath::Clustered)
+			{
+				RenderManager::Get().SetWindowViewport();
+				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+				for (uint32_t index = 0; index < POINT_LIGHT_COUNT; ++index)
+				{
+					float angle = TwoPi * static_cast<float>(index) / static_cast<float>(POINT_LIGHT_COUNT) + 0.5f * timer_.GetTotalSeconds();
+					float radius = 3.0f + 2.0f * static_cast<float>(index % 4);
+					pointLights[index].SetPosition(Vector3f(radius * MathUtils::Cos(angle), -1.5f, radius * MathUtils::Sin(angle)));
+				}
+
+				clusterBuilder.SetProjection(fov, window_->GetAspectSize(), nearPlane, farPlane);
+				clusterBuilder.Build(view, pointLights, spotLights);
+
+				clusteredLightBuffer->Upload(clusterBuilder, pointLights, spotLights);
+				clusteredLightBuffer->Bind();
+
+				RenderManager::Get().SetDirectionalLight(directionalLight);
+				materialPool->Flush();
+
+				int32_t screenWidth = 0;
+				int32_t screenHeight = 0;
+				window_->GetSize(screenWidth, screenHeight);
+
+				clusteredShader->Bind();
+				clusteredShader->SetUniform(screenSizeHandle, static_cast<float>(screenWidth), static_cast<float>(screenHeight));
+				clusteredShader->SetUniform(nearZHandle, nearPlane);
+				clusteredShader->SetUniform(farZHandle, farPlane);
+
+				visibleObjects.clear();
+				cullingTree.Query(Frustum::Extract(view, projection), visibleObjects);
+
+				renderQueue.Begin(view, nearPlane, farPlane);
+				for (const auto& visibleObject : visibleObjects)
+				{
+					const RenderObject& renderObject = renderObjects[visibleObject];
+					renderQueue.Submit(ERenderPass::Opaque, clusteredShader, renderObject.mesh, renderObject.material, renderObject.world);
+				}
+				renderQueue.Sort();
+
+				RenderManager::Get().RenderQueue3D(&renderQueue, [&](Shader*, const Material* material) { materialPool->Bind(material); });
 			}
 
 			RenderManager::Get().RenderLine3D(view, projection, Vector3f(-10.0f, 0.0f, 0.0f), Vector3f(+10.0f, 0.0f, 0.0f), Vector4f(1.0f, 0.0f, 0.0f, 1.0f));
@@ -165,9 +444,45 @@ public:
 			RenderManager::Get().RenderLine3D(view, projection, Vector3f(0.0f, 0.0f, 0.0f), lightPosition, Vector4f(0.0f, 1.0f, 1.0f, 1.0f));
 			RenderManager::Get().EndFrame();
 		}
+
+		textureTable->Remove(checkerSlot);
+		textureTable->Remove(stripeSlot);
+
+		materialPool->Remove(&floorMaterial);
+		materialPool->Remove(&cubeMaterial);
+		materialPool->Remove(&sphereMaterial);
 	}
 
 
+private:
+	/**
+	 * @brief ȭ鿡 ׸ ƮԴϴ.
+	 */
+	struct RenderObject
+	{
+		StaticMesh* mesh;
+		Matrix4x4f world;
+		bool bIsStatic;
+		int32_t proxyID;
+		int32_t meshID;      // Ʈ Ǯ  ޽ ̵
+		int32_t textureSlot; // ؽó ε ̺  ȣ, ؽó ٸ -1
+		const Material* material;
+	};
+
+
+	/**
+	 * @brief ȭ ׸ Դϴ. Tab Ű ٲߴϴ.
+	 */
+	enum class ERenderPath : int32_t
+	{
+		Shadow    = 0x00, // ĳ̵ ׸ 
+		Textured  = 0x01, // Ʈ Ǯ ؽó ε ̺
+		Forward   = 0x02, //  ť  Ǯ, Ɽ  
+		Clustered = 0x03, // Ʈ ŬͿ Ŭ͵ Ʈ 
+		Count     = 0x04,
+	};
+
+
 private:
 	/**
 	 * @brief Ŭ̾Ʈ Դϴ.
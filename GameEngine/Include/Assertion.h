@@ -3,9 +3,14 @@
 #include <cstdarg>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <cwchar>
 #include <string>
+
+#if defined(_WIN32)
 #include <windows.h>
+#endif
 
 
 #if defined(DEBUG_MODE) || defined(RELEASE_MODE) || defined(REL_WITH_DEB_INFO_MODE)
@@ -29,7 +34,11 @@ inline void AssertPrintF(const char* format, ...)
 	int32_t size = vsnprintf(buffer, BUFFER_SIZE, format, args);
 	va_end(args);
 
+#if defined(_WIN32)
 	OutputDebugStringA(buffer);
+#else
+	std::fputs(buffer, stderr);
+#endif
 }
 
 
@@ -50,14 +59,46 @@ inline void AssertPrintF(const wchar_t* format, ...)
 
 	va_list args;
 	va_start(args, format);
+#if defined(_WIN32)
 	int32_t size = _vsnwprintf_s(buffer, BUFFER_SIZE, format, args);
+#else
+	int32_t size = vswprintf(buffer, BUFFER_SIZE, format, args);
+#endif
 	va_end(args);
 
+#if defined(_WIN32)
 	OutputDebugStringW(buffer);
+#else
+	std::fprintf(stderr, "%ls", buffer);
+#endif
 }
 #endif
 
 
+/**
+ * @brief 򰡽 ˻翡    ϴ.
+ *
+ * @note
+ * - 쿡 극ũ Ʈ ɰ,   ÷(帮 ׽Ʈ ) μ ߴմϴ.
+ * - ASSERT_EXIT Debug 忡 극ũ Ʈ  μ   մϴ.
+ */
+#if defined(_WIN32)
+#ifndef ASSERT_BREAK
+#define ASSERT_BREAK() __debugbreak()
+#endif
+#ifndef ASSERT_EXIT
+#define ASSERT_EXIT() ExitProcess(-1)
+#endif
+#else
+#ifndef ASSERT_BREAK
+#define ASSERT_BREAK() std::abort()
+#endif
+#ifndef ASSERT_EXIT
+#define ASSERT_EXIT() std::exit(-1)
+#endif
+#endif
+
+
 /**
  * @brief 򰡽 ˻մϴ.
  * 
@@ -78,8 +119,8 @@ inline void AssertPrintF(const wchar_t* format, ...)
 		AssertPrintF("\nAssertion check point failed!\nFile : %s\nLine : %d\nExpression : %s\nMessage : ", __FILE__, __LINE__, #Expression);\
 		AssertPrintF(__VA_ARGS__);\
 		AssertPrintF("\n");\
-		__debugbreak();\
-		ExitProcess(-1);\
+		ASSERT_BREAK();\
+		ASSERT_EXIT();\
 	}\
 }
 #endif
@@ -92,7 +133,7 @@ inline void AssertPrintF(const wchar_t* format, ...)
 		AssertPrintF("\nAssertion check point failed!\nFile : %s\nLine : %d\nExpression : %s\nMessage : ", __FILE__, __LINE__, #Expression);\
 		AssertPrintF(__VA_ARGS__);\
 		AssertPrintF("\n");\
-		__debugbreak();\
+		ASSERT_BREAK();\
 	}\
 }
 #endif
@@ -0,0 +1,199 @@
+#pragma once
+
+#include "MathUtils.h"
+#include "Matrix4x4.h"
+#include "Vector3.h"
+
+
+/**
+ * @brief    (Axis Aligned Bounding Box)Դϴ.
+ *
+ * @note ּڰ ִ񰪺 ũ  ִ  ڷ մϴ.
+ */
+struct AxisAlignedBoundingBox
+{
+	/**
+	 * @brief  ִ  ڸ մϴ.
+	 */
+	AxisAlignedBoundingBox() noexcept
+		: minPosition(Infinity, Infinity, Infinity)
+		, maxPosition(NInfinity, NInfinity, NInfinity) {}
+
+
+	/**
+	 * @brief   Դϴ.
+	 *
+	 * @param minp   ּڰԴϴ.
+	 * @param maxp   ִԴϴ.
+	 */
+	AxisAlignedBoundingBox(const Vector3f& minp, const Vector3f& maxp) noexcept
+		: minPosition(minp)
+		, maxPosition(maxp) {}
+
+
+	/**
+	 * @brief  ڰ  ִ Ȯմϴ.
+	 *
+	 * @return  ڰ  ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsEmpty() const
+	{
+		return minPosition.x > maxPosition.x || minPosition.y > maxPosition.y || minPosition.z > maxPosition.z;
+	}
+
+
+	/**
+	 * @brief  ڰ  ϵ Ȯմϴ.
+	 *
+	 * @param position   ġԴϴ.
+	 */
+	void Expand(const Vector3f& position)
+	{
+		minPosition = Vector3f(MathUtils::Min(minPosition.x, position.x), MathUtils::Min(minPosition.y, position.y), MathUtils::Min(minPosition.z, position.z));
+		maxPosition = Vector3f(MathUtils::Max(maxPosition.x, position.x), MathUtils::Max(maxPosition.y, position.y), MathUtils::Max(maxPosition.z, position.z));
+	}
+
+
+	/**
+	 * @brief  ڰ ٸ  ڸ ϵ Ȯմϴ.
+	 *
+	 * @param bound   Դϴ.
+	 */
+	void Expand(const AxisAlignedBoundingBox& bound)
+	{
+		if (bound.IsEmpty())
+		{
+			return;
+		}
+
+		Expand(bound.minPosition);
+		Expand(bound.maxPosition);
+	}
+
+
+	/**
+	 * @brief   ߽ ϴ.
+	 *
+	 * @return   ߽ ȯմϴ.
+	 */
+	Vector3f GetCenter() const
+	{
+		return Vector3f(
+			(minPosition.x + maxPosition.x) * 0.5f,
+			(minPosition.y + maxPosition.y) * 0.5f,
+			(minPosition.z + maxPosition.z) * 0.5f
+		);
+	}
+
+
+	/**
+	 * @brief   ߽κ     ũ⸦ ϴ.
+	 *
+	 * @return   ߽κ     ũ⸦ ȯմϴ.
+	 */
+	Vector3f GetExtents() const
+	{
+		return Vector3f(
+			(maxPosition.x - minPosition.x) * 0.5f,
+			(maxPosition.y - minPosition.y) * 0.5f,
+			(maxPosition.z - minPosition.z) * 0.5f
+		);
+	}
+
+
+	/**
+	 * @brief  ڸ ķ ȯ , ȯ ڸ δ    ڸ մϴ.
+	 *
+	 * @param matrix ȯ Դϴ.
+	 *
+	 * @return ȯ  ڸ ȯմϴ.
+	 *
+	 * @see https://github.com/erich666/GraphicsGems/blob/master/gems/TransBox.c
+	 */
+	AxisAlignedBoundingBox Transform(const Matrix4x4f& matrix) const
+	{
+		if (IsEmpty())
+		{
+			return AxisAlignedBoundingBox();
+		}
+
+		float minp[3] = { matrix.m[3][0], matrix.m[3][1], matrix.m[3][2] };
+		float maxp[3] = { matrix.m[3][0], matrix.m[3][1], matrix.m[3][2] };
+
+		for (int32_t col = 0; col < 3; ++col)
+		{
+			for (int32_t row = 0; row < 3; ++row)
+			{
+				float a = matrix.m[row][col] * minPosition.data[row];
+				float b = matrix.m[row][col] * maxPosition.data[row];
+
+				minp[col] += MathUtils::Min(a, b);
+				maxp[col] += MathUtils::Max(a, b);
+			}
+		}
+
+		return AxisAlignedBoundingBox(Vector3f(minp[0], minp[1], minp[2]), Vector3f(maxp[0], maxp[1], maxp[2]));
+	}
+
+
+	/**
+	 * @brief   ڰ ġ Ȯմϴ.
+	 *
+	 * @param bound ˻  Դϴ.
+	 *
+	 * @return   ڰ ģٸ true, ׷  false ȯմϴ.
+	 */
+	bool Intersect(const AxisAlignedBoundingBox& bound) const
+	{
+		return minPosition.x <= bound.maxPosition.x && bound.minPosition.x <= maxPosition.x
+			&& minPosition.y <= bound.maxPosition.y && bound.minPosition.y <= maxPosition.y
+			&& minPosition.z <= bound.maxPosition.z && bound.minPosition.z <= maxPosition.z;
+	}
+
+
+	/**
+	 * @brief  ڰ ٸ  ڸ  ϴ Ȯմϴ.
+	 *
+	 * @param bound ˻  Դϴ.
+	 *
+	 * @return  ڰ ٸ  ڸ  Ѵٸ true, ׷  false ȯմϴ.
+	 */
+	bool Contain(const AxisAlignedBoundingBox& bound) const
+	{
+		return minPosition.x <= bound.minPosition.x && bound.maxPosition.x <= maxPosition.x
+			&& minPosition.y <= bound.minPosition.y && bound.maxPosition.y <= maxPosition.y
+			&& minPosition.z <= bound.minPosition.z && bound.maxPosition.z <= maxPosition.z;
+	}
+
+
+	/**
+	 * @brief   ǥ մϴ.
+	 *
+	 * @return   ǥ ȯմϴ.
+	 */
+	float GetSurfaceArea() const
+	{
+		if (IsEmpty())
+		{
+			return 0.0f;
+		}
+
+		float dx = maxPosition.x - minPosition.x;
+		float dy = maxPosition.y - minPosition.y;
+		float dz = maxPosition.z - minPosition.z;
+
+		return 2.0f * (dx * dy + dy * dz + dz * dx);
+	}
+
+
+	/**
+	 * @brief   ּڰԴϴ.
+	 */
+	Vector3f minPosition;
+
+
+	/**
+	 * @brief   ִԴϴ.
+	 */
+	Vector3f maxPosition;
+};
\ No newline at end of file
@@ -0,0 +1,266 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "IResource.h"
+#include "ShadowMap.h"
+
+
+/**
+ * @brief   ĳ̵(Cascade) 2D ؽó 迭 ̾ ϴ ĳ̵ ε Դϴ.
+ *
+ * @note
+ * -  ĳ̵ ī޶ ü Ϻ  ϸ,  ũ  ؽó ̾ մϴ.
+ * - ĳ̵庰  þ/  ShadowCascadeUtils մϴ.
+ * -  ĳø ϸ  ʴ ü ̸  ؽó 迭 ϰ,   ̸   ̴ ü ׸ϴ.
+ */
+class CascadedShadowMap : public IResource
+{
+public:
+	/**
+	 * @brief ĳ̵ ε  ϴ ּ ĳ̵ Դϴ.
+	 */
+	static const uint32_t MIN_CASCADE_COUNT = 2;
+
+
+	/**
+	 * @brief ĳ̵ ε  ϴ ִ ĳ̵ Դϴ.
+	 */
+	static const uint32_t MAX_CASCADE_COUNT = 4;
+
+
+public:
+	/**
+	 * @brief ĳ̵ ε  Ʈ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	CascadedShadowMap() = default;
+
+
+	/**
+	 * @brief ĳ̵ ε   ҸԴϴ.
+	 */
+	virtual ~CascadedShadowMap();
+
+
+	/**
+	 * @brief ĳ̵ ε   ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(CascadedShadowMap);
+
+
+	/**
+	 * @brief ĳ̵ ε  մϴ.
+	 *
+	 * @param shadowSize ĳ̵   / ũԴϴ.
+	 * @param cascadeCount ĳ̵ Դϴ. MIN_CASCADE_COUNT ̻ MAX_CASCADE_COUNT Ͽ մϴ.
+	 * @param bEnableStaticCache  ü ̸  ĳø  Դϴ.
+	 * @param filter ĳ̵ ε  ͸ Դϴ.
+	 */
+	void Initialize(uint32_t shadowSize, uint32_t cascadeCount, bool bEnableStaticCache = false, EShadowFilter filter = EShadowFilter::HardwarePCF);
+
+
+	/**
+	 * @brief ĳ̵ ε   ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief ε ĳ̵   ʱȭմϴ.
+	 */
+	void Clear();
+
+
+	/**
+	 * @brief ĳ̵带   εմϴ.
+	 *
+	 * @param cascade ε ĳ̵ εԴϴ.
+	 *
+	 * @note Ʈ ĳ̵ ũ մϴ.
+	 */
+	void Bind(uint32_t cascade);
+
+
+	/**
+	 * @brief ĳ̵ ε  ε մϴ.
+	 *
+	 * @note Variance  Ʈ ؽó 迭 Ӹ ĳ̵帶  ʰ,  ĳ̵带 ׸  Active   մϴ.
+	 */
+	void Unbind();
+
+
+	/**
+	 * @brief ĳ̵  ĳø   εմϴ.
+	 *
+	 * @param cascade ε ĳ̵ εԴϴ.
+	 *
+	 * @note
+	 * - Ʈ ĳ̵ ũ մϴ.
+	 * - ε ĳ̵  ĳô ŵ  ϹǷ, ε   ü  ׷ մϴ.
+	 */
+	void BindStaticCache(uint32_t cascade);
+
+
+	/**
+	 * @brief ε ĳ̵    ĳ   ϴ.
+	 *
+	 * @param cascade  ĳ̵ εԴϴ.
+	 *
+	 * @note Bind  ĳ̵带 ε  Clear  ȣմϴ.
+	 */
+	void RestoreStaticCache(uint32_t cascade);
+
+
+	/**
+	 * @brief ĳ̵  ĳø ٽ ׷ ϴ · մϴ.
+	 *
+	 * @param cascade  ĳ̵ εԴϴ.
+	 *
+	 * @note ĳ̵   ٲ  ȣմϴ.
+	 */
+	void MarkStaticCacheDirty(uint32_t cascade);
+
+
+	/**
+	 * @brief  ĳ̵  ĳø ٽ ׷ ϴ · մϴ.
+	 *
+	 * @note ̳  ü  ٲ  ȣմϴ.
+	 */
+	void MarkAllStaticCacheDirty();
+
+
+	/**
+	 * @brief ĳ̵  ĳø ٽ ׷ ϴ Ȯմϴ.
+	 *
+	 * @param cascade Ȯ ĳ̵ εԴϴ.
+	 *
+	 * @return  ĳø ٽ ׷ Ѵٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsStaticCacheDirty(uint32_t cascade) const { return bIsStaticCacheDirty_[cascade]; }
+
+
+	/**
+	 * @brief ĳ̵ ε  ؽó 迭 Ȱȭմϴ.
+	 *
+	 * @param unit Ȱȭ  ؽó Դϴ.
+	 *
+	 * @note
+	 * -   ؽó 迭 unit, Variance  Ʈ ؽó 迭 unit + 1 εմϴ.
+	 * -  Ȱȭ  ĳ̵带 ٽ ׷ȴٸ, ε  Ʈ ؽó 迭 Ӹ   մϴ.
+	 */
+	void Active(uint32_t unit);
+
+
+	/**
+	 * @brief ĳ̵ ε  ͸  ϴ.
+	 *
+	 * @return ĳ̵ ε  ͸  ȯմϴ.
+	 */
+	EShadowFilter GetFilter() const { return filter_; }
+
+
+	/**
+	 * @brief ĳ̵   / ũ⸦ ϴ.
+	 *
+	 * @return ĳ̵   / ũ⸦ ȯմϴ.
+	 */
+	uint32_t GetShadowSize() const { return shadowSize_; }
+
+
+	/**
+	 * @brief ĳ̵  ϴ.
+	 *
+	 * @return ĳ̵  ȯմϴ.
+	 */
+	uint32_t GetCascadeCount() const { return cascadeCount_; }
+
+
+	/**
+	 * @brief  ĳø ϴ Ȯմϴ.
+	 *
+	 * @return  ĳø Ѵٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsEnableStaticCache() const { return bIsEnableStaticCache_; }
+
+
+private:
+	/**
+	 * @brief ĳ̵ ε  ε Ǿ Ȯմϴ.
+	 */
+	bool bIsBind_ = false;
+
+
+	/**
+	 * @brief ĳ̵   / ũԴϴ.
+	 */
+	uint32_t shadowSize_ = 0;
+
+
+	/**
+	 * @brief ĳ̵ Դϴ.
+	 */
+	uint32_t cascadeCount_ = 0;
+
+
+	/**
+	 * @brief ĳ̵ ε    IDԴϴ.
+	 */
+	uint32_t shadowMapFBO_ = 0;
+
+
+	/**
+	 * @brief ĳ̵ ε  ̰ ؽó 迭 IDԴϴ.
+	 */
+	uint32_t shadowMapID_ = 0;
+
+
+	/**
+	 * @brief ĳ̵ ε  ͸ Դϴ.
+	 */
+	EShadowFilter filter_ = EShadowFilter::HardwarePCF;
+
+
+	/**
+	 * @brief Variance  Ʈ ؽó 迭 IDԴϴ.
+	 */
+	uint32_t momentsID_ = 0;
+
+
+	/**
+	 * @brief Ʈ ؽó 迭 Ӹ ٽ ؾ ϴ Ȯմϴ.
+	 */
+	bool bIsMomentsMipmapDirty_ = false;
+
+
+	/**
+	 * @brief  ĳø ϴ Ȯմϴ.
+	 */
+	bool bIsEnableStaticCache_ = false;
+
+
+	/**
+	 * @brief  ĳ   IDԴϴ.
+	 */
+	uint32_t staticCacheFBO_ = 0;
+
+
+	/**
+	 * @brief  ĳ ̰ ؽó 迭 IDԴϴ.
+	 */
+	uint32_t staticCacheID_ = 0;
+
+
+	/**
+	 * @brief  ĳ Ʈ ؽó 迭 IDԴϴ.
+	 */
+	uint32_t staticCacheMomentsID_ = 0;
+
+
+	/**
+	 * @brief ĳ̵庰  ĳø ٽ ׷ ϴ Դϴ.
+	 */
+	std::array<bool, MAX_CASCADE_COUNT> bIsStaticCacheDirty_ = { true, true, true, true };
+};
\ No newline at end of file
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "IResource.h"
+#include "LightClusterBuilder.h"
+#include "PointLight.h"
+#include "ShaderBufferPool.h"
+#include "SpotLight.h"
+
+
+/**
+ * @brief Ŭ   (Clustered Forward Rendering) ʿ  ͸ ̴ 丮 ۷ մϴ.
+ *
+ * @note
+ * -  , Ŭͺ  ε  ,  ε   ̴ 丮 ۿ մϴ.
+ * -  ε LightClusterBuilder     Ʈ  Դϴ.
+ * -   ShaderDataUtils::LightData ̾ƿ ShaderBufferPool Ƿ, ٲ  ٽ εմϴ.
+ * - ̴ ׸Ʈ  Ŭ  ȸմϴ.
+ *   ) layout(std430, binding = 1) buffer LightBuffer { Light lights[]; };
+ */
+class ClusteredLightBuffer : public IResource
+{
+public:
+	/**
+	 * @brief   ̴ 丮  ε ġԴϴ.
+	 */
+	static const uint32_t LIGHT_BUFFER_BINDING = 1;
+
+
+	/**
+	 * @brief Ŭ  ̴ 丮  ε ġԴϴ.
+	 */
+	static const uint32_t CLUSTER_BUFFER_BINDING = 2;
+
+
+	/**
+	 * @brief  ε  ̴ 丮  ε ġԴϴ.
+	 */
+	static const uint32_t LIGHT_INDEX_BUFFER_BINDING = 3;
+
+
+
+public:
+	/**
+	 * @brief Ŭ   Ʈ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	ClusteredLightBuffer() = default;
+
+
+	/**
+	 * @brief Ŭ    ҸԴϴ.
+	 *
+	 * @note Ŭ   ο Ҵ Ҹ ϱ ؼ ݵ Release ȣؾ մϴ.
+	 */
+	virtual ~ClusteredLightBuffer();
+
+
+	/**
+	 * @brief Ŭ    ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(ClusteredLightBuffer);
+
+
+	/**
+	 * @brief Ŭ  ۸ ʱȭմϴ.
+	 *
+	 * @param maxLightCount   Ʈ   ִ  Դϴ.
+	 */
+	void Initialize(uint32_t maxLightCount = 1024);
+
+
+	/**
+	 * @brief Ŭ    ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief  Ҵ    ̴ 丮 ۿ εմϴ.
+	 *
+	 * @param builder  Ҵ ģ  Ŭ Դϴ.
+	 * @param pointLights  Ŭ     Դϴ.
+	 * @param spotLights  Ŭ   Ʈ  Դϴ.
+	 *
+	 * @note
+	 * -    ε ޶  ٽ εմϴ.
+	 * - Ŭ  ۸ (Orphan) ·   εϹǷ,   ׸ ȭ ʽϴ.
+	 */
+	void Upload(const LightClusterBuilder& builder, const std::vector<PointLight>& pointLights, const std::vector<SpotLight>& spotLights);
+
+
+	/**
+	 * @brief ̴ 丮 ۸ ε ġ εմϴ.
+	 */
+	void Bind();
+
+
+	/**
+	 * @brief  ε   ϴ.
+	 *
+	 * @return  ε   ȯմϴ.
+	 */
+	uint32_t GetLightCount() const { return static_cast<uint32_t>(lightIDs_.size()); }
+
+
+private:
+	/**
+	 * @brief    ̴ 丮  ǮԴϴ.
+	 */
+	ShaderBufferPool lightPool_;
+
+
+	/**
+	 * @brief  ε  Ҵ  Ǯ ׸ ID Դϴ.
+	 */
+	std::vector<int32_t> lightIDs_;
+
+
+	/**
+	 * @brief Ŭͺ  ε    ̴ 丮  ƮԴϴ.
+	 */
+	uint32_t clusterBufferObject_ = 0;
+
+
+	/**
+	 * @brief  ε   ̴ 丮  ƮԴϴ.
+	 */
+	uint32_t lightIndexBufferObject_ = 0;
+};
\ No newline at end of file
@@ -0,0 +1,291 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "AxisAlignedBoundingBox.h"
+#include "Frustum.h"
+#include "Macro.h"
+
+
+/**
+ * @brief   νϽ  ڸ ϴ    Ʈ(Dynamic AABB Tree)Դϴ.
+ *
+ * @note
+ * -     ں  ū(Fat)  ڸ Ƿ,  ӿ Ʈ  ʽϴ.
+ * -   ǥ ޸ƽ(SAH)  带 , ȸ Ʈ  մϴ.
+ * - ü   ü ȿ  Ե  Ʈ ߰ ˻    մϴ.
+ * - GPU ҽ  Ƿ CPU 󿡼 ܵ   ֽϴ.
+ *
+ * @see https://box2d.org/files/ErinCatto_DynamicBVH_Full.pdf
+ */
+class DynamicBoundingVolumeTree
+{
+public:
+	/**
+	 * @brief ȿ   ̵Դϴ.
+	 */
+	static const int32_t NULL_NODE = -1;
+
+
+	/**
+	 * @brief   Դϴ.
+	 */
+	struct QueryStatistics
+	{
+		uint32_t visitNodeCount;
+		uint32_t testNodeCount;
+		uint32_t visibleCount;
+	};
+
+
+public:
+	/**
+	 * @brief    Ʈ Դϴ.
+	 *
+	 * @param fatMargin    ڸ Ű  ũԴϴ.
+	 */
+	explicit DynamicBoundingVolumeTree(float fatMargin = 0.1f);
+
+
+	/**
+	 * @brief    Ʈ  ҸԴϴ.
+	 */
+	virtual ~DynamicBoundingVolumeTree() {}
+
+
+	/**
+	 * @brief    Ʈ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(DynamicBoundingVolumeTree);
+
+
+	/**
+	 * @brief νϽ Ʈ ߰մϴ.
+	 *
+	 * @param bound νϽ  ǥ   Դϴ.
+	 * @param userData    νϽ Դϴ. (νϽ ε )
+	 *
+	 * @return ߰ νϽ Ͻ ̵ ȯմϴ.
+	 */
+	int32_t Insert(const AxisAlignedBoundingBox& bound, uint32_t userData);
+
+
+	/**
+	 * @brief νϽ Ʈ մϴ.
+	 *
+	 * @param proxyID  νϽ Ͻ ̵Դϴ.
+	 */
+	void Remove(int32_t proxyID);
+
+
+	/**
+	 * @brief νϽ  ڸ մϴ.
+	 *
+	 * @param proxyID  νϽ Ͻ ̵Դϴ.
+	 * @param bound νϽ ο  ǥ   Դϴ.
+	 *
+	 * @return Ʈ  ٲٸ true,  Fat   ȿ ־ ٲ ʾҴٸ false ȯմϴ.
+	 */
+	bool Refit(int32_t proxyID, const AxisAlignedBoundingBox& bound);
+
+
+	/**
+	 * @brief ü ġ νϽ մϴ.
+	 *
+	 * @param frustum  üԴϴ.
+	 * @param outUserData ü ġ νϽ  Դϴ.   ڿ ߰˴ϴ.
+	 */
+	void Query(const Frustum& frustum, std::vector<uint32_t>& outUserData);
+
+
+	/**
+	 * @brief  ڿ ġ νϽ մϴ.
+	 *
+	 * @param bound   Դϴ.
+	 * @param outUserData  ڿ ġ νϽ  Դϴ.   ڿ ߰˴ϴ.
+	 */
+	void Query(const AxisAlignedBoundingBox& bound, std::vector<uint32_t>& outUserData);
+
+
+	/**
+	 * @brief Ʈ  νϽ մϴ.
+	 */
+	void Clear();
+
+
+	/**
+	 * @brief νϽ Fat  ڸ ϴ.
+	 *
+	 * @param proxyID  ڸ  νϽ Ͻ ̵Դϴ.
+	 *
+	 * @return νϽ Fat  ڸ ȯմϴ.
+	 */
+	const AxisAlignedBoundingBox& GetFatBoundingBox(int32_t proxyID) const;
+
+
+	/**
+	 * @brief νϽ  ϴ.
+	 *
+	 * @param proxyID   νϽ Ͻ ̵Դϴ.
+	 *
+	 * @return νϽ  ȯմϴ.
+	 */
+	uint32_t GetUserData(int32_t proxyID) const;
+
+
+	/**
+	 * @brief Ʈ ߰ νϽ  ϴ.
+	 *
+	 * @return Ʈ ߰ νϽ  ȯմϴ.
+	 */
+	uint32_t GetProxyCount() const { return proxyCount_; }
+
+
+	/**
+	 * @brief Ʈ ̸ ϴ.
+	 *
+	 * @return Ʈ ̸ ȯմϴ. Ʈ  ִٸ 0 ȯմϴ.
+	 */
+	int32_t GetHeight() const;
+
+
+	/**
+	 * @brief   踦 ϴ.
+	 *
+	 * @return   踦 ȯմϴ.
+	 */
+	const QueryStatistics& GetQueryStatistics() const { return queryStatistics_; }
+
+
+private:
+	/**
+	 * @brief Ʈ Դϴ.
+	 *
+	 * @note   child1 NULL_NODE̸,  ʴ  parent    մϴ.
+	 */
+	struct Node
+	{
+		AxisAlignedBoundingBox bound;
+		int32_t parent;
+		int32_t child1;
+		int32_t child2;
+		int32_t height;
+		uint32_t userData;
+
+		bool IsLeaf() const { return child1 == NULL_NODE; }
+	};
+
+
+	/**
+	 * @brief  带 Ҵմϴ.
+	 *
+	 * @return Ҵ  ̵ ȯմϴ.
+	 */
+	int32_t AllocateNode();
+
+
+	/**
+	 * @brief 带    ǵϴ.
+	 *
+	 * @param nodeID ǵ  ̵Դϴ.
+	 */
+	void FreeNode(int32_t nodeID);
+
+
+	/**
+	 * @brief  带 Ʈ մϴ.
+	 *
+	 * @param leaf    ̵Դϴ.
+	 */
+	void InsertLeaf(int32_t leaf);
+
+
+	/**
+	 * @brief  带 Ʈ иմϴ.
+	 *
+	 * @param leaf и   ̵Դϴ.
+	 */
+	void RemoveLeaf(int32_t leaf);
+
+
+	/**
+	 * @brief  Ʈ ̿  ڸ ٽ ϰ  ϴ.
+	 *
+	 * @param nodeID    ̵Դϴ.
+	 */
+	void RefitAncestors(int32_t nodeID);
+
+
+	/**
+	 * @brief 带 ȸϿ  ϴ.
+	 *
+	 * @param nodeA    ̵Դϴ.
+	 *
+	 * @return    ش ġ  ̵ ȯմϴ.
+	 */
+	int32_t Balance(int32_t nodeA);
+
+
+	/**
+	 * @brief  Ʈ     մϴ.
+	 *
+	 * @param nodeID  Ʈ Ʈ  ̵Դϴ.
+	 * @param outUserData     Դϴ.
+	 */
+	void CollectLeaves(int32_t nodeID, std::vector<uint32_t>& outUserData);
+
+
+	/**
+	 * @brief   ڸ ģ  ڸ մϴ.
+	 *
+	 * @param lhs ĥ  Դϴ.
+	 * @param rhs ĥ  ٸ  Դϴ.
+	 *
+	 * @return   ڸ ģ  ڸ ȯմϴ.
+	 */
+	static AxisAlignedBoundingBox Combine(const AxisAlignedBoundingBox& lhs, const AxisAlignedBoundingBox& rhs);
+
+
+private:
+	/**
+	 * @brief    ڸ Ű  ũԴϴ.
+	 */
+	float fatMargin_ = 0.1f;
+
+
+	/**
+	 * @brief Ʈ Ʈ  ̵Դϴ.
+	 */
+	int32_t root_ = NULL_NODE;
+
+
+	/**
+	 * @brief  Դϴ.
+	 */
+	std::vector<Node> nodes_;
+
+
+	/**
+	 * @brief    ù °  ̵Դϴ.
+	 */
+	int32_t freeList_ = NULL_NODE;
+
+
+	/**
+	 * @brief Ʈ ߰ νϽ Դϴ.
+	 */
+	uint32_t proxyCount_ = 0;
+
+
+	/**
+	 * @brief     Դϴ.
+	 */
+	std::vector<int32_t> queryStack_;
+
+
+	/**
+	 * @brief   Դϴ.
+	 */
+	QueryStatistics queryStatistics_ = { 0, 0, 0 };
+};
\ No newline at end of file
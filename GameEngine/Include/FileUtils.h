@@ -66,6 +66,32 @@ namespace FileUtils
 	void WriteBufferToFile(const std::wstring& path, const std::vector<uint8_t>& buffer);
 
 
+	/**
+	 * @brief ۸   ̾ ϴ.
+	 *
+	 * @param path ۸   Դϴ.  ٸ  մϴ.
+	 * @param buffer Ͽ  Դϴ.
+	 *
+	 * @see
+	 * - https://learn.microsoft.com/ko-kr/windows/win32/api/fileapi/nf-fileapi-createfilea
+	 * - https://learn.microsoft.com/ko-kr/windows/win32/api/fileapi/nf-fileapi-writefile
+	 */
+	void AppendBufferToFile(const std::string& path, const std::vector<uint8_t>& buffer);
+
+
+	/**
+	 * @brief ۸   ̾ ϴ.
+	 *
+	 * @param path ۸   Դϴ.  ٸ  մϴ.
+	 * @param buffer Ͽ  Դϴ.
+	 *
+	 * @see
+	 * - https://learn.microsoft.com/ko-kr/windows/win32/api/fileapi/nf-fileapi-createfilew
+	 * - https://learn.microsoft.com/ko-kr/windows/win32/api/fileapi/nf-fileapi-writefile
+	 */
+	void AppendBufferToFile(const std::wstring& path, const std::vector<uint8_t>& buffer);
+
+
 	/**
 	 * @brief  Ȥ 丮 ȿ Ȯմϴ.
 	 *
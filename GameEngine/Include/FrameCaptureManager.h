@@ -0,0 +1,306 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "IManager.h"
+
+
+/**
+ * @brief  ۸  (Stall)  о ũ   Ϸ ϴ ŴԴϴ.
+ *
+ * @note
+ * -  Ŭ ̱Դϴ.
+ * -     ۸   ȼ  Ʈ(PBO)  񵿱 а 潺 մϴ.
+ * - 潺 ȣ PBO   ڿ    ѱ,  尡 ȼ   PNG ڵ̳ RAW ⸦ մϴ.
+ * -   ȼ ϰų ٸ ,  ִ PBO    ĸó     ϴ.
+ * - ϴ ȼ  Ʒ  RGB 8Ʈ̸,  ä  ʽϴ.
+ *
+ * @see
+ * - https://www.khronos.org/opengl/wiki/Pixel_Buffer_Object
+ * - https://github.com/nothings/stb/blob/master/stb_image_write.h
+ */
+class FrameCaptureManager : public IManager
+{
+public:
+	/**
+	 * @brief  ۸  ȼ  Ʈ Դϴ.
+	 */
+	static const uint32_t READBACK_COUNT = 4;
+
+
+	/**
+	 * @brief ĸó   Դϴ.
+	 */
+	enum class EFormat : int32_t
+	{
+		Png = 0x00,
+		Raw = 0x01,
+	};
+
+
+public:
+	/**
+	 * @brief  ĸó Ŵ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(FrameCaptureManager);
+
+
+	/**
+	 * @brief  ĸó Ŵ  νϽ ϴ.
+	 *
+	 * @return  ĸó Ŵ ڸ ȯմϴ.
+	 */
+	static FrameCaptureManager& Get()
+	{
+		static FrameCaptureManager instance;
+		return instance;
+	}
+
+
+	/**
+	 * @brief  ĸó Ŵ  մϴ.
+	 *
+	 * @note
+	 * -  Ŵ   ڿ ȣؾ մϴ.
+	 * - ȼ  Ʈ ù ĸó    ũ⿡ ° Ҵմϴ.
+	 * -  ޼   ȣǾ մϴ.
+	 */
+	virtual void Startup() override;
+
+
+	/**
+	 * @brief  ĸó Ŵ  մϴ.
+	 *
+	 * @note
+	 * - б⸦ ٸ Ӱ ⸦ ٸ      带 մϴ.
+	 * -  Ŵ  ϱ  ȣؾ մϴ.
+	 * -  ޼ ݵ   ȣǾ մϴ.
+	 */
+	virtual void Shutdown() override;
+
+
+	/**
+	 * @brief   ũ PNG Ϸ ϵ ûմϴ.
+	 *
+	 * @param path  PNG  Դϴ. ̹ ϴ ̸  ˴ϴ.
+	 *
+	 * @note  ׸⸦  ģ ,  Ŵ EndFrame ȣϱ  ûؾ մϴ.
+	 */
+	void CaptureScreenshot(const std::wstring& path);
+
+
+	/**
+	 * @brief   ĸóϴ   ĸó մϴ.
+	 *
+	 * @param basePath    Դϴ.
+	 * @param format ĸó   Դϴ.
+	 *
+	 * @note
+	 * - PNG  Ӹ (basePath)_( ȣ 6ڸ).png  մϴ.
+	 * - RAW    (basePath).rgb  ϳ ̾ ϹǷ, PNG ڵ   ġũ ĸó  մϴ.
+	 * - RAW   Ƿ,  ߿ â ũⰡ ٲ ʾƾ մϴ. ) ffmpeg -f rawvideo -pixel_format rgb24 -video_size (ʺ)x() -i (basePath).rgb
+	 */
+	void BeginSequence(const std::wstring& basePath, const EFormat& format);
+
+
+	/**
+	 * @brief   ĸó մϴ.
+	 *
+	 * @note ̹ б⸦ û   մϴ.
+	 */
+	void EndSequence();
+
+
+	/**
+	 * @brief û ĸó   б⸦ ûϰ, бⰡ     ѱϴ.
+	 *
+	 * @note  Ŵ EndFrame ۸ üϱ  Ӹ ȣմϴ.
+	 */
+	void Tick();
+
+
+	/**
+	 * @brief б ⸦ ٸ     ٸϴ.
+	 */
+	void Flush();
+
+
+	/**
+	 * @brief   ĸóϰ ִ Ȯմϴ.
+	 *
+	 * @return   ĸóϰ ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsCaptureSequence() const { return bIsCaptureSequence_; }
+
+
+	/**
+	 * @brief Ϸ    ϴ.
+	 *
+	 * @return Ϸ    ȯմϴ.
+	 */
+	uint32_t GetWrittenFrameCount() const { return writtenFrameCount_.load(std::memory_order_relaxed); }
+
+
+	/**
+	 * @brief  ִ ȼ  Ʈ     ϴ.
+	 *
+	 * @return    ȯմϴ.
+	 */
+	uint32_t GetDroppedFrameCount() const { return droppedFrameCount_; }
+
+
+private:
+	/**
+	 * @brief  ĸó Ŵ Ʈ ڿ   Ҹڸ մϴ.
+	 */
+	DEFAULT_CONSTRUCTOR_AND_VIRTUAL_DESTRUCTOR(FrameCaptureManager);
+
+
+	/**
+	 * @brief  ۸ д ȼ  ƮԴϴ.
+	 */
+	struct Readback;
+
+
+	/**
+	 * @brief    б⸦ ûմϴ.
+	 *
+	 * @param path     Դϴ.
+	 * @param format    Դϴ.
+	 */
+	void RequestReadback(const std::wstring& path, const EFormat& format);
+
+
+	/**
+	 * @brief бⰡ   û   忡 ѱϴ.
+	 *
+	 * @param bIsWait бⰡ   ٸ Դϴ.
+	 */
+	void ResolveReadbacks(bool bIsWait);
+
+
+	/**
+	 * @brief   ó Դϴ.
+	 */
+	void RunWriterLoop();
+
+
+	/**
+	 * @brief ĸó  Ͽ մϴ.
+	 *
+	 * @param path   Դϴ.
+	 * @param format  Դϴ.
+	 * @param width   ũԴϴ.
+	 * @param height   ũԴϴ.
+	 * @param pixels  Ʒ  RGB 8Ʈ ȼԴϴ.
+	 */
+	static void WriteFrame(const std::wstring& path, const EFormat& format, int32_t width, int32_t height, const std::vector<uint8_t>& pixels);
+
+
+private:
+	/**
+	 * @brief  ۸ д ȼ  Ʈ Դϴ.
+	 */
+	std::vector<std::shared_ptr<Readback>> readbacks_;
+
+
+	/**
+	 * @brief б⸦ û  潺 ٸ ȼ  Ʈ Դϴ.
+	 */
+	std::deque<std::shared_ptr<Readback>> pendingReadbacks_;
+
+
+	/**
+	 * @brief  Tick  ũ   Դϴ.
+	 */
+	std::vector<std::wstring> screenshotPaths_;
+
+
+	/**
+	 * @brief   ĸóϰ ִ Դϴ.
+	 */
+	bool bIsCaptureSequence_ = false;
+
+
+	/**
+	 * @brief    Դϴ.
+	 */
+	std::wstring sequenceBasePath_;
+
+
+	/**
+	 * @brief    Դϴ.
+	 */
+	EFormat sequenceFormat_ = EFormat::Png;
+
+
+	/**
+	 * @brief    ĸó  ȣԴϴ.
+	 */
+	uint32_t sequenceFrameIndex_ = 0;
+
+
+	/**
+	 * @brief  ִ ȼ  Ʈ    Դϴ.
+	 */
+	uint32_t droppedFrameCount_ = 0;
+
+
+	/**
+	 * @brief Ϸ   Դϴ.
+	 */
+	std::atomic<uint32_t> writtenFrameCount_ = 0;
+
+
+	/**
+	 * @brief  Ͽ   Դϴ.
+	 *
+	 * @note RAW  ϳ Ͽ  ̾  ϹǷ TaskManager  ϳ  带 մϴ.
+	 */
+	std::thread writer_;
+
+
+	/**
+	 * @brief  忡 ѱ ȼ  Ʈ Դϴ.
+	 */
+	std::queue<std::shared_ptr<Readback>> writeQueue_;
+
+
+	/**
+	 * @brief ⸦ ġ   Դϴ.
+	 */
+	uint32_t pendingWriteCount_ = 0;
+
+
+	/**
+	 * @brief  Ͽ   ϴ ؽԴϴ.
+	 */
+	std::mutex writeMutex_;
+
+
+	/**
+	 * @brief  忡 ο ̳ Ḧ ˸  Դϴ.
+	 */
+	std::condition_variable writeCondition_;
+
+
+	/**
+	 * @brief ⸦ ģ  ˸  Դϴ.
+	 */
+	std::condition_variable writtenCondition_;
+
+
+	/**
+	 * @brief    û Դϴ.
+	 */
+	bool bIsRequestStop_ = false;
+};
\ No newline at end of file
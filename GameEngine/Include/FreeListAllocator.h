@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+
+#include "Macro.h"
+
+
+/**
+ * @brief ӵ (, ε )  Ҵϴ  Ʈ ҴԴϴ.
+ *
+ * @note
+ * -  ޸𸮸  ʰ [0, capacity)  ¸ մϴ.
+ * - Ҵ   ´  (Best-Fit) ϸ,     ϰ մϴ.
+ * - GPU ҽ ϹǷ CPU 󿡼 ܵ   ֽϴ.
+ */
+class FreeListAllocator
+{
+public:
+	/**
+	 * @brief  Ʈ Ҵ Ʈ Դϴ.
+	 */
+	FreeListAllocator() = default;
+
+
+	/**
+	 * @brief  Ʈ Ҵ  ҸԴϴ.
+	 */
+	virtual ~FreeListAllocator() {}
+
+
+	/**
+	 * @brief  Ʈ Ҵ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(FreeListAllocator);
+
+
+	/**
+	 * @brief Ҵ   ʱȭմϴ.
+	 *
+	 * @param capacity Ҵ  ü  ũԴϴ.
+	 *
+	 * @note  Ҵ   ȿȭ˴ϴ.
+	 */
+	void Reset(uint32_t capacity);
+
+
+	/**
+	 * @brief  Ҵմϴ.
+	 *
+	 * @param size Ҵ  ũԴϴ.
+	 * @param outOffset Ҵ   Դϴ.
+	 *
+	 * @return Ҵ翡 ϸ true, ׷  false ȯմϴ.
+	 */
+	bool Allocate(uint32_t size, uint32_t& outOffset);
+
+
+	/**
+	 * @brief Ҵ  մϴ.
+	 *
+	 * @param offset    Դϴ.
+	 * @param size   ũԴϴ.
+	 */
+	void Free(uint32_t offset, uint32_t size);
+
+
+	/**
+	 * @brief Ҵ  ü  ũ⸦ ϴ.
+	 *
+	 * @return Ҵ  ü  ũ⸦ ȯմϴ.
+	 */
+	uint32_t GetCapacity() const { return capacity_; }
+
+
+	/**
+	 * @brief Ҵ    ũ⸦ ϴ.
+	 *
+	 * @return Ҵ    ũ⸦ ȯմϴ.
+	 */
+	uint32_t GetFreeSize() const { return freeSize_; }
+
+
+	/**
+	 * @brief Ҵ   ū   ũ⸦ ϴ.
+	 *
+	 * @return Ҵ   ū   ũ⸦ ȯմϴ.
+	 */
+	uint32_t GetLargestFreeBlockSize() const;
+
+
+private:
+	/**
+	 * @brief   Ͽ ߰մϴ.
+	 *
+	 * @param offset    Դϴ.
+	 * @param size   ũԴϴ.
+	 */
+	void InsertFreeBlock(uint32_t offset, uint32_t size);
+
+
+	/**
+	 * @brief   Ͽ մϴ.
+	 *
+	 * @param offset     Դϴ.
+	 * @param size    ũԴϴ.
+	 */
+	void EraseFreeBlock(uint32_t offset, uint32_t size);
+
+
+private:
+	/**
+	 * @brief Ҵ  ü  ũԴϴ.
+	 */
+	uint32_t capacity_ = 0;
+
+
+	/**
+	 * @brief Ҵ    ũԴϴ.
+	 */
+	uint32_t freeSize_ = 0;
+
+
+	/**
+	 * @brief   Ű ϴ   Դϴ.
+	 *
+	 * @note     ϴ  մϴ.
+	 */
+	std::map<uint32_t, uint32_t> freeBlocksByOffset_;
+
+
+	/**
+	 * @brief ũ⸦ Ű ϴ   Դϴ.
+	 *
+	 * @note Ҵ    ´  ã  մϴ.
+	 */
+	std::multimap<uint32_t, uint32_t> freeBlocksBySize_;
+};
\ No newline at end of file
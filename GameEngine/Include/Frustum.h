@@ -0,0 +1,138 @@
+#pragma once
+
+#include <array>
+
+#include "AxisAlignedBoundingBox.h"
+#include "MathUtils.h"
+#include "Matrix4x4.h"
+#include "Vector3.h"
+#include "Vector4.h"
+
+
+/**
+ * @brief ü    Դϴ.
+ */
+enum class EContainment : int32_t
+{
+	Outside   = 0x00,
+	Intersect = 0x01,
+	Inside    = 0x02,
+};
+
+
+/**
+ * @brief þ İ  ķκ  6  ̷ üԴϴ.
+ *
+ * @note
+ * -   ( x,  y,  z, Ÿ) ̸,  ü  մϴ.
+ * -   , , Ʒ, ,  ,  Դϴ.
+ */
+struct Frustum
+{
+	/**
+	 * @brief ü  Դϴ.
+	 */
+	static const int32_t PLANE_COUNT = 6;
+
+
+	/**
+	 * @brief þ İ  ķκ ü մϴ.
+	 *
+	 * @param view þ Դϴ.
+	 * @param projection  Դϴ.
+	 *
+	 * @return  ü ȯմϴ.
+	 *
+	 * @see https://www.gamedevs.org/uploads/fast-extraction-viewing-frustum-planes-from-world-view-projection-matrix.pdf
+	 */
+	static Frustum Extract(const Matrix4x4f& view, const Matrix4x4f& projection)
+	{
+		Matrix4x4f viewProjection = view * projection;
+		const float (&m)[4][4] = viewProjection.m;
+
+		Frustum frustum;
+		for (int32_t axis = 0; axis < 3; ++axis)
+		{
+			frustum.planes[axis * 2 + 0] = Vector4f(m[0][3] + m[0][axis], m[1][3] + m[1][axis], m[2][3] + m[2][axis], m[3][3] + m[3][axis]);
+			frustum.planes[axis * 2 + 1] = Vector4f(m[0][3] - m[0][axis], m[1][3] - m[1][axis], m[2][3] - m[2][axis], m[3][3] - m[3][axis]);
+		}
+
+		for (auto& plane : frustum.planes)
+		{
+			float length = MathUtils::Length(Vector3f(plane.x, plane.y, plane.z));
+			if (!MathUtils::NearZero(length))
+			{
+				plane = Vector4f(plane.x / length, plane.y / length, plane.z / length, plane.w / length);
+			}
+		}
+
+		return frustum;
+	}
+
+
+	/**
+	 * @brief  ڰ ü ġ Ȯմϴ.
+	 *
+	 * @param bound ˻  Դϴ.
+	 *
+	 * @return  ڰ ü ģٸ true, ׷  false ȯմϴ.
+	 */
+	bool Intersect(const AxisAlignedBoundingBox& bound) const
+	{
+		for (const auto& plane : planes)
+		{
+			float x = (plane.x >= 0.0f) ? bound.maxPosition.x : bound.minPosition.x;
+			float y = (plane.y >= 0.0f) ? bound.maxPosition.y : bound.minPosition.y;
+			float z = (plane.z >= 0.0f) ? bound.maxPosition.z : bound.minPosition.z;
+
+			if (plane.x * x + plane.y * y + plane.z * z + plane.w < 0.0f)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+
+	/**
+	 * @brief  ڿ ü  踦 մϴ.
+	 *
+	 * @param bound ˻  Դϴ.
+	 *
+	 * @return  ڿ ü  踦 ȯմϴ.
+	 */
+	EContainment Contain(const AxisAlignedBoundingBox& bound) const
+	{
+		EContainment containment = EContainment::Inside;
+
+		for (const auto& plane : planes)
+		{
+			float px = (plane.x >= 0.0f) ? bound.maxPosition.x : bound.minPosition.x;
+			float py = (plane.y >= 0.0f) ? bound.maxPosition.y : bound.minPosition.y;
+			float pz = (plane.z >= 0.0f) ? bound.maxPosition.z : bound.minPosition.z;
+
+			if (plane.x * px + plane.y * py + plane.z * pz + plane.w < 0.0f)
+			{
+				return EContainment::Outside;
+			}
+
+			float nx = (plane.x >= 0.0f) ? bound.minPosition.x : bound.maxPosition.x;
+			float ny = (plane.y >= 0.0f) ? bound.minPosition.y : bound.maxPosition.y;
+			float nz = (plane.z >= 0.0f) ? bound.minPosition.z : bound.maxPosition.z;
+
+			if (plane.x * nx + plane.y * ny + plane.z * nz + plane.w < 0.0f)
+			{
+				containment = EContainment::Intersect;
+			}
+		}
+
+		return containment;
+	}
+
+
+	/**
+	 * @brief ü  Դϴ.
+	 */
+	std::array<Vector4f, PLANE_COUNT> planes;
+};
\ No newline at end of file
@@ -0,0 +1,413 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "IManager.h"
+
+
+/**
+ * @brief GPU Ÿӽ  Ӱ  н GPU ð  (Stall)  ϴ ŴԴϴ.
+ *
+ * @note
+ * -  Ŭ ̱Դϴ.
+ * -  ۰  GL_TIMESTAMP  ϸ, ø    ֽϴ.
+ * -  FRAME_COUNT    ϰ,    ִ Ӹ   ڿ нϴ.
+ * -   ٽ        ٸ ʰ ,    ϴ.
+ * -  Ŵ BeginFrame/EndFrame ̸ "Frame" , Render* 迭 ӵ ȣ ϳ  ڵ մϴ.
+ * - Ʈ̽ ϴ    ũ Ʈ̽ ̺Ʈ(chrome://tracing, Perfetto)  JSON Ϸ մϴ.
+ *
+ * @see
+ * - https://www.khronos.org/opengl/wiki/Query_Object#Timer_queries
+ * - https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+ */
+class GPUProfileManager : public IManager
+{
+public:
+	/**
+	 * @brief   ϴ   Դϴ.
+	 */
+	static const uint32_t FRAME_COUNT = 3;
+
+
+	/**
+	 * @brief  ӿ   ִ ִ  Դϴ.
+	 */
+	static const uint32_t MAX_SCOPE_COUNT = 512;
+
+
+	/**
+	 * @brief  ģ  Դϴ.
+	 *
+	 * @note ð  и̸,  ð ӿ ó    ð  մϴ.
+	 */
+	struct ScopeResult
+	{
+		std::string name;
+		uint32_t depth = 0;
+		float beginTime = 0.0f;
+		float elapsedTime = 0.0f;
+	};
+
+
+public:
+	/**
+	 * @brief GPU  Ŵ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(GPUProfileManager);
+
+
+	/**
+	 * @brief GPU  Ŵ  νϽ ϴ.
+	 *
+	 * @return GPU  Ŵ ڸ ȯմϴ.
+	 */
+	static GPUProfileManager& Get()
+	{
+		static GPUProfileManager instance;
+		return instance;
+	}
+
+
+	/**
+	 * @brief GPU  Ŵ  մϴ.
+	 *
+	 * @note
+	 * -  Ŵ   ڿ ȣؾ մϴ.
+	 * -  ޼   ȣǾ մϴ.
+	 */
+	virtual void Startup() override;
+
+
+	/**
+	 * @brief GPU  Ŵ  մϴ.
+	 *
+	 * @note
+	 * - Ʈ̽ ϰ ִٸ Ʈ̽ ϰ Ϸ մϴ.
+	 * -  Ŵ  ϱ  ȣؾ մϴ.
+	 * -  ޼ ݵ   ȣǾ մϴ.
+	 */
+	virtual void Shutdown() override;
+
+
+	/**
+	 * @brief   մϴ.
+	 *
+	 * @note
+	 * -    ִ     ,     մϴ.
+	 * -  Ŵ BeginFrame ȣմϴ.
+	 */
+	void BeginFrame();
+
+
+	/**
+	 * @brief   մϴ.
+	 *
+	 * @note
+	 * -     ݽϴ.
+	 * -  Ŵ EndFrame ۸ üϱ  ȣմϴ.
+	 */
+	void EndFrame();
+
+
+	/**
+	 * @brief ̸ ִ   մϴ.
+	 *
+	 * @param name  ̸Դϴ.
+	 *
+	 * @note
+	 * -  ø  , ݵ EndScope ¦  մϴ.
+	 * -  ۿ ȣϰų   ִ     ʽϴ.
+	 */
+	void BeginScope(const std::string& name);
+
+
+	/**
+	 * @brief  ֱٿ    մϴ.
+	 */
+	void EndScope();
+
+
+	/**
+	 * @brief   ų   ̾  ǥմϴ.
+	 *
+	 * @param name  ̸Դϴ.
+	 *
+	 * @note
+	 * -  ̸ ؼ ȣϸ ϳ  Ĩϴ.
+	 * - ٸ ̸ ȣϰų BeginScope, EndScope, EndFrame ȣϸ  ݽϴ.
+	 * -  Ŵ Render* 迭 ȣ   մϴ.
+	 */
+	void MarkScope(const std::string& name);
+
+
+	/**
+	 * @brief GPU  Ŵ  θ մϴ.
+	 *
+	 * @param bIsEnable  Դϴ. ⺻  ȰȭԴϴ.
+	 *
+	 * @note  ۿ ȣؾ մϴ.
+	 */
+	void SetEnable(bool bIsEnable);
+
+
+	/**
+	 * @brief GPU  Ŵ  θ Ȯմϴ.
+	 *
+	 * @return ϰ ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsEnable() const { return bIsEnable_; }
+
+
+	/**
+	 * @brief  ֱٿ      ϴ.
+	 *
+	 * @return    ĵ    ȯմϴ.
+	 */
+	const std::vector<ScopeResult>& GetScopeResults() const { return scopeResults_; }
+
+
+	/**
+	 * @brief  ֱٿ   ӿ ̸   GPU ð  ϴ.
+	 *
+	 * @param name  ̸Դϴ.
+	 *
+	 * @return  GPU ð(и)  ȯմϴ.  ٸ 0 ȯմϴ.
+	 */
+	float GetScopeTime(const std::string& name) const;
+
+
+	/**
+	 * @brief     ϴ.
+	 *
+	 * @return     ȯմϴ.
+	 */
+	uint32_t GetResolvedFrameCount() const { return resolvedFrameCount_; }
+
+
+	/**
+	 * @brief         ϴ.
+	 *
+	 * @return    ȯմϴ.
+	 */
+	uint32_t GetDroppedFrameCount() const { return droppedFrameCount_; }
+
+
+	/**
+	 * @brief   ִ   Ѿ     ϴ.
+	 *
+	 * @return     ȯմϴ.
+	 */
+	uint32_t GetDroppedScopeCount() const { return droppedScopeCount_; }
+
+
+	/**
+	 * @brief Ʈ̽  մϴ.
+	 *
+	 * @param path  JSON  Դϴ.
+	 *
+	 * @note
+	 * - GPU Ÿӽ CPU std::chrono::steady_clock ð(ũ) ȯϿ ϹǷ,  ð  CPU Ʈ̽ ̺Ʈ ĥ  ֽϴ.
+	 * - GPU  "GPU" (tid 1),   CPU ð "CPU" (tid 0) "Frame" ̺Ʈ մϴ.
+	 * -  ۿ ȣؾ մϴ.
+	 */
+	void BeginTrace(const std::wstring& path);
+
+
+	/**
+	 * @brief Ʈ̽  ϰ JSON Ϸ մϴ.
+	 *
+	 * @note
+	 * -     ϱ  GPU ۾   ٸϴ.
+	 * -  ۿ ȣؾ մϴ.
+	 */
+	void EndTrace();
+
+
+	/**
+	 * @brief Ʈ̽ ϰ ִ Ȯմϴ.
+	 *
+	 * @return Ʈ̽ ϰ ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsTrace() const { return bIsTrace_; }
+
+
+private:
+	/**
+	 * @brief GPU  Ŵ Ʈ ڿ   Ҹڸ մϴ.
+	 */
+	DEFAULT_CONSTRUCTOR_AND_VIRTUAL_DESTRUCTOR(GPUProfileManager);
+
+
+	/**
+	 * @brief   Դϴ.
+	 */
+	struct Scope;
+
+
+	/**
+	 * @brief       Դϴ.
+	 */
+	struct Frame;
+
+
+	/**
+	 * @brief ũ Ʈ̽ Ϸ ̺Ʈ(ph "X") ϳԴϴ.
+	 *
+	 * @note ð  ũԴϴ.
+	 */
+	struct TraceEvent
+	{
+		std::string name;
+		uint32_t tid = 0;
+		uint64_t timestamp = 0;
+		uint64_t duration = 0;
+	};
+
+
+	/**
+	 * @brief       Ÿӽ  մϴ.
+	 *
+	 * @param name  ̸Դϴ.
+	 */
+	void PushScope(const std::string& name);
+
+
+	/**
+	 * @brief  ֱٿ   ݰ  Ÿӽ  մϴ.
+	 */
+	void PopScope();
+
+
+	/**
+	 * @brief MarkScope   ִٸ ݽϴ.
+	 */
+	void EndMarkScope();
+
+
+	/**
+	 * @brief    ִ      нϴ.
+	 *
+	 * @note        ߴϸ,   ٸ ʽϴ.
+	 */
+	void ResolveFrames();
+
+
+	/**
+	 * @brief     о   Ʈ̽ ̺Ʈ ϴ.
+	 *
+	 * @param frame    Դϴ.
+	 */
+	void ResolveFrame(Frame& frame);
+
+
+	/**
+	 * @brief CPU std::chrono::steady_clock ð ϴ.
+	 *
+	 * @return ũ  ð ȯմϴ.
+	 */
+	static uint64_t GetCPUTime();
+
+
+private:
+	/**
+	 * @brief   ϴ   Դϴ.
+	 */
+	std::vector<std::shared_ptr<Frame>> frames_;
+
+
+	/**
+	 * @brief      εԴϴ.
+	 */
+	uint32_t frameIndex_ = 0;
+
+
+	/**
+	 * @brief   ߴ Դϴ.
+	 */
+	bool bIsBeginFrame_ = false;
+
+
+	/**
+	 * @brief  Դϴ.
+	 */
+	bool bIsEnable_ = true;
+
+
+	/**
+	 * @brief  ִ  ε Դϴ.
+	 *
+	 * @note ִ   Ѿ  ʴ  -1Դϴ.
+	 */
+	std::vector<int32_t> scopeStack_;
+
+
+	/**
+	 * @brief MarkScope   ִ Դϴ.
+	 *
+	 * @note MarkScope   ׻     ֽϴ.
+	 */
+	bool bIsOpenMarkScope_ = false;
+
+
+	/**
+	 * @brief MarkScope   ̸Դϴ.
+	 */
+	std::string markScopeName_;
+
+
+	/**
+	 * @brief  ֱٿ      Դϴ.
+	 */
+	std::vector<ScopeResult> scopeResults_;
+
+
+	/**
+	 * @brief    Դϴ.
+	 */
+	uint32_t resolvedFrameCount_ = 0;
+
+
+	/**
+	 * @brief        Դϴ.
+	 */
+	uint32_t droppedFrameCount_ = 0;
+
+
+	/**
+	 * @brief ִ   Ѿ    Դϴ.
+	 */
+	uint32_t droppedScopeCount_ = 0;
+
+
+	/**
+	 * @brief Ʈ̽ ϰ ִ Դϴ.
+	 */
+	bool bIsTrace_ = false;
+
+
+	/**
+	 * @brief Ʈ̽  JSON  Դϴ.
+	 */
+	std::wstring tracePath_;
+
+
+	/**
+	 * @brief Ʈ̽   GPU Ÿӽ()Դϴ.
+	 */
+	uint64_t traceGPUBaseTime_ = 0;
+
+
+	/**
+	 * @brief Ʈ̽   CPU ð(ũ)Դϴ.
+	 */
+	uint64_t traceCPUBaseTime_ = 0;
+
+
+	/**
+	 * @brief  Ʈ̽ ̺Ʈ Դϴ.
+	 */
+	std::vector<TraceEvent> traceEvents_;
+};
\ No newline at end of file
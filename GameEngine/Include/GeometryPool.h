@@ -0,0 +1,287 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "FreeListAllocator.h"
+#include "IResource.h"
+#include "Matrix4x4.h"
+#include "ShaderDataUtils.h"
+#include "StaticMesh.h"
+
+
+/**
+ * @brief     ޽õ ϳ /ε ۿ   Ʈ ǮԴϴ.
+ *
+ * @note
+ * -  ޽ð ϳ  迭 Ʈ(VAO) ϹǷ,  ޽ø ׸  VAO ٽ ε ʿ䰡 ϴ.
+ * - Ӹ ׸    glMultiDrawElementsIndirect   н ü ׸ϴ.
+ * - ׸   ׸ (ShaderDataUtils::DrawData)  Ŵ ׸  ۿ ϵǸ,
+ *   ٸ ׸ ο  ̴ gl_BaseInstance ° ׸ ͷ մϴ. (DrawData.glsl)
+ */
+class GeometryPool : public IResource
+{
+public:
+	/**
+	 * @brief glMultiDrawElementsIndirect ׸ Դϴ.
+	 *
+	 * @see https://registry.khronos.org/OpenGL-Refpages/gl4/html/glMultiDrawElementsIndirect.xhtml
+	 */
+	struct DrawElementsIndirectCommand
+	{
+		uint32_t count;
+		uint32_t instanceCount;
+		uint32_t firstIndex;
+		int32_t baseVertex;
+		uint32_t baseInstance;
+	};
+
+
+	/**
+	 * @brief Ʈ Ǯ  Ҵ ޽ Դϴ.
+	 */
+	struct MeshRange
+	{
+		uint32_t baseVertex;
+		uint32_t vertexCount;
+		uint32_t firstIndex;
+		uint32_t indexCount;
+	};
+
+
+public:
+	/**
+	 * @brief Ʈ Ǯ Ʈ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	GeometryPool() = default;
+
+
+	/**
+	 * @brief Ʈ Ǯ  ҸԴϴ.
+	 *
+	 * @note Ʈ Ǯ ο Ҵ Ҹ ϱ ؼ ݵ Release ȣؾ մϴ.
+	 */
+	virtual ~GeometryPool();
+
+
+	/**
+	 * @brief Ʈ Ǯ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(GeometryPool);
+
+
+	/**
+	 * @brief Ʈ Ǯ մϴ.
+	 *
+	 * @param maxVertexCount Ʈ Ǯ   ִ ִ  Դϴ.
+	 * @param maxIndexCount Ʈ Ǯ   ִ ִ ε Դϴ.
+	 */
+	void Initialize(uint32_t maxVertexCount, uint32_t maxIndexCount);
+
+
+	/**
+	 * @brief Ʈ Ǯ  ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief Ʈ Ǯ ޽ø ߰մϴ.
+	 *
+	 * @param vertices ޽  Դϴ.
+	 * @param indices ޽ ε Դϴ. ε ޽ ù °   մϴ.
+	 *
+	 * @return ߰ ޽ ̵ ȯմϴ. Ǯ  ϸ -1 ȯմϴ.
+	 */
+	int32_t AddMesh(const std::vector<StaticMesh::Vertex>& vertices, const std::vector<uint32_t>& indices);
+
+
+	/**
+	 * @brief Ʈ Ǯ ޽ø մϴ.
+	 *
+	 * @param meshID  ޽ ̵Դϴ.
+	 *
+	 * @note ŵ ޽ ̵   ߰Ǵ ޽ÿ   ֽϴ.
+	 */
+	void RemoveMesh(int32_t meshID);
+
+
+	/**
+	 * @brief ޽ð Ʈ Ǯ  ȿ Ȯմϴ.
+	 *
+	 * @param meshID Ȯ ޽ ̵Դϴ.
+	 *
+	 * @return ޽ð ȿϴٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsValidMesh(int32_t meshID) const;
+
+
+	/**
+	 * @brief Ʈ Ǯ  ޽  ϴ.
+	 *
+	 * @param meshID   ޽ ̵Դϴ.
+	 *
+	 * @return Ʈ Ǯ  ޽  ȯմϴ.
+	 */
+	const MeshRange& GetMeshRange(int32_t meshID) const;
+
+
+	/**
+	 * @brief ̹ ӿ  ׸   մϴ.
+	 */
+	void ClearDrawCommands();
+
+
+	/**
+	 * @brief ׸  ߰մϴ.
+	 *
+	 * @param meshID ׸ ޽ ̵Դϴ.
+	 * @param world ޽  Դϴ.
+	 * @param textureSlot ׸⿡ ø TextureBindingTable  ȣԴϴ. ؽó ٸ -1Դϴ.
+	 *
+	 * @note  ȣ ׸ Ϳ Ƿ,   Ƽ ο ȿ ׸⸶ ٸ ؽó ø  ֽϴ.
+	 */
+	void AddDrawCommand(int32_t meshID, const Matrix4x4f& world, int32_t textureSlot = -1);
+
+
+	/**
+	 * @brief  ׸  GPU ۿ մϴ.
+	 *
+	 * @param firstDrawIndex ù ° ׸  ׸  εԴϴ. ׸  baseInstance   ʷ ˴ϴ.
+	 *
+	 * @note  Ŵ ׸ ͸ ׸  ۿ  ڿ ȣϹǷ, Ϲ  ȣ ʿ䰡 ϴ.
+	 */
+	void FlushDrawCommands(uint32_t firstDrawIndex);
+
+
+	/**
+	 * @brief ̹ ӿ  ׸   ϴ.
+	 *
+	 * @return ̹ ӿ  ׸   ȯմϴ.
+	 */
+	uint32_t GetDrawCommandCount() const { return static_cast<uint32_t>(drawCommands_.size()); }
+
+
+	/**
+	 * @brief Ʈ Ǯ  迭 Ʈ ϴ.
+	 *
+	 * @return Ʈ Ǯ  迭 Ʈ ȯմϴ.
+	 */
+	uint32_t GetVertexArrayObject() const { return vertexArrayObject_; }
+
+
+	/**
+	 * @brief ׸   Ʈ ϴ.
+	 *
+	 * @return ׸   Ʈ ȯմϴ.
+	 */
+	uint32_t GetDrawIndirectBufferObject() const { return drawIndirectBufferObject_; }
+
+
+	/**
+	 * @brief ̹ ӿ  ׸   ׸   ϴ.
+	 *
+	 * @return ׸   ׸   ȯմϴ.
+	 */
+	const std::vector<ShaderDataUtils::DrawData>& GetDrawDatas() const { return drawDatas_; }
+
+
+	/**
+	 * @brief   Ҵڸ ϴ.
+	 *
+	 * @return   Ҵ  ڸ ȯմϴ.
+	 */
+	const FreeListAllocator& GetVertexAllocator() const { return vertexAllocator_; }
+
+
+	/**
+	 * @brief ε  Ҵڸ ϴ.
+	 *
+	 * @return ε  Ҵ  ڸ ȯմϴ.
+	 */
+	const FreeListAllocator& GetIndexAllocator() const { return indexAllocator_; }
+
+
+private:
+	/**
+	 * @brief ׸   ũ⸦ ʿ ŭ øϴ.
+	 *
+	 * @param commandCount ۿ  ׸  Դϴ.
+	 */
+	void ReserveDrawBuffers(uint32_t commandCount);
+
+
+private:
+	/**
+	 * @brief   ҴԴϴ.
+	 */
+	FreeListAllocator vertexAllocator_;
+
+
+	/**
+	 * @brief ε  ҴԴϴ.
+	 */
+	FreeListAllocator indexAllocator_;
+
+
+	/**
+	 * @brief ޽ ̵ ϴ  Դϴ.
+	 */
+	std::vector<MeshRange> meshRanges_;
+
+
+	/**
+	 * @brief ޽ ̵ ȿ  Դϴ.
+	 */
+	std::vector<bool> meshValidFlags_;
+
+
+	/**
+	 * @brief   ޽ ̵ Դϴ.
+	 */
+	std::vector<int32_t> freeMeshIDs_;
+
+
+	/**
+	 * @brief ̹ ӿ  ׸  Դϴ.
+	 */
+	std::vector<DrawElementsIndirectCommand> drawCommands_;
+
+
+	/**
+	 * @brief ̹ ӿ  ׸   ׸  Դϴ.
+	 */
+	std::vector<ShaderDataUtils::DrawData> drawDatas_;
+
+
+	/**
+	 * @brief ׸  ۿ   ִ ׸  Դϴ.
+	 */
+	uint32_t drawBufferCapacity_ = 0;
+
+
+	/**
+	 * @brief  ޽ð ϴ  迭 ƮԴϴ.
+	 */
+	uint32_t vertexArrayObject_ = 0;
+
+
+	/**
+	 * @brief  ޽ð ϴ   ƮԴϴ.
+	 */
+	uint32_t vertexBufferObject_ = 0;
+
+
+	/**
+	 * @brief  ޽ð ϴ ε  ƮԴϴ.
+	 */
+	uint32_t indexBufferObject_ = 0;
+
+
+	/**
+	 * @brief ׸   ƮԴϴ.
+	 */
+	uint32_t drawIndirectBufferObject_ = 0;
+};
\ No newline at end of file
@@ -9,26 +9,53 @@
 #include <vector>
 
 #include "Assertion.h"
+#include "AxisAlignedBoundingBox.h"
+#include "CascadedShadowMap.h"
+#include "ClusteredLightBuffer.h"
 #include "CommandLineUtils.h"
 #include "DirectionalLight.h"
+#include "DynamicBoundingVolumeTree.h"
 #include "FileUtils.h"
+#include "FrameCaptureManager.h"
+#include "FreeListAllocator.h"
+#include "Frustum.h"
 #include "GameTimer.h"
 #include "GeometryGenerator.h"
+#include "GeometryPool.h"
 #include "GLAssertion.h"
+#include "GPUProfileManager.h"
 #include "InputManager.h"
+#include "LightClusterBuilder.h"
 #include "Macro.h"
 #include "Material.h"
+#include "MaterialPool.h"
 #include "MathUtils.h"
+#include "OcclusionCuller.h"
 #include "PointLight.h"
 #include "RenderManager.h"
+#include "RenderQueue.h"
 #include "ResourceManager.h"
+#include "RingBuffer.h"
 #include "Shader.h"
+#include "ShaderBufferPool.h"
+#include "ShaderCacheUtils.h"
+#include "ShaderDataUtils.h"
+#include "ShaderPreprocessUtils.h"
+#include "ShaderVariantSet.h"
+#include "ShadowCascadeUtils.h"
 #include "SpotLight.h"
+#include "StaticBatch.h"
+#include "StaticBatchBuilder.h"
 #include "StaticMesh.h"
 #include "StringUtils.h"
 #include "ShadowMap.h"
 #include "Skybox.h"
+#include "TaskManager.h"
 #include "Texture2D.h"
+#include "TextureBindingTable.h"
+#include "TextureBudgetUtils.h"
+#include "TextureResidencyManager.h"
+#include "TextureStreamManager.h"
 #include "TTFont.h"
 #include "Window.h"
 #include "WindowsAssertion.h"
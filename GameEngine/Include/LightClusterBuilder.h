@@ -0,0 +1,276 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "AxisAlignedBoundingBox.h"
+#include "Macro.h"
+#include "Matrix4x4.h"
+#include "PointLight.h"
+#include "SpotLight.h"
+#include "Vector3.h"
+
+
+/**
+ * @brief þ ü 3 (Ŭ) ,  ŬͿ  ִ   մϴ.
+ *
+ * @note
+ * - ȭ CLUSTER_COUNT_X x CLUSTER_COUNT_Y ŸϷ, ̸ CLUSTER_COUNT_Z   ϴ.
+ * -   Ʈ        ٻϸ,  ε    Ʈ  Դϴ.
+ * -    Ŀ 忡 , Ŭ  ڿ    SIMD(SSE2)   ˻մϴ.
+ * - GPU ҽ  Ƿ CPU 󿡼 ܵ   ֽϴ.  ClusteredLightBuffer εմϴ.
+ */
+class LightClusterBuilder
+{
+public:
+	/**
+	 * @brief   Ŭ Դϴ.
+	 */
+	static const uint32_t CLUSTER_COUNT_X = 16;
+
+
+	/**
+	 * @brief   Ŭ Դϴ.
+	 */
+	static const uint32_t CLUSTER_COUNT_Y = 9;
+
+
+	/**
+	 * @brief   Ŭ Դϴ.
+	 */
+	static const uint32_t CLUSTER_COUNT_Z = 24;
+
+
+	/**
+	 * @brief ü Ŭ Դϴ.
+	 */
+	static const uint32_t CLUSTER_COUNT = CLUSTER_COUNT_X * CLUSTER_COUNT_Y * CLUSTER_COUNT_Z;
+
+
+	/**
+	 * @brief  ǥ    Դϴ.
+	 */
+	struct LightBound
+	{
+		Vector3f position;
+		float radius;
+	};
+
+
+	/**
+	 * @brief Ŭ  ε  Դϴ.
+	 */
+	struct ClusterEntry
+	{
+		uint32_t offset;
+		uint32_t count;
+	};
+
+
+public:
+	/**
+	 * @brief  Ŭ  Ʈ Դϴ.
+	 */
+	LightClusterBuilder() = default;
+
+
+	/**
+	 * @brief  Ŭ   ҸԴϴ.
+	 */
+	virtual ~LightClusterBuilder() {}
+
+
+	/**
+	 * @brief  Ŭ   ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(LightClusterBuilder);
+
+
+	/**
+	 * @brief Ŭ͸  ī޶   մϴ.
+	 *
+	 * @param fov ī޶    þ Դϴ.
+	 * @param aspect ī޶ / Դϴ.
+	 * @param nearZ ī޶   ŸԴϴ.
+	 * @param farZ ī޶   ŸԴϴ.
+	 *
+	 * @note   ٲ 쿡 Ŭ  ڸ ٽ մϴ.
+	 */
+	void SetProjection(float fov, float aspect, float nearZ, float farZ);
+
+
+	/**
+	 * @brief  ŬͿ Ҵմϴ.
+	 *
+	 * @param view ī޶ þ Դϴ.
+	 * @param pointLights   Դϴ.
+	 * @param spotLights Ʈ  Դϴ.
+	 */
+	void Build(const Matrix4x4f& view, const std::vector<PointLight>& pointLights, const std::vector<SpotLight>& spotLights);
+
+
+	/**
+	 * @brief Ŭͺ  ε   ϴ.
+	 *
+	 * @return Ŭͺ  ε   ȯմϴ. ũ CLUSTER_COUNTԴϴ.
+	 */
+	const std::vector<ClusterEntry>& GetClusterEntries() const { return clusterEntries_; }
+
+
+	/**
+	 * @brief  Ŭ  ε  ϴ.
+	 *
+	 * @return  Ŭ  ε  ȯմϴ.
+	 */
+	const std::vector<uint32_t>& GetLightIndices() const { return lightIndices_; }
+
+
+	/**
+	 * @brief  Ҵ     ϴ.
+	 *
+	 * @return    Ʈ       ȯմϴ.
+	 */
+	const std::vector<LightBound>& GetLightBounds() const { return lightBounds_; }
+
+
+	/**
+	 * @brief þ ǥ  Ŭ  ڸ ϴ.
+	 *
+	 * @param cluster  ڸ  Ŭ εԴϴ.
+	 *
+	 * @return þ ǥ  Ŭ  ڸ ȯմϴ.
+	 */
+	const AxisAlignedBoundingBox& GetClusterBoundingBox(uint32_t cluster) const { return clusterBounds_[cluster]; }
+
+
+	/**
+	 * @brief Ŭ ε մϴ.
+	 *
+	 * @param x   Ŭ εԴϴ.
+	 * @param y   Ŭ εԴϴ.
+	 * @param z   Ŭ εԴϴ.
+	 *
+	 * @return Ŭ ε ȯմϴ.
+	 */
+	static uint32_t GetClusterIndex(uint32_t x, uint32_t y, uint32_t z) { return x + y * CLUSTER_COUNT_X + z * CLUSTER_COUNT_X * CLUSTER_COUNT_Y; }
+
+
+	/**
+	 * @brief  κ    մϴ.
+	 *
+	 * @param constant  Դϴ.
+	 * @param linear  Դϴ.
+	 * @param quadratic  Դϴ.
+	 * @param intensity   ִ Դϴ.
+	 * @param threshold   ִ  Դϴ.
+	 *
+	 * @return  Ⱑ threshold Ϸ  Ÿ ȯմϴ.
+	 */
+	static float ComputeLightRange(float constant, float linear, float quadratic, float intensity, float threshold = 1.0f / 256.0f);
+
+
+private:
+	/**
+	 * @brief   ϳ   SIMD ˻ϱ  к   ۾ Դϴ.
+	 *
+	 * @note Ӹ ٽ Ҵ ʵ   ϳ մϴ.
+	 */
+	struct SliceScratch
+	{
+		std::vector<float> positionX;
+		std::vector<float> positionY;
+		std::vector<float> positionZ;
+		std::vector<float> radiusSquare;
+	};
+
+
+	/**
+	 * @brief þ ǥ ̿ شϴ   Ŭ ε մϴ.
+	 *
+	 * @param depth ī޶κ ŸԴϴ.
+	 *
+	 * @return   Ŭ ε ȯմϴ.      ε մϴ.  ̵ óմϴ.
+	 */
+	int32_t ComputeSlice(float depth) const;
+
+
+	/**
+	 * @brief   ϳ ϴ ŬͿ  Ҵմϴ.
+	 *
+	 * @param slice   Ŭ εԴϴ.
+	 */
+	void BuildSlice(uint32_t slice);
+
+
+private:
+	/**
+	 * @brief ī޶    þ Դϴ.
+	 */
+	float fov_ = 0.0f;
+
+
+	/**
+	 * @brief ī޶ / Դϴ.
+	 */
+	float aspect_ = 0.0f;
+
+
+	/**
+	 * @brief ī޶   ŸԴϴ.
+	 */
+	float nearZ_ = 0.0f;
+
+
+	/**
+	 * @brief ī޶   ŸԴϴ.
+	 */
+	float farZ_ = 0.0f;
+
+
+	/**
+	 * @brief þ ǥ  Ŭ   Դϴ.
+	 */
+	std::vector<AxisAlignedBoundingBox> clusterBounds_;
+
+
+	/**
+	 * @brief  ǥ     Դϴ.
+	 */
+	std::vector<LightBound> lightBounds_;
+
+
+	/**
+	 * @brief þ ǥ     Դϴ.
+	 */
+	std::vector<LightBound> viewLightBounds_;
+
+
+	/**
+	 * @brief   ġ  ε Դϴ.
+	 */
+	std::vector<std::vector<uint32_t>> sliceLights_;
+
+
+	/**
+	 * @brief     ε Դϴ.
+	 */
+	std::vector<std::vector<uint32_t>> sliceLightIndices_;
+
+
+	/**
+	 * @brief   ۾ Դϴ.
+	 */
+	std::vector<SliceScratch> sliceScratches_;
+
+
+	/**
+	 * @brief Ŭͺ  ε  Դϴ.
+	 */
+	std::vector<ClusterEntry> clusterEntries_;
+
+
+	/**
+	 * @brief  Ŭ  ε Դϴ.
+	 */
+	std::vector<uint32_t> lightIndices_;
+};
\ No newline at end of file
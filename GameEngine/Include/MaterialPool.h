@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "IResource.h"
+#include "Material.h"
+#include "ShaderBufferPool.h"
+
+
+/**
+ * @brief  ͸ ϳ  ۿ , ׸⸶  ϳ εϴ  ǮԴϴ.
+ *
+ * @note
+ * -  ShaderDataUtils::MaterialData ̾ƿ ShaderBufferPool Ƿ, ٲ  ٽ εմϴ.
+ * - Bind  ׸ ShaderDataUtils::MATERIAL_BUFFER_BINDING ġ εմϴ.
+ *   ) layout(std140, binding = 1) uniform MaterialBuffer { Material m; };
+ * - RenderManager::RenderQueue3D  ε Լ Bind ȣϸ,  ٲ  εմϴ.
+ * -  ͸ Ű ϹǷ,  ϱ  ݵ Ǯ ؾ մϴ.
+ */
+class MaterialPool : public IResource
+{
+public:
+	/**
+	 * @brief  Ǯ Ʈ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	MaterialPool() = default;
+
+
+	/**
+	 * @brief  Ǯ  ҸԴϴ.
+	 *
+	 * @note  Ǯ ο Ҵ Ҹ ϱ ؼ ݵ Release ȣؾ մϴ.
+	 */
+	virtual ~MaterialPool();
+
+
+	/**
+	 * @brief  Ǯ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(MaterialPool);
+
+
+	/**
+	 * @brief  Ǯ ʱȭմϴ.
+	 *
+	 * @param maxMaterialCount Ǯ   ִ ִ  Դϴ.
+	 */
+	void Initialize(uint32_t maxMaterialCount = 256);
+
+
+	/**
+	 * @brief  Ǯ  ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief  Ǯ ߰մϴ.
+	 *
+	 * @param material ߰ Դϴ.
+	 *
+	 * @note ̹ ߰ ̶  ͸ մϴ.
+	 */
+	void Add(const Material* material);
+
+
+	/**
+	 * @brief  Ǯ մϴ.
+	 *
+	 * @param material  Դϴ.
+	 */
+	void Remove(const Material* material);
+
+
+	/**
+	 * @brief   ٲٸ  ͸   ǥմϴ.
+	 *
+	 * @param material  Դϴ.
+	 *
+	 * @note  ε Flush մϴ.
+	 */
+	void Update(const Material* material);
+
+
+	/**
+	 * @brief   ǥ  ͸ εմϴ.
+	 *
+	 * @note Ӹ  Ǯ ϴ ù ׸    ȣմϴ.
+	 */
+	void Flush();
+
+
+	/**
+	 * @brief   ͸   ε ġ εմϴ.
+	 *
+	 * @param material ε Դϴ. Ǯ ߰ ̾ մϴ.
+	 */
+	void Bind(const Material* material);
+
+
+	/**
+	 * @brief Ǯ    ϴ.
+	 *
+	 * @return Ǯ    ȯմϴ.
+	 */
+	uint32_t GetMaterialCount() const { return static_cast<uint32_t>(materialIDs_.size()); }
+
+
+private:
+	/**
+	 * @brief  ͸    ǮԴϴ.
+	 */
+	ShaderBufferPool materialPool_;
+
+
+	/**
+	 * @brief  Ҵ  Ǯ ׸ IDԴϴ.
+	 */
+	std::unordered_map<const Material*, int32_t> materialIDs_;
+};
\ No newline at end of file
@@ -379,7 +379,7 @@ namespace MathUtils
 	inline float Length(const Vector2<T>& v)
 	{
 		float lengthSquare = static_cast<float>(LengthSquare<T>(v));
-		return std::sqrtf(lengthSquare);
+		return std::sqrt(lengthSquare);
 	}
 
 
@@ -394,7 +394,7 @@ namespace MathUtils
 	inline float Length(const Vector3<T>& v)
 	{
 		float lengthSquare = static_cast<float>(LengthSquare<T>(v));
-		return std::sqrtf(lengthSquare);
+		return std::sqrt(lengthSquare);
 	}
 
 
@@ -409,7 +409,7 @@ namespace MathUtils
 	inline float Length(const Vector4<T>& v)
 	{
 		float lengthSquare = static_cast<float>(LengthSquare<T>(v));
-		return std::sqrtf(lengthSquare);
+		return std::sqrt(lengthSquare);
 	}
 
 
@@ -706,7 +706,7 @@ namespace MathUtils
 			1.0f / (aspect * tanHalfFovy),                 0.0f,                                    0.0f,  0.0f,
 			                         0.0f, 1.0f / (tanHalfFovy),                                    0.0f,  0.0f,
 			                         0.0f,                 0.0f,        -(farZ + nearZ) / (farZ - nearZ), -1.0f,
-			                         0.0f,                 0.0f, -(2.0f * farZ * nearZ) / (farZ - nearZ),  1.0f
+			                         0.0f,                 0.0f, -(2.0f * farZ * nearZ) / (farZ - nearZ),  0.0f
 		);
 	}
 
@@ -733,4 +733,108 @@ namespace MathUtils
 			-DotProduct(s, eyePosition), -DotProduct(u, eyePosition), DotProduct(f, eyePosition), 1.0f
 		);
 	}
+
+
+	/**
+	 * @brief ġ  մϴ.
+	 *
+	 * @param matrix ġ Դϴ.
+	 *
+	 * @return  ġ  ȯմϴ.
+	 */
+	inline Matrix4x4f Transpose(const Matrix4x4f& matrix)
+	{
+		return Matrix4x4f(
+			matrix.m[0][0], matrix.m[1][0], matrix.m[2][0], matrix.m[3][0],
+			matrix.m[0][1], matrix.m[1][1], matrix.m[2][1], matrix.m[3][1],
+			matrix.m[0][2], matrix.m[1][2], matrix.m[2][2], matrix.m[3][2],
+			matrix.m[0][3], matrix.m[1][3], matrix.m[2][3], matrix.m[3][3]
+		);
+	}
+
+
+	/**
+	 * @brief  մϴ.
+	 *
+	 * @param matrix   Դϴ.
+	 *
+	 * @return   ȯմϴ.     ȯմϴ.
+	 */
+	inline Matrix4x4f Inverse(const Matrix4x4f& matrix)
+	{
+		const float* a = matrix.GetPtr();
+		float inv[16];
+
+		inv[0] = a[5] * a[10] * a[15] - a[5] * a[11] * a[14] - a[9] * a[6] * a[15] + a[9] * a[7] * a[14] + a[13] * a[6] * a[11] - a[13] * a[7] * a[10];
+		inv[4] = -a[4] * a[10] * a[15] + a[4] * a[11] * a[14] + a[8] * a[6] * a[15] - a[8] * a[7] * a[14] - a[12] * a[6] * a[11] + a[12] * a[7] * a[10];
+		inv[8] = a[4] * a[9] * a[15] - a[4] * a[11] * a[13] - a[8] * a[5] * a[15] + a[8] * a[7] * a[13] + a[12] * a[5] * a[11] - a[12] * a[7] * a[9];
+		inv[12] = -a[4] * a[9] * a[14] + a[4] * a[10] * a[13] + a[8] * a[5] * a[14] - a[8] * a[6] * a[13] - a[12] * a[5] * a[10] + a[12] * a[6] * a[9];
+		inv[1] = -a[1] * a[10] * a[15] + a[1] * a[11] * a[14] + a[9] * a[2] * a[15] - a[9] * a[3] * a[14] - a[13] * a[2] * a[11] + a[13] * a[3] * a[10];
+		inv[5] = a[0] * a[10] * a[15] - a[0] * a[11] * a[14] - a[8] * a[2] * a[15] + a[8] * a[3] * a[14] + a[12] * a[2] * a[11] - a[12] * a[3] * a[10];
+		inv[9] = -a[0] * a[9] * a[15] + a[0] * a[11] * a[13] + a[8] * a[1] * a[15] - a[8] * a[3] * a[13] - a[12] * a[1] * a[11] + a[12] * a[3] * a[9];
+		inv[13] = a[0] * a[9] * a[14] - a[0] * a[10] * a[13] - a[8] * a[1] * a[14] + a[8] * a[2] * a[13] + a[12] * a[1] * a[10] - a[12] * a[2] * a[9];
+		inv[2] = a[1] * a[6] * a[15] - a[1] * a[7] * a[14] - a[5] * a[2] * a[15] + a[5] * a[3] * a[14] + a[13] * a[2] * a[7] - a[13] * a[3] * a[6];
+		inv[6] = -a[0] * a[6] * a[15] + a[0] * a[7] * a[14] + a[4] * a[2] * a[15] - a[4] * a[3] * a[14] - a[12] * a[2] * a[7] + a[12] * a[3] * a[6];
+		inv[10] = a[0] * a[5] * a[15] - a[0] * a[7] * a[13] - a[4] * a[1] * a[15] + a[4] * a[3] * a[13] + a[12] * a[1] * a[7] - a[12] * a[3] * a[5];
+		inv[14] = -a[0] * a[5] * a[14] + a[0] * a[6] * a[13] + a[4] * a[1] * a[14] - a[4] * a[2] * a[13] - a[12] * a[1] * a[6] + a[12] * a[2] * a[5];
+		inv[3] = -a[1] * a[6] * a[11] + a[1] * a[7] * a[10] + a[5] * a[2] * a[11] - a[5] * a[3] * a[10] - a[9] * a[2] * a[7] + a[9] * a[3] * a[6];
+		inv[7] = a[0] * a[6] * a[11] - a[0] * a[7] * a[10] - a[4] * a[2] * a[11] + a[4] * a[3] * a[10] + a[8] * a[2] * a[7] - a[8] * a[3] * a[6];
+		inv[11] = -a[0] * a[5] * a[11] + a[0] * a[7] * a[9] + a[4] * a[1] * a[11] - a[4] * a[3] * a[9] - a[8] * a[1] * a[7] + a[8] * a[3] * a[5];
+		inv[15] = a[0] * a[5] * a[10] - a[0] * a[6] * a[9] - a[4] * a[1] * a[10] + a[4] * a[2] * a[9] + a[8] * a[1] * a[6] - a[8] * a[2] * a[5];
+
+		float determinant = a[0] * inv[0] + a[1] * inv[4] + a[2] * inv[8] + a[3] * inv[12];
+		if (NearZero(determinant))
+		{
+			return Matrix4x4f();
+		}
+
+		float oneDivDeterminant = 1.0f / determinant;
+
+		return Matrix4x4f(
+			 inv[0] * oneDivDeterminant,  inv[1] * oneDivDeterminant,  inv[2] * oneDivDeterminant,  inv[3] * oneDivDeterminant,
+			 inv[4] * oneDivDeterminant,  inv[5] * oneDivDeterminant,  inv[6] * oneDivDeterminant,  inv[7] * oneDivDeterminant,
+			 inv[8] * oneDivDeterminant,  inv[9] * oneDivDeterminant, inv[10] * oneDivDeterminant, inv[11] * oneDivDeterminant,
+			inv[12] * oneDivDeterminant, inv[13] * oneDivDeterminant, inv[14] * oneDivDeterminant, inv[15] * oneDivDeterminant
+		);
+	}
+
+
+	/**
+	 * @brief ġ ķ ȯմϴ.
+	 *
+	 * @param position ȯ ġԴϴ.
+	 * @param matrix ȯ Դϴ.
+	 *
+	 * @return ȯ ġ ȯմϴ.
+	 *
+	 * @note   (position * matrix)̸,  ǥ w   ʽϴ.
+	 */
+	inline Vector3f TransformPosition(const Vector3f& position, const Matrix4x4f& matrix)
+	{
+		return Vector3f(
+			position.x * matrix.m[0][0] + position.y * matrix.m[1][0] + position.z * matrix.m[2][0] + matrix.m[3][0],
+			position.x * matrix.m[0][1] + position.y * matrix.m[1][1] + position.z * matrix.m[2][1] + matrix.m[3][1],
+			position.x * matrix.m[0][2] + position.y * matrix.m[1][2] + position.z * matrix.m[2][2] + matrix.m[3][2]
+		);
+	}
+
+
+	/**
+	 * @brief  ķ ȯմϴ.
+	 *
+	 * @param direction ȯ Դϴ.
+	 * @param matrix ȯ Դϴ.
+	 *
+	 * @return ȯ  ȯմϴ.
+	 *
+	 * @note  ̵  մϴ.
+	 */
+	inline Vector3f TransformDirection(const Vector3f& direction, const Matrix4x4f& matrix)
+	{
+		return Vector3f(
+			direction.x * matrix.m[0][0] + direction.y * matrix.m[1][0] + direction.z * matrix.m[2][0],
+			direction.x * matrix.m[0][1] + direction.y * matrix.m[1][1] + direction.z * matrix.m[2][1],
+			direction.x * matrix.m[0][2] + direction.y * matrix.m[1][2] + direction.z * matrix.m[2][2]
+		);
+	}
 };
\ No newline at end of file
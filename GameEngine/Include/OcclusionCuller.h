@@ -0,0 +1,299 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "AxisAlignedBoundingBox.h"
+#include "Macro.h"
+#include "Matrix4x4.h"
+#include "StaticMesh.h"
+
+
+/**
+ * @brief ػ  ۿ  (Hi-Z) Ƕ̵带 CPU ϴ Ʈ Ŭ ÷Դϴ.
+ *
+ * @note
+ * -   (Occluder) ޽ø Ÿ   SIMD(SSE2) Ͷ  ۿ ׸ϴ.
+ * -  ۷κ 2x2 ؼ   ̸ ϴ Hi-Z Ƕ̵带 , νϽ  ڸ ̿ մϴ.
+ * - ȭ ü ˻ TaskManager Ŀ 忡 ϸ, GPU ҽ (Readback)  ʽϴ.
+ * - ̴ OpenGL  ġ ǥ(NDC) ̸ [0, 1]  ű ̸,   ϴ.
+ *
+ * @see https://www.intel.com/content/www/us/en/developer/articles/technical/masked-software-occlusion-culling.html
+ */
+class OcclusionCuller
+{
+public:
+	/**
+	 * @brief Ͷ  ۸  Ÿ ũԴϴ.
+	 */
+	static const int32_t TILE_SIZE = 32;
+
+
+	/**
+	 * @brief   Դϴ.
+	 */
+	struct Statistics
+	{
+		uint32_t occluderTriangleCount;
+		uint32_t rasterizedTriangleCount;
+		uint32_t testedCount;
+		uint32_t occludedCount;
+	};
+
+
+public:
+	/**
+	 * @brief Ŭ ÷ Դϴ.
+	 *
+	 * @param width    ũԴϴ. TILE_SIZE  մϴ.
+	 * @param height    ũԴϴ. TILE_SIZE  մϴ.
+	 */
+	explicit OcclusionCuller(int32_t width = 256, int32_t height = 128);
+
+
+	/**
+	 * @brief Ŭ ÷  ҸԴϴ.
+	 */
+	virtual ~OcclusionCuller() {}
+
+
+	/**
+	 * @brief Ŭ ÷  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(OcclusionCuller);
+
+
+	/**
+	 * @brief ο    մϴ.
+	 *
+	 * @param view þ Դϴ.
+	 * @param projection  Դϴ.
+	 *
+	 * @note  ӿ ߰   ŵ˴ϴ.
+	 */
+	void Begin(const Matrix4x4f& view, const Matrix4x4f& projection);
+
+
+	/**
+	 * @brief  ޽ø ߰մϴ.
+	 *
+	 * @param mesh    ޽Դϴ. CPU  /ε  ϵ ʱȭ ޽ÿ մϴ.
+	 * @param world  ޽  Դϴ.
+	 *
+	 * @note ޽ô Rasterize ȣ   ȿؾ մϴ.
+	 */
+	void AddOccluder(const StaticMesh* mesh, const Matrix4x4f& world);
+
+
+	/**
+	 * @brief CPU  /ε   ߰մϴ.
+	 *
+	 * @param vertices   Դϴ.
+	 * @param indices  ﰢ ε Դϴ.
+	 * @param world   Դϴ.
+	 *
+	 * @note
+	 * - GPU ҽ  GeometryGenerator     Ͻø ״   ֽϴ.
+	 * - /ε  Rasterize ȣ   ȿؾ մϴ.
+	 */
+	void AddOccluder(const std::vector<StaticMesh::Vertex>& vertices, const std::vector<uint32_t>& indices, const Matrix4x4f& world);
+
+
+	/**
+	 * @brief ߰   ۿ ȭϰ Hi-Z Ƕ̵带 ϴ.
+	 *
+	 * @note
+	 * -   ȯ  , ȭ Ÿ  Ŀ 忡  մϴ.
+	 * -  鿡 ġ ﰢ  ϹǷ, ̴ νϽ    ʽϴ.
+	 */
+	void Rasterize();
+
+
+	/**
+	 * @brief  ڰ ̴ Ȯմϴ.
+	 *
+	 * @param bound ˻  ǥ   Դϴ.
+	 *
+	 * @return  ڰ ȭ ۿ ְų   ٸ false, ׷  true ȯմϴ.
+	 *
+	 * @note  ڰ  鿡 ġ ׻ true ȯմϴ.
+	 */
+	bool IsVisible(const AxisAlignedBoundingBox& bound) const;
+
+
+	/**
+	 * @brief νϽ Ͽ  νϽ մϴ.
+	 *
+	 * @param bounds νϽ  ǥ    Դϴ.
+	 * @param inOutIndices ˻ νϽ ε Դϴ. ȣ Ŀ ̴ νϽ ε  ϴ.
+	 *
+	 * @note   ˻ Ŀ 忡  մϴ.
+	 */
+	void Cull(const std::vector<AxisAlignedBoundingBox>& bounds, std::vector<uint32_t>& inOutIndices);
+
+
+	/**
+	 * @brief    ũ⸦ ϴ.
+	 *
+	 * @return    ũ⸦ ȯմϴ.
+	 */
+	int32_t GetWidth() const { return width_; }
+
+
+	/**
+	 * @brief    ũ⸦ ϴ.
+	 *
+	 * @return    ũ⸦ ȯմϴ.
+	 */
+	int32_t GetHeight() const { return height_; }
+
+
+	/**
+	 * @brief ȭ  ۸ ϴ.
+	 *
+	 * @return Ʒ    ۸ ȯմϴ.
+	 */
+	const std::vector<float>& GetDepthBuffer() const { return depthPyramid_.front().depth; }
+
+
+	/**
+	 * @brief   踦 ϴ.
+	 *
+	 * @return   踦 ȯմϴ.
+	 */
+	const Statistics& GetStatistics() const { return statistics_; }
+
+
+private:
+	/**
+	 * @brief  /ε ϰ  Դϴ.
+	 */
+	struct Occluder
+	{
+		const std::vector<StaticMesh::Vertex>* vertices;
+		const std::vector<uint32_t>* indices;
+		Matrix4x4f world;
+	};
+
+
+	/**
+	 * @brief ȭ  ȯ ﰢԴϴ.
+	 *
+	 * @note ̴ ȭ  ̹Ƿ (depthX, depthY, depthC)   մϴ.
+	 */
+	struct Triangle
+	{
+		float x[3];
+		float y[3];
+		float depthX;
+		float depthY;
+		float depthC;
+		int32_t minX;
+		int32_t minY;
+		int32_t maxX;
+		int32_t maxY;
+	};
+
+
+	/**
+	 * @brief Hi-Z Ƕ̵  ܰԴϴ.
+	 */
+	struct DepthLevel
+	{
+		int32_t width;
+		int32_t height;
+		std::vector<float> depth;
+	};
+
+
+	/**
+	 * @brief  ﰢ ȭ  ȯմϴ.
+	 *
+	 * @param occluder ȯ Դϴ.
+	 * @param outTriangles ȯ ﰢ ߰ Դϴ.
+	 */
+	void SetupTriangles(const Occluder& occluder, std::vector<Triangle>& outTriangles) const;
+
+
+	/**
+	 * @brief ŸϿ ġ ﰢ  ۿ ȭմϴ.
+	 *
+	 * @param tileX Ÿ  εԴϴ.
+	 * @param tileY Ÿ  εԴϴ.
+	 */
+	void RasterizeTile(int32_t tileX, int32_t tileY);
+
+
+	/**
+	 * @brief  ۷κ Hi-Z Ƕ̵  ܰ踦 ϴ.
+	 */
+	void BuildDepthPyramid();
+
+
+private:
+	/**
+	 * @brief    ũԴϴ.
+	 */
+	int32_t width_ = 0;
+
+
+	/**
+	 * @brief    ũԴϴ.
+	 */
+	int32_t height_ = 0;
+
+
+	/**
+	 * @brief  Ÿ Դϴ.
+	 */
+	int32_t tileCountX_ = 0;
+
+
+	/**
+	 * @brief  Ÿ Դϴ.
+	 */
+	int32_t tileCountY_ = 0;
+
+
+	/**
+	 * @brief þ İ    Դϴ.
+	 */
+	Matrix4x4f viewProjection_;
+
+
+	/**
+	 * @brief ̹ ӿ ߰  Դϴ.
+	 */
+	std::vector<Occluder> occluders_;
+
+
+	/**
+	 * @brief  ȯ ﰢ Դϴ.
+	 */
+	std::vector<std::vector<Triangle>> occluderTriangles_;
+
+
+	/**
+	 * @brief ŸϺ ġ ﰢ ( ε, ﰢ ε) Դϴ.
+	 */
+	std::vector<std::vector<std::pair<uint32_t, uint32_t>>> tileBins_;
+
+
+	/**
+	 * @brief Hi-Z Ƕ̵Դϴ. 0° ܰ谡 ȭ  Դϴ.
+	 */
+	std::vector<DepthLevel> depthPyramid_;
+
+
+	/**
+	 * @brief νϽ ü ˻ Դϴ.
+	 */
+	std::vector<uint8_t> visibleFlags_;
+
+
+	/**
+	 * @brief   Դϴ.
+	 */
+	Statistics statistics_ = { 0, 0, 0, 0 };
+};
\ No newline at end of file
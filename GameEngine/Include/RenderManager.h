@@ -1,12 +1,14 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <unordered_map>
 #include <vector>
 #include <windows.h>
 
 #include "IManager.h"
+#include "ShaderDataUtils.h"
 #include "Vector2.h"
 #include "Vector3.h"
 #include "Vector4.h"
@@ -14,9 +16,14 @@
 #include "Matrix3x3.h"
 #include "Matrix4x4.h"
 
+class GeometryPool;
+class Material;
+class RenderQueue;
+class RingBuffer;
 class Window;
 class Shader;
 class Skybox;
+class StaticBatch;
 class StaticMesh;
 class Texture2D;
 class TTFont;
@@ -87,6 +94,10 @@ public:
 	/**
 	 * @brief   մϴ.
 	 * 
+	 * @note
+	 * - ̴        ϰ, ׸  ۸ ShaderDataUtils::DRAW_BUFFER_BINDING ġ εմϴ.
+	 * - GPU  Ŵ   ϰ "Frame"  ϴ. Render* 迭 ӵ ȣ 迭 ̸  մϴ.
+	 * 
 	 * @param red   R Դϴ.
 	 * @param green   G Դϴ.
 	 * @param blue   B Դϴ.
@@ -99,10 +110,55 @@ public:
 
 	/**
 	 * @brief ۿ Ʈ ۸ մϴ.
+	 * 
+	 * @note   ̴       潺 ϰ,  ĸó Ŵ   б⸦ û  GPU  Ŵ   մϴ.
 	 */
 	void EndFrame();
 
 
+	/**
+	 * @brief  ͸ մϴ.
+	 * 
+	 * @param frameData ̴   Դϴ.
+	 * 
+	 * @note  ʹ ShaderDataUtils::FRAME_BUFFER_BINDING ġ  ۿ εǸ, Ӹ   ϸ ˴ϴ.
+	 */
+	void SetFrameData(const ShaderDataUtils::FrameData& frameData);
+
+
+	/**
+	 * @brief Ɽ մϴ.
+	 * 
+	 * @param light ̴  ⱤԴϴ.
+	 * 
+	 * @note Ɽ ShaderDataUtils::DirectionalLightData ̾ƿ ShaderDataUtils::DIRECTIONAL_LIGHT_BUFFER_BINDING ġ  ۿ ε˴ϴ.
+	 */
+	void SetDirectionalLight(const DirectionalLight& light);
+
+
+	/**
+	 * @brief  н þ İ   մϴ.
+	 * 
+	 * @param view  н þ Դϴ.
+	 * @param projection  н  Դϴ.
+	 * 
+	 * @note
+	 * - н ʹ ShaderDataUtils::PASS_BUFFER_BINDING ġ  ۿ ε˴ϴ.
+	 * - þ İ    ޴ ׸ ޼(: RenderLine3D, RenderSkybox3D) ׸Ⱑ   н ͸ ٽ εմϴ.
+	 */
+	void SetPassData(const Matrix4x4f& view, const Matrix4x4f& projection);
+
+
+	/**
+	 * @brief ׸ ͸ ߰մϴ.
+	 * 
+	 * @param world ׸  Դϴ.
+	 * 
+	 * @return ̴ gl_BaseInstance ޹ ׸  ε ȯմϴ.
+	 */
+	uint32_t PushDrawData(const Matrix4x4f& world);
+
+
 	/**
 	 * @brief  Ʈ մϴ.
 	 * 
@@ -160,6 +216,16 @@ public:
 	void Resize();
 
 
+	/**
+	 * @brief  OpenGL ؽƮ Ȯ ϴ Ȯմϴ.
+	 *
+	 * @param extension Ȯ Ȯ ̸Դϴ. ) "GL_ARB_bindless_texture"
+	 *
+	 * @return Ȯ Ѵٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsSupportExtension(const char* extension) const;
+
+
 	/**
 	 * @brief ȭ鿡 2D  ׸ϴ.
 	 *
@@ -628,17 +694,88 @@ public:
 	 * 
 	 * @param mesh ȭ鿡 ׸  ޽Դϴ.
 	 * 
-	 * @note  ޼ ȣ   ̴ ο εǾ ־ մϴ.
+	 * @note
+	 * -  ޼ ȣ   ̴ ο εǾ ־ մϴ.
+	 * -    ׸  ۿ ߰ϸ, ̴ gl_BaseInstance ° ׸ ͷ մϴ.
 	 */
 	void RenderStaticMesh3D(const StaticMesh* mesh);
 
 
+	/**
+	 * @brief StaticMesh  İ Բ ȭ鿡 ׸ϴ.
+	 * 
+	 * @param mesh ȭ鿡 ׸  ޽Դϴ.
+	 * @param world  ޽  Դϴ.
+	 * 
+	 * @note
+	 * -  ޼ ȣ   ̴ ο εǾ ־ մϴ.
+	 * -   ׸  ۿ ߰Ǹ, ̴ gl_BaseInstance ° ׸ ͷ մϴ.
+	 */
+	void RenderStaticMesh3D(const StaticMesh* mesh, const Matrix4x4f& world);
+
+
+	/**
+	 * @brief Ʈ Ǯ  ׸    ȣ ȭ鿡 ׸ϴ.
+	 * 
+	 * @param geometryPool ȭ鿡 ׸ Ʈ ǮԴϴ.
+	 * 
+	 * @note
+	 * -  ޼ ȣ   ̴ ο εǾ ־ մϴ.
+	 * - ׸   ׸ ʹ ׸  ۿ ߰Ǹ, ̴ gl_BaseInstance ° ׸ ͷ մϴ.
+	 * - ׸Ⱑ  Ʈ Ǯ ׸  ǹǷ,    н ׸  ֽϴ.
+	 */
+	void RenderGeometryPool3D(GeometryPool* geometryPool);
+
+
+	/**
+	 * @brief  ġ ü ȭ鿡 ׸ϴ.
+	 * 
+	 * @param staticBatch ȭ鿡 ׸  ġԴϴ.
+	 * 
+	 * @note
+	 * -  ޼ ȣ   ̴ ο εǾ ־ մϴ.
+	 * -  ġ   ǥ迡 Ƿ,    ׸  ۿ ߰ϸ ̴ gl_BaseInstance ° ׸ ͷ մϴ.
+	 */
+	void RenderStaticBatch3D(const StaticBatch* staticBatch);
+
+
+	/**
+	 * @brief  ġ  ̴  ޽ø ȭ鿡 ׸ϴ.
+	 * 
+	 * @param staticBatch ȭ鿡 ׸  ġԴϴ.
+	 * @param subMeshIndices ȭ鿡 ׸  ޽ ε Դϴ.
+	 * 
+	 * @note
+	 * -  ޼ ȣ   ̴ ο εǾ ־ մϴ.
+	 * -  ġ   ǥ迡 Ƿ,    ׸  ۿ ߰ϸ ̴ gl_BaseInstance ° ׸ ͷ մϴ.
+	 * -  ޽   ׸   glMultiDrawElementsIndirect   ׸ϴ.
+	 */
+	void RenderStaticBatch3D(const StaticBatch* staticBatch, const std::vector<uint32_t>& subMeshIndices);
+
+
+	/**
+	 * @brief  ť ׸ ׸  ȭ鿡 ׸ϴ.
+	 * 
+	 * @param renderQueue ȭ鿡 ׸  ťԴϴ. Ϲ    ťԴϴ.
+	 * @param bindMaterial ̴  ٲ  ȣ   ԼԴϴ. ʿ ٸ nullptrԴϴ.
+	 * 
+	 * @note
+	 * - ̴  迭 Ʈ ٲ  ٽ εմϴ.
+	 * - ׸ ׸   ׸  ۿ ߰Ǹ, ̴ gl_BaseInstance ° ׸ ͷ մϴ.
+	 * -  н ׸   Ȱȭϰ  ⸦  · ׸ϴ.
+	 * - ũ   ̴ ׸ ׸ ǳʶݴϴ.
+	 */
+	void RenderQueue3D(const RenderQueue* renderQueue, const std::function<void(Shader*, const Material*)>& bindMaterial = nullptr);
+
+
 	/**
 	 * @brief ī ڽ ȭ鿡 ׸ϴ.
 	 * 
 	 * @param view þ Դϴ.
 	 * @param projection  Դϴ.
 	 * @param skybox ȭ鿡 ׸ ī ڽԴϴ.
+	 * 
+	 * @note þ İ   ī ڽ ׸ ȿ ϸ, ׸Ⱑ  SetPassData  н ͸ ٽ εմϴ.
 	 */
 	void RenderSkybox3D(const Matrix4x4f& view, const Matrix4x4f& projection, const Skybox* skybox);
 
@@ -650,6 +787,41 @@ private:
 	DEFAULT_CONSTRUCTOR_AND_VIRTUAL_DESTRUCTOR(RenderManager);
 
 
+	/**
+	 * @brief  ̴  غǸ ̴ ε ð   մϴ.
+	 *
+	 * @note ̴  ҽ ε  ǹǷ,   ̴ غ ù ӿ   մϴ.
+	 */
+	void ReportShaderStartup();
+
+
+	/**
+	 * @brief н ͸   ۿ մϴ.
+	 *
+	 * @param view  н þ Դϴ.
+	 * @param projection  н  Դϴ.
+	 *
+	 * @return  н     ȯմϴ.
+	 */
+	uint32_t WritePassData(const Matrix4x4f& view, const Matrix4x4f& projection);
+
+
+	/**
+	 * @brief   ۿ  н ͸ εմϴ.
+	 *
+	 * @param offset ε н    Դϴ.
+	 */
+	void BindPassData(uint32_t offset);
+
+
+	/**
+	 * @brief SetPassData  н ͸ ٽ εմϴ.
+	 *
+	 * @note ̹ ӿ  н Ͱ ٸ ƹ͵  ʽϴ.
+	 */
+	void RestorePassData();
+
+
 private:
 	/**
 	 * @brief   Ǵ  Դϴ.
@@ -695,6 +867,8 @@ private:
 
 	/**
 	 * @brief ̴ ҽ Դϴ.
+	 *
+	 * @note  shaderPath    ̺귯 Ե ̴  Դϴ.
 	 */
 	std::wstring shaderPath_;
 
@@ -705,8 +879,44 @@ private:
 	std::unordered_map<std::wstring, Shader*> shaderCache_;
 
 
+	/**
+	 * @brief ̴ ε ð ߴ Ȯմϴ.
+	 */
+	bool bIsReportShaderStartup_ = false;
+
+
 	/**
 	 * @brief  ũ ϴ   Դϴ.
 	 */
 	Matrix4x4f screenOrtho_;
+
+
+	/**
+	 * @brief  Ϳ н ͸   Դϴ.
+	 */
+	RingBuffer* uniformRingBuffer_ = nullptr;
+
+
+	/**
+	 * @brief ׸ ͸   Դϴ.
+	 */
+	RingBuffer* drawRingBuffer_ = nullptr;
+
+
+	/**
+	 * @brief  ׸    Դϴ.
+	 */
+	RingBuffer* drawCommandRingBuffer_ = nullptr;
+
+
+	/**
+	 * @brief SetPassData  н    Դϴ.
+	 */
+	uint32_t passDataOffset_ = 0;
+
+
+	/**
+	 * @brief ̹ ӿ SetPassData н ͸ ߴ Դϴ.
+	 */
+	bool bHasPassData_ = false;
 };
\ No newline at end of file
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Macro.h"
+#include "Matrix4x4.h"
+#include "Vector3.h"
+
+class Material;
+class Shader;
+class StaticMesh;
+
+
+/**
+ * @brief  ť ߰ ׸ ׸ нԴϴ.
+ *
+ * @note н    ׷ϴ.
+ */
+enum class ERenderPass : int32_t
+{
+	Opaque      = 0x00,
+	Translucent = 0x01,
+};
+
+
+/**
+ * @brief 3D ׸ ׸  64Ʈ  Ű ϴ  ťԴϴ.
+ *
+ * @note
+ * -  Ű  Ʈ (н, ̴, , ޽, ȭ ) Դϴ.
+ * -  ׸ ̴//޽    տ ڷ(Front-to-Back) Ͽ Early-Z Ȱմϴ.
+ * -  ׸ ùٸ   ̸ 켱Ͽ ڿ (Back-to-Front) մϴ.
+ * -   (Radix Sort) ϸ, GPU ҽ  Ƿ CPU 󿡼 ܵ   ֽϴ.
+ */
+class RenderQueue
+{
+public:
+	/**
+	 * @brief  ť ׸ ׸Դϴ.
+	 */
+	struct DrawItem
+	{
+		uint64_t key;
+		ERenderPass pass;
+		Shader* shader;
+		const StaticMesh* mesh;
+		const Material* material;
+		Matrix4x4f world;
+	};
+
+
+	/**
+	 * @brief     Ƚ  Ű ̵ ģ ׸ ׸ Դϴ.
+	 */
+	struct Statistics
+	{
+		uint32_t itemCount;
+		uint32_t unsortedStateChangeCount;
+		uint32_t sortedStateChangeCount;
+		uint32_t sortedShaderChangeCount;
+		uint32_t sortedMaterialChangeCount;
+		uint32_t sortedMeshChangeCount;
+		uint32_t overflowItemCount;
+	};
+
+
+public:
+	/**
+	 * @brief  ť Ʈ Դϴ.
+	 */
+	RenderQueue() = default;
+
+
+	/**
+	 * @brief  ť  ҸԴϴ.
+	 */
+	virtual ~RenderQueue() {}
+
+
+	/**
+	 * @brief  ť  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(RenderQueue);
+
+
+	/**
+	 * @brief ο  ׸ ׸  մϴ.
+	 *
+	 * @param view ̸  þ Դϴ.
+	 * @param nearZ ̸ ȭ   ŸԴϴ.
+	 * @param farZ ̸ ȭ   ŸԴϴ.
+	 *
+	 * @note  ӿ  ׸ ׸  ŵ˴ϴ.
+	 */
+	void Begin(const Matrix4x4f& view, float nearZ, float farZ);
+
+
+	/**
+	 * @brief ׸ ׸ ߰մϴ.
+	 *
+	 * @param pass ׸ ׸ нԴϴ.
+	 * @param shader ׸ ׸ ׸ ̴Դϴ.
+	 * @param mesh ׸  ޽Դϴ.
+	 * @param material  ޽ Դϴ.  ٸ nullptrԴϴ.
+	 * @param world  ޽  Դϴ.
+	 *
+	 * @note ̴  ޽   ߽( ڰ ٸ   ġ)  մϴ.
+	 */
+	void Submit(ERenderPass pass, Shader* shader, const StaticMesh* mesh, const Material* material, const Matrix4x4f& world);
+
+
+	/**
+	 * @brief ̸  ġ Ͽ ׸ ׸ ߰մϴ.
+	 *
+	 * @param pass ׸ ׸ нԴϴ.
+	 * @param shader ׸ ׸ ׸ ̴Դϴ.
+	 * @param mesh ׸  ޽Դϴ.
+	 * @param material  ޽ Դϴ.  ٸ nullptrԴϴ.
+	 * @param world  ޽  Դϴ.
+	 * @param position ̸   ǥ  ġԴϴ.
+	 *
+	 * @note  ޽ÿ  Ƿ,   ߽ ̹ ˰ ִٸ  ޼ ߰ϸ ˴ϴ.
+	 */
+	void Submit(ERenderPass pass, Shader* shader, const StaticMesh* mesh, const Material* material, const Matrix4x4f& world, const Vector3f& position);
+
+
+	/**
+	 * @brief  ׸ ׸  Ű մϴ.
+	 */
+	void Sort();
+
+
+	/**
+	 * @brief ׸ ׸  ϴ.
+	 *
+	 * @return Sort ȣ Ķ ĵ ׸ ׸ , ׷  ߰  ׸ ׸  ȯմϴ.
+	 */
+	const std::vector<DrawItem>& GetDrawItems() const { return drawItems_; }
+
+
+	/**
+	 * @brief     踦 ϴ.
+	 *
+	 * @return     踦 ȯմϴ.
+	 */
+	const Statistics& GetStatistics() const { return statistics_; }
+
+
+	/**
+	 * @brief ̴, , ޽ÿ Ҵ  Ű ̵  մϴ.
+	 *
+	 * @note
+	 * -  Ű ̵  ̿ ǹǷ, ҽ ũ ٲ ( ȯ ) ȣϸ ˴ϴ.
+	 * -  overflowItemCount 0 ũٸ  ̻  ʴ ҽ ̵ ϰ   Ƿ,  ޼ ̵ ٽ Ҵմϴ.
+	 */
+	void ResetSortKeyIDs();
+
+
+	/**
+	 * @brief ׸ ׸       Ƚ մϴ.
+	 *
+	 * @param drawItems   Ƚ  ׸ ׸ Դϴ.
+	 * @param outShaderChangeCount ̴  ȽԴϴ.
+	 * @param outMaterialChangeCount   ȽԴϴ.
+	 * @param outMeshChangeCount ޽( 迭 Ʈ)  ȽԴϴ.
+	 *
+	 * @return ü   Ƚ ȯմϴ.
+	 */
+	static uint32_t CountStateChanges(
+		const std::vector<DrawItem>& drawItems,
+		uint32_t& outShaderChangeCount,
+		uint32_t& outMaterialChangeCount,
+		uint32_t& outMeshChangeCount
+	);
+
+
+private:
+	/**
+	 * @brief Ϳ ϴ  Ű ̵ ϴ.
+	 *
+	 * @param ids Ϳ  Ű ̵  Դϴ.
+	 * @param ptr  Ű ̵  Դϴ.
+	 *
+	 * @return Ϳ ϴ  Ű ̵ ȯմϴ.
+	 *
+	 * @note ̵ ʵ尡 ġ ο ̵ Ҵ ʰ  ִ ȯմϴ. ģ ҽ    Ű ٸ ʵ ħ ʽϴ.
+	 */
+	static uint64_t GetSortKeyID(std::unordered_map<const void*, uint64_t>& ids, const void* ptr);
+
+
+private:
+	/**
+	 * @brief ̸  þ Դϴ.
+	 */
+	Matrix4x4f view_;
+
+
+	/**
+	 * @brief ̸ ȭ   ŸԴϴ.
+	 */
+	float nearZ_ = 0.1f;
+
+
+	/**
+	 * @brief ̸ ȭ   ŸԴϴ.
+	 */
+	float farZ_ = 100.0f;
+
+
+	/**
+	 * @brief ׸ ׸ Դϴ.
+	 */
+	std::vector<DrawItem> drawItems_;
+
+
+	/**
+	 * @brief Ŀ  ӽ ׸ ׸ Դϴ.
+	 */
+	std::vector<DrawItem> sortBuffer_;
+
+
+	/**
+	 * @brief ̴ Ϳ ϴ  Ű ̵Դϴ.
+	 */
+	std::unordered_map<const void*, uint64_t> shaderIDs_;
+
+
+	/**
+	 * @brief  Ϳ ϴ  Ű ̵Դϴ.
+	 */
+	std::unordered_map<const void*, uint64_t> materialIDs_;
+
+
+	/**
+	 * @brief ޽ Ϳ ϴ  Ű ̵Դϴ.
+	 */
+	std::unordered_map<const void*, uint64_t> meshIDs_;
+
+
+	/**
+	 * @brief     Դϴ.
+	 */
+	Statistics statistics_ = { 0, 0, 0, 0, 0, 0, 0 };
+};
\ No newline at end of file
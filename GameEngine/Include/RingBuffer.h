@@ -0,0 +1,157 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "IResource.h"
+
+
+/**
+ * @brief Ӹ ٲ ̴ ͸   (Persistent Mapping)  Դϴ.
+ *
+ * @note
+ * - ۸ FRAME_COUNT   , Ӹ   ͸  ϴ.
+ * -  ٽ ϱ       潺(Fence) ٸǷ, GPU д  ͸  ʽϴ.
+ * - ۴   ϰ  , ϰ(Coherent)  ϹǷ    ÷ð ʿ ϴ.
+ * -  Ʈ Ÿ꿡  Ƿ  ۿ ̴ 丮   ε ε  ֽϴ.
+ *
+ * @see https://www.khronos.org/opengl/wiki/Buffer_Object_Streaming#Persistent_mapping
+ */
+class RingBuffer : public IResource
+{
+public:
+	/**
+	 * @brief     Դϴ.
+	 */
+	static const uint32_t FRAME_COUNT = 3;
+
+
+public:
+	/**
+	 * @brief   Ʈ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	RingBuffer() = default;
+
+
+	/**
+	 * @brief    ҸԴϴ.
+	 *
+	 * @note   ο Ҵ Ҹ ϱ ؼ ݵ Release ȣؾ մϴ.
+	 */
+	virtual ~RingBuffer();
+
+
+	/**
+	 * @brief    ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(RingBuffer);
+
+
+	/**
+	 * @brief  ۸ ʱȭմϴ.
+	 *
+	 * @param frameSize   ϳ Ʈ ũԴϴ.
+	 * @param alignment Ҵϴ  Ʈ  Դϴ.
+	 */
+	void Initialize(uint32_t frameSize, uint32_t alignment);
+
+
+	/**
+	 * @brief    ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief     մϴ.
+	 *
+	 * @note     GPU   ٸϴ.
+	 */
+	void BeginFrame();
+
+
+	/**
+	 * @brief      潺 մϴ.
+	 */
+	void EndFrame();
+
+
+	/**
+	 * @brief    ͸ ϴ.
+	 *
+	 * @param data  Դϴ.
+	 * @param size   Ʈ ũԴϴ.
+	 *
+	 * @return ͸    Ʈ  ȯմϴ.  alignment Դϴ.
+	 */
+	uint32_t Write(const void* data, uint32_t size);
+
+
+	/**
+	 * @brief    Ʈ ϴ.
+	 *
+	 * @return    Ʈ ȯմϴ.
+	 */
+	uint32_t GetBufferObject() const { return bufferObject_; }
+
+
+	/**
+	 * @brief   ü Ʈ ũ⸦ ϴ.
+	 *
+	 * @return   ü Ʈ ũ⸦ ȯմϴ.
+	 */
+	uint32_t GetBufferSize() const { return frameSize_ * FRAME_COUNT; }
+
+
+	/**
+	 * @brief       ִ Ʈ ũ⸦ ϴ.
+	 *
+	 * @return       ִ Ʈ ũ⸦ ȯմϴ.
+	 */
+	uint32_t GetFrameRemainSize() const { return frameSize_ - frameOffset_; }
+
+
+private:
+	/**
+	 * @brief   ϳ Ʈ ũԴϴ.
+	 */
+	uint32_t frameSize_ = 0;
+
+
+	/**
+	 * @brief Ҵϴ  Ʈ  Դϴ.
+	 */
+	uint32_t alignment_ = 0;
+
+
+	/**
+	 * @brief    εԴϴ.
+	 */
+	uint32_t frameIndex_ = 0;
+
+
+	/**
+	 * @brief       Ʈ Դϴ.
+	 */
+	uint32_t frameOffset_ = 0;
+
+
+	/**
+	 * @brief   潺Դϴ.
+	 */
+	std::array<void*, FRAME_COUNT> fences_ = { nullptr, };
+
+
+	/**
+	 * @brief     ּԴϴ.
+	 */
+	uint8_t* mappedBuffer_ = nullptr;
+
+
+	/**
+	 * @brief    ƮԴϴ.
+	 */
+	uint32_t bufferObject_ = 0;
+};
\ No newline at end of file
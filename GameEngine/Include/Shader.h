@@ -1,7 +1,7 @@
 #pragma once
 
 #include <string>
-#include <map>
+#include <vector>
 
 #include "IResource.h"
 #include "Matrix2x2.h"
@@ -28,6 +28,36 @@ public:
 	};
 
 
+	/**
+	 * @brief ũ  ÷    ڵԴϴ.
+	 *
+	 * @note
+	 * - ڵ ̸  ̴ α׷ ȿմϴ.
+	 * - ̴ ų Ϸ    ڵ ȿ ,  ڵ  ϸ õ˴ϴ.
+	 */
+	struct UniformHandle
+	{
+		int32_t location = -1;
+		uint32_t type = 0;
+
+		bool IsValid() const { return location >= 0; }
+	};
+
+
+	/**
+	 * @brief ̴ α׷   Դϴ.
+	 *
+	 * @note 迭   "name", "name[0]", "name[i]" ̸ η ϵ˴ϴ.
+	 */
+	struct UniformInfo
+	{
+		uint32_t id = 0;
+		std::string name;
+		UniformHandle handle;
+		int32_t arraySize = 0;
+	};
+
+
 public:
 	/**
 	 * @brief ̴ Ʈ Դϴ.
@@ -56,18 +86,58 @@ public:
 	 * 
 	 * @param vsFile ؽ ̴ Ȯ(.vert)  Դϴ.
 	 * @param fsFile ׸Ʈ ̴ Ȯ(.frag)  Դϴ.
+	 *
+	 * @note
+	 * - ϰ ũ ̹ ⸸ ϰ,  IsReady Ȥ WaitForReady ȣ  Ȯմϴ.
+	 * -  ̴   ʱȭ   Ȯϸ, ̹ ̴ ķ   ֽϴ.
+	 * -  Ȯϱ  Bind, GetUniformHandle ȣϸ ũ   ٸϴ.
 	 */
 	virtual void Initialize(const std::wstring& vsPath, const std::wstring& fsPath);
 
 
+	/**
+	 * @brief ũ Ǹ ߰Ͽ GLSL ̴ ҽ  ϰ ̴ α׷ մϴ.
+	 *
+	 * @param vsFile ؽ ̴ Ȯ(.vert)  Դϴ.
+	 * @param fsFile ׸Ʈ ̴ Ȯ(.frag)  Դϴ.
+	 * @param defines  ̴ ܰ迡 ߰ ũ  Դϴ. "NAME" Ȥ "NAME=VALUE" Դϴ.
+	 *
+	 * @note ̴ ҽ ShaderPreprocessUtils #include ġ ũ Ǹ ߰  մϴ.
+	 *
+	 * @see ShaderPreprocessUtils
+	 */
+	void Initialize(const std::wstring& vsPath, const std::wstring& fsPath, const std::vector<std::string>& defines);
+
+
 	/**
 	 * @brief ̴  ҽ Ҵ մϴ.
 	 */
 	virtual void Release() override;
 
 
+	/**
+	 * @brief ̴ α׷ ũ  Ȯմϴ.
+	 *
+	 * @return ũ  ̴   ִٸ true,   ̶ false ȯմϴ.
+	 *
+	 * @note
+	 * -  ̴ (GL_KHR_parallel_shader_compile) ϸ ٸ ʰ  ¸ ȯմϴ.
+	 * -  ̴    ũ   ٸ  true ȯմϴ.
+	 * -  false ȯ ̴ ׸⸦ ǳʶݴϴ.
+	 */
+	bool IsReady();
+
+
+	/**
+	 * @brief ̴ α׷ ũ   ٸϴ.
+	 */
+	void WaitForReady();
+
+
 	/**
 	 * @brief ̴ ο εմϴ.
+	 *
+	 * @note ̴ α׷ ũ  ʾҴٸ   ٸϴ.
 	 */
 	void Bind();
 
@@ -252,6 +322,184 @@ public:
 	void SetUniform(const std::string& name, const Matrix4x4f& value);
 
 
+	/**
+	 * @brief ̴  boolean Ÿ   ڵ մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 *
+	 * @note
+	 * - ڿ ȸ   ϹǷ,   ȣϴ ο ڵ ̸ ΰ  ޼带 մϴ.
+	 * - Ǽ Ÿ԰  Ÿ   Ÿ԰ ġϴ ˻մϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, bool value);
+
+
+	/**
+	 * @brief ̴  int Ÿ   ڵ մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, int32_t value);
+	
+
+	/**
+	 * @brief ̴  float Ÿ   ڵ մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, float value);
+
+	
+	/**
+	 * @brief ̴  2  Ÿ   ڵ մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, const Vector2f& value);
+	
+
+	/**
+	 * @brief ̴  2  Ÿ   ڵ մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param x   x Դϴ.
+	 * @param y   y Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, float x, float y);
+	
+
+	/**
+	 * @brief ̴  2  Ÿ   ڵ մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, const Vector2i& value);
+
+
+	/**
+	 * @brief ̴  2  Ÿ   ڵ մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param x   x Դϴ.
+	 * @param y   y Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, int32_t x, int32_t y);
+
+
+	/**
+	 * @brief ̴  3  Ÿ   ڵ մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, const Vector3f& value);
+	
+
+	/**
+	 * @brief ̴  3  Ÿ   ڵ մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param x   x Դϴ.
+	 * @param y   y Դϴ.
+	 * @param z   z Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, float x, float y, float z);
+	
+
+	/**
+	 * @brief ̴  3  Ÿ   ڵ մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, const Vector3i& value);
+
+	
+	/**
+	 * @brief ̴  3  Ÿ   ڵ մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param x   x Դϴ.
+	 * @param y   y Դϴ.
+	 * @param z   z Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, int32_t x, int32_t y, int32_t z);
+	
+
+	/**
+	 * @brief ̴  4  Ÿ   ڵ մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, const Vector4f& value);
+	
+
+	/**
+	 * @brief ̴  4  Ÿ   ڵ մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param x   x Դϴ.
+	 * @param y   y Դϴ.
+	 * @param z   z Դϴ.
+	 * @param w   w Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, float x, float y, float z, float w);
+	
+
+	/**
+	 * @brief ̴  4  Ÿ   ڵ մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, const Vector4i& value);
+
+
+	/**
+	 * @brief ̴  4  Ÿ   ڵ մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param x   x Դϴ.
+	 * @param y   y Դϴ.
+	 * @param z   z Դϴ.
+	 * @param w   w Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, int32_t x, int32_t y, int32_t z, int32_t w);
+
+
+	/**
+	 * @brief ̴  2x2 Ÿ    ڵ մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, const Matrix2x2f& value);
+
+
+	/**
+	 * @brief ̴  3x3 Ÿ    ڵ մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, const Matrix3x3f& value);
+
+
+	/**
+	 * @brief ̴  4x4 Ÿ    ڵ մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, const Matrix4x4f& value);
+
+
 	/**
 	 * @brief ̴   ü ġ ϴ.
 	 *
@@ -264,6 +512,81 @@ public:
 	int32_t GetUniformLocation(const std::string& uniformName);
 
 
+	/**
+	 * @brief ̴    ڵ ϴ.
+	 *
+	 * @param uniformName ڵ ã ̴   ̸Դϴ.
+	 *
+	 * @return ̴    ڵ ȯմϴ. ã ϸ ȿ  ڵ ȯմϴ.
+	 *
+	 * @note
+	 * - OpenGL API ȣ ʰ ũ  ÷ Ͽ ãϴ.
+	 * - ̴ α׷ ũ  ʾҴٸ   ٸϴ.
+	 */
+	UniformHandle GetUniformHandle(const std::string& uniformName);
+
+
+	/**
+	 * @brief ̴    ڵ ϴ.
+	 *
+	 * @param uniformID GetUniformID   ̸ ؽ Դϴ.
+	 *
+	 * @return ̴    ڵ ȯմϴ. ã ϸ ȿ  ڵ ȯմϴ.
+	 */
+	UniformHandle GetUniformHandle(uint32_t uniformID);
+
+
+	/**
+	 * @brief ũ  ÷    ϴ.
+	 *
+	 * @return ID  ĵ    ȯմϴ.     ʽϴ.
+	 */
+	const std::vector<UniformInfo>& GetUniforms()
+	{
+		WaitForReady();
+		return uniforms_;
+	}
+
+
+	/**
+	 * @brief  ̸ ؽ (FNV-1a) մϴ.
+	 *
+	 * @param uniformName ؽ    ̸Դϴ.
+	 *
+	 * @return  ̸ ؽ  ȯմϴ.
+	 *
+	 * @note ڿ ͷ ȣϸ   ˴ϴ.
+	 */
+	static constexpr uint32_t GetUniformID(const char* uniformName)
+	{
+		uint32_t hash = 2166136261u;
+		for (; *uniformName != '\0'; ++uniformName)
+		{
+			hash = (hash ^ static_cast<uint8_t>(*uniformName)) * 16777619u;
+		}
+
+		return hash;
+	}
+
+
+	/**
+	 * @brief ̹  ̴   θ մϴ.
+	 *
+	 * @param bIsEnable  ̴   Դϴ.
+	 *
+	 * @note  Ŵ GL_KHR_parallel_shader_compile Ȥ GL_ARB_parallel_shader_compile Ȯ ȮϿ մϴ.
+	 */
+	static void SetParallelCompileMode(bool bIsEnable) { bIsEnableParallelCompile_ = bIsEnable; }
+
+
+	/**
+	 * @brief ̹  ̴   θ ϴ.
+	 *
+	 * @return  ̴  Ѵٸ true, ׷  false ȯմϴ.
+	 */
+	static bool IsEnableParallelCompile() { return bIsEnableParallelCompile_; }
+
+
 protected:
 	/**
 	 * @brief ؽ  ̳ ؽ ۸ ϴ.
@@ -275,11 +598,21 @@ protected:
 	void WriteDynamicVertexBuffer(uint32_t vertexBufferID, const void* vertexPtr, uint32_t bufferByteSize);
 
 
+	/**
+	 * @brief ̴ α׷ ũ    ÷  ȣ˴ϴ.
+	 *
+	 * @note  Ŭ  ޼忡   ڵ ϴ.
+	 */
+	virtual void OnReady() {}
+
+
 private:
 	/**
-	 * @brief ̴ ü ϰ ̴ ҽ մϴ.
+	 * @brief ̴ ü ϰ ̴ ҽ  մϴ.
 	 *
-	 * @note ̴ ü  ϸ 0 ƴ  ȯմϴ.
+	 * @note
+	 * - ̴ ü  ϸ 0 ƴ  ȯմϴ.
+	 * -   FinishLink Ȯմϴ.
 	 *
 	 * @param type ̴ ŸԴϴ.
 	 * @param source ̴ ҽԴϴ.
@@ -289,6 +622,22 @@ private:
 	uint32_t CreateAndCompileShader(const EType& type, const std::string& source);
 
 
+	/**
+	 * @brief  ̴ α׷ ũ  Ȯϰ   ֵ մϴ.
+	 *
+	 * @note ũ  ʾҴٸ   ٸϴ.
+	 */
+	void FinishLink();
+
+
+	/**
+	 * @brief ũ ̴ α׷    ȸմϴ.
+	 *
+	 * @see https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGetProgramInterface.xhtml
+	 */
+	void ReflectUniforms();
+
+
 private:
 	/**
 	 * @brief ̴ α׷ ̵Դϴ.
@@ -297,7 +646,67 @@ private:
 
 
 	/**
-	 * @brief   ġԴϴ.
+	 * @brief ũ  Ȯϱ  ϴ ؽ ̴ ̵Դϴ.
+	 */
+	uint32_t vsID_ = 0;
+
+
+	/**
+	 * @brief ũ  Ȯϱ  ϴ ׸Ʈ ̴ ̵Դϴ.
+	 */
+	uint32_t fsID_ = 0;
+
+
+	/**
+	 * @brief ̴ ĳÿ ϱ  ũ  Ȯϱ  ϴ ؽ ̴ ҽԴϴ.
+	 */
+	std::string vsSource_;
+
+
+	/**
+	 * @brief ̴ ĳÿ ϱ  ũ  Ȯϱ  ϴ ׸Ʈ ̴ ҽԴϴ.
+	 */
+	std::string fsSource_;
+
+
+	/**
+	 * @brief   ġ ǵ  ũ  Ȯϱ  ϴ ؽ ̴  Դϴ.
+	 */
+	std::vector<std::wstring> vsFiles_;
+
+
+	/**
+	 * @brief   ġ ǵ  ũ  Ȯϱ  ϴ ׸Ʈ ̴  Դϴ.
+	 */
+	std::vector<std::wstring> fsFiles_;
+
+
+	/**
+	 * @brief ĳõ ̳ʸ ̴ α׷ ũߴ Ȯմϴ.
+	 */
+	bool bIsCacheHit_ = false;
+
+
+	/**
+	 * @brief ̴ α׷ ũ    ִ Ȯմϴ.
+	 */
+	bool bIsReady_ = false;
+
+
+	/**
+	 * @brief ̴ α׷ ε  尡    ðԴϴ.
+	 */
+	float loadSeconds_ = 0.0f;
+
+
+	/**
+	 * @brief ID  ĵ   Դϴ.
+	 */
+	std::vector<UniformInfo> uniforms_;
+
+
+	/**
+	 * @brief ̹  ̴   Դϴ.
 	 */
-	std::map<std::string, uint32_t> uniformLocationCache_;
+	static bool bIsEnableParallelCompile_;
 };
\ No newline at end of file
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include "IResource.h"
+
+
+/**
+ * @brief  ũ ׸ ϳ   Ǵ ̴ 丮 ۿ , ٲ ׸ ٽ εϴ  ǮԴϴ.
+ *
+ * @note
+ * - CPU   纻 ϸ, Update  Ͱ 纻 ٸ  ׸   ǥմϴ.
+ * - Flush   ׸ ε  ϰ,  ׸  glBufferSubData εմϴ.
+ * -   Ǯ ׸  GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT ߹Ƿ, BindElement ׸⸶ ׸ ϳ ε  ֽϴ.
+ * - ̴ 丮  Ǯ ׸  ׸ ũ Ƿ, Bind  ü εϰ ̴ 迭   ֽϴ.
+ * - ׸ ID  ִ   ε Ҵմϴ.
+ */
+class ShaderBufferPool : public IResource
+{
+public:
+	/**
+	 * @brief  Ǯ  Դϴ.
+	 */
+	enum class EType : int32_t
+	{
+		Uniform       = 0x00,
+		ShaderStorage = 0x01,
+	};
+
+
+public:
+	/**
+	 * @brief  Ǯ Ʈ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	ShaderBufferPool() = default;
+
+
+	/**
+	 * @brief  Ǯ  ҸԴϴ.
+	 *
+	 * @note  Ǯ ο Ҵ Ҹ ϱ ؼ ݵ Release ȣؾ մϴ.
+	 */
+	virtual ~ShaderBufferPool();
+
+
+	/**
+	 * @brief  Ǯ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(ShaderBufferPool);
+
+
+	/**
+	 * @brief  Ǯ ʱȭմϴ.
+	 *
+	 * @param type  Ǯ  Դϴ.
+	 * @param elementSize ׸ ϳ Ʈ ũԴϴ. 16  մϴ.
+	 * @param capacity  Ǯ   ִ ִ ׸ Դϴ.
+	 */
+	void Initialize(const EType& type, uint32_t elementSize, uint32_t capacity);
+
+
+	/**
+	 * @brief  Ǯ  ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief  Ǯ ׸ Ҵմϴ.
+	 *
+	 * @return Ҵ ׸ ID ȯմϴ. Ҵ ׸ ʹ 0 ʱȭǾ ֽϴ.
+	 */
+	int32_t Allocate();
+
+
+	/**
+	 * @brief  Ǯ ׸ Ҵ մϴ.
+	 *
+	 * @param elementID Ҵ  ׸ IDԴϴ.
+	 */
+	void Free(int32_t elementID);
+
+
+	/**
+	 * @brief ׸ ͸ մϴ.
+	 *
+	 * @param elementID  ׸ IDԴϴ.
+	 * @param data ׸  Դϴ. ũ elementSize ƾ մϴ.
+	 *
+	 * @note Ͱ ٲ ʾҴٸ ׸   ǥ ʽϴ.
+	 */
+	void Update(int32_t elementID, const void* data);
+
+
+	/**
+	 * @brief   ǥõ ׸ ۿ εմϴ.
+	 */
+	void Flush();
+
+
+	/**
+	 * @brief  ü ε ġ εմϴ.
+	 *
+	 * @param binding ε ġԴϴ.
+	 */
+	void Bind(uint32_t binding);
+
+
+	/**
+	 * @brief ׸ ϳ ε ġ εմϴ.
+	 *
+	 * @param binding ε ġԴϴ.
+	 * @param elementID ε ׸ IDԴϴ.
+	 */
+	void BindElement(uint32_t binding, int32_t elementID);
+
+
+	/**
+	 * @brief ׸ ҴǾ ִ Ȯմϴ.
+	 *
+	 * @param elementID Ȯ ׸ IDԴϴ.
+	 *
+	 * @return ׸ ҴǾ ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsValidElement(int32_t elementID) const;
+
+
+	/**
+	 * @brief   ׸  Ʈ  ϴ.
+	 *
+	 * @return   ׸  Ʈ  ȯմϴ.
+	 */
+	uint32_t GetStride() const { return stride_; }
+
+
+	/**
+	 * @brief  ε  ׸  ϴ.
+	 *
+	 * @return  ε  ׸  ȯմϴ.
+	 */
+	uint32_t GetDirtyCount() const { return static_cast<uint32_t>(dirtyElements_.size()); }
+
+
+	/**
+	 * @brief  Ʈ ϴ.
+	 *
+	 * @return  Ʈ ȯմϴ.
+	 */
+	uint32_t GetBufferObject() const { return bufferObject_; }
+
+
+private:
+	/**
+	 * @brief  Ǯ  Դϴ.
+	 */
+	EType type_ = EType::Uniform;
+
+
+	/**
+	 * @brief ׸ ϳ Ʈ ũԴϴ.
+	 */
+	uint32_t elementSize_ = 0;
+
+
+	/**
+	 * @brief   ׸  Ʈ Դϴ.
+	 */
+	uint32_t stride_ = 0;
+
+
+	/**
+	 * @brief  Ǯ   ִ ִ ׸ Դϴ.
+	 */
+	uint32_t capacity_ = 0;
+
+
+	/**
+	 * @brief  ̶ Ҵ ׸   ū ID  Դϴ.
+	 */
+	uint32_t elementCount_ = 0;
+
+
+	/**
+	 * @brief CPU   纻Դϴ.
+	 */
+	std::vector<uint8_t> shadowBuffer_;
+
+
+	/**
+	 * @brief ׸ Ҵ Դϴ.
+	 */
+	std::vector<uint8_t> allocatedFlags_;
+
+
+	/**
+	 * @brief ׸   Դϴ.
+	 */
+	std::vector<uint8_t> dirtyFlags_;
+
+
+	/**
+	 * @brief   ׸ ID Դϴ.
+	 */
+	std::vector<int32_t> dirtyElements_;
+
+
+	/**
+	 * @brief Ҵ  ׸ ID Դϴ.   ID ϴ.
+	 */
+	std::priority_queue<int32_t, std::vector<int32_t>, std::greater<int32_t>> freeElements_;
+
+
+	/**
+	 * @brief  ƮԴϴ.
+	 */
+	uint32_t bufferObject_ = 0;
+};
\ No newline at end of file
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+
+/**
+ * @brief ũ ̴ α׷ ̳ʸ ũ ĳϴ Ȯ  մϴ.
+ *
+ * @note
+ * - ĳ     ShaderCache 丮 մϴ.
+ * - ĳ Ű ̴ ҽ ̹ // ڿ ؽ Դϴ.
+ * - ̹ ĳõ ̳ʸ źϸ ҽ Ϸ ǵư,  ũ ̳ʸ ĳø մϴ.
+ * - ĳø (ShaderCache 丮 )   ݵ ŸƮ ˴ϴ.
+ *
+ * @see https://registry.khronos.org/OpenGL-Refpages/gl4/html/glProgramBinary.xhtml
+ */
+namespace ShaderCacheUtils
+{
+	/**
+	 * @brief ̴ α׷ ε Դϴ.
+	 */
+	struct Statistics
+	{
+		uint32_t hitCount;
+		uint32_t missCount;
+		float hitSeconds;
+		float missSeconds;
+	};
+
+
+	/**
+	 * @brief ̴ ĳø ʱȭմϴ.
+	 *
+	 * @note
+	 * - OpenGL ؽƮ   ̴ ϱ  ȣؾ մϴ.
+	 * - ̹ α׷ ̳ʸ    ĳø  ʽϴ.
+	 */
+	void Initialize();
+
+
+	/**
+	 * @brief ̴ ĳø   ִ Ȯմϴ.
+	 *
+	 * @return ̴ ĳø   ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsEnable();
+
+
+	/**
+	 * @brief ĳõ ̳ʸ ̴ α׷ ũմϴ.
+	 *
+	 * @param programID ̳ʸ  ̴ α׷ ̵Դϴ.
+	 * @param vsSource ؽ ̴ ҽԴϴ.
+	 * @param fsSource ׸Ʈ ̴ ҽԴϴ.
+	 *
+	 * @return ĳõ ̳ʸ ũ ߴٸ true, ĳð ų ̹ źߴٸ false ȯմϴ.
+	 */
+	bool LoadProgramBinary(uint32_t programID, const std::string& vsSource, const std::string& fsSource);
+
+
+	/**
+	 * @brief ũ ̴ α׷ ̳ʸ ĳÿ մϴ.
+	 *
+	 * @param programID ̳ʸ  ̴ α׷ ̵Դϴ.
+	 * @param vsSource ؽ ̴ ҽԴϴ.
+	 * @param fsSource ׸Ʈ ̴ ҽԴϴ.
+	 *
+	 * @note ̳ʸ  ũ  GL_PROGRAM_BINARY_RETRIEVABLE_HINT ؾ մϴ.
+	 */
+	void SaveProgramBinary(uint32_t programID, const std::string& vsSource, const std::string& fsSource);
+
+
+	/**
+	 * @brief ̴ α׷ ε ð 迡 մϴ.
+	 *
+	 * @param bIsCacheHit ĳõ ̳ʸ εߴ Դϴ.
+	 * @param seconds ̴ α׷ ε ɸ   ðԴϴ.
+	 */
+	void RecordProgramLoad(bool bIsCacheHit, float seconds);
+
+
+	/**
+	 * @brief ̴ α׷ ε 踦 ϴ.
+	 *
+	 * @return ̴ α׷ ε 踦 ȯմϴ.
+	 */
+	const Statistics& GetStatistics();
+}
\ No newline at end of file
@@ -0,0 +1,297 @@
+#pragma once
+
+#include <cstdint>
+
+#include "DirectionalLight.h"
+#include "Material.h"
+#include "MathUtils.h"
+#include "Matrix4x4.h"
+#include "PointLight.h"
+#include "SpotLight.h"
+#include "Vector4.h"
+
+
+/**
+ * @brief , , ī޶ ȯ  ̴ std140/std430 ̾ƿ  ü ȯϴ Ȯ  մϴ.
+ *
+ * @note
+ * -  ü 4   Ǿ std140 std430  ̾ƿ ,  ۿ ̴ 丮 ۿ    ֽϴ.
+ * - Į  3   w п Բ  е Դϴ.
+ * - ̴  ü   ü   ġؾ մϴ.
+ */
+namespace ShaderDataUtils
+{
+	/**
+	 * @brief    ε ġԴϴ.
+	 */
+	const uint32_t FRAME_BUFFER_BINDING = 0;
+
+
+	/**
+	 * @brief    ε ġԴϴ.
+	 */
+	const uint32_t MATERIAL_BUFFER_BINDING = 1;
+
+
+	/**
+	 * @brief Ɽ   ε ġԴϴ.
+	 */
+	const uint32_t DIRECTIONAL_LIGHT_BUFFER_BINDING = 2;
+
+
+	/**
+	 * @brief н   ε ġԴϴ.
+	 */
+	const uint32_t PASS_BUFFER_BINDING = 3;
+
+
+	/**
+	 * @brief ׸  ̴ 丮  ε ġԴϴ.
+	 *
+	 * @note ̴ gl_BaseInstance ׸ Ϳ մϴ.
+	 */
+	const uint32_t DRAW_BUFFER_BINDING = 4;
+
+
+	/**
+	 * @brief  Ϳ   ִ ִ   Դϴ.
+	 */
+	const uint32_t MAX_LIGHT_MATRIX_COUNT = 4;
+
+
+	/**
+	 * @brief    Դϴ.
+	 */
+	const float LIGHT_TYPE_POINT = 0.0f;
+
+
+	/**
+	 * @brief Ʈ   Դϴ.
+	 */
+	const float LIGHT_TYPE_SPOT = 1.0f;
+
+
+	/**
+	 * @brief ̴   Դϴ.
+	 */
+	struct MaterialData
+	{
+		Vector4f ambientShininess; // xyz : Ambient , w : 
+		Vector4f diffuseRGB;       // xyz : Diffuse 
+		Vector4f specularRGB;      // xyz : Specular 
+	};
+
+
+	/**
+	 * @brief ̴  Ɽ Դϴ.
+	 */
+	struct DirectionalLightData
+	{
+		Vector4f direction;   // xyz : 
+		Vector4f ambientRGB;  // xyz : Ambient 
+		Vector4f diffuseRGB;  // xyz : Diffuse 
+		Vector4f specularRGB; // xyz : Specular 
+	};
+
+
+	/**
+	 * @brief ̴    Ǵ Ʈ  Դϴ.
+	 */
+	struct LightData
+	{
+		Vector4f positionRange;      // xyz : ġ, w :  
+		Vector4f directionType;      // xyz : , w :  
+		Vector4f ambientCutOff;      // xyz : Ambient , w :   ڻ 
+		Vector4f diffuseOuterCutOff; // xyz : Diffuse , w : ܺ   ڻ 
+		Vector4f specularRGB;        // xyz : Specular 
+		Vector4f attenuation;        // x :  , y :  , z :  
+	};
+
+
+	/**
+	 * @brief Ӹ   ϴ ̴ Դϴ.
+	 */
+	struct FrameData
+	{
+		Matrix4x4f view;
+		Matrix4x4f projection;
+		Matrix4x4f viewProjection;
+		Matrix4x4f lightViewProjections[MAX_LIGHT_MATRIX_COUNT];
+		Vector4f lightSplits;  //  ĺ    Ÿ
+		Vector4f viewPosition; // xyz : ī޶ ġ
+		Vector4f time;         // x :  ð, y :  ð
+	};
+
+
+	/**
+	 * @brief  н ϴ ̴ Դϴ.
+	 */
+	struct PassData
+	{
+		Matrix4x4f view;
+		Matrix4x4f projection;
+		Matrix4x4f viewProjection;
+	};
+
+
+	/**
+	 * @brief ׸⸶ ϴ ̴ Դϴ.
+	 */
+	struct DrawData
+	{
+		Matrix4x4f world;
+		Matrix4x4f normal;   //   ġ 
+		int32_t textureSlot; // TextureBindingTable  ȣ, ؽó ٸ -1
+		int32_t padding[3];
+	};
+
+
+	static_assert(sizeof(MaterialData) == 48, "invalid material data size...");
+	static_assert(sizeof(DirectionalLightData) == 64, "invalid directional light data size...");
+	static_assert(sizeof(LightData) == 96, "invalid light data size...");
+	static_assert(sizeof(FrameData) == 496, "invalid frame data size...");
+	static_assert(sizeof(PassData) == 192, "invalid pass data size...");
+	static_assert(sizeof(DrawData) == 144, "invalid draw data size...");
+
+
+	/**
+	 * @brief  ̴  ͷ ȯմϴ.
+	 *
+	 * @param material ȯ Դϴ.
+	 *
+	 * @return ȯ  ͸ ȯմϴ.
+	 */
+	inline MaterialData Pack(const Material& material)
+	{
+		const Vector3f& ambientRGB = material.GetAmbientRGB();
+		const Vector3f& diffuseRGB = material.GetDiffuseRGB();
+		const Vector3f& specularRGB = material.GetSpecularRGB();
+
+		MaterialData data;
+		data.ambientShininess = Vector4f(ambientRGB.x, ambientRGB.y, ambientRGB.z, material.GetShininess());
+		data.diffuseRGB = Vector4f(diffuseRGB.x, diffuseRGB.y, diffuseRGB.z, 0.0f);
+		data.specularRGB = Vector4f(specularRGB.x, specularRGB.y, specularRGB.z, 0.0f);
+
+		return data;
+	}
+
+
+	/**
+	 * @brief Ɽ ̴  ͷ ȯմϴ.
+	 *
+	 * @param light ȯ ⱤԴϴ.
+	 *
+	 * @return ȯ Ɽ ͸ ȯմϴ.
+	 */
+	inline DirectionalLightData Pack(const DirectionalLight& light)
+	{
+		const Vector3f& direction = light.GetDirection();
+		const Vector3f& ambientRGB = light.GetAmbientRGB();
+		const Vector3f& diffuseRGB = light.GetDiffuseRGB();
+		const Vector3f& specularRGB = light.GetSpecularRGB();
+
+		DirectionalLightData data;
+		data.direction = Vector4f(direction.x, direction.y, direction.z, 0.0f);
+		data.ambientRGB = Vector4f(ambientRGB.x, ambientRGB.y, ambientRGB.z, 0.0f);
+		data.diffuseRGB = Vector4f(diffuseRGB.x, diffuseRGB.y, diffuseRGB.z, 0.0f);
+		data.specularRGB = Vector4f(specularRGB.x, specularRGB.y, specularRGB.z, 0.0f);
+
+		return data;
+	}
+
+
+	/**
+	 * @brief   ̴  ͷ ȯմϴ.
+	 *
+	 * @param light ȯ  Դϴ.
+	 * @param range    Դϴ.
+	 *
+	 * @return ȯ  ͸ ȯմϴ.
+	 */
+	inline LightData Pack(const PointLight& light, float range)
+	{
+		const Vector3f& position = light.GetPosition();
+		const Vector3f& ambientRGB = light.GetAmbientRGB();
+		const Vector3f& diffuseRGB = light.GetDiffuseRGB();
+		const Vector3f& specularRGB = light.GetSpecularRGB();
+
+		LightData data;
+		data.positionRange = Vector4f(position.x, position.y, position.z, range);
+		data.directionType = Vector4f(0.0f, 0.0f, 0.0f, LIGHT_TYPE_POINT);
+		data.ambientCutOff = Vector4f(ambientRGB.x, ambientRGB.y, ambientRGB.z, 0.0f);
+		data.diffuseOuterCutOff = Vector4f(diffuseRGB.x, diffuseRGB.y, diffuseRGB.z, 0.0f);
+		data.specularRGB = Vector4f(specularRGB.x, specularRGB.y, specularRGB.z, 0.0f);
+		data.attenuation = Vector4f(light.GetConstant(), light.GetLinear(), light.GetQuadratic(), 0.0f);
+
+		return data;
+	}
+
+
+	/**
+	 * @brief Ʈ  ̴  ͷ ȯմϴ.
+	 *
+	 * @param light ȯ Ʈ Դϴ.
+	 * @param range Ʈ   Դϴ.
+	 *
+	 * @return ȯ  ͸ ȯմϴ.
+	 */
+	inline LightData Pack(const SpotLight& light, float range)
+	{
+		const Vector3f& position = light.GetPosition();
+		const Vector3f& direction = light.GetDirection();
+		const Vector3f& ambientRGB = light.GetAmbientRGB();
+		const Vector3f& diffuseRGB = light.GetDiffuseRGB();
+		const Vector3f& specularRGB = light.GetSpecularRGB();
+
+		LightData data;
+		data.positionRange = Vector4f(position.x, position.y, position.z, range);
+		data.directionType = Vector4f(direction.x, direction.y, direction.z, LIGHT_TYPE_SPOT);
+		data.ambientCutOff = Vector4f(ambientRGB.x, ambientRGB.y, ambientRGB.z, light.GetCutOff());
+		data.diffuseOuterCutOff = Vector4f(diffuseRGB.x, diffuseRGB.y, diffuseRGB.z, light.GetOuterCutOff());
+		data.specularRGB = Vector4f(specularRGB.x, specularRGB.y, specularRGB.z, 0.0f);
+		data.attenuation = Vector4f(light.GetConstant(), light.GetLinear(), light.GetQuadratic(), 0.0f);
+
+		return data;
+	}
+
+
+	/**
+	 * @brief þ İ   ̴  н ͷ ȯմϴ.
+	 *
+	 * @param view þ Դϴ.
+	 * @param projection  Դϴ.
+	 *
+	 * @return ȯ н ͸ ȯմϴ.
+	 */
+	inline PassData Pack(const Matrix4x4f& view, const Matrix4x4f& projection)
+	{
+		PassData data;
+		data.view = view;
+		data.projection = projection;
+		data.viewProjection = view * projection;
+
+		return data;
+	}
+
+
+	/**
+	 * @brief   ̴  ׸ ͷ ȯմϴ.
+	 *
+	 * @param world  Դϴ.
+	 * @param textureSlot ׸⿡ ø TextureBindingTable  ȣԴϴ. ؽó ٸ -1Դϴ.
+	 *
+	 * @return ȯ ׸ ͸ ȯմϴ.
+	 */
+	inline DrawData Pack(const Matrix4x4f& world, int32_t textureSlot = -1)
+	{
+		DrawData data;
+		data.world = world;
+		data.normal = MathUtils::Transpose(MathUtils::Inverse(world));
+		data.textureSlot = textureSlot;
+		data.padding[0] = 0;
+		data.padding[1] = 0;
+		data.padding[2] = 0;
+
+		return data;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+/**
+ * @brief GLSL ̴ ҽ   óϴ Ȯ  մϴ.
+ *
+ * @note
+ * - #include "" ù ϴ  丮,     ã Ĩϴ.
+ * -    ̴ ܰ迡   մϴ.   Ͽ  尡 ʿ ϴ.
+ * - Ǻ ù(#if, #ifdef, #ifndef, #elif, #else) Ͽ, Ȱ б #include ġ  ʽϴ.
+ * - ũ Ǵ #version ù ٷ ڿ ߰մϴ.
+ * -  踶 #line ù ߰Ͽ,   ġ  ϰ  ȣ ǵ  ְ մϴ.
+ * - ޸ Ϸ  δ ũ  ޸𸮿 нϴ.
+ */
+namespace ShaderPreprocessUtils
+{
+	/**
+	 * @brief ó ̴ ҽԴϴ.
+	 */
+	struct Source
+	{
+		std::string code;
+		std::vector<std::wstring> files;
+	};
+
+
+	/**
+	 * @brief #include ù  ã θ ߰մϴ.
+	 *
+	 * @param path  ã 丮 Դϴ. δ /  մϴ.
+	 */
+	void AddIncludePath(const std::wstring& path);
+
+
+	/**
+	 * @brief ޸𸮿 ִ ̴ ҽ  η մϴ.
+	 *
+	 * @param path ̴ ҽ    Դϴ.
+	 * @param code ̴ ҽ  Դϴ.
+	 * @param size ̴ ҽ Ʈ ũԴϴ.
+	 *
+	 * @note ̴ ҽ ޸𸮴  Ƿ, α׷   ȿؾ մϴ.
+	 */
+	void AddMemoryFile(const std::wstring& path, const char* code, uint32_t size);
+
+
+	/**
+	 * @brief GLSL ̴ ҽ  óմϴ.
+	 *
+	 * @param path ó ̴ ҽ  Դϴ.
+	 * @param defines ߰ ũ  Դϴ. "NAME" Ȥ "NAME=VALUE" Դϴ.
+	 *
+	 * @return ó ̴ ҽ ȯմϴ. files ε #line ù ҽ ڿ ȣԴϴ.
+	 */
+	Source Preprocess(const std::wstring& path, const std::vector<std::string>& defines);
+
+
+	/**
+	 * @brief ̴  α ҽ ڿ ȣ  η ٲߴϴ.
+	 *
+	 * @param log ̴  αԴϴ.
+	 * @param files ó   Դϴ.
+	 *
+	 * @return ҽ ڿ ȣ  η ٲ α׸ ȯմϴ.
+	 *
+	 * @note "0(12)" (NVIDIA) "0:12" (AMD, Intel) ġ մϴ.
+	 */
+	std::string RemapLog(const std::string& log, const std::vector<std::wstring>& files);
+
+
+	/**
+	 * @brief ũ  κ  ߺ  (Permutation) Ű ϴ.
+	 *
+	 * @param defines ũ  Դϴ.
+	 *
+	 * @return  ũ Ǹ ;  Ű ȯմϴ.
+	 */
+	std::string MakePermutationKey(const std::vector<std::string>& defines);
+}
\ No newline at end of file
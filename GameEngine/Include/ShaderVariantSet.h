@@ -0,0 +1,96 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "IResource.h"
+
+class Shader;
+
+
+/**
+ * @brief ϳ ̴ ҽκ ũ  () ̴ ʿ   մϴ.
+ *
+ * @note
+ * - ʱȭ  ƹ ̴  ʰ, GetVariant ó û ո մϴ.
+ * - ̴ ShaderPreprocessUtils::MakePermutationKey  Ű ĳϹǷ, ũ      ʽϴ.
+ * - Ű   ڿ  ϹǷ,   ȣϴ ο  ̴  ΰ ؾ մϴ.
+ */
+class ShaderVariantSet : public IResource
+{
+public:
+	/**
+	 * @brief ̴   Ʈ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	ShaderVariantSet() = default;
+
+
+	/**
+	 * @brief ̴    ҸԴϴ.
+	 *
+	 * @note ̴   ο Ҵ Ҹ ϱ ؼ ݵ Release ȣؾ մϴ.
+	 */
+	virtual ~ShaderVariantSet();
+
+
+	/**
+	 * @brief ̴    ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(ShaderVariantSet);
+
+
+	/**
+	 * @brief ̴   ʱȭմϴ.
+	 *
+	 * @param vsPath ؽ ̴ Ȯ(.vert)  Դϴ.
+	 * @param fsPath ׸Ʈ ̴ Ȯ(.frag)  Դϴ.
+	 */
+	void Initialize(const std::wstring& vsPath, const std::wstring& fsPath);
+
+
+	/**
+	 * @brief ̴    ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief ũ  տ شϴ ̴ ϴ.
+	 *
+	 * @param defines ũ  Դϴ. "NAME" Ȥ "NAME=VALUE" Դϴ.
+	 *
+	 * @return ũ  տ شϴ ̴ ȯմϴ. ó û ̸   ̴ ȯմϴ.
+	 */
+	Shader* GetVariant(const std::vector<std::string>& defines);
+
+
+	/**
+	 * @brief ݱ  ̴  ϴ.
+	 *
+	 * @return ݱ  ̴  ȯմϴ.
+	 */
+	uint32_t GetVariantCount() const { return static_cast<uint32_t>(variants_.size()); }
+
+
+private:
+	/**
+	 * @brief ؽ ̴ Դϴ.
+	 */
+	std::wstring vsPath_;
+
+
+	/**
+	 * @brief ׸Ʈ ̴ Դϴ.
+	 */
+	std::wstring fsPath_;
+
+
+	/**
+	 * @brief  Ű ̴Դϴ.
+	 */
+	std::unordered_map<std::string, std::unique_ptr<Shader>> variants_;
+};
\ No newline at end of file
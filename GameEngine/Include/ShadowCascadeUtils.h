@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Matrix4x4.h"
+#include "Vector3.h"
+
+
+/**
+ * @brief ĳ̵ ε   Ÿ ĳ̵庰   ϴ Ȯ  մϴ.
+ *
+ * @note GPU ҽ  Ƿ CPU 󿡼 ܵ   ֽϴ.
+ */
+namespace ShadowCascadeUtils
+{
+	/**
+	 * @brief ĳ̵ ϳ  İ  Դϴ.
+	 */
+	struct Cascade
+	{
+		Matrix4x4f lightView;
+		Matrix4x4f lightProjection;
+		float splitNear;
+		float splitFar;
+	};
+
+
+	/**
+	 * @brief ī޶ ü   Ÿ մϴ.
+	 *
+	 * @param nearZ ī޶   ŸԴϴ.
+	 * @param farZ ī޶   ŸԴϴ.
+	 * @param cascadeCount ĳ̵ Դϴ.
+	 * @param lambda α Ұ յ   Դϴ. 1̸ α , 0̸ յ Դϴ.
+	 * @param outSplits  Ÿ Դϴ. ù °  nearZ,   farZ̸ ũ cascadeCount + 1Դϴ.
+	 *
+	 * @see https://developer.nvidia.com/gpugems/gpugems3/part-ii-light-and-shadows/chapter-10-parallel-split-shadow-maps-programmable-gpus
+	 */
+	void ComputeSplitDistances(float nearZ, float farZ, uint32_t cascadeCount, float lambda, std::vector<float>& outSplits);
+
+
+	/**
+	 * @brief ī޶ ü   δ ĳ̵   մϴ.
+	 *
+	 * @param cameraView ī޶ þ Դϴ.
+	 * @param fov ī޶    þ Դϴ.
+	 * @param aspect ī޶ / Դϴ.
+	 * @param splitNear   ŸԴϴ.
+	 * @param splitFar   ŸԴϴ.
+	 * @param lightDirection  ߴ Դϴ.
+	 * @param shadowSize ĳ̵   / ؼ Դϴ.
+	 * @param casterDistance  ۿ ׸ڸ 帮 ü ϱ    ø ŸԴϴ.
+	 *
+	 * @return  ĳ̵带 ȯմϴ.
+	 *
+	 * @note
+	 * -   (Bounding Sphere) ε    ϹǷ, ī޶ ȸص  ũⰡ ٲ ʽϴ.
+	 * -  þ     ϰ    ؼ  ߾, ī޶ ̵  ׸ 谡 鸮 ʽϴ.
+	 */
+	Cascade FitCascade(
+		const Matrix4x4f& cameraView,
+		float fov,
+		float aspect,
+		float splitNear,
+		float splitFar,
+		const Vector3f& lightDirection,
+		uint32_t shadowSize,
+		float casterDistance
+	);
+
+
+	/**
+	 * @brief ī޶ ü ü   ĳ̵   մϴ.
+	 *
+	 * @param cameraView ī޶ þ Դϴ.
+	 * @param fov ī޶    þ Դϴ.
+	 * @param aspect ī޶ / Դϴ.
+	 * @param nearZ ī޶   ŸԴϴ.
+	 * @param farZ ī޶   ŸԴϴ.
+	 * @param lightDirection  ߴ Դϴ.
+	 * @param cascadeCount ĳ̵ Դϴ.
+	 * @param lambda α Ұ յ   Դϴ.
+	 * @param shadowSize ĳ̵   / ؼ Դϴ.
+	 * @param casterDistance  ۿ ׸ڸ 帮 ü ϱ    ø ŸԴϴ.
+	 * @param outCascades  ĳ̵ Դϴ.
+	 */
+	void ComputeCascades(
+		const Matrix4x4f& cameraView,
+		float fov,
+		float aspect,
+		float nearZ,
+		float farZ,
+		const Vector3f& lightDirection,
+		uint32_t cascadeCount,
+		float lambda,
+		uint32_t shadowSize,
+		float casterDistance,
+		std::vector<Cascade>& outCascades
+	);
+};
\ No newline at end of file
@@ -5,8 +5,27 @@
 #include "IResource.h"
 
 
+/**
+ * @brief ε  ͸ Դϴ.
+ *
+ * @note
+ * - HardwarePCF     ͸ Ͽ   ø 2x2 ؼ մϴ. (sampler2DShadow)
+ * - PoissonPCF ȼ ȸ Ƽ ũ ġ ϵ  ø   մϴ.
+ * - Variance ̿  (Ʈ)  ؽó ϰ Ӹ ̸ ͸ , ü ε ׸ڸ մϴ. (VSM)
+ * - ̸  ʹ  ̴ "ShadowMap", Variance Ʈ Բ   ̴ "VarianceShadowMap" մϴ.
+ */
+enum class EShadowFilter : int32_t
+{
+	HardwarePCF = 0x00,
+	PoissonPCF  = 0x01,
+	Variance    = 0x02,
+};
+
+
 /**
  * @brief    ̰   ε Դϴ.
+ *
+ * @note  ĳø ϸ  ʴ ü ̸  ؽó ϰ,   ̸   ̴ ü ׸ϴ.
  */
 class ShadowMap : public IResource
 {
@@ -36,8 +55,10 @@ public:
 	 * 
 	 * @param shadowWidth ε   ũԴϴ.
 	 * @param shadowHeight ε   ũԴϴ.
+	 * @param bEnableStaticCache  ü ̸  ĳø  Դϴ.
+	 * @param filter ε  ͸ Դϴ.
 	 */
-	void Initialize(uint32_t shadowWidth, uint32_t shadowHeight);
+	void Initialize(uint32_t shadowWidth, uint32_t shadowHeight, bool bEnableStaticCache = false, EShadowFilter filter = EShadowFilter::HardwarePCF);
 
 
 	/**
@@ -60,18 +81,62 @@ public:
 
 	/**
 	 * @brief ε  ε մϴ.
+	 *
+	 * @note Variance Ͷ Ʈ ؽó Ӹ ٽ մϴ.
 	 */
 	void Unbind();
 
 
+	/**
+	 * @brief ε   ĳø   εմϴ.
+	 *
+	 * @note  ĳô ŵ  ϹǷ, ε   ü  ׷ մϴ.
+	 */
+	void BindStaticCache();
+
+
+	/**
+	 * @brief ε     ĳ   ϴ.
+	 *
+	 * @note Bind ȣ  Clear  ȣմϴ.
+	 */
+	void RestoreStaticCache();
+
+
+	/**
+	 * @brief  ĳø ٽ ׷ ϴ · մϴ.
+	 *
+	 * @note ̳  ü  ٲ  ȣմϴ.
+	 */
+	void MarkStaticCacheDirty() { bIsStaticCacheDirty_ = true; }
+
+
+	/**
+	 * @brief  ĳø ٽ ׷ ϴ Ȯմϴ.
+	 *
+	 * @return  ĳø ٽ ׷ Ѵٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsStaticCacheDirty() const { return bIsStaticCacheDirty_; }
+
+
 	/**
 	 * @brief ε  ؽó Ȱȭմϴ.
 	 *
 	 * @param unit Ȱȭ  ؽó Դϴ.
+	 *
+	 * @note   ؽó unit, Variance  Ʈ ؽó unit + 1 εմϴ.
 	 */
 	void Active(uint32_t unit);
 
 
+	/**
+	 * @brief ε  ͸  ϴ.
+	 *
+	 * @return ε  ͸  ȯմϴ.
+	 */
+	EShadowFilter GetFilter() const { return filter_; }
+
+
 private:
 	/**
 	 * @brief ε  ε Ǿ Ȯմϴ.
@@ -79,6 +144,18 @@ private:
 	bool bIsBind_ = false;
 
 
+	/**
+	 * @brief ε   ũԴϴ.
+	 */
+	uint32_t shadowWidth_ = 0;
+
+
+	/**
+	 * @brief ε   ũԴϴ.
+	 */
+	uint32_t shadowHeight_ = 0;
+
+
 	/**
 	 * @brief ε    IDԴϴ.
 	 */
@@ -89,4 +166,46 @@ private:
 	 * @brief ε  ̰  IDԴϴ.
 	 */
 	uint32_t shadowMapID_ = 0;
+
+
+	/**
+	 * @brief ε  ͸ Դϴ.
+	 */
+	EShadowFilter filter_ = EShadowFilter::HardwarePCF;
+
+
+	/**
+	 * @brief Variance  Ʈ ؽó IDԴϴ.
+	 */
+	uint32_t momentsID_ = 0;
+
+
+	/**
+	 * @brief  ĳø ϴ Ȯմϴ.
+	 */
+	bool bIsEnableStaticCache_ = false;
+
+
+	/**
+	 * @brief  ĳø ٽ ׷ ϴ Ȯմϴ.
+	 */
+	bool bIsStaticCacheDirty_ = true;
+
+
+	/**
+	 * @brief  ĳ   IDԴϴ.
+	 */
+	uint32_t staticCacheFBO_ = 0;
+
+
+	/**
+	 * @brief  ĳ ̰  IDԴϴ.
+	 */
+	uint32_t staticCacheID_ = 0;
+
+
+	/**
+	 * @brief  ĳ Ʈ ؽó IDԴϴ.
+	 */
+	uint32_t staticCacheMomentsID_ = 0;
 };
\ No newline at end of file
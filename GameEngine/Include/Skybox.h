@@ -54,6 +54,16 @@ public:
 	);
 
 
+	/**
+	 * @brief ť ؽó ̳  а ī  ҽ մϴ.
+	 *
+	 * @param path  6 ť ؽó ̳(.dds, .ktx2)  Դϴ.
+	 *
+	 * @note Ͽ    Ӹ  ״ εմϴ.
+	 */
+	void Initialize(const std::wstring& path);
+
+
 	/**
 	 * @brief ī ڽ  ҽ Ҵ մϴ.
 	 */
@@ -112,11 +122,11 @@ private:
 
 
 	/**
-	 * @brief DXT   ؽó ť մϴ.
+	 * @brief 鸶 ϳ ؽó ̳(.dds, .ktx2) Ϸ ؽó ť մϴ.
 	 * 
-	 * @param resourcePaths DXT   ť Դϴ.
+	 * @param resourcePaths ؽó ̳  Դϴ.
 	 */
-	uint32_t CreateDxtCompressionCubemap(const std::vector<std::wstring>& resourcePaths);
+	uint32_t CreateContainerCubemap(const std::vector<std::wstring>& resourcePaths);
 
 
 	/**
@@ -148,4 +158,4 @@ private:
 	 * @brief ī ڽ  Դϴ.
 	 */
 	uint32_t vertexCount_ = 0;
-};
+};
\ No newline at end of file
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "AxisAlignedBoundingBox.h"
+#include "IResource.h"
+#include "StaticMesh.h"
+
+class Material;
+
+
+/**
+ * @brief  ʴ  ޽õ  ǥ ̸ ȯϿ ϳ ģ  ġ ҽԴϴ.
+ *
+ * @note
+ * -  ̹  ǥ迡 Ƿ, ̴    ̾ մϴ.
+ * -  ޽( ޽)  ε   ڸ ϹǷ, ̴  ޽ø  ׸  ֽϴ.
+ */
+class StaticBatch : public IResource
+{
+public:
+	/**
+	 * @brief  ġ  ޽ ε   Դϴ.
+	 */
+	struct SubMesh
+	{
+		uint32_t firstIndex;
+		uint32_t indexCount;
+		AxisAlignedBoundingBox boundingBox;
+	};
+
+
+public:
+	/**
+	 * @brief  ġ Ʈ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	StaticBatch() = default;
+
+
+	/**
+	 * @brief  ġ  ҸԴϴ.
+	 *
+	 * @note  ġ ο Ҵ Ҹ ϱ ؼ ݵ Release ȣؾ մϴ.
+	 */
+	virtual ~StaticBatch();
+
+
+	/**
+	 * @brief  ġ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(StaticBatch);
+
+
+	/**
+	 * @brief  ġ ҽ մϴ.
+	 *
+	 * @param material  ġ Դϴ.
+	 * @param vertices  ǥ ȯ  Դϴ.
+	 * @param indices   ε Դϴ.
+	 * @param subMeshes  ޽ ε    Դϴ.
+	 */
+	void Initialize(
+		const Material* material,
+		const std::vector<StaticMesh::Vertex>& vertices,
+		const std::vector<uint32_t>& indices,
+		const std::vector<SubMesh>& subMeshes
+	);
+
+
+	/**
+	 * @brief  ġ  ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief  ġ  ϴ.
+	 *
+	 * @return  ġ  ȯմϴ.
+	 */
+	const Material* GetMaterial() const { return material_; }
+
+
+	/**
+	 * @brief  ġ ü  ڸ ϴ.
+	 *
+	 * @return  ġ ü  ڸ ȯմϴ.
+	 */
+	const AxisAlignedBoundingBox& GetBoundingBox() const { return boundingBox_; }
+
+
+	/**
+	 * @brief  ġ  ޽  ϴ.
+	 *
+	 * @return  ġ  ޽  ȯմϴ.
+	 */
+	const std::vector<SubMesh>& GetSubMeshes() const { return subMeshes_; }
+
+
+	/**
+	 * @brief  ġ ε  ϴ.
+	 *
+	 * @return  ġ ε  ȯմϴ.
+	 */
+	uint32_t GetIndexCount() const { return indexCount_; }
+
+
+	/**
+	 * @brief  ġ  迭 Ʈ ϴ.
+	 *
+	 * @return  ġ  迭 Ʈ ȯմϴ.
+	 */
+	uint32_t GetVertexArrayObject() const { return vertexArrayObject_; }
+
+
+private:
+	/**
+	 * @brief  ġ Դϴ.
+	 */
+	const Material* material_ = nullptr;
+
+
+	/**
+	 * @brief  ġ ü  Դϴ.
+	 */
+	AxisAlignedBoundingBox boundingBox_;
+
+
+	/**
+	 * @brief  ġ  ޽ Դϴ.
+	 */
+	std::vector<SubMesh> subMeshes_;
+
+
+	/**
+	 * @brief ε  Դϴ.
+	 */
+	uint32_t indexCount_ = 0;
+
+
+	/**
+	 * @brief  迭 ƮԴϴ.
+	 */
+	uint32_t vertexArrayObject_ = 0;
+
+
+	/**
+	 * @brief   ƮԴϴ.
+	 */
+	uint32_t vertexBufferObject_ = 0;
+
+
+	/**
+	 * @brief ε  ƮԴϴ.
+	 */
+	uint32_t indexBufferObject_ = 0;
+};
\ No newline at end of file
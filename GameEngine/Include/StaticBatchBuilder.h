@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "AxisAlignedBoundingBox.h"
+#include "Macro.h"
+#include "Matrix4x4.h"
+#include "StaticBatch.h"
+#include "StaticMesh.h"
+
+class Material;
+
+
+/**
+ * @brief  ʴ (޽,  , ) ׸     ġ ͸  Դϴ.
+ *
+ * @note
+ * -   ǥ ȯ ۾ 忡 ķ մϴ.
+ * -   CPU ̹Ƿ, GPU ̵     ֽϴ.
+ * -    ġ ҽ Ϸ StaticBatch::Initialize ȣؾ մϴ.
+ *
+ * @code
+ * StaticBatchBuilder builder;
+ * builder.AddEntry(floor, floorWorld, stone);
+ * builder.AddEntry(wall, wallWorld, stone);
+ * builder.Build();
+ *
+ * for (const auto& batch : builder.GetBatches())
+ * {
+ *     StaticBatch* staticBatch = ResourceManager::Get().CreateResource<StaticBatch>(...);
+ *     staticBatch->Initialize(batch.material, batch.vertices, batch.indices, batch.subMeshes);
+ * }
+ *
+ * floor->ReleaseGeometry();
+ * wall->ReleaseGeometry();
+ * @endcode
+ */
+class StaticBatchBuilder
+{
+public:
+	/**
+	 * @brief  ġ ĥ ׸Դϴ.
+	 */
+	struct Entry
+	{
+		const StaticMesh* mesh;
+		Matrix4x4f world;
+		const Material* material;
+	};
+
+
+	/**
+	 * @brief  ϳ ϴ  ġ Դϴ.
+	 */
+	struct Batch
+	{
+		const Material* material;
+		std::vector<StaticMesh::Vertex> vertices;
+		std::vector<uint32_t> indices;
+		std::vector<StaticBatch::SubMesh> subMeshes;
+		AxisAlignedBoundingBox boundingBox;
+	};
+
+
+public:
+	/**
+	 * @brief  ġ  Ʈ Դϴ.
+	 */
+	StaticBatchBuilder() = default;
+
+
+	/**
+	 * @brief  ġ   ҸԴϴ.
+	 */
+	virtual ~StaticBatchBuilder() {}
+
+
+	/**
+	 * @brief  ġ   ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(StaticBatchBuilder);
+
+
+	/**
+	 * @brief  ġ ĥ ׸ ߰մϴ.
+	 *
+	 * @param mesh ĥ  ޽Դϴ. CPU  /ε  ϵ ʱȭ ޽ÿ մϴ.
+	 * @param world  ޽  Դϴ.
+	 * @param material  ޽ Դϴ.   ͸  ׸񳢸 ϴ.
+	 */
+	void AddEntry(const StaticMesh* mesh, const Matrix4x4f& world, const Material* material);
+
+
+	/**
+	 * @brief ߰ ׸  ġ ͸ մϴ.
+	 *
+	 * @note
+	 * - ġ   ó ߰  ,  ޽  ׸ ߰  ϴ.
+	 * -     ŵ˴ϴ.
+	 */
+	void Build();
+
+
+	/**
+	 * @brief ߰ ׸    մϴ.
+	 */
+	void Clear();
+
+
+	/**
+	 * @brief ߰ ׸  ϴ.
+	 *
+	 * @return ߰ ׸  ȯմϴ.
+	 */
+	const std::vector<Entry>& GetEntries() const { return entries_; }
+
+
+	/**
+	 * @brief   ġ   ϴ.
+	 *
+	 * @return   ġ   ȯմϴ.
+	 */
+	const std::vector<Batch>& GetBatches() const { return batches_; }
+
+
+private:
+	/**
+	 * @brief  ġ ĥ ׸ Դϴ.
+	 */
+	std::vector<Entry> entries_;
+
+
+	/**
+	 * @brief   ġ  Դϴ.
+	 */
+	std::vector<Batch> batches_;
+};
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <vector>
 
+#include "AxisAlignedBoundingBox.h"
 #include "IResource.h"
 #include "Vector2.h"
 #include "Vector3.h"
@@ -172,8 +173,13 @@ public:
 	 * 
 	 * @param vertices ޽  Դϴ.
 	 * @param indices ޽ ε Դϴ.
+	 * @param bIsKeepGeometry /ε  纻 CPU   Դϴ.
+	 * 
+	 * @note
+	 * -  ڴ ׻ CPU  մϴ.
+	 * -  Ī(StaticBatchBuilder)̳ Ŭ ø(OcclusionCuller) ó CPU  /ε  д ޽ø bIsKeepGeometry true ؾ մϴ.
 	 */
-	void Initialize(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
+	void Initialize(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, bool bIsKeepGeometry = false);
 
 
 	/**
@@ -181,6 +187,22 @@ public:
 	 */
 	virtual void Release() override;
 
+
+	/**
+	 * @brief CPU   /ε  մϴ.
+	 * 
+	 * @note  ġó CPU  /ε  д    ڿ ȣմϴ.
+	 */
+	void ReleaseGeometry();
+
+
+	/**
+	 * @brief CPU  /ε  ϰ ִ Ȯմϴ.
+	 * 
+	 * @return CPU  /ε  ϰ ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool HasGeometry() const { return bHasGeometry_; }
+
 	
 	/**
 	 * @brief ޽ ε  ϴ.
@@ -198,6 +220,30 @@ public:
 	uint32_t GetVertexArrayObject() const { return vertexArrayObject_; }
 
 
+	/**
+	 * @brief ޽   ϴ.
+	 * 
+	 * @return ޽   ȯմϴ. CPU     ʴ´ٸ   ȯմϴ.
+	 */
+	const std::vector<Vertex>& GetVertices() const { return vertices_; }
+
+
+	/**
+	 * @brief ޽ ε  ϴ.
+	 * 
+	 * @return ޽ ε  ȯմϴ. CPU  ε   ʴ´ٸ   ȯմϴ.
+	 */
+	const std::vector<uint32_t>& GetIndices() const { return indices_; }
+
+
+	/**
+	 * @brief  ǥ  ޽  ڸ ϴ.
+	 * 
+	 * @return  ǥ  ޽  ڸ ȯմϴ.
+	 */
+	const AxisAlignedBoundingBox& GetBoundingBox() const { return boundingBox_; }
+
+
 private:
 	/**
 	 * @brief ޽ ҽ ʱȭմϴ.
@@ -217,6 +263,30 @@ private:
 	uint32_t indexCount_ = 0;
 
 
+	/**
+	 * @brief CPU  ϴ ޽  Դϴ.
+	 */
+	std::vector<Vertex> vertices_;
+
+
+	/**
+	 * @brief CPU  ϴ ޽ ε Դϴ.
+	 */
+	std::vector<uint32_t> indices_;
+
+
+	/**
+	 * @brief CPU  /ε  ϰ ִ Դϴ.
+	 */
+	bool bHasGeometry_ = false;
+
+
+	/**
+	 * @brief  ǥ  ޽  Դϴ.
+	 */
+	AxisAlignedBoundingBox boundingBox_;
+
+
 	/**
 	 * @brief  ͸ ϴ  ʿ  Դϴ.
 	 * 
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "IManager.h"
+
+
+/**
+ * @brief ۾ (Worker Thread) 񵿱 ۾ óϴ ŴԴϴ.
+ *
+ * @note
+ * -  Ŭ ̱Դϴ.
+ * - Ŵ    ¿ û ۾ ȣ 忡 ٷ ó˴ϴ.
+ */
+class TaskManager : public IManager
+{
+public:
+	/**
+	 * @brief ۾ óϴ Ŵ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(TaskManager);
+
+
+	/**
+	 * @brief ۾ óϴ Ŵ  νϽ ϴ.
+	 *
+	 * @return ۾ óϴ Ŵ ڸ ȯմϴ.
+	 */
+	static TaskManager& Get()
+	{
+		static TaskManager instance;
+		return instance;
+	}
+
+
+	/**
+	 * @brief ۾ óϴ Ŵ  մϴ.
+	 *
+	 * @note
+	 * - ۾   (ϵ   - 1)̸, ּ 1Դϴ.
+	 * -  ޼   ȣǾ մϴ.
+	 */
+	virtual void Startup() override;
+
+
+	/**
+	 * @brief ۾ óϴ Ŵ  մϴ.
+	 *
+	 * @note
+	 * -   ۾  ó  ۾ 带 մϴ.
+	 * -  ޼ ݵ   ȣǾ մϴ.
+	 */
+	virtual void Shutdown() override;
+
+
+	/**
+	 * @brief ۾ ۾ 忡 ûմϴ.
+	 *
+	 * @param task ۾ 忡 ó ۾Դϴ.
+	 *
+	 * @return ۾ ϷḦ ٸ  ִ ǻó ü ȯմϴ.
+	 */
+	std::future<void> Submit(const std::function<void()>& task);
+
+
+	/**
+	 * @brief [0, count)   ۾ 忡 ķ óմϴ.
+	 *
+	 * @param count ó  ũԴϴ.
+	 * @param task   [begin, end) ó ۾Դϴ.
+	 * @param minBatchSize   ó  ּ ũԴϴ.
+	 *
+	 * @note
+	 * - ȣ 嵵 ۾ ϸ,   ó   ȯ ʽϴ.
+	 * - ȣ  ٸ 尡 ̹   ϷḸ ٸϴ. ۾ Ͽ Submit û  ۾ ڿ   ۾ ٸ , ʰ   ۾ ó   ٷ մϴ.
+	 * - ۾   ȣϸ  ¸   ȣ 忡  óմϴ.
+	 */
+	void ParallelFor(uint32_t count, const std::function<void(uint32_t, uint32_t)>& task, uint32_t minBatchSize = 1);
+
+
+	/**
+	 * @brief ۾   ϴ.
+	 *
+	 * @return ۾   ȯմϴ.
+	 */
+	uint32_t GetWorkerCount() const { return static_cast<uint32_t>(workers_.size()); }
+
+
+	/**
+	 * @brief  尡 ۾  Ȯմϴ.
+	 *
+	 * @return  尡 ۾  true, ׷  false ȯմϴ.
+	 */
+	bool IsWorkerThread() const;
+
+
+private:
+	/**
+	 * @brief ۾ óϴ Ŵ Ʈ ڿ   Ҹڸ մϴ.
+	 */
+	DEFAULT_CONSTRUCTOR_AND_VIRTUAL_DESTRUCTOR(TaskManager);
+
+
+	/**
+	 * @brief ۾  ó Դϴ.
+	 */
+	void RunWorkerLoop();
+
+
+private:
+	/**
+	 * @brief ۾  Դϴ.
+	 */
+	std::vector<std::thread> workers_;
+
+
+	/**
+	 * @brief ó ٸ ۾ Դϴ.
+	 */
+	std::queue<std::function<void()>> tasks_;
+
+
+	/**
+	 * @brief ۾ Ͽ   ϴ ؽԴϴ.
+	 */
+	std::mutex taskMutex_;
+
+
+	/**
+	 * @brief ۾ 忡 ο ۾̳ Ḧ ˸  Դϴ.
+	 */
+	std::condition_variable taskCondition_;
+
+
+	/**
+	 * @brief ۾   û Դϴ.
+	 */
+	bool bIsRequestStop_ = false;
+};
\ No newline at end of file
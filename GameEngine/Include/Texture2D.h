@@ -10,9 +10,10 @@
  * 
  * @note
  * - ̹  .jpeg, .jpg, .png, .tga, .bmp  մϴ.
- * -   ASTC DXT(S3TC)  մϴ.
- * - ASTC    ݵ astcenc.exe ̿ؼ  ̿ մϴ.
- * - DXT    ݵ texconv.exe ̿ؼ  ̿ մϴ.
+ * -   ASTC  մϴ. ASTC    ݵ astcenc.exe ̿ؼ  ̿ մϴ.
+ * - ؽó ̳ʴ .dds(DX10 Ȯ  ) .ktx2  ϸ, Ͽ  Ӹ ״ մϴ.
+ * - BC1, BC3, BC4, BC5, BC7  .dds  Tool/BlockCompressor   ֽϴ.
+ * -  ؽó Һ ҷ ϸ, ε尡  TextureResidencyManager մϴ.
  */
 class Texture2D : public IResource
 {
@@ -47,13 +48,24 @@ public:
 	 * @note
 	 * - ̹  .jpeg, .jpg, .png, .tga, .bmp  մϴ.
 	 * - ASTC   ݵ astcenc.exe ̿ؼ  ̿ մϴ.
-	 * - ASTC   Ȯڴ .astc Ǿ ־ մϴ.
-	 * - DXT   ݵ texconv.exe ̿ؼ  ̿ մϴ.
-	 * - DXT   Ȯڴ .dds Ǿ ־ մϴ.
+	 * - ASTC   Ȯڴ .astc Ǿ ־ ϸ, Ӹ Ƿ Ӹ ʿϸ .ktx2 ؾ մϴ.
+	 * - ؽó ̳ Ȯڴ .dds Ȥ .ktx2 Ǿ ־ մϴ.
 	 */
 	void Initialize(const std::wstring& path);
 
 
+	/**
+	 * @brief ̹  񵿱 ε ûϰ ؽó ҽ ʱȭմϴ.
+	 *
+	 * @param path ̹  Դϴ.
+	 *
+	 * @note
+	 * - ϴ   Initialize ϴ.
+	 * - ε ε TextureStreamManager óϸ, ε尡   ÷̽Ȧ ؽó Ȱȭմϴ.
+	 */
+	void InitializeAsync(const std::wstring& path);
+
+
 	/**
 	 * @brief ؽó  ҽ Ҵ մϴ.
 	 */
@@ -68,7 +80,33 @@ public:
 	void Active(uint32_t unit) const;
 
 
+	/**
+	 * @brief ؽó ε尡  Ȯմϴ.
+	 *
+	 * @return ؽó ε尡 ٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsReady() const { return bIsReady_; }
+
+
 private:
+	/**
+	 * @brief ؽó Ʈ Ŵ ε ؽó ҽ   ֵ մϴ.
+	 */
+	friend class TextureStreamManager;
+
+
+	/**
+	 * @brief ؽó  Ŵ ؽó ҽ  Ӹ  ٲ  ֵ մϴ.
+	 */
+	friend class TextureResidencyManager;
+
+
+	/**
+	 * @brief ؽó ε ̺ ε帮 ڵ ų ؽó 迭   ֵ մϴ.
+	 */
+	friend class TextureBindingTable;
+
+
 	/**
 	 * @brief  ؽó ҽ մϴ.
 	 * 
@@ -90,13 +128,15 @@ private:
 
 
 	/**
-	 * @brief DXT  ؽó ҽ մϴ.
+	 * @brief ؽó ̳(DDS, KTX2) Ϸκ ؽó ҽ մϴ.
 	 * 
-	 * @param path ̹  Դϴ.
+	 * @param path ؽó ̳  Դϴ.
 	 * 
 	 * @return ؽó ҽ ID ȯմϴ.
+	 *
+	 * @note Ͽ  Ӹ  ״ εϸ, 迭 ؽó GL_TEXTURE_2D_ARRAY Ÿ մϴ.
 	 */
-	uint32_t CreateDxtCompressionTexture(const std::wstring& path);
+	uint32_t CreateContainerTexture(const std::wstring& path);
 
 
 private:
@@ -104,4 +144,24 @@ private:
 	 * @brief ؽó ҽ IDԴϴ.
 	 */
 	uint32_t textureID_ = 0;
+
+
+	/**
+	 * @brief ؽó ҽ ŸԴϴ.
+	 */
+	uint32_t target_ = 0x0DE1; // GL_TEXTURE_2D
+
+
+	/**
+	 * @brief ؽó ε尡  Դϴ.
+	 */
+	bool bIsReady_ = false;
+
+
+	/**
+	 * @brief ̹  Դϴ.
+	 *
+	 * @note ؽó  Ŵ  Ӹ  ٽ ø   ٽ нϴ.
+	 */
+	std::wstring path_;
 };
\ No newline at end of file
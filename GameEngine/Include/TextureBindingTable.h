@@ -0,0 +1,257 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+#include "IResource.h"
+#include "ShaderBufferPool.h"
+
+class Texture2D;
+
+
+/**
+ * @brief ׸⸶ ؽó ε ʰ, ̴  ȣ ؽó   ֵ ϴ ؽó ε ̺Դϴ.
+ *
+ * @note
+ * - ؽó ߰ϸ  ȣ ,  ʹ ̴ 丮 ۿ ϴ.
+ * -  ȣ ׸ ͳ  Ϳ , νϽ̳ Ƽ ο ġ  ׸Ⱑ  ٸ ؽó ε    ֽϴ.
+ * - GL_ARB_bindless_texture ϸ ε帮 ؽó ڵ Կ ϴ.
+ * -   , ũ, Ӹ    ؽó GL_TEXTURE_2D_ARRAY ̾ ϰ, 迭 ȣ ̾ Կ ϴ.
+ * - ̴ TextureBinding.glsl ϰ GetShaderDefine() ũθ   SampleTextureSlot øմϴ.
+ * -  ȣ ׸  (Dynamically Uniform)ؾ մϴ. ) gl_BaseInstance, gl_DrawID  ׸ 
+ * - ؽó ϱ  ݵ ̺ ؾ մϴ.
+ * - ε帮 ڵ  ؽó ؽó Ķ͸ ٲ  Ƿ, ̺  ڿ ؽó  Ŵ Ӹ   ʽϴ.
+ * - ε帮 Ŀ ϳ ؽó ϳ ̺ ߰ؾ մϴ.
+ *
+ * @see https://registry.khronos.org/OpenGL/extensions/ARB/ARB_bindless_texture.txt
+ */
+class TextureBindingTable : public IResource
+{
+public:
+	/**
+	 * @brief   ̴ 丮  ε ġԴϴ.
+	 */
+	static const uint32_t SLOT_BUFFER_BINDING = 5;
+
+
+	/**
+	 * @brief ؽó 迭 ε ù ° ؽó Դϴ.
+	 */
+	static const uint32_t TEXTURE_ARRAY_UNIT = 8;
+
+
+	/**
+	 * @brief ؽó 迭 Ŀ   ִ ִ ؽó 迭 Դϴ.
+	 *
+	 * @note ̴ MAX_TEXTURE_ARRAY_COUNT ƾ մϴ.
+	 */
+	static const uint32_t MAX_TEXTURE_ARRAY_COUNT = 8;
+
+
+	/**
+	 * @brief ؽó ε ̺  Դϴ.
+	 */
+	enum class EBackend : int32_t
+	{
+		Bindless     = 0x00,
+		TextureArray = 0x01,
+	};
+
+
+public:
+	/**
+	 * @brief ؽó ε ̺ Ʈ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	TextureBindingTable() = default;
+
+
+	/**
+	 * @brief ؽó ε ̺  ҸԴϴ.
+	 *
+	 * @note ؽó ε ̺ ο Ҵ Ҹ ϱ ؼ ݵ Release ȣؾ մϴ.
+	 */
+	virtual ~TextureBindingTable();
+
+
+	/**
+	 * @brief ؽó ε ̺  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(TextureBindingTable);
+
+
+	/**
+	 * @brief ؽó ε ̺ ʱȭմϴ.
+	 *
+	 * @param maxTextureCount ̺   ִ ִ ؽó Դϴ.
+	 * @param layerCount ؽó 迭 Ŀ ؽó 迭 ϳ ̾ Դϴ.
+	 * @param bIsForceTextureArray ε帮 ؽó ϴ ؽó 迭   Դϴ.
+	 */
+	void Initialize(uint32_t maxTextureCount = 1024, uint32_t layerCount = 64, bool bIsForceTextureArray = false);
+
+
+	/**
+	 * @brief ؽó ε ̺  ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief ؽó ̺ ߰մϴ.
+	 *
+	 * @param texture ߰ 2D ؽóԴϴ. GL_TEXTURE_2D Ÿ̾ մϴ.
+	 *
+	 * @return ؽó  ȣ ȯմϴ.
+	 *
+	 * @note
+	 * - ̹ ߰ ؽó   ȣ ȯϸ, ߰ Ƚŭ ؾ  ϴ.
+	 * - ε尡  ʾҰų  Ӹ  ٽ ö  ؽó غ  ڸ ǥ  ø˴ϴ.
+	 * - ̺ ִ  ؽó  Ŵ ؽó Ӹ   ʽϴ. ؽó 迭  ̾  ں ٽ   ֽϴ.
+	 */
+	int32_t Add(const Texture2D* texture);
+
+
+	/**
+	 * @brief ؽó ̺ մϴ.
+	 *
+	 * @param slot  ؽó  ȣԴϴ.
+	 */
+	void Remove(int32_t slot);
+
+
+	/**
+	 * @brief غ ؽó Կ ݿϰ,  ۿ ؽó 迭 εմϴ.
+	 *
+	 * @note Ӹ ̺ ϴ ù ׸    ȣմϴ.
+	 */
+	void Bind();
+
+
+	/**
+	 * @brief ؽó ε ̺   ϴ.
+	 *
+	 * @return ؽó ε ̺   ȯմϴ.
+	 */
+	EBackend GetBackend() const { return backend_; }
+
+
+	/**
+	 * @brief  Ŀ ° ̴  ũθ ϴ.
+	 *
+	 * @return ε帮 ̶ "TEXTURE_BINDLESS", ؽó 迭 ̶ "TEXTURE_ARRAY" ȯմϴ.
+	 *
+	 * @note ShaderVariantSet::GetVariant  ũ  Ͽ ߰մϴ.
+	 */
+	const char* GetShaderDefine() const;
+
+
+private:
+	/**
+	 * @brief ̴   Դϴ.
+	 *
+	 * @note ̴ TextureSlot ü   ƾ մϴ.
+	 */
+	struct SlotData
+	{
+		uint32_t handle[2]; // ε帮 ؽó ڵ ,  32Ʈ
+		int32_t arrayIndex; // ؽó 迭 ȣ, غ ʾҴٸ -1
+		int32_t layer;      // ؽó 迭 ̾
+	};
+
+
+	/**
+	 * @brief ̺ ߰ ؽó Դϴ.
+	 */
+	struct Slot
+	{
+		const Texture2D* texture = nullptr;
+		uint32_t refCount = 0;
+		uint64_t handle = 0;
+		int32_t arrayIndex = -1;
+		int32_t layer = -1;
+		bool bIsReady = false;
+	};
+
+
+	/**
+	 * @brief , ũ, Ӹ    ؽó ̾  ؽó 迭Դϴ.
+	 */
+	struct TextureArray
+	{
+		uint32_t textureID = 0;
+		uint32_t internalFormat = 0;
+		int32_t width = 0;
+		int32_t height = 0;
+		int32_t levelCount = 0;
+		std::priority_queue<int32_t, std::vector<int32_t>, std::greater<int32_t>> freeLayers;
+	};
+
+
+	/**
+	 * @brief غ ؽó Կ ݿմϴ.
+	 *
+	 * @param slot ݿ  ȣԴϴ.
+	 *
+	 * @return ؽó غǾ Կ ݿߴٸ true, ׷  false ȯմϴ.
+	 */
+	bool Resolve(int32_t slot);
+
+
+	/**
+	 * @brief ؽó  ؽó 迭 ̾ Ҵմϴ.
+	 *
+	 * @param textureID  ؽó ҽ IDԴϴ.
+	 * @param outArrayIndex Ҵ ؽó 迭 ȣԴϴ.
+	 * @param outLayer Ҵ ̾Դϴ.
+	 */
+	void AllocateLayer(uint32_t textureID, int32_t& outArrayIndex, int32_t& outLayer);
+
+
+private:
+	/**
+	 * @brief ؽó ε ̺  Դϴ.
+	 */
+	EBackend backend_ = EBackend::TextureArray;
+
+
+	/**
+	 * @brief  ͸  ̴ 丮  ǮԴϴ.
+	 *
+	 * @note  Ǯ ׸ ID  ȣԴϴ.
+	 */
+	ShaderBufferPool slotPool_;
+
+
+	/**
+	 * @brief  ȣ ؽó Դϴ.
+	 */
+	std::vector<Slot> slots_;
+
+
+	/**
+	 * @brief ؽó  ȣԴϴ.
+	 */
+	std::unordered_map<const Texture2D*, int32_t> textureSlots_;
+
+
+	/**
+	 * @brief  غ  ؽó  ȣ Դϴ.
+	 */
+	std::vector<int32_t> pendingSlots_;
+
+
+	/**
+	 * @brief ؽó 迭 Ŀ ϴ ؽó 迭 Դϴ.
+	 */
+	std::vector<TextureArray> textureArrays_;
+
+
+	/**
+	 * @brief ؽó 迭 ϳ ̾ Դϴ.
+	 */
+	uint32_t layerCount_ = 0;
+};
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * @brief ؽó ޸  ȿ ؽó ֽų Ӹ  ϴ Ȯ  մϴ.
+ *
+ * @note
+ * - GPU ҽ  Ƿ CPU 󿡼 ܵ   ֽϴ.
+ * - ؽó  Ӹ (GL_TEXTURE_BASE_LEVEL)  Ӹ  Ѵٰ մϴ.
+ * - Ʈ ũ øϴ Ӹ  ũ̸, Һ Ұ Ҵ ޸ ũⰡ ƴմϴ.
+ */
+namespace TextureBudgetUtils
+{
+	/**
+	 * @brief   ؽó ϳ Դϴ.
+	 */
+	struct Entry
+	{
+		std::vector<uint64_t> levelSizes; // Ӹ  Ʈ ũ
+		int32_t width = 0;                // Ӹ  0  ũ
+		int32_t height = 0;               // Ӹ  0  ũ
+		float requestedSize = 0.0f;       // ȭ鿡 ׷    ȼ ũ
+		bool bIsStreamable = true;        //  Ӹ  ٲ  ִ 
+	};
+
+
+	/**
+	 * @brief û ȭ ũ⸦ ϴ   ػ  Ӹ  մϴ.
+	 *
+	 * @param entry ؽó Դϴ.
+	 *
+	 * @return  Ӹ  ȯմϴ. Ʈ   ؽó ׻ 0 ȯմϴ.
+	 *
+	 * @note û ũⰡ 1 ȼ ϶  Ӹ  ȯմϴ.
+	 */
+	uint32_t ComputeDesiredBaseLevel(const Entry& entry);
+
+
+	/**
+	 * @brief  Ӹ   Ӹ  Ʈ ũ⸦ մϴ.
+	 *
+	 * @param entry ؽó Դϴ.
+	 * @param baseLevel  Ӹ Դϴ.
+	 *
+	 * @return ϴ Ӹ  Ʈ ũ  ȯմϴ.
+	 */
+	uint64_t ComputeResidentSize(const Entry& entry, uint32_t baseLevel);
+
+
+	/**
+	 * @brief  ȿ ؽó  Ӹ  մϴ.
+	 *
+	 * @param entries ؽó  Դϴ.
+	 * @param budget ؽó ޸ Ʈ Դϴ.
+	 * @param outBaseLevels ؽó   Ӹ Դϴ. ũ entries ϴ.
+	 *
+	 * @return   Ӹ  ϴ Ʈ ũ  ȯմϴ.
+	 *
+	 * @note
+	 * -  û ȭ ũ⸦ ϴ  Ӹ  մϴ.
+	 * -   , Ӹ  ϳ   û ũ  ػ    ؽó   ϴ.
+	 * -   ٸ   Ʈ ϴ ؽó  ϴ.
+	 * -  ؽó  Ӹ  ϸ  Ѵ ϴ.
+	 */
+	uint64_t Solve(const std::vector<Entry>& entries, uint64_t budget, std::vector<uint32_t>& outBaseLevels);
+}
\ No newline at end of file
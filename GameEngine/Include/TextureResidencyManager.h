@@ -0,0 +1,219 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "IManager.h"
+#include "TextureBudgetUtils.h"
+
+class Texture2D;
+
+
+/**
+ * @brief ؽó Ӹ  ޸ 뷮 ϰ,  ȿ  Ӹ  ų ٽ ø ŴԴϴ.
+ *
+ * @note
+ * -  Ŭ ̱Դϴ.
+ * - ؽó Һ (Immutable Storage) ϹǷ, Ҵ  GL_TEXTURE_BASE_LEVEL ػ󵵸 ٲߴϴ.
+ * -  Ӹ  glInvalidateTexImage  ϴ. Һ Ҵ  Ƿ Ҵ GPU ޸𸮴  ʽϴ.
+ * -   Ҵ ޸𸮰 ƴ϶ øϴ Ӹ ( Ӹ   Ӹ ) ũ⸦ ϴ.
+ * - ٽ ø Ӹ  TextureStreamManager Ͽ о εմϴ.
+ * -   TextureBudgetUtils մϴ.
+ *
+ * @see https://www.khronos.org/opengl/wiki/Texture#Mipmap_range
+ */
+class TextureResidencyManager : public IManager
+{
+public:
+	/**
+	 * @brief ؽó  Ŵ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(TextureResidencyManager);
+
+
+	/**
+	 * @brief ؽó  Ŵ  νϽ ϴ.
+	 *
+	 * @return ؽó  Ŵ ڸ ȯմϴ.
+	 */
+	static TextureResidencyManager& Get()
+	{
+		static TextureResidencyManager instance;
+		return instance;
+	}
+
+
+	/**
+	 * @brief ؽó  Ŵ  մϴ.
+	 *
+	 * @note
+	 * - ؽó Ʈ Ŵ   ڿ ȣؾ մϴ.
+	 * -  ޼   ȣǾ մϴ.
+	 */
+	virtual void Startup() override;
+
+
+	/**
+	 * @brief ؽó  Ŵ  մϴ.
+	 *
+	 * @note
+	 * - ҽ Ŵ   , ؽó Ʈ Ŵ  ϱ  ȣؾ մϴ.
+	 * -  ޼ ݵ   ȣǾ մϴ.
+	 */
+	virtual void Shutdown() override;
+
+
+	/**
+	 * @brief ε尡  ؽó ϰ Ӹ  Ʈ ũ⸦ մϴ.
+	 *
+	 * @param texture  ؽóԴϴ.
+	 *
+	 * @note
+	 * -  ޼ Texture2D TextureStreamManager ؽó ε尡  ȣմϴ.
+	 * - û ȭ ũ Ӹ  0 ũ մϴ.
+	 */
+	void Register(Texture2D* texture);
+
+
+	/**
+	 * @brief ؽó  մϴ.
+	 *
+	 * @param texture   ؽóԴϴ.
+	 *
+	 * @note  ޼ Texture2D::Release ȣϸ,   Ӹ  ε带 մϴ.
+	 */
+	void Unregister(Texture2D* texture);
+
+
+	/**
+	 * @brief ؽó ȭ鿡 ׷ ũ⸦ մϴ.
+	 *
+	 * @param texture ũ⸦  ؽóԴϴ.
+	 * @param size ȭ鿡 ׷    ȼ ũԴϴ.
+	 *
+	 * @note
+	 * -  ӿ   ϸ  ū  մϴ.
+	 * -   ӿ    մϴ.
+	 * - 0 ϸ  Ӹ  մϴ.
+	 */
+	void SetRequestedSize(const Texture2D* texture, float size);
+
+
+	/**
+	 * @brief ؽó Ӹ  ų ٽ ø  ִ մϴ.
+	 *
+	 * @param texture  ؽóԴϴ.
+	 * @param bIsStreamable Ӹ  ų ٽ ø  ִ Դϴ.
+	 *
+	 * @note
+	 * - Ʈ ʴ ؽó  Ӹ  ֽŰ, ̹  Ӹ  ٽ øϴ.
+	 * - ε帮 ڵ  ؽó ؽó Ķ͸ ٲ  Ƿ Ʈ ʾƾ մϴ.
+	 * - ϵ  ؽó ƹ ͵  ʽϴ.
+	 */
+	void SetStreamable(const Texture2D* texture, bool bIsStreamable);
+
+
+	/**
+	 * @brief  ȿ ؽó  Ӹ  ϰ Ӹ  ų ٽ øϴ.
+	 *
+	 * @note
+	 * -  Ŵ BeginFrame ؽó Ʈ Ŵ Tick  ȣմϴ.
+	 * - , û ũ,   ϳ ٲ ӿ  ٽ մϴ.
+	 */
+	void Tick();
+
+
+	/**
+	 * @brief ؽó ޸ Ʈ  մϴ.
+	 *
+	 * @param budget  Ʈ Դϴ.
+	 *
+	 * @note  øϴ Ӹ  ũ տ  ̸, ؽó Ҵ GPU ޸  ƴմϴ.
+	 */
+	void SetBudget(uint64_t budget);
+
+
+	/**
+	 * @brief ؽó ޸ Ʈ  ϴ.
+	 *
+	 * @return ؽó ޸ Ʈ  ȯմϴ.
+	 */
+	uint64_t GetBudget() const { return budget_; }
+
+
+	/**
+	 * @brief ϵ ؽó  ֽŰ ִ Ʈ ũ  ϴ.
+	 *
+	 * @return ϴ Ʈ ũ  ȯմϴ.
+	 *
+	 * @note  Ӹ  Ҵ Ҵ ä Ƿ,    GPU ޸ 뷮   ֽϴ.
+	 */
+	uint64_t GetResidentSize() const;
+
+
+	/**
+	 * @brief ϵ ؽó  Ӹ  ֽų  Ʈ ũ  ϴ.
+	 *
+	 * @return  Ӹ  Ʈ ũ  ȯմϴ.
+	 */
+	uint64_t GetTotalSize() const;
+
+
+	/**
+	 * @brief ؽó   Ӹ  ϴ.
+	 *
+	 * @param texture  Ӹ   ؽóԴϴ.
+	 *
+	 * @return  Ӹ  ȯմϴ. ϵ  ؽó 0 ȯմϴ.
+	 */
+	uint32_t GetBaseLevel(const Texture2D* texture) const;
+
+
+private:
+	/**
+	 * @brief ؽó  Ŵ Ʈ ڿ   Ҹڸ մϴ.
+	 */
+	DEFAULT_CONSTRUCTOR_AND_VIRTUAL_DESTRUCTOR(TextureResidencyManager);
+
+
+	/**
+	 * @brief ϵ ؽó  Դϴ.
+	 */
+	struct Record
+	{
+		TextureBudgetUtils::Entry entry;
+		float frameRequestedSize = -1.0f; // ̹ ӿ  ũ ִ,  ʾҴٸ 
+		uint32_t baseLevel = 0;           //  ϴ  Ӹ 
+		uint32_t pendingBaseLevel = 0;    // ε   Ӹ , ε  ƴ϶ baseLevel ϴ.
+	};
+
+
+	/**
+	 * @brief ؽó  Ӹ  ϴ.
+	 *
+	 * @param texture Ӹ   ؽóԴϴ.
+	 * @param record ؽó  Դϴ.
+	 * @param baseLevel   Ӹ Դϴ.
+	 */
+	void Evict(const Texture2D* texture, Record& record, uint32_t baseLevel);
+
+
+private:
+	/**
+	 * @brief ϵ ؽó  Դϴ.
+	 */
+	std::unordered_map<Texture2D*, Record> records_;
+
+
+	/**
+	 * @brief ؽó ޸ Ʈ Դϴ.
+	 */
+	uint64_t budget_ = 0;
+
+
+	/**
+	 * @brief  ٽ ؾ ϴ Դϴ.
+	 */
+	bool bIsDirty_ = false;
+};
\ No newline at end of file
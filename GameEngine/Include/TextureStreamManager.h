@@ -0,0 +1,212 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+
+#include "IManager.h"
+
+class RingBuffer;
+class Texture2D;
+
+
+/**
+ * @brief ؽó 񵿱 εϰ Ӹ  Ʈ   GPU εϴ ŴԴϴ.
+ *
+ * @note
+ * -  Ŭ ̱Դϴ.
+ * - ̹ ڵ  ؽó  б TaskManager ۾ 忡 óմϴ.
+ * - ε   Tick   ȼ  Ʈ(PBO)  մϴ.
+ * - ε尡   ؽó Ȱȭϸ ÷̽Ȧ ؽó εմϴ.
+ *
+ * @see https://www.khronos.org/opengl/wiki/Pixel_Buffer_Object
+ */
+class TextureStreamManager : public IManager
+{
+public:
+	/**
+	 * @brief ؽó Ʈ Ŵ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(TextureStreamManager);
+
+
+	/**
+	 * @brief ؽó Ʈ Ŵ  νϽ ϴ.
+	 *
+	 * @return ؽó Ʈ Ŵ ڸ ȯմϴ.
+	 */
+	static TextureStreamManager& Get()
+	{
+		static TextureStreamManager instance;
+		return instance;
+	}
+
+
+	/**
+	 * @brief ؽó Ʈ Ŵ  մϴ.
+	 *
+	 * @note
+	 * -  Ŵ   ڿ ȣؾ մϴ.
+	 * -  ޼   ȣǾ մϴ.
+	 */
+	virtual void Startup() override;
+
+
+	/**
+	 * @brief ؽó Ʈ Ŵ  մϴ.
+	 *
+	 * @note
+	 * - ҽ Ŵ   ,  Ŵ  ϱ  ȣؾ մϴ.
+	 * -  ޼ ݵ   ȣǾ մϴ.
+	 */
+	virtual void Shutdown() override;
+
+
+	/**
+	 * @brief ؽó 񵿱 ε ûմϴ.
+	 *
+	 * @param texture ε ̹ ε ؽóԴϴ.
+	 * @param path ̹  Դϴ.
+	 *
+	 * @note  ޼ Texture2D::InitializeAsync ȣմϴ.
+	 */
+	void Request(Texture2D* texture, const std::wstring& path);
+
+
+	/**
+	 * @brief ε尡  ؽó Ӹ  Ϻθ Ͽ ٽ о εϵ ûմϴ.
+	 *
+	 * @param texture Ӹ  ٽ ε ؽóԴϴ.
+	 * @param baseLevel ٽ ε ù ° Ӹ Դϴ.
+	 * @param endLevel ٽ ε  Ӹ   Դϴ.
+	 *
+	 * @note
+	 * -  ޼ TextureResidencyManager  Ӹ  ٽ ø  ȣմϴ.
+	 * - ε尡  ؽó  Ӹ (GL_TEXTURE_BASE_LEVEL) baseLevel մϴ.
+	 * - Ӹ   ̹  ۾ 忡 ڵ ̹ ٿ û Ӹ  εմϴ.
+	 */
+	void RequestLevels(Texture2D* texture, uint32_t baseLevel, uint32_t endLevel);
+
+
+	/**
+	 * @brief ε尡   ؽó ε û մϴ.
+	 *
+	 * @param texture ε û  ؽóԴϴ.
+	 */
+	void Cancel(Texture2D* texture);
+
+
+	/**
+	 * @brief ؽó ε û ε带 ٸ ִ Ȯմϴ.
+	 *
+	 * @param texture Ȯ ؽóԴϴ.
+	 *
+	 * @return ε尡   ε û ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsPending(const Texture2D* texture) const;
+
+
+	/**
+	 * @brief ڵ  ؽó ε   GPU εմϴ.
+	 *
+	 * @note
+	 * -  Ŵ BeginFrame Ӹ ȣմϴ.
+	 * - ε Ӹ   ϸ,  ӿ ּ   εմϴ.
+	 */
+	void Tick();
+
+
+	/**
+	 * @brief Ӵ ε Ʈ  մϴ.
+	 *
+	 * @param uploadBudget  Ӵ ε Ʈ Դϴ.
+	 */
+	void SetUploadBudget(uint32_t uploadBudget) { uploadBudget_ = uploadBudget; }
+
+
+	/**
+	 * @brief Ӵ ε Ʈ  ϴ.
+	 *
+	 * @return Ӵ ε Ʈ  ȯմϴ.
+	 */
+	uint32_t GetUploadBudget() const { return uploadBudget_; }
+
+
+	/**
+	 * @brief ε尡   ε û  ϴ.
+	 *
+	 * @return ε尡   ε û  ȯմϴ.
+	 */
+	uint32_t GetPendingCount() const { return static_cast<uint32_t>(requests_.size()); }
+
+
+	/**
+	 * @brief ε尡    ε ÷̽Ȧ ؽó ϴ.
+	 *
+	 * @return ÷̽Ȧ ؽó ҽ ID ȯմϴ.
+	 */
+	uint32_t GetPlaceholderTextureID() const { return placeholderTextureID_; }
+
+
+private:
+	/**
+	 * @brief ؽó Ʈ Ŵ Ʈ ڿ   Ҹڸ մϴ.
+	 */
+	DEFAULT_CONSTRUCTOR_AND_VIRTUAL_DESTRUCTOR(TextureStreamManager);
+
+
+	/**
+	 * @brief ε Ӹ Դϴ.
+	 */
+	struct Level;
+
+
+	/**
+	 * @brief ؽó ε ûԴϴ.
+	 */
+	struct LoadRequest;
+
+
+	/**
+	 * @brief ۾ 忡 ̹  а ε Ӹ  մϴ.
+	 *
+	 * @param request ڵ ؽó ε ûԴϴ.
+	 */
+	static void Decode(LoadRequest& request);
+
+
+	/**
+	 * @brief ؽó ε û Ӹ  ϳ εմϴ.
+	 *
+	 * @param request ε ؽó ε ûԴϴ.
+	 * @param level ε Ӹ Դϴ.
+	 * @param bIsUseStagingBuffer ¡ (PBO)  ε Դϴ.
+	 */
+	void UploadLevel(LoadRequest& request, const Level& level, bool bIsUseStagingBuffer);
+
+
+private:
+	/**
+	 * @brief ε尡   ؽó ε û Դϴ.
+	 */
+	std::deque<std::shared_ptr<LoadRequest>> requests_;
+
+
+	/**
+	 * @brief ε忡    ¡ Դϴ.
+	 */
+	RingBuffer* stagingBuffer_ = nullptr;
+
+
+	/**
+	 * @brief Ӵ ε Ʈ Դϴ.
+	 */
+	uint32_t uploadBudget_ = 0;
+
+
+	/**
+	 * @brief ÷̽Ȧ ؽó ҽ IDԴϴ.
+	 */
+	uint32_t placeholderTextureID_ = 0;
+};
\ No newline at end of file
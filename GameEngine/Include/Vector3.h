@@ -345,7 +345,7 @@ struct Vector3
 		{
 			T s;
 			T t;
-			T r;
+			T p;
 		};
 		T data[3];
 	};
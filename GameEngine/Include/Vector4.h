@@ -362,7 +362,7 @@ struct Vector4
 		{
 			T s;
 			T t;
-			T r;
+			T p;
 			T q;
 		};
 		T data[4];
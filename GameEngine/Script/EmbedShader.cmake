@@ -0,0 +1,31 @@
+# 엔진 셰이더 소스를 바이트 배열로 포함하는 C++ 소스 파일을 생성합니다.
+# 사용법: cmake -DSHADER_PATH=<셰이더 디렉토리> -DOUTPUT_FILE=<생성할 파일> -P EmbedShader.cmake
+
+file(GLOB SHADER_FILES RELATIVE "${SHADER_PATH}" "${SHADER_PATH}/*.vert" "${SHADER_PATH}/*.frag" "${SHADER_PATH}/*.glsl")
+list(SORT SHADER_FILES)
+
+set(ARRAYS "")
+set(ENTRIES "")
+
+foreach(SHADER_FILE ${SHADER_FILES})
+    string(MAKE_C_IDENTIFIER "${SHADER_FILE}" SHADER_NAME)
+    file(READ "${SHADER_PATH}/${SHADER_FILE}" SHADER_HEX HEX)
+    file(SIZE "${SHADER_PATH}/${SHADER_FILE}" SHADER_SIZE)
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," SHADER_HEX "${SHADER_HEX}")
+
+    # 0x80 이상의 바이트(UTF-8 주석 등)가 char로 축소 변환되지 않도록 unsigned char 배열로 생성합니다.
+    string(APPEND ARRAYS "static constexpr unsigned char ${SHADER_NAME}[] = { ${SHADER_HEX}0x00 };\n")
+    string(APPEND ENTRIES "\t{ \"${SHADER_FILE}\", reinterpret_cast<const char*>(${SHADER_NAME}), ${SHADER_SIZE} },\n")
+endforeach()
+
+list(LENGTH SHADER_FILES SHADER_COUNT)
+
+set(CONTENT "// Generated by EmbedShader.cmake at build time. Do not edit.\n")
+string(APPEND CONTENT "#include \"EmbeddedShaderUtils.h\"\n\n")
+string(APPEND CONTENT "${ARRAYS}\n")
+string(APPEND CONTENT "static const EmbeddedShaderUtils::File files[] =\n{\n${ENTRIES}};\n\n")
+string(APPEND CONTENT "const EmbeddedShaderUtils::File* EmbeddedShaderUtils::GetFiles()\n{\n\treturn files;\n}\n\n")
+string(APPEND CONTENT "uint32_t EmbeddedShaderUtils::GetFileCount()\n{\n\treturn ${SHADER_COUNT};\n}\n")
+
+# 내용이 같으면 파일을 다시 쓰지 않아 불필요한 재컴파일을 막습니다.
+file(CONFIGURE OUTPUT "${OUTPUT_FILE}" CONTENT "${CONTENT}" @ONLY)
\ No newline at end of file
@@ -0,0 +1,15 @@
+// per-draw data indexed by gl_BaseInstance, see ShaderDataUtils::DrawData
+struct DrawData
+{
+	mat4 world;
+	mat4 normal;
+	int textureSlot; // slot of TextureBindingTable, -1 if the draw has no texture
+	int padding0;
+	int padding1;
+	int padding2;
+};
+
+layout(std430, binding = 4) readonly buffer DrawBuffer
+{
+	DrawData draws[];
+};
\ No newline at end of file
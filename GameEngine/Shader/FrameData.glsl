@@ -0,0 +1,13 @@
+// per-frame data, see ShaderDataUtils::FrameData
+const int MAX_LIGHT_MATRIX_COUNT = 4;
+
+layout(std140, binding = 0) uniform FrameBuffer
+{
+	mat4 view;
+	mat4 projection;
+	mat4 viewProjection;
+	mat4 lightViewProjections[MAX_LIGHT_MATRIX_COUNT];
+	vec4 lightSplits;
+	vec4 viewPosition;
+	vec4 time;
+} frame;
\ No newline at end of file
@@ -5,12 +5,11 @@ layout(location = 1) in vec4 inColor;
 
 layout(location = 0) out vec4 outColor;
 
-uniform mat4 world;
-uniform mat4 view;
-uniform mat4 projection;
+#include "PassData.glsl"
+#include "DrawData.glsl"
 
 void main()
 {
-	gl_Position = projection * view * world * vec4(inPosition, 1.0f);
+	gl_Position = pass.viewProjection * draws[gl_BaseInstance].world * vec4(inPosition, 1.0f);
 	outColor = inColor;
 }
\ No newline at end of file
@@ -0,0 +1,7 @@
+// per-pass data, see ShaderDataUtils::PassData
+layout(std140, binding = 3) uniform PassBuffer
+{
+	mat4 view;
+	mat4 projection;
+	mat4 viewProjection;
+} pass;
\ No newline at end of file
@@ -1,6 +1,17 @@
 #version 460 core
 
+// depth only pass keeps early depth test; VARIANCE_SHADOW_MAP adds the moments output
+#ifdef VARIANCE_SHADOW_MAP
+layout(location = 0) out vec2 outMoments;
+#endif
+
 void main()
 {
-	gl_FragDepth = gl_FragCoord.z;
+#ifdef VARIANCE_SHADOW_MAP
+	float depth = gl_FragCoord.z;
+	float dx = dFdx(depth);
+	float dy = dFdy(depth);
+
+	outMoments = vec2(depth, depth * depth + 0.25f * (dx * dx + dy * dy));
+#endif
 }
\ No newline at end of file
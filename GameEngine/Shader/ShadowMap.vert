@@ -2,11 +2,10 @@
 
 layout(location = 0) in vec3 inPosition;
 
-uniform mat4 world;
-uniform mat4 lightView;
-uniform mat4 lightProjection;
+#include "PassData.glsl"
+#include "DrawData.glsl"
 
 void main()
 {
-	gl_Position = lightProjection * lightView * world * vec4(inPosition, 1.0f);
+	gl_Position = pass.viewProjection * draws[gl_BaseInstance].world * vec4(inPosition, 1.0f);
 }
\ No newline at end of file
@@ -4,14 +4,13 @@ layout(location = 0) in vec3 inPosition;
 
 layout(location = 0) out vec3 outTexture;
 
-uniform mat4 view;
-uniform mat4 projection;
+#include "PassData.glsl"
 
 void main()
 {
 	outTexture = inPosition;
-	mat4 view3x3 = mat4(mat3(view));
+	mat4 view3x3 = mat4(mat3(pass.view));
 	
-	vec4 position = projection * view3x3 * vec4(inPosition, 1.0f);
+	vec4 position = pass.projection * view3x3 * vec4(inPosition, 1.0f);
 	gl_Position = position.xyww;
 }
\ No newline at end of file
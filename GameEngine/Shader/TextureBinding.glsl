@@ -0,0 +1,49 @@
+// per-texture slot data indexed by a texture slot, see TextureBindingTable
+// the slot must be dynamically uniform, e.g. DrawData.textureSlot of draws[gl_BaseInstance]
+// include right after #version, the bindless backend needs an #extension directive
+#if defined(TEXTURE_BINDLESS)
+#extension GL_ARB_bindless_texture : require
+#endif
+
+struct TextureSlot
+{
+	uvec2 handle;
+	int arrayIndex;
+	int layer;
+};
+
+layout(std430, binding = 5) readonly buffer TextureSlotBuffer
+{
+	TextureSlot textureSlots[];
+};
+
+const vec4 PLACEHOLDER_TEXTURE_COLOR = vec4(0.5f, 0.5f, 0.5f, 1.0f);
+
+#if defined(TEXTURE_BINDLESS)
+vec4 SampleTextureSlot(int slot, vec2 uv)
+{
+	TextureSlot textureSlot = textureSlots[slot];
+	if(textureSlot.arrayIndex < 0)
+	{
+		return PLACEHOLDER_TEXTURE_COLOR;
+	}
+
+	return texture(sampler2D(textureSlot.handle), uv);
+}
+#else
+const int MAX_TEXTURE_ARRAY_COUNT = 8;
+
+layout(binding = 8) uniform sampler2DArray textureArrays[MAX_TEXTURE_ARRAY_COUNT];
+
+vec4 SampleTextureSlot(int slot, vec2 uv)
+{
+	TextureSlot textureSlot = textureSlots[slot];
+	if(textureSlot.arrayIndex < 0)
+	{
+		return PLACEHOLDER_TEXTURE_COLOR;
+	}
+
+	// indexing a sampler array needs a dynamically uniform index, arrayIndex is loaded from a dynamically uniform slot so it is too
+	return texture(textureArrays[textureSlot.arrayIndex], vec3(uv, float(textureSlot.layer)));
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,248 @@
+#include "CascadedShadowMap.h"
+
+#include "Assertion.h"
+#include "GLAssertion.h"
+#include "GLResourceUtils.h"
+
+#include <glad/glad.h>
+
+/**
+ * @brief ĳ̵ ε  ̰ ؽó 迭 մϴ.
+ *
+ * @note ϵ PCF      ͸ մϴ.
+ */
+static uint32_t CreateDepthTextureArray(uint32_t shadowSize, uint32_t cascadeCount)
+{
+	uint32_t textureID = 0;
+	float border[] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+	textureID = GLResourceUtils::CreateTexture(GL_TEXTURE_2D_ARRAY, GL_LINEAR, GL_LINEAR, GL_CLAMP_TO_BORDER);
+	GL_ASSERT(glTextureStorage3D(textureID, 1, GL_DEPTH_COMPONENT32F, shadowSize, shadowSize, cascadeCount), "failed to allocate cascaded shadow map texture array...");
+	GL_ASSERT(glTextureParameterfv(textureID, GL_TEXTURE_BORDER_COLOR, border), "failed to set texture border color...");
+	GL_ASSERT(glTextureParameteri(textureID, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE), "failed to set texture compare mode...");
+	GL_ASSERT(glTextureParameteri(textureID, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL), "failed to set texture compare function...");
+
+	return textureID;
+}
+
+/**
+ * @brief Variance  Ʈ(,  ) ؽó 迭 մϴ.
+ */
+static uint32_t CreateMomentsTextureArray(uint32_t shadowSize, uint32_t cascadeCount, bool bEnableMipmap)
+{
+	uint32_t textureID = 0;
+	float border[] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+	int32_t levels = 1;
+	if (bEnableMipmap)
+	{
+		for (uint32_t size = shadowSize; size > 1; size >>= 1)
+		{
+			levels++;
+		}
+	}
+
+	textureID = GLResourceUtils::CreateTexture(GL_TEXTURE_2D_ARRAY, bEnableMipmap ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR, GL_LINEAR, GL_CLAMP_TO_BORDER);
+	GL_ASSERT(glTextureStorage3D(textureID, levels, GL_RG32F, shadowSize, shadowSize, cascadeCount), "failed to allocate cascaded shadow map moments texture array...");
+	GL_ASSERT(glTextureParameterfv(textureID, GL_TEXTURE_BORDER_COLOR, border), "failed to set texture border color...");
+
+	return textureID;
+}
+
+/**
+ * @brief ̰ ؽó 迭( Ʈ ؽó 迭) ù ° ̾  ϴ  ۸ մϴ.
+ */
+static uint32_t CreateShadowFramebuffer(uint32_t depthID, uint32_t momentsID)
+{
+	uint32_t framebufferID = 0;
+
+	GL_ASSERT(glCreateFramebuffers(1, &framebufferID), "failed to create cascaded shadow map framebuffer...");
+	GL_ASSERT(glNamedFramebufferTextureLayer(framebufferID, GL_DEPTH_ATTACHMENT, depthID, 0, 0), "failed to set framebuffer depth buffer...");
+
+	if (momentsID != 0)
+	{
+		GL_ASSERT(glNamedFramebufferTextureLayer(framebufferID, GL_COLOR_ATTACHMENT0, momentsID, 0, 0), "failed to set framebuffer moments buffer...");
+		GL_ASSERT(glNamedFramebufferDrawBuffer(framebufferID, GL_COLOR_ATTACHMENT0), "failed to set moments buffer to draw buffer...");
+	}
+	else
+	{
+		GL_ASSERT(glNamedFramebufferDrawBuffer(framebufferID, GL_NONE), "failed to no color buffers are written...");
+	}
+	GL_ASSERT(glNamedFramebufferReadBuffer(framebufferID, GL_NONE), "failed to select a color buffer source for pixels...");
+
+	GLenum state = glCheckNamedFramebufferStatus(framebufferID, GL_FRAMEBUFFER);
+	ASSERT(state == GL_FRAMEBUFFER_COMPLETE, "not complete framebuffer state : %x...", static_cast<int32_t>(state));
+
+	return framebufferID;
+}
+
+CascadedShadowMap::~CascadedShadowMap()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void CascadedShadowMap::Initialize(uint32_t shadowSize, uint32_t cascadeCount, bool bEnableStaticCache, EShadowFilter filter)
+{
+	ASSERT(!bIsInitialized_, "already initialize cascaded shadow map...");
+	ASSERT(shadowSize > 0, "%d is invalid cascaded shadow map size...", shadowSize);
+	ASSERT(MIN_CASCADE_COUNT <= cascadeCount && cascadeCount <= MAX_CASCADE_COUNT, "%d is invalid cascade count...", cascadeCount);
+
+	shadowSize_ = shadowSize;
+	cascadeCount_ = cascadeCount;
+	filter_ = filter;
+
+	shadowMapID_ = CreateDepthTextureArray(shadowSize_, cascadeCount_);
+	if (filter_ == EShadowFilter::Variance)
+	{
+		momentsID_ = CreateMomentsTextureArray(shadowSize_, cascadeCount_, true);
+	}
+	shadowMapFBO_ = CreateShadowFramebuffer(shadowMapID_, momentsID_);
+
+	bIsEnableStaticCache_ = bEnableStaticCache;
+	if (bIsEnableStaticCache_)
+	{
+		staticCacheID_ = CreateDepthTextureArray(shadowSize_, cascadeCount_);
+		if (filter_ == EShadowFilter::Variance)
+		{
+			staticCacheMomentsID_ = CreateMomentsTextureArray(shadowSize_, cascadeCount_, false);
+		}
+		staticCacheFBO_ = CreateShadowFramebuffer(staticCacheID_, staticCacheMomentsID_);
+
+		MarkAllStaticCacheDirty();
+	}
+
+	bIsInitialized_ = true;
+}
+
+void CascadedShadowMap::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+	if (bIsEnableStaticCache_)
+	{
+		if (staticCacheMomentsID_ != 0)
+		{
+			GL_ASSERT(glDeleteTextures(1, &staticCacheMomentsID_), "failed to delete cascaded shadow map static cache moments texture...");
+			staticCacheMomentsID_ = 0;
+		}
+
+		GL_ASSERT(glDeleteTextures(1, &staticCacheID_), "failed to delete cascaded shadow map static cache texture...");
+		GL_ASSERT(glDeleteFramebuffers(1, &staticCacheFBO_), "failed to delete cascaded shadow map static cache framebuffer...");
+	}
+
+	if (momentsID_ != 0)
+	{
+		GL_ASSERT(glDeleteTextures(1, &momentsID_), "failed to delete cascaded shadow map moments texture...");
+		momentsID_ = 0;
+	}
+
+	GL_ASSERT(glDeleteTextures(1, &shadowMapID_), "failed to delete cascaded shadow map texture...");
+	GL_ASSERT(glDeleteFramebuffers(1, &shadowMapFBO_), "failed to delete cascaded shadow map framebuffer...");
+
+	bIsInitialized_ = false;
+}
+
+void CascadedShadowMap::Clear()
+{
+	ASSERT(bIsBind_, "unbind this cascaded shadow map...");
+	glClear(GL_DEPTH_BUFFER_BIT);
+
+	if (filter_ == EShadowFilter::Variance)
+	{
+		float moments[] = { 1.0f, 1.0f, 0.0f, 0.0f };
+		GL_ASSERT(glClearBufferfv(GL_COLOR, 0, moments), "failed to clear moments buffer...");
+	}
+}
+
+void CascadedShadowMap::Bind(uint32_t cascade)
+{
+	ASSERT(cascade < cascadeCount_, "out of range cascade index : %d...", cascade);
+
+	bIsBind_ = true;
+	GL_ASSERT(glBindFramebuffer(GL_FRAMEBUFFER, shadowMapFBO_), "failed to bind cascaded shadow map framebuffer...");
+	GL_ASSERT(glNamedFramebufferTextureLayer(shadowMapFBO_, GL_DEPTH_ATTACHMENT, shadowMapID_, 0, cascade), "failed to attach cascade layer...");
+	if (momentsID_ != 0)
+	{
+		GL_ASSERT(glNamedFramebufferTextureLayer(shadowMapFBO_, GL_COLOR_ATTACHMENT0, momentsID_, 0, cascade), "failed to attach cascade moments layer...");
+		bIsMomentsMipmapDirty_ = true;
+	}
+	GL_ASSERT(glViewport(0, 0, shadowSize_, shadowSize_), "failed to set cascaded shadow map viewport...");
+}
+
+void CascadedShadowMap::Unbind()
+{
+	if (bIsBind_)
+	{
+		bIsBind_ = false;
+		GL_ASSERT(glBindFramebuffer(GL_FRAMEBUFFER, 0), "failed to unbind cascaded shadow map framebuffer...");
+	}
+}
+
+void CascadedShadowMap::BindStaticCache(uint32_t cascade)
+{
+	ASSERT(bIsEnableStaticCache_, "disable cascaded shadow map static cache...");
+	ASSERT(cascade < cascadeCount_, "out of range cascade index : %d...", cascade);
+
+	bIsBind_ = true;
+	GL_ASSERT(glBindFramebuffer(GL_FRAMEBUFFER, staticCacheFBO_), "failed to bind cascaded shadow map static cache framebuffer...");
+	GL_ASSERT(glNamedFramebufferTextureLayer(staticCacheFBO_, GL_DEPTH_ATTACHMENT, staticCacheID_, 0, cascade), "failed to attach static cache cascade layer...");
+	if (staticCacheMomentsID_ != 0)
+	{
+		GL_ASSERT(glNamedFramebufferTextureLayer(staticCacheFBO_, GL_COLOR_ATTACHMENT0, staticCacheMomentsID_, 0, cascade), "failed to attach static cache cascade moments layer...");
+	}
+	GL_ASSERT(glViewport(0, 0, shadowSize_, shadowSize_), "failed to set cascaded shadow map viewport...");
+
+	bIsStaticCacheDirty_[cascade] = false;
+}
+
+void CascadedShadowMap::RestoreStaticCache(uint32_t cascade)
+{
+	ASSERT(bIsBind_, "unbind this cascaded shadow map...");
+	ASSERT(bIsEnableStaticCache_, "disable cascaded shadow map static cache...");
+	ASSERT(!bIsStaticCacheDirty_[cascade], "static cache of cascade %d is dirty...", cascade);
+
+	GL_ASSERT(glCopyImageSubData(
+		staticCacheID_, GL_TEXTURE_2D_ARRAY, 0, 0, 0, cascade,
+		shadowMapID_, GL_TEXTURE_2D_ARRAY, 0, 0, 0, cascade,
+		shadowSize_, shadowSize_, 1
+	), "failed to copy static cache depth...");
+
+	if (staticCacheMomentsID_ != 0)
+	{
+		GL_ASSERT(glCopyImageSubData(
+			staticCacheMomentsID_, GL_TEXTURE_2D_ARRAY, 0, 0, 0, cascade,
+			momentsID_, GL_TEXTURE_2D_ARRAY, 0, 0, 0, cascade,
+			shadowSize_, shadowSize_, 1
+		), "failed to copy static cache moments...");
+	}
+}
+
+void CascadedShadowMap::MarkStaticCacheDirty(uint32_t cascade)
+{
+	ASSERT(cascade < cascadeCount_, "out of range cascade index : %d...", cascade);
+	bIsStaticCacheDirty_[cascade] = true;
+}
+
+void CascadedShadowMap::MarkAllStaticCacheDirty()
+{
+	bIsStaticCacheDirty_.fill(true);
+}
+
+void CascadedShadowMap::Active(uint32_t unit)
+{
+	GL_ASSERT(glBindTextureUnit(unit, shadowMapID_), "failed to bind cascaded shadow map texture to %d texture unit...", unit);
+
+	if (momentsID_ != 0)
+	{
+		if (bIsMomentsMipmapDirty_)
+		{
+			GL_ASSERT(glGenerateTextureMipmap(momentsID_), "failed to generate cascaded shadow map moments mipmap...");
+			bIsMomentsMipmapDirty_ = false;
+		}
+
+		GL_ASSERT(glBindTextureUnit(unit + 1, momentsID_), "failed to bind cascaded shadow map moments texture to %d texture unit...", (unit + 1));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include "ClusteredLightBuffer.h"
+
+#include "Assertion.h"
+#include "GLAssertion.h"
+#include "ShaderDataUtils.h"
+
+#include <glad/glad.h>
+
+/**
+ * @brief ̴ 丮 ۸  ·   ͸ εմϴ.
+ */
+static void UploadShaderStorageBuffer(uint32_t bufferObject, uint32_t size, uint32_t minSize, const void* data)
+{
+	GL_ASSERT(glNamedBufferData(bufferObject, (size < minSize) ? minSize : size, nullptr, GL_STREAM_DRAW), "failed to orphan clustered light buffer...");
+
+	if (size > 0)
+	{
+		GL_ASSERT(glNamedBufferSubData(bufferObject, 0, size, data), "failed to write clustered light buffer...");
+	}
+}
+
+ClusteredLightBuffer::~ClusteredLightBuffer()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void ClusteredLightBuffer::Initialize(uint32_t maxLightCount)
+{
+	ASSERT(!bIsInitialized_, "already initialize clustered light buffer resource...");
+
+	lightPool_.Initialize(ShaderBufferPool::EType::ShaderStorage, sizeof(ShaderDataUtils::LightData), maxLightCount);
+	lightIDs_.clear();
+
+	GL_ASSERT(glCreateBuffers(1, &clusterBufferObject_), "failed to create clustered light cluster buffer...");
+	GL_ASSERT(glCreateBuffers(1, &lightIndexBufferObject_), "failed to create clustered light index buffer...");
+
+	bIsInitialized_ = true;
+}
+
+void ClusteredLightBuffer::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+	bIsInitialized_ = false;
+
+	GL_ASSERT(glDeleteBuffers(1, &lightIndexBufferObject_), "failed to delete clustered light index buffer...");
+	GL_ASSERT(glDeleteBuffers(1, &clusterBufferObject_), "failed to delete clustered light cluster buffer...");
+
+	lightPool_.Release();
+}
+
+void ClusteredLightBuffer::Upload(const LightClusterBuilder& builder, const std::vector<PointLight>& pointLights, const std::vector<SpotLight>& spotLights)
+{
+	ASSERT(bIsInitialized_, "not initialized clustered light buffer resource...");
+
+	const std::vector<LightClusterBuilder::LightBound>& lightBounds = builder.GetLightBounds();
+	ASSERT(lightBounds.size() == pointLights.size() + spotLights.size(), "mismatch clustered light count : (bound : %d, light : %d)", lightBounds.size(), pointLights.size() + spotLights.size());
+
+	uint32_t lightCount = static_cast<uint32_t>(lightBounds.size());
+	while (lightIDs_.size() < lightCount)
+	{
+		int32_t lightID = lightPool_.Allocate();
+		ASSERT(lightID == static_cast<int32_t>(lightIDs_.size()), "invalid clustered light id : %d", lightID);
+
+		lightIDs_.push_back(lightID);
+	}
+
+	while (lightIDs_.size() > lightCount)
+	{
+		lightPool_.Free(lightIDs_.back());
+		lightIDs_.pop_back();
+	}
+
+	uint32_t lightIndex = 0;
+	for (const auto& pointLight : pointLights)
+	{
+		ShaderDataUtils::LightData light = ShaderDataUtils::Pack(pointLight, lightBounds[lightIndex].radius);
+		lightPool_.Update(lightIDs_[lightIndex++], &light);
+	}
+
+	for (const auto& spotLight : spotLights)
+	{
+		ShaderDataUtils::LightData light = ShaderDataUtils::Pack(spotLight, lightBounds[lightIndex].radius);
+		lightPool_.Update(lightIDs_[lightIndex++], &light);
+	}
+
+	lightPool_.Flush();
+
+	const std::vector<LightClusterBuilder::ClusterEntry>& clusterEntries = builder.GetClusterEntries();
+	const std::vector<uint32_t>& lightIndices = builder.GetLightIndices();
+
+	UploadShaderStorageBuffer(clusterBufferObject_, static_cast<uint32_t>(clusterEntries.size() * sizeof(LightClusterBuilder::ClusterEntry)), sizeof(LightClusterBuilder::ClusterEntry), clusterEntries.data());
+	UploadShaderStorageBuffer(lightIndexBufferObject_, static_cast<uint32_t>(lightIndices.size() * sizeof(uint32_t)), sizeof(uint32_t), lightIndices.data());
+}
+
+void ClusteredLightBuffer::Bind()
+{
+	ASSERT(bIsInitialized_, "not initialized clustered light buffer resource...");
+
+	lightPool_.Bind(LIGHT_BUFFER_BINDING);
+	GL_ASSERT(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CLUSTER_BUFFER_BINDING, clusterBufferObject_), "failed to bind clustered light cluster buffer...");
+	GL_ASSERT(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, LIGHT_INDEX_BUFFER_BINDING, lightIndexBufferObject_), "failed to bind clustered light index buffer...");
+}
\ No newline at end of file
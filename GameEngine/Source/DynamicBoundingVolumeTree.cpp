@@ -0,0 +1,439 @@
+#include "DynamicBoundingVolumeTree.h"
+
+#include "Assertion.h"
+#include "MathUtils.h"
+
+DynamicBoundingVolumeTree::DynamicBoundingVolumeTree(float fatMargin)
+	: fatMargin_(fatMargin)
+{
+}
+
+int32_t DynamicBoundingVolumeTree::Insert(const AxisAlignedBoundingBox& bound, uint32_t userData)
+{
+	int32_t proxyID = AllocateNode();
+
+	Vector3f margin(fatMargin_, fatMargin_, fatMargin_);
+
+	Node& node = nodes_[proxyID];
+	node.bound = AxisAlignedBoundingBox(bound.minPosition - margin, bound.maxPosition + margin);
+	node.userData = userData;
+	node.height = 0;
+
+	InsertLeaf(proxyID);
+	proxyCount_++;
+
+	return proxyID;
+}
+
+void DynamicBoundingVolumeTree::Remove(int32_t proxyID)
+{
+	ASSERT(0 <= proxyID && proxyID < static_cast<int32_t>(nodes_.size()) && nodes_[proxyID].IsLeaf(), "invalid bounding volume tree proxy id : %d", proxyID);
+
+	RemoveLeaf(proxyID);
+	FreeNode(proxyID);
+	proxyCount_--;
+}
+
+bool DynamicBoundingVolumeTree::Refit(int32_t proxyID, const AxisAlignedBoundingBox& bound)
+{
+	ASSERT(0 <= proxyID && proxyID < static_cast<int32_t>(nodes_.size()) && nodes_[proxyID].IsLeaf(), "invalid bounding volume tree proxy id : %d", proxyID);
+
+	if (nodes_[proxyID].bound.Contain(bound))
+	{
+		return false;
+	}
+
+	RemoveLeaf(proxyID);
+
+	Vector3f margin(fatMargin_, fatMargin_, fatMargin_);
+	nodes_[proxyID].bound = AxisAlignedBoundingBox(bound.minPosition - margin, bound.maxPosition + margin);
+
+	InsertLeaf(proxyID);
+	return true;
+}
+
+void DynamicBoundingVolumeTree::Query(const Frustum& frustum, std::vector<uint32_t>& outUserData)
+{
+	queryStatistics_ = { 0, 0, 0 };
+
+	if (root_ == NULL_NODE)
+	{
+		return;
+	}
+
+	std::size_t beginSize = outUserData.size();
+
+	queryStack_.clear();
+	queryStack_.push_back(root_);
+
+	while (!queryStack_.empty())
+	{
+		int32_t nodeID = queryStack_.back();
+		queryStack_.pop_back();
+
+		const Node& node = nodes_[nodeID];
+		queryStatistics_.visitNodeCount++;
+		queryStatistics_.testNodeCount++;
+
+		EContainment containment = frustum.Contain(node.bound);
+		if (containment == EContainment::Outside)
+		{
+			continue;
+		}
+
+		if (node.IsLeaf())
+		{
+			outUserData.push_back(node.userData);
+		}
+		else if (containment == EContainment::Inside)
+		{
+			CollectLeaves(nodeID, outUserData);
+		}
+		else
+		{
+			queryStack_.push_back(node.child1);
+			queryStack_.push_back(node.child2);
+		}
+	}
+
+	queryStatistics_.visibleCount = static_cast<uint32_t>(outUserData.size() - beginSize);
+}
+
+void DynamicBoundingVolumeTree::Query(const AxisAlignedBoundingBox& bound, std::vector<uint32_t>& outUserData)
+{
+	queryStatistics_ = { 0, 0, 0 };
+
+	if (root_ == NULL_NODE)
+	{
+		return;
+	}
+
+	std::size_t beginSize = outUserData.size();
+
+	queryStack_.clear();
+	queryStack_.push_back(root_);
+
+	while (!queryStack_.empty())
+	{
+		int32_t nodeID = queryStack_.back();
+		queryStack_.pop_back();
+
+		const Node& node = nodes_[nodeID];
+		queryStatistics_.visitNodeCount++;
+		queryStatistics_.testNodeCount++;
+
+		if (!node.bound.Intersect(bound))
+		{
+			continue;
+		}
+
+		if (node.IsLeaf())
+		{
+			outUserData.push_back(node.userData);
+		}
+		else
+		{
+			queryStack_.push_back(node.child1);
+			queryStack_.push_back(node.child2);
+		}
+	}
+
+	queryStatistics_.visibleCount = static_cast<uint32_t>(outUserData.size() - beginSize);
+}
+
+void DynamicBoundingVolumeTree::Clear()
+{
+	nodes_.clear();
+	root_ = NULL_NODE;
+	freeList_ = NULL_NODE;
+	proxyCount_ = 0;
+}
+
+const AxisAlignedBoundingBox& DynamicBoundingVolumeTree::GetFatBoundingBox(int32_t proxyID) const
+{
+	ASSERT(0 <= proxyID && proxyID < static_cast<int32_t>(nodes_.size()), "invalid bounding volume tree proxy id : %d", proxyID);
+	return nodes_[proxyID].bound;
+}
+
+uint32_t DynamicBoundingVolumeTree::GetUserData(int32_t proxyID) const
+{
+	ASSERT(0 <= proxyID && proxyID < static_cast<int32_t>(nodes_.size()), "invalid bounding volume tree proxy id : %d", proxyID);
+	return nodes_[proxyID].userData;
+}
+
+int32_t DynamicBoundingVolumeTree::GetHeight() const
+{
+	return (root_ == NULL_NODE) ? 0 : nodes_[root_].height + 1;
+}
+
+int32_t DynamicBoundingVolumeTree::AllocateNode()
+{
+	if (freeList_ == NULL_NODE)
+	{
+		Node node;
+		node.parent = NULL_NODE;
+		node.child1 = NULL_NODE;
+		node.child2 = NULL_NODE;
+		node.height = 0;
+		node.userData = 0;
+
+		nodes_.push_back(node);
+		return static_cast<int32_t>(nodes_.size()) - 1;
+	}
+
+	int32_t nodeID = freeList_;
+	freeList_ = nodes_[nodeID].parent;
+
+	Node& node = nodes_[nodeID];
+	node.parent = NULL_NODE;
+	node.child1 = NULL_NODE;
+	node.child2 = NULL_NODE;
+	node.height = 0;
+	node.userData = 0;
+
+	return nodeID;
+}
+
+void DynamicBoundingVolumeTree::FreeNode(int32_t nodeID)
+{
+	nodes_[nodeID].parent = freeList_;
+	nodes_[nodeID].height = -1;
+	freeList_ = nodeID;
+}
+
+void DynamicBoundingVolumeTree::InsertLeaf(int32_t leaf)
+{
+	if (root_ == NULL_NODE)
+	{
+		root_ = leaf;
+		nodes_[root_].parent = NULL_NODE;
+		return;
+	}
+
+	const AxisAlignedBoundingBox leafBound = nodes_[leaf].bound;
+
+	int32_t index = root_;
+	while (!nodes_[index].IsLeaf())
+	{
+		int32_t child1 = nodes_[index].child1;
+		int32_t child2 = nodes_[index].child2;
+
+		float area = nodes_[index].bound.GetSurfaceArea();
+		float combinedArea = Combine(nodes_[index].bound, leafBound).GetSurfaceArea();
+
+		float cost = 2.0f * combinedArea;
+		float inheritanceCost = 2.0f * (combinedArea - area);
+
+		float cost1 = Combine(leafBound, nodes_[child1].bound).GetSurfaceArea() + inheritanceCost;
+		if (!nodes_[child1].IsLeaf())
+		{
+			cost1 -= nodes_[child1].bound.GetSurfaceArea();
+		}
+
+		float cost2 = Combine(leafBound, nodes_[child2].bound).GetSurfaceArea() + inheritanceCost;
+		if (!nodes_[child2].IsLeaf())
+		{
+			cost2 -= nodes_[child2].bound.GetSurfaceArea();
+		}
+
+		if (cost < cost1 && cost < cost2)
+		{
+			break;
+		}
+
+		index = (cost1 < cost2) ? child1 : child2;
+	}
+
+	int32_t sibling = index;
+	int32_t oldParent = nodes_[sibling].parent;
+	int32_t newParent = AllocateNode();
+
+	nodes_[newParent].parent = oldParent;
+	nodes_[newParent].bound = Combine(leafBound, nodes_[sibling].bound);
+	nodes_[newParent].height = nodes_[sibling].height + 1;
+	nodes_[newParent].child1 = sibling;
+	nodes_[newParent].child2 = leaf;
+
+	nodes_[sibling].parent = newParent;
+	nodes_[leaf].parent = newParent;
+
+	if (oldParent != NULL_NODE)
+	{
+		if (nodes_[oldParent].child1 == sibling)
+		{
+			nodes_[oldParent].child1 = newParent;
+		}
+		else
+		{
+			nodes_[oldParent].child2 = newParent;
+		}
+	}
+	else
+	{
+		root_ = newParent;
+	}
+
+	RefitAncestors(nodes_[leaf].parent);
+}
+
+void DynamicBoundingVolumeTree::RemoveLeaf(int32_t leaf)
+{
+	if (leaf == root_)
+	{
+		root_ = NULL_NODE;
+		return;
+	}
+
+	int32_t parent = nodes_[leaf].parent;
+	int32_t grandParent = nodes_[parent].parent;
+	int32_t sibling = (nodes_[parent].child1 == leaf) ? nodes_[parent].child2 : nodes_[parent].child1;
+
+	if (grandParent != NULL_NODE)
+	{
+		if (nodes_[grandParent].child1 == parent)
+		{
+			nodes_[grandParent].child1 = sibling;
+		}
+		else
+		{
+			nodes_[grandParent].child2 = sibling;
+		}
+
+		nodes_[sibling].parent = grandParent;
+		FreeNode(parent);
+
+		RefitAncestors(grandParent);
+	}
+	else
+	{
+		root_ = sibling;
+		nodes_[sibling].parent = NULL_NODE;
+		FreeNode(parent);
+	}
+
+	nodes_[leaf].parent = NULL_NODE;
+}
+
+void DynamicBoundingVolumeTree::RefitAncestors(int32_t nodeID)
+{
+	int32_t index = nodeID;
+	while (index != NULL_NODE)
+	{
+		index = Balance(index);
+
+		int32_t child1 = nodes_[index].child1;
+		int32_t child2 = nodes_[index].child2;
+
+		nodes_[index].height = 1 + MathUtils::Max(nodes_[child1].height, nodes_[child2].height);
+		nodes_[index].bound = Combine(nodes_[child1].bound, nodes_[child2].bound);
+
+		index = nodes_[index].parent;
+	}
+}
+
+int32_t DynamicBoundingVolumeTree::Balance(int32_t nodeA)
+{
+	Node& a = nodes_[nodeA];
+	if (a.IsLeaf() || a.height < 2)
+	{
+		return nodeA;
+	}
+
+	int32_t nodeB = a.child1;
+	int32_t nodeC = a.child2;
+	int32_t balance = nodes_[nodeC].height - nodes_[nodeB].height;
+
+	auto rotate = [&](int32_t nodeUp, int32_t nodeStay)
+		{
+			Node& up = nodes_[nodeUp];
+			int32_t nodeF = up.child1;
+			int32_t nodeG = up.child2;
+
+			up.child1 = nodeA;
+			up.parent = nodes_[nodeA].parent;
+			nodes_[nodeA].parent = nodeUp;
+
+			if (up.parent != NULL_NODE)
+			{
+				if (nodes_[up.parent].child1 == nodeA)
+				{
+					nodes_[up.parent].child1 = nodeUp;
+				}
+				else
+				{
+					nodes_[up.parent].child2 = nodeUp;
+				}
+			}
+			else
+			{
+				root_ = nodeUp;
+			}
+
+			int32_t nodeKeep = (nodes_[nodeF].height > nodes_[nodeG].height) ? nodeF : nodeG;
+			int32_t nodeMove = (nodeKeep == nodeF) ? nodeG : nodeF;
+
+			up.child2 = nodeKeep;
+			if (nodes_[nodeA].child1 == nodeUp)
+			{
+				nodes_[nodeA].child1 = nodeMove;
+			}
+			else
+			{
+				nodes_[nodeA].child2 = nodeMove;
+			}
+			nodes_[nodeMove].parent = nodeA;
+
+			nodes_[nodeA].bound = Combine(nodes_[nodeStay].bound, nodes_[nodeMove].bound);
+			nodes_[nodeA].height = 1 + MathUtils::Max(nodes_[nodeStay].height, nodes_[nodeMove].height);
+
+			up.bound = Combine(nodes_[nodeA].bound, nodes_[nodeKeep].bound);
+			up.height = 1 + MathUtils::Max(nodes_[nodeA].height, nodes_[nodeKeep].height);
+		};
+
+	if (balance > 1)
+	{
+		rotate(nodeC, nodeB);
+		return nodeC;
+	}
+
+	if (balance < -1)
+	{
+		rotate(nodeB, nodeC);
+		return nodeB;
+	}
+
+	return nodeA;
+}
+
+void DynamicBoundingVolumeTree::CollectLeaves(int32_t nodeID, std::vector<uint32_t>& outUserData)
+{
+	std::size_t stackBase = queryStack_.size();
+	queryStack_.push_back(nodeID);
+
+	while (queryStack_.size() > stackBase)
+	{
+		int32_t index = queryStack_.back();
+		queryStack_.pop_back();
+
+		const Node& node = nodes_[index];
+		queryStatistics_.visitNodeCount++;
+
+		if (node.IsLeaf())
+		{
+			outUserData.push_back(node.userData);
+		}
+		else
+		{
+			queryStack_.push_back(node.child1);
+			queryStack_.push_back(node.child2);
+		}
+	}
+}
+
+AxisAlignedBoundingBox DynamicBoundingVolumeTree::Combine(const AxisAlignedBoundingBox& lhs, const AxisAlignedBoundingBox& rhs)
+{
+	return AxisAlignedBoundingBox(
+		Vector3f(MathUtils::Min(lhs.minPosition.x, rhs.minPosition.x), MathUtils::Min(lhs.minPosition.y, rhs.minPosition.y), MathUtils::Min(lhs.minPosition.z, rhs.minPosition.z)),
+		Vector3f(MathUtils::Max(lhs.maxPosition.x, rhs.maxPosition.x), MathUtils::Max(lhs.maxPosition.y, rhs.maxPosition.y), MathUtils::Max(lhs.maxPosition.z, rhs.maxPosition.z))
+	);
+}
\ No newline at end of file
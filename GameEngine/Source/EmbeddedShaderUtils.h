@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+
+
+/**
+ * @brief     ̺귯   ̴ ҽ մϴ.
+ *
+ * @note
+ * -     Script/EmbedShader.cmake GameEngine/Shader Ϸκ մϴ.
+ * - ̴ ҽ  ڷ  Ʈ 迭 Ե˴ϴ.
+ */
+namespace EmbeddedShaderUtils
+{
+	/**
+	 * @brief Ե ̴ ҽ Դϴ.
+	 */
+	struct File
+	{
+		const char* name;
+		const char* code;
+		uint32_t size;
+	};
+
+
+	/**
+	 * @brief Ե ̴ ҽ   ϴ.
+	 *
+	 * @return Ե ̴ ҽ    ͸ ȯմϴ.
+	 */
+	const File* GetFiles();
+
+
+	/**
+	 * @brief Ե ̴ ҽ   ϴ.
+	 *
+	 * @return Ե ̴ ҽ   ȯմϴ.
+	 */
+	uint32_t GetFileCount();
+}
\ No newline at end of file
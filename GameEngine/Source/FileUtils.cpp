@@ -56,6 +56,26 @@ void FileUtils::WriteBufferToFile(const std::wstring& path, const std::vector<ui
 	WINDOWS_ASSERT(CloseHandle(fileHandle), L"failed to close %s...", path.c_str());
 }
 
+void FileUtils::AppendBufferToFile(const std::string& path, const std::vector<uint8_t>& buffer)
+{
+	HANDLE fileHandle = CreateFileA(path.c_str(), FILE_APPEND_DATA, 0, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	WINDOWS_ASSERT(fileHandle != INVALID_HANDLE_VALUE, "failed to open %s...", path.c_str());
+
+	DWORD writeByteSize = 0;
+	WINDOWS_ASSERT(WriteFile(fileHandle, &buffer[0], static_cast<DWORD>(buffer.size()), &writeByteSize, nullptr), "failed to append %s...", path.c_str());
+	WINDOWS_ASSERT(CloseHandle(fileHandle), "failed to close %s...", path.c_str());
+}
+
+void FileUtils::AppendBufferToFile(const std::wstring& path, const std::vector<uint8_t>& buffer)
+{
+	HANDLE fileHandle = CreateFileW(path.c_str(), FILE_APPEND_DATA, 0, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	WINDOWS_ASSERT(fileHandle != INVALID_HANDLE_VALUE, L"failed to open %s...", path.c_str());
+
+	DWORD writeByteSize = 0;
+	WINDOWS_ASSERT(WriteFile(fileHandle, &buffer[0], static_cast<DWORD>(buffer.size()), &writeByteSize, nullptr), L"failed to append %s...", path.c_str());
+	WINDOWS_ASSERT(CloseHandle(fileHandle), L"failed to close %s...", path.c_str());
+}
+
 bool FileUtils::IsValidPath(const std::string& path)
 {
 	return PathFileExistsA(path.c_str());
@@ -0,0 +1,326 @@
+#include "FrameCaptureManager.h"
+
+#include "Assertion.h"
+#include "FileUtils.h"
+#include "GLAssertion.h"
+#include "GLResourceUtils.h"
+#include "RenderManager.h"
+#include "StringUtils.h"
+#include "Window.h"
+
+#include <glad/glad.h>
+#include <stb_image_write.h>
+
+/**
+ * @brief  ۸ д ȼ  ƮԴϴ.
+ *
+ * @note bIsBusy true ȿ  尡 ۸ ٽ ϰų  ʽϴ.
+ */
+struct FrameCaptureManager::Readback
+{
+	uint32_t bufferObject = 0;
+	uint32_t bufferSize = 0;
+	const uint8_t* mappedBuffer = nullptr;
+	void* fence = nullptr;
+	int32_t width = 0;
+	int32_t height = 0;
+	std::wstring path;
+	EFormat format = EFormat::Png;
+	std::atomic<bool> bIsBusy = false; // б⸦ û ں  尡 ȼ   true
+};
+
+/**
+ * @brief  ۸  ȼ  Ʈ  ÷Դϴ.
+ *
+ * @note GL_CLIENT_STORAGE_BIT CPU б  ý ޸𸮿 Ҵϵ ûմϴ.
+ */
+static const GLbitfield READBACK_STORAGE_FLAGS = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT | GL_CLIENT_STORAGE_BIT;
+
+/**
+ * @brief  ۸  ȼ  Ʈ  ÷Դϴ.
+ */
+static const GLbitfield READBACK_MAP_FLAGS = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+/**
+ * @brief 潺 ٸ ִ ð()Դϴ.
+ */
+static const GLuint64 FENCE_WAIT_TIMEOUT = 1000000000;
+
+void FrameCaptureManager::Startup()
+{
+	ASSERT(!bIsStartup_, "already startup frame capture manager...");
+
+	readbacks_.clear();
+	for (uint32_t index = 0; index < READBACK_COUNT; ++index)
+	{
+		readbacks_.push_back(std::make_shared<Readback>());
+	}
+
+	pendingReadbacks_ = std::deque<std::shared_ptr<Readback>>();
+	screenshotPaths_.clear();
+	bIsCaptureSequence_ = false;
+	droppedFrameCount_ = 0;
+	writtenFrameCount_.store(0, std::memory_order_relaxed);
+
+	pendingWriteCount_ = 0;
+	bIsRequestStop_ = false;
+	writer_ = std::thread([&]() { RunWriterLoop(); });
+
+	bIsStartup_ = true;
+}
+
+void FrameCaptureManager::Shutdown()
+{
+	ASSERT(bIsStartup_, "not startup before or has already been shutdowned...");
+
+	bIsCaptureSequence_ = false;
+	Flush();
+
+	{
+		std::unique_lock<std::mutex> lock(writeMutex_);
+		bIsRequestStop_ = true;
+	}
+	writeCondition_.notify_all();
+
+	if (writer_.joinable())
+	{
+		writer_.join();
+	}
+
+	for (auto& readback : readbacks_)
+	{
+		if (readback->bufferObject != 0)
+		{
+			GL_ASSERT(glUnmapNamedBuffer(readback->bufferObject), "failed to unmap frame capture readback buffer...");
+			GL_ASSERT(glDeleteBuffers(1, &readback->bufferObject), "failed to delete frame capture readback buffer...");
+		}
+	}
+	readbacks_.clear();
+
+	bIsStartup_ = false;
+}
+
+void FrameCaptureManager::CaptureScreenshot(const std::wstring& path)
+{
+	ASSERT(bIsStartup_, "not startup frame capture manager...");
+	screenshotPaths_.push_back(path);
+}
+
+void FrameCaptureManager::BeginSequence(const std::wstring& basePath, const EFormat& format)
+{
+	ASSERT(bIsStartup_, "not startup frame capture manager...");
+	ASSERT(!bIsCaptureSequence_, "already begin frame capture sequence...");
+
+	if (format == EFormat::Raw)
+	{
+		ASSERT(!FileUtils::IsValidPath(basePath + L".rgb"), L"%s.rgb is already exist...", basePath.c_str());
+	}
+
+	bIsCaptureSequence_ = true;
+	sequenceBasePath_ = basePath;
+	sequenceFormat_ = format;
+	sequenceFrameIndex_ = 0;
+}
+
+void FrameCaptureManager::EndSequence()
+{
+	bIsCaptureSequence_ = false;
+}
+
+void FrameCaptureManager::Tick()
+{
+	ASSERT(bIsStartup_, "not startup frame capture manager...");
+
+	ResolveReadbacks(false);
+
+	for (const auto& path : screenshotPaths_)
+	{
+		RequestReadback(path, EFormat::Png);
+	}
+	screenshotPaths_.clear();
+
+	if (bIsCaptureSequence_)
+	{
+		if (sequenceFormat_ == EFormat::Png)
+		{
+			RequestReadback(StringUtils::PrintF(L"%s_%06d.png", sequenceBasePath_.c_str(), sequenceFrameIndex_), EFormat::Png);
+		}
+		else
+		{
+			RequestReadback(sequenceBasePath_ + L".rgb", EFormat::Raw);
+		}
+
+		sequenceFrameIndex_++;
+	}
+}
+
+void FrameCaptureManager::Flush()
+{
+	ResolveReadbacks(true);
+
+	std::unique_lock<std::mutex> lock(writeMutex_);
+	writtenCondition_.wait(lock, [&]() { return pendingWriteCount_ == 0; });
+}
+
+void FrameCaptureManager::RequestReadback(const std::wstring& path, const EFormat& format)
+{
+	std::shared_ptr<Readback> readback = nullptr;
+	for (auto& candidate : readbacks_)
+	{
+		if (!candidate->bIsBusy.load(std::memory_order_acquire))
+		{
+			readback = candidate;
+			break;
+		}
+	}
+
+	if (!readback)
+	{
+		droppedFrameCount_++;
+		return;
+	}
+
+	int32_t width = 0;
+	int32_t height = 0;
+	RenderManager::Get().GetRenderTargetWindow()->GetSize(width, height);
+	if (width <= 0 || height <= 0)
+	{
+		return; // ּȭ â ĸó ʽϴ.
+	}
+
+	uint32_t size = static_cast<uint32_t>(width) * static_cast<uint32_t>(height) * 4;
+	if (readback->bufferSize < size)
+	{
+		if (readback->bufferObject != 0)
+		{
+			GL_ASSERT(glUnmapNamedBuffer(readback->bufferObject), "failed to unmap frame capture readback buffer...");
+			GL_ASSERT(glDeleteBuffers(1, &readback->bufferObject), "failed to delete frame capture readback buffer...");
+		}
+
+		readback->bufferObject = GLResourceUtils::CreateBuffer(size, nullptr, READBACK_STORAGE_FLAGS);
+		readback->bufferSize = size;
+		readback->mappedBuffer = reinterpret_cast<const uint8_t*>(glMapNamedBufferRange(readback->bufferObject, 0, size, READBACK_MAP_FLAGS));
+		ASSERT(readback->mappedBuffer != nullptr, "failed to map frame capture readback buffer...");
+	}
+
+	readback->width = width;
+	readback->height = height;
+	readback->path = path;
+	readback->format = format;
+	readback->bIsBusy.store(true, std::memory_order_relaxed);
+
+	GL_ASSERT(glBindFramebuffer(GL_READ_FRAMEBUFFER, 0), "failed to bind default read framebuffer...");
+	GL_ASSERT(glBindBuffer(GL_PIXEL_PACK_BUFFER, readback->bufferObject), "failed to bind pixel pack buffer...");
+	GL_ASSERT(glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr), "failed to read back buffer pixels...");
+	GL_ASSERT(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0), "failed to unbind pixel pack buffer...");
+
+	readback->fence = reinterpret_cast<void*>(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+	pendingReadbacks_.push_back(readback);
+}
+
+void FrameCaptureManager::ResolveReadbacks(bool bIsWait)
+{
+	while (!pendingReadbacks_.empty())
+	{
+		std::shared_ptr<Readback> readback = pendingReadbacks_.front();
+		GLsync sync = reinterpret_cast<GLsync>(readback->fence);
+
+		GLenum result = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, bIsWait ? FENCE_WAIT_TIMEOUT : 0);
+		while (bIsWait && result == GL_TIMEOUT_EXPIRED)
+		{
+			result = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_WAIT_TIMEOUT);
+		}
+		ASSERT(result != GL_WAIT_FAILED, "failed to wait frame capture readback fence...");
+
+		if (result == GL_TIMEOUT_EXPIRED)
+		{
+			break; // ڿ û б  б⺸   ʽϴ.
+		}
+
+		GL_ASSERT(glDeleteSync(sync), "failed to delete frame capture readback fence...");
+		readback->fence = nullptr;
+		pendingReadbacks_.pop_front();
+
+		{
+			std::unique_lock<std::mutex> lock(writeMutex_);
+			writeQueue_.push(readback);
+			pendingWriteCount_++;
+		}
+		writeCondition_.notify_one();
+	}
+}
+
+void FrameCaptureManager::RunWriterLoop()
+{
+	std::vector<uint8_t> pixels;
+
+	while (true)
+	{
+		std::shared_ptr<Readback> readback = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(writeMutex_);
+			writeCondition_.wait(lock, [&]() { return bIsRequestStop_ || !writeQueue_.empty(); });
+
+			if (writeQueue_.empty())
+			{
+				return;
+			}
+
+			readback = writeQueue_.front();
+			writeQueue_.pop();
+		}
+
+		int32_t width = readback->width;
+		int32_t height = readback->height;
+		std::wstring path = readback->path;
+		EFormat format = readback->format;
+
+		/** Ʒ   RGBA ȼ  Ʒ  RGB ȼ մϴ. */
+		pixels.resize(static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 3);
+		for (int32_t y = 0; y < height; ++y)
+		{
+			const uint8_t* src = readback->mappedBuffer + static_cast<std::size_t>(height - 1 - y) * width * 4;
+			uint8_t* dst = pixels.data() + static_cast<std::size_t>(y) * width * 3;
+
+			for (int32_t x = 0; x < width; ++x)
+			{
+				dst[x * 3 + 0] = src[x * 4 + 0];
+				dst[x * 3 + 1] = src[x * 4 + 1];
+				dst[x * 3 + 2] = src[x * 4 + 2];
+			}
+		}
+
+		readback->bIsBusy.store(false, std::memory_order_release);
+
+		WriteFrame(path, format, width, height, pixels);
+		writtenFrameCount_.fetch_add(1, std::memory_order_relaxed);
+
+		{
+			std::unique_lock<std::mutex> lock(writeMutex_);
+			pendingWriteCount_--;
+		}
+		writtenCondition_.notify_all();
+	}
+}
+
+void FrameCaptureManager::WriteFrame(const std::wstring& path, const EFormat& format, int32_t width, int32_t height, const std::vector<uint8_t>& pixels)
+{
+	if (format == EFormat::Raw)
+	{
+		FileUtils::AppendBufferToFile(path, pixels);
+		return;
+	}
+
+	auto writeToBuffer = [](void* context, void* data, int size)
+		{
+			std::vector<uint8_t>* buffer = reinterpret_cast<std::vector<uint8_t>*>(context);
+			const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+			buffer->insert(buffer->end(), bytes, bytes + size);
+		};
+
+	std::vector<uint8_t> buffer;
+	int32_t result = stbi_write_png_to_func(writeToBuffer, &buffer, width, height, 3, pixels.data(), width * 3);
+	ASSERT(result != 0, L"failed to encode %s...", path.c_str());
+
+	FileUtils::WriteBufferToFile(path, buffer);
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+#include "FreeListAllocator.h"
+
+#include "Assertion.h"
+
+void FreeListAllocator::Reset(uint32_t capacity)
+{
+	capacity_ = capacity;
+	freeSize_ = 0;
+
+	freeBlocksByOffset_.clear();
+	freeBlocksBySize_.clear();
+
+	if (capacity_ > 0)
+	{
+		InsertFreeBlock(0, capacity_);
+	}
+}
+
+bool FreeListAllocator::Allocate(uint32_t size, uint32_t& outOffset)
+{
+	if (size == 0)
+	{
+		return false;
+	}
+
+	auto bestFit = freeBlocksBySize_.lower_bound(size);
+	if (bestFit == freeBlocksBySize_.end())
+	{
+		return false;
+	}
+
+	uint32_t blockSize = bestFit->first;
+	uint32_t blockOffset = bestFit->second;
+
+	EraseFreeBlock(blockOffset, blockSize);
+
+	if (blockSize > size)
+	{
+		InsertFreeBlock(blockOffset + size, blockSize - size);
+	}
+
+	outOffset = blockOffset;
+	return true;
+}
+
+void FreeListAllocator::Free(uint32_t offset, uint32_t size)
+{
+	ASSERT(size > 0 && offset + size <= capacity_, "out of range free block...");
+
+	uint32_t freeOffset = offset;
+	uint32_t freeSize = size;
+
+	auto next = freeBlocksByOffset_.lower_bound(offset);
+	if (next != freeBlocksByOffset_.end())
+	{
+		ASSERT(offset + size <= next->first, "free block overlaps with other free block...");
+
+		if (offset + size == next->first)
+		{
+			uint32_t nextSize = next->second;
+			EraseFreeBlock(next->first, nextSize);
+			freeSize += nextSize;
+		}
+	}
+
+	auto prev = freeBlocksByOffset_.lower_bound(offset);
+	if (prev != freeBlocksByOffset_.begin())
+	{
+		--prev;
+		ASSERT(prev->first + prev->second <= offset, "free block overlaps with other free block...");
+
+		if (prev->first + prev->second == offset)
+		{
+			uint32_t prevOffset = prev->first;
+			uint32_t prevSize = prev->second;
+			EraseFreeBlock(prevOffset, prevSize);
+			freeOffset = prevOffset;
+			freeSize += prevSize;
+		}
+	}
+
+	InsertFreeBlock(freeOffset, freeSize);
+}
+
+uint32_t FreeListAllocator::GetLargestFreeBlockSize() const
+{
+	return freeBlocksBySize_.empty() ? 0 : freeBlocksBySize_.rbegin()->first;
+}
+
+void FreeListAllocator::InsertFreeBlock(uint32_t offset, uint32_t size)
+{
+	freeBlocksByOffset_.insert({ offset, size });
+	freeBlocksBySize_.insert({ size, offset });
+	freeSize_ += size;
+}
+
+void FreeListAllocator::EraseFreeBlock(uint32_t offset, uint32_t size)
+{
+	freeBlocksByOffset_.erase(offset);
+
+	auto range = freeBlocksBySize_.equal_range(size);
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		if (it->second == offset)
+		{
+			freeBlocksBySize_.erase(it);
+			break;
+		}
+	}
+
+	freeSize_ -= size;
+}
\ No newline at end of file
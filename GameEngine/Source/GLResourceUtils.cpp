@@ -0,0 +1,56 @@
+#include "GLResourceUtils.h"
+
+#include "Assertion.h"
+#include "GLAssertion.h"
+
+#include <glad/glad.h>
+
+/**
+ * @brief  迭 Ʈ  ۸ ϴ ε ġԴϴ.
+ */
+static const uint32_t VERTEX_BUFFER_BINDING = 0;
+
+uint32_t GLResourceUtils::CreateBuffer(std::size_t size, const void* data, uint32_t flags)
+{
+	ASSERT(size > 0, "invalid buffer size : %d", static_cast<int32_t>(size));
+
+	uint32_t bufferObject = 0;
+	GL_ASSERT(glCreateBuffers(1, &bufferObject), "failed to create buffer object...");
+	GL_ASSERT(glNamedBufferStorage(bufferObject, static_cast<GLsizeiptr>(size), data, flags), "failed to allocate buffer storage...");
+
+	return bufferObject;
+}
+
+uint32_t GLResourceUtils::CreateVertexArray(uint32_t vertexBufferObject, uint32_t stride, const std::vector<VertexAttribute>& attributes, uint32_t indexBufferObject)
+{
+	uint32_t vertexArrayObject = 0;
+	GL_ASSERT(glCreateVertexArrays(1, &vertexArrayObject), "failed to create vertex array object...");
+	GL_ASSERT(glVertexArrayVertexBuffer(vertexArrayObject, VERTEX_BUFFER_BINDING, vertexBufferObject, 0, stride), "failed to attach vertex buffer to vertex array object...");
+
+	for (const auto& attribute : attributes)
+	{
+		GL_ASSERT(glEnableVertexArrayAttrib(vertexArrayObject, attribute.location), "failed to enable vertex array attribute...");
+		GL_ASSERT(glVertexArrayAttribFormat(vertexArrayObject, attribute.location, attribute.size, GL_FLOAT, GL_FALSE, attribute.offset), "failed to set vertex array attribute format...");
+		GL_ASSERT(glVertexArrayAttribBinding(vertexArrayObject, attribute.location, VERTEX_BUFFER_BINDING), "failed to set vertex array attribute binding...");
+	}
+
+	if (indexBufferObject != 0)
+	{
+		GL_ASSERT(glVertexArrayElementBuffer(vertexArrayObject, indexBufferObject), "failed to attach index buffer to vertex array object...");
+	}
+
+	return vertexArrayObject;
+}
+
+uint32_t GLResourceUtils::CreateTexture(uint32_t target, int32_t minFilter, int32_t magFilter, int32_t wrap)
+{
+	uint32_t textureID = 0;
+	GL_ASSERT(glCreateTextures(target, 1, &textureID), "failed to create texture object...");
+	GL_ASSERT(glTextureParameteri(textureID, GL_TEXTURE_MIN_FILTER, minFilter), "failed to set texture object min filter...");
+	GL_ASSERT(glTextureParameteri(textureID, GL_TEXTURE_MAG_FILTER, magFilter), "failed to set texture object mag filter...");
+	GL_ASSERT(glTextureParameteri(textureID, GL_TEXTURE_WRAP_S, wrap), "failed to set texture object warp s...");
+	GL_ASSERT(glTextureParameteri(textureID, GL_TEXTURE_WRAP_T, wrap), "failed to set texture object warp t...");
+	GL_ASSERT(glTextureParameteri(textureID, GL_TEXTURE_WRAP_R, wrap), "failed to set texture object warp r...");
+
+	return textureID;
+}
\ No newline at end of file
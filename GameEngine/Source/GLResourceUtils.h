@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+/**
+ * @brief DSA(Direct State Access) ,  迭, ؽó Ʈ ε  ϴ Ȯ  մϴ.
+ *
+ * @note
+ * - OpenGL 4.5 ̻ Լ ϸ,  OpenGL ؽƮ 4.6 Ǿ ֽϴ.
+ * -    ε ¸ ٲ Ƿ, ҽ  ׸ ¿  ʽϴ.
+ * - ۴ glNamedBufferStorage Һ Ҹ Ҵմϴ. (Orphan) ·  ũ⸦ ٲٴ ۿ  ʽϴ.
+ * -  迭  İ  ۸ и(Separate Attribute Format)Ͽ,  ۸ ε ġ 0 մϴ.
+ *
+ * @see https://www.khronos.org/opengl/wiki/Direct_State_Access
+ */
+namespace GLResourceUtils
+{
+	/**
+	 * @brief  Ӽ ϳ Դϴ.
+	 *
+	 * @note   Ӽ ȭ ʴ float Դϴ.
+	 */
+	struct VertexAttribute
+	{
+		uint32_t location; // ̴  Ӽ ġ
+		int32_t size;      // float  
+		uint32_t offset;   //  ȿ Ӽ Ʈ 
+	};
+
+
+	/**
+	 * @brief Һ Ҹ  ۸ մϴ.
+	 *
+	 * @param size  Ʈ ũԴϴ. 0 Ŀ մϴ.
+	 * @param data  ʱ Դϴ. ʿ ٸ nullptrԴϴ.
+	 * @param flags   ÷Դϴ. ) GL_DYNAMIC_STORAGE_BIT
+	 *
+	 * @return   Ʈ ȯմϴ.
+	 *
+	 * @note  Ŀ glNamedBufferSubData Ϸ GL_DYNAMIC_STORAGE_BIT ʿմϴ.
+	 */
+	uint32_t CreateBuffer(std::size_t size, const void* data, uint32_t flags);
+
+
+	/**
+	 * @brief  İ  ۸ и  迭 Ʈ մϴ.
+	 *
+	 * @param vertexBufferObject ε ġ 0    ƮԴϴ.
+	 * @param stride  ϳ Ʈ ũԴϴ.
+	 * @param attributes  Ӽ  Դϴ.
+	 * @param indexBufferObject  ε  ƮԴϴ. ʿ ٸ 0Դϴ.
+	 *
+	 * @return   迭 Ʈ ȯմϴ.
+	 */
+	uint32_t CreateVertexArray(uint32_t vertexBufferObject, uint32_t stride, const std::vector<VertexAttribute>& attributes, uint32_t indexBufferObject = 0);
+
+
+	/**
+	 * @brief ؽó Ʈ ϰ ͸   մϴ.
+	 *
+	 * @param target ؽó ŸԴϴ. ) GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP
+	 * @param minFilter  Դϴ.
+	 * @param magFilter Ȯ Դϴ.
+	 * @param wrap S, T, R   Դϴ.
+	 *
+	 * @return  ؽó Ʈ ȯմϴ.
+	 *
+	 * @note Ҵ ȣ ʿ glTextureStorage2D Ǵ glTextureStorage3D Ҵմϴ.
+	 */
+	uint32_t CreateTexture(uint32_t target, int32_t minFilter, int32_t magFilter, int32_t wrap);
+}
\ No newline at end of file
@@ -0,0 +1,408 @@
+#include "GPUProfileManager.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include <json/json.h>
+
+#include "Assertion.h"
+#include "FileUtils.h"
+#include "GLAssertion.h"
+
+#include <glad/glad.h>
+
+/**
+ * @brief   Դϴ.
+ *
+ * @note beginQuery endQuery    Ʈ  εԴϴ.
+ */
+struct GPUProfileManager::Scope
+{
+	std::string name;
+	uint32_t depth = 0;
+	uint32_t beginQuery = 0;
+	uint32_t endQuery = 0;
+};
+
+/**
+ * @brief       Դϴ.
+ *
+ * @note    Ƿ,     Ȯϸ  ü    ִ   ֽϴ.
+ */
+struct GPUProfileManager::Frame
+{
+	std::vector<uint32_t> queryObjects;
+	uint32_t queryCount = 0;
+	uint32_t lastQuery = 0;
+	std::vector<Scope> scopes;
+	uint64_t cpuBeginTime = 0;
+	uint64_t cpuEndTime = 0;
+	bool bIsPending = false; //   ں  аų   true
+};
+
+/**
+ * @brief     Ʈ Դϴ.
+ */
+static const uint32_t MAX_QUERY_COUNT = GPUProfileManager::MAX_SCOPE_COUNT * 2;
+
+/**
+ * @brief Ʈ̽ CPU ̺Ʈ GPU ̺Ʈ   IDԴϴ.
+ */
+static const uint32_t CPU_TRACE_THREAD_ID = 0;
+static const uint32_t GPU_TRACE_THREAD_ID = 1;
+
+void GPUProfileManager::Startup()
+{
+	ASSERT(!bIsStartup_, "already startup gpu profile manager...");
+
+	frames_.clear();
+	for (uint32_t index = 0; index < FRAME_COUNT; ++index)
+	{
+		std::shared_ptr<Frame> frame = std::make_shared<Frame>();
+
+		frame->queryObjects.resize(MAX_QUERY_COUNT);
+		GL_ASSERT(glCreateQueries(GL_TIMESTAMP, MAX_QUERY_COUNT, frame->queryObjects.data()), "failed to create timestamp query objects...");
+		frame->scopes.reserve(MAX_SCOPE_COUNT);
+
+		frames_.push_back(frame);
+	}
+
+	frameIndex_ = 0;
+	bIsBeginFrame_ = false;
+	scopeStack_.clear();
+	bIsOpenMarkScope_ = false;
+	scopeResults_.clear();
+	resolvedFrameCount_ = 0;
+	droppedFrameCount_ = 0;
+	droppedScopeCount_ = 0;
+	bIsTrace_ = false;
+
+	bIsStartup_ = true;
+}
+
+void GPUProfileManager::Shutdown()
+{
+	ASSERT(bIsStartup_, "not startup before or has already been shutdowned...");
+
+	if (bIsTrace_)
+	{
+		EndTrace();
+	}
+
+	for (auto& frame : frames_)
+	{
+		GL_ASSERT(glDeleteQueries(MAX_QUERY_COUNT, frame->queryObjects.data()), "failed to delete timestamp query objects...");
+	}
+	frames_.clear();
+
+	bIsStartup_ = false;
+}
+
+void GPUProfileManager::BeginFrame()
+{
+	ASSERT(bIsStartup_, "not startup gpu profile manager...");
+
+	if (!bIsEnable_)
+	{
+		return;
+	}
+
+	ResolveFrames();
+
+	frameIndex_ = (frameIndex_ + 1) % FRAME_COUNT;
+	Frame& frame = *frames_[frameIndex_];
+
+	if (frame.bIsPending)
+	{
+		droppedFrameCount_++;
+		frame.bIsPending = false;
+	}
+
+	frame.queryCount = 0;
+	frame.lastQuery = 0;
+	frame.scopes.clear();
+	frame.cpuBeginTime = GetCPUTime();
+
+	bIsBeginFrame_ = true;
+}
+
+void GPUProfileManager::EndFrame()
+{
+	if (!bIsBeginFrame_)
+	{
+		return;
+	}
+
+	EndMarkScope();
+	while (!scopeStack_.empty())
+	{
+		PopScope();
+	}
+
+	Frame& frame = *frames_[frameIndex_];
+	frame.cpuEndTime = GetCPUTime();
+	frame.bIsPending = (frame.queryCount > 0);
+
+	bIsBeginFrame_ = false;
+}
+
+void GPUProfileManager::BeginScope(const std::string& name)
+{
+	if (!bIsBeginFrame_)
+	{
+		return;
+	}
+
+	EndMarkScope();
+	PushScope(name);
+}
+
+void GPUProfileManager::EndScope()
+{
+	if (!bIsBeginFrame_)
+	{
+		return;
+	}
+
+	EndMarkScope();
+
+	ASSERT(!scopeStack_.empty(), "not begin gpu profile scope...");
+	PopScope();
+}
+
+void GPUProfileManager::MarkScope(const std::string& name)
+{
+	if (!bIsBeginFrame_)
+	{
+		return;
+	}
+
+	if (bIsOpenMarkScope_)
+	{
+		if (markScopeName_ == name)
+		{
+			return;
+		}
+
+		PopScope();
+	}
+
+	PushScope(name);
+	bIsOpenMarkScope_ = true;
+	markScopeName_ = name;
+}
+
+void GPUProfileManager::SetEnable(bool bIsEnable)
+{
+	ASSERT(!bIsBeginFrame_, "can't change gpu profile mode in frame...");
+	bIsEnable_ = bIsEnable;
+}
+
+float GPUProfileManager::GetScopeTime(const std::string& name) const
+{
+	float elapsedTime = 0.0f;
+	for (const auto& scopeResult : scopeResults_)
+	{
+		if (scopeResult.name == name)
+		{
+			elapsedTime += scopeResult.elapsedTime;
+		}
+	}
+
+	return elapsedTime;
+}
+
+void GPUProfileManager::BeginTrace(const std::wstring& path)
+{
+	ASSERT(bIsStartup_, "not startup gpu profile manager...");
+	ASSERT(!bIsTrace_, "already begin gpu profile trace...");
+	ASSERT(!bIsBeginFrame_, "can't begin gpu profile trace in frame...");
+
+	/**  GPU Ÿӽ CPU ð ¦ GPU Ÿӽ CPU ð ȯմϴ. */
+	GLint64 gpuTime = 0;
+	GL_ASSERT(glGetInteger64v(GL_TIMESTAMP, &gpuTime), "failed to get gpu timestamp...");
+
+	traceGPUBaseTime_ = static_cast<uint64_t>(gpuTime);
+	traceCPUBaseTime_ = GetCPUTime();
+	tracePath_ = path;
+	traceEvents_.clear();
+
+	bIsTrace_ = true;
+}
+
+void GPUProfileManager::EndTrace()
+{
+	ASSERT(bIsTrace_, "not begin gpu profile trace...");
+	ASSERT(!bIsBeginFrame_, "can't end gpu profile trace in frame...");
+
+	GL_ASSERT(glFinish(), "failed to finish gpu commands...");
+	ResolveFrames();
+
+	bIsTrace_ = false;
+
+	Json::Value root;
+	Json::Value& events = root["traceEvents"];
+	events = Json::Value(Json::arrayValue);
+
+	auto appendThreadName = [&](uint32_t tid, const std::string& name)
+		{
+			Json::Value event;
+			event["name"] = "thread_name";
+			event["ph"] = "M";
+			event["pid"] = 0;
+			event["tid"] = tid;
+			event["args"]["name"] = name;
+			events.append(event);
+		};
+
+	appendThreadName(CPU_TRACE_THREAD_ID, "CPU");
+	appendThreadName(GPU_TRACE_THREAD_ID, "GPU");
+
+	for (const auto& traceEvent : traceEvents_)
+	{
+		Json::Value event;
+		event["name"] = traceEvent.name;
+		event["cat"] = (traceEvent.tid == GPU_TRACE_THREAD_ID) ? "GPU" : "CPU";
+		event["ph"] = "X";
+		event["pid"] = 0;
+		event["tid"] = traceEvent.tid;
+		event["ts"] = static_cast<Json::UInt64>(traceEvent.timestamp);
+		event["dur"] = static_cast<Json::UInt64>(traceEvent.duration);
+		events.append(event);
+	}
+	root["displayTimeUnit"] = "ms";
+
+	Json::StreamWriterBuilder builder;
+	builder["indentation"] = "";
+
+	std::string trace = Json::writeString(builder, root);
+	FileUtils::WriteBufferToFile(tracePath_, std::vector<uint8_t>(trace.begin(), trace.end()));
+
+	traceEvents_.clear();
+}
+
+void GPUProfileManager::PushScope(const std::string& name)
+{
+	Frame& frame = *frames_[frameIndex_];
+
+	if (frame.queryCount + 2 > MAX_QUERY_COUNT)
+	{
+		droppedScopeCount_++;
+		scopeStack_.push_back(-1);
+		return;
+	}
+
+	Scope scope;
+	scope.name = name;
+	scope.depth = static_cast<uint32_t>(scopeStack_.size());
+	scope.beginQuery = frame.queryCount++;
+	scope.endQuery = frame.queryCount++; //    ̸ Ͽ,   ׻   ֽϴ.
+
+	GL_ASSERT(glQueryCounter(frame.queryObjects[scope.beginQuery], GL_TIMESTAMP), "failed to record begin timestamp...");
+	frame.lastQuery = scope.beginQuery;
+
+	scopeStack_.push_back(static_cast<int32_t>(frame.scopes.size()));
+	frame.scopes.push_back(scope);
+}
+
+void GPUProfileManager::PopScope()
+{
+	int32_t scopeIndex = scopeStack_.back();
+	scopeStack_.pop_back();
+
+	if (scopeIndex < 0)
+	{
+		return;
+	}
+
+	Frame& frame = *frames_[frameIndex_];
+	const Scope& scope = frame.scopes[scopeIndex];
+
+	GL_ASSERT(glQueryCounter(frame.queryObjects[scope.endQuery], GL_TIMESTAMP), "failed to record end timestamp...");
+	frame.lastQuery = scope.endQuery;
+}
+
+void GPUProfileManager::EndMarkScope()
+{
+	if (bIsOpenMarkScope_)
+	{
+		PopScope();
+		bIsOpenMarkScope_ = false;
+	}
+}
+
+void GPUProfileManager::ResolveFrames()
+{
+	for (uint32_t offset = 1; offset <= FRAME_COUNT; ++offset)
+	{
+		Frame& frame = *frames_[(frameIndex_ + offset) % FRAME_COUNT];
+		if (!frame.bIsPending)
+		{
+			continue;
+		}
+
+		GLint bIsAvailable = GL_FALSE;
+		GL_ASSERT(glGetQueryObjectiv(frame.queryObjects[frame.lastQuery], GL_QUERY_RESULT_AVAILABLE, &bIsAvailable), "failed to get timestamp query availability...");
+
+		if (bIsAvailable == GL_FALSE)
+		{
+			break; // ڿ       ʽϴ.
+		}
+
+		ResolveFrame(frame);
+		frame.bIsPending = false;
+	}
+}
+
+void GPUProfileManager::ResolveFrame(Frame& frame)
+{
+	std::vector<uint64_t> timestamps(frame.queryCount);
+	for (uint32_t index = 0; index < frame.queryCount; ++index)
+	{
+		GL_ASSERT(glGetQueryObjectui64v(frame.queryObjects[index], GL_QUERY_RESULT, &timestamps[index]), "failed to get timestamp query result...");
+	}
+
+	uint64_t baseTime = timestamps[frame.scopes.front().beginQuery];
+
+	scopeResults_.resize(frame.scopes.size());
+	for (std::size_t index = 0; index < frame.scopes.size(); ++index)
+	{
+		const Scope& scope = frame.scopes[index];
+		uint64_t beginTime = timestamps[scope.beginQuery];
+		uint64_t endTime = std::max(timestamps[scope.endQuery], beginTime);
+
+		ScopeResult& scopeResult = scopeResults_[index];
+		scopeResult.name = scope.name;
+		scopeResult.depth = scope.depth;
+		scopeResult.beginTime = static_cast<float>(static_cast<double>(beginTime - baseTime) / 1000000.0);
+		scopeResult.elapsedTime = static_cast<float>(static_cast<double>(endTime - beginTime) / 1000000.0);
+
+		if (bIsTrace_ && beginTime >= traceGPUBaseTime_)
+		{
+			TraceEvent traceEvent;
+			traceEvent.name = scope.name;
+			traceEvent.tid = GPU_TRACE_THREAD_ID;
+			traceEvent.timestamp = traceCPUBaseTime_ + (beginTime - traceGPUBaseTime_) / 1000;
+			traceEvent.duration = (endTime - beginTime) / 1000;
+			traceEvents_.push_back(traceEvent);
+		}
+	}
+
+	if (bIsTrace_ && frame.cpuBeginTime >= traceCPUBaseTime_)
+	{
+		TraceEvent traceEvent;
+		traceEvent.name = "Frame";
+		traceEvent.tid = CPU_TRACE_THREAD_ID;
+		traceEvent.timestamp = frame.cpuBeginTime;
+		traceEvent.duration = frame.cpuEndTime - frame.cpuBeginTime;
+		traceEvents_.push_back(traceEvent);
+	}
+
+	resolvedFrameCount_++;
+}
+
+uint64_t GPUProfileManager::GetCPUTime()
+{
+	std::chrono::microseconds time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch());
+	return static_cast<uint64_t>(time.count());
+}
\ No newline at end of file
@@ -0,0 +1,190 @@
+#include "GeometryPool.h"
+
+#include "Assertion.h"
+#include "GLAssertion.h"
+#include "GLResourceUtils.h"
+
+#include <glad/glad.h>
+
+GeometryPool::~GeometryPool()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void GeometryPool::Initialize(uint32_t maxVertexCount, uint32_t maxIndexCount)
+{
+	ASSERT(!bIsInitialized_, "already initialize geometry pool resource...");
+	ASSERT(maxVertexCount > 0 && maxIndexCount > 0, "invalid geometry pool size : (vertex : %d, index : %d)", maxVertexCount, maxIndexCount);
+
+	vertexAllocator_.Reset(maxVertexCount);
+	indexAllocator_.Reset(maxIndexCount);
+
+	uint32_t vertexBufferSize = maxVertexCount * StaticMesh::Vertex::GetStride();
+	uint32_t indexBufferSize = maxIndexCount * sizeof(uint32_t);
+
+	vertexBufferObject_ = GLResourceUtils::CreateBuffer(vertexBufferSize, nullptr, GL_DYNAMIC_STORAGE_BIT);
+	indexBufferObject_ = GLResourceUtils::CreateBuffer(indexBufferSize, nullptr, GL_DYNAMIC_STORAGE_BIT);
+	vertexArrayObject_ = GLResourceUtils::CreateVertexArray(vertexBufferObject_, StaticMesh::Vertex::GetStride(), {
+		{ 0, 3, static_cast<uint32_t>(offsetof(StaticMesh::Vertex, position)) },
+		{ 1, 3, static_cast<uint32_t>(offsetof(StaticMesh::Vertex, normal))   },
+		{ 2, 2, static_cast<uint32_t>(offsetof(StaticMesh::Vertex, texture))  },
+	}, indexBufferObject_);
+
+	GL_ASSERT(glCreateBuffers(1, &drawIndirectBufferObject_), "failed to create geometry pool draw indirect buffer...");
+
+	drawBufferCapacity_ = 0;
+	ReserveDrawBuffers(256);
+
+	bIsInitialized_ = true;
+}
+
+void GeometryPool::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+	GL_ASSERT(glDeleteBuffers(1, &drawIndirectBufferObject_), "failed to delete geometry pool draw indirect buffer...");
+	GL_ASSERT(glDeleteBuffers(1, &indexBufferObject_), "failed to delete geometry pool index buffer...");
+	GL_ASSERT(glDeleteBuffers(1, &vertexBufferObject_), "failed to delete geometry pool vertex buffer...");
+	GL_ASSERT(glDeleteVertexArrays(1, &vertexArrayObject_), "failed to delete geometry pool vertex array object...");
+
+	meshRanges_.clear();
+	meshValidFlags_.clear();
+	freeMeshIDs_.clear();
+	drawCommands_.clear();
+	drawDatas_.clear();
+	drawBufferCapacity_ = 0;
+
+	bIsInitialized_ = false;
+}
+
+int32_t GeometryPool::AddMesh(const std::vector<StaticMesh::Vertex>& vertices, const std::vector<uint32_t>& indices)
+{
+	ASSERT(bIsInitialized_, "not initialized geometry pool resource...");
+
+	uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+	uint32_t indexCount = static_cast<uint32_t>(indices.size());
+
+	uint32_t baseVertex = 0;
+	if (!vertexAllocator_.Allocate(vertexCount, baseVertex))
+	{
+		return -1;
+	}
+
+	uint32_t firstIndex = 0;
+	if (!indexAllocator_.Allocate(indexCount, firstIndex))
+	{
+		vertexAllocator_.Free(baseVertex, vertexCount);
+		return -1;
+	}
+
+	GL_ASSERT(glNamedBufferSubData(vertexBufferObject_, baseVertex * StaticMesh::Vertex::GetStride(), vertexCount * StaticMesh::Vertex::GetStride(), vertices.data()), "failed to write geometry pool vertex buffer...");
+	GL_ASSERT(glNamedBufferSubData(indexBufferObject_, firstIndex * sizeof(uint32_t), indexCount * sizeof(uint32_t), indices.data()), "failed to write geometry pool index buffer...");
+
+	MeshRange range;
+	range.baseVertex = baseVertex;
+	range.vertexCount = vertexCount;
+	range.firstIndex = firstIndex;
+	range.indexCount = indexCount;
+
+	int32_t meshID = -1;
+	if (freeMeshIDs_.empty())
+	{
+		meshID = static_cast<int32_t>(meshRanges_.size());
+		meshRanges_.push_back(range);
+		meshValidFlags_.push_back(true);
+	}
+	else
+	{
+		meshID = freeMeshIDs_.back();
+		freeMeshIDs_.pop_back();
+
+		meshRanges_[meshID] = range;
+		meshValidFlags_[meshID] = true;
+	}
+
+	return meshID;
+}
+
+void GeometryPool::RemoveMesh(int32_t meshID)
+{
+	ASSERT(IsValidMesh(meshID), "invalid geometry pool mesh id : %d", meshID);
+
+	const MeshRange& range = meshRanges_[meshID];
+	vertexAllocator_.Free(range.baseVertex, range.vertexCount);
+	indexAllocator_.Free(range.firstIndex, range.indexCount);
+
+	meshValidFlags_[meshID] = false;
+	freeMeshIDs_.push_back(meshID);
+}
+
+bool GeometryPool::IsValidMesh(int32_t meshID) const
+{
+	return 0 <= meshID && meshID < static_cast<int32_t>(meshValidFlags_.size()) && meshValidFlags_[meshID];
+}
+
+const GeometryPool::MeshRange& GeometryPool::GetMeshRange(int32_t meshID) const
+{
+	ASSERT(IsValidMesh(meshID), "invalid geometry pool mesh id : %d", meshID);
+	return meshRanges_[meshID];
+}
+
+void GeometryPool::ClearDrawCommands()
+{
+	drawCommands_.clear();
+	drawDatas_.clear();
+}
+
+void GeometryPool::AddDrawCommand(int32_t meshID, const Matrix4x4f& world, int32_t textureSlot)
+{
+	const MeshRange& range = GetMeshRange(meshID);
+
+	DrawElementsIndirectCommand command;
+	command.count = range.indexCount;
+	command.instanceCount = 1;
+	command.firstIndex = range.firstIndex;
+	command.baseVertex = static_cast<int32_t>(range.baseVertex);
+	command.baseInstance = 0;
+
+	drawCommands_.push_back(command);
+	drawDatas_.push_back(ShaderDataUtils::Pack(world, textureSlot));
+}
+
+void GeometryPool::FlushDrawCommands(uint32_t firstDrawIndex)
+{
+	ASSERT(bIsInitialized_, "not initialized geometry pool resource...");
+
+	if (drawCommands_.empty())
+	{
+		return;
+	}
+
+	uint32_t commandCount = static_cast<uint32_t>(drawCommands_.size());
+	ReserveDrawBuffers(commandCount);
+
+	for (uint32_t index = 0; index < commandCount; ++index)
+	{
+		drawCommands_[index].baseInstance = firstDrawIndex + index;
+	}
+
+	GL_ASSERT(glNamedBufferData(drawIndirectBufferObject_, drawBufferCapacity_ * sizeof(DrawElementsIndirectCommand), nullptr, GL_STREAM_DRAW), "failed to orphan geometry pool draw indirect buffer...");
+	GL_ASSERT(glNamedBufferSubData(drawIndirectBufferObject_, 0, commandCount * sizeof(DrawElementsIndirectCommand), drawCommands_.data()), "failed to write geometry pool draw indirect buffer...");
+}
+
+void GeometryPool::ReserveDrawBuffers(uint32_t commandCount)
+{
+	if (commandCount <= drawBufferCapacity_)
+	{
+		return;
+	}
+
+	while (drawBufferCapacity_ < commandCount)
+	{
+		drawBufferCapacity_ = (drawBufferCapacity_ == 0) ? commandCount : drawBufferCapacity_ * 2;
+	}
+
+	drawCommands_.reserve(drawBufferCapacity_);
+	drawDatas_.reserve(drawBufferCapacity_);
+}
\ No newline at end of file
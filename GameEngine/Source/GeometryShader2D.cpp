@@ -2,6 +2,7 @@
 
 #include "Assertion.h"
 #include "GLAssertion.h"
+#include "GLResourceUtils.h"
 #include "MathUtils.h"
 
 #include <glad/glad.h>
@@ -21,23 +22,11 @@ void GeometryShader2D::Initialize(const std::wstring& vsPath, const std::wstring
 
 	Shader::Initialize(vsPath, fsPath);
 
-	GL_ASSERT(glGenVertexArrays(1, &vertexArrayObject_), "failed to generate 2d geometry vertex array...");
-	GL_ASSERT(glGenBuffers(1, &vertexBufferObject_), "failed to generate 2d geometry vertex buffer...");
-
-	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind 2d geometry vertex array...");
-	GL_ASSERT(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind 2d geometry vertex buffer...");
-	GL_ASSERT(glBufferData(GL_ARRAY_BUFFER, VertexPositionColor::GetStride() * vertices_.size(), reinterpret_cast<const void*>(vertices_.data()), GL_DYNAMIC_DRAW),
-		"failed to create a new data store for a 2d geometry buffer object...");
-
-	GL_ASSERT(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, VertexPositionColor::GetStride(), (void*)(offsetof(VertexPositionColor, position))),
-		"failed to specify the location and data format of the array of generic vertex attributes at index...");
-	GL_ASSERT(glEnableVertexAttribArray(0), "failed to enable vertex attrib array...");
-
-	GL_ASSERT(glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, VertexPositionColor::GetStride(), (void*)(offsetof(VertexPositionColor, color))),
-		"failed to specify the location and data format of the array of generic vertex attributes at index...");
-	GL_ASSERT(glEnableVertexAttribArray(1), "failed to enable vertex attrib array...");
-
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind 2d geometry vertex array...");
+	vertexBufferObject_ = GLResourceUtils::CreateBuffer(VertexPositionColor::GetStride() * vertices_.size(), reinterpret_cast<const void*>(vertices_.data()), GL_DYNAMIC_STORAGE_BIT);
+	vertexArrayObject_ = GLResourceUtils::CreateVertexArray(vertexBufferObject_, VertexPositionColor::GetStride(), {
+		{ 0, 3, static_cast<uint32_t>(offsetof(VertexPositionColor, position)) },
+		{ 1, 4, static_cast<uint32_t>(offsetof(VertexPositionColor, color))    },
+	});
 }
 
 void GeometryShader2D::Release()
@@ -50,6 +39,13 @@ void GeometryShader2D::Release()
 	GL_ASSERT(glDeleteVertexArrays(1, &vertexArrayObject_), "failed to delete 2d geometry vertex array object...");
 }
 
+void GeometryShader2D::OnReady()
+{
+	pointSizeHandle_ = GetUniformHandle("pointSize");
+	transformHandle_ = GetUniformHandle("transform");
+	orthoHandle_ = GetUniformHandle("ortho");
+}
+
 void GeometryShader2D::DrawPoints2D(const Matrix4x4f& ortho, const std::vector<Vector2f>& positions, const Vector4f& color, float pointSize)
 {
 	ASSERT(positions.size() <= MAX_VERTEX_SIZE, "overflow 2d point count : %d", static_cast<int32_t>(positions.size()));
@@ -287,6 +283,11 @@ void GeometryShader2D::DrawGeometry2D(const Matrix4x4f& transform, const Matrix4
 {
 	ASSERT(drawType != EDrawType::None, "invalid draw type...");
 
+	if (!IsReady())
+	{
+		return;
+	}
+
 	const void* bufferPtr = reinterpret_cast<const void*>(vertices_.data());
 	uint32_t bufferByteSize = static_cast<uint32_t>(VertexPositionColor::GetStride() * vertices_.size());
 	WriteDynamicVertexBuffer(vertexBufferObject_, bufferPtr, bufferByteSize);
@@ -294,11 +295,11 @@ void GeometryShader2D::DrawGeometry2D(const Matrix4x4f& transform, const Matrix4
 	Shader::Bind();
 	if (drawType == EDrawType::Points)
 	{
-		Shader::SetUniform("pointSize", pointSize_);
+		Shader::SetUniform(pointSizeHandle_, pointSize_);
 	}
 
-	Shader::SetUniform("transform", transform);
-	Shader::SetUniform("ortho", ortho);
+	Shader::SetUniform(transformHandle_, transform);
+	Shader::SetUniform(orthoHandle_, ortho);
 
 	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind 2d geometry vertex array...");
 	GL_ASSERT(glDrawArrays(static_cast<GLenum>(drawType), 0, vertexCount), "failed to draw 2d geometry...");
@@ -293,6 +293,13 @@ public:
 	void DrawGrid2D(const Matrix4x4f& ortho, float minX, float maxX, float strideX, float minY, float maxY, float strideY, const Vector4f& color);
 
 
+protected:
+	/**
+	 * @brief ̴ α׷ ũ    ڵ ϴ.
+	 */
+	virtual void OnReady() override;
+
+
 private:
 	/**
 	 * @brief ⺻  ׸ ŸԴϴ.
@@ -482,4 +489,22 @@ private:
 	 * @brief Ʈ ũԴϴ.
 	 */
 	float pointSize_ = 1.0f;
+
+
+	/**
+	 * @brief Ʈ ũ   ڵԴϴ.
+	 */
+	UniformHandle pointSizeHandle_;
+
+
+	/**
+	 * @brief 2   ȯ    ڵԴϴ.
+	 */
+	UniformHandle transformHandle_;
+
+
+	/**
+	 * @brief ũ      ڵԴϴ.
+	 */
+	UniformHandle orthoHandle_;
 };
\ No newline at end of file
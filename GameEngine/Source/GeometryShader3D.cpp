@@ -2,6 +2,7 @@
 
 #include "Assertion.h"
 #include "GLAssertion.h"
+#include "GLResourceUtils.h"
 #include "MathUtils.h"
 
 #include <glad/glad.h>
@@ -20,23 +21,11 @@ void GeometryShader3D::Initialize(const std::wstring& vsPath, const std::wstring
 
 	Shader::Initialize(vsPath, fsPath);
 
-	GL_ASSERT(glGenVertexArrays(1, &vertexArrayObject_), "failed to generate 3d geometry vertex array...");
-	GL_ASSERT(glGenBuffers(1, &vertexBufferObject_), "failed to generate 3d geometry vertex buffer...");
-
-	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind 3d geometry vertex array...");
-	GL_ASSERT(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind 3d geometry vertex buffer...");
-	GL_ASSERT(glBufferData(GL_ARRAY_BUFFER, VertexPositionColor::GetStride() * vertices_.size(), reinterpret_cast<const void*>(vertices_.data()), GL_DYNAMIC_DRAW),
-		"failed to create a new data store for a 3d geometry buffer object...");
-
-	GL_ASSERT(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, VertexPositionColor::GetStride(), (void*)(offsetof(VertexPositionColor, position))),
-		"failed to specify the location and data format of the array of generic vertex attributes at index...");
-	GL_ASSERT(glEnableVertexAttribArray(0), "failed to enable vertex attrib array...");
-
-	GL_ASSERT(glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, VertexPositionColor::GetStride(), (void*)(offsetof(VertexPositionColor, color))),
-		"failed to specify the location and data format of the array of generic vertex attributes at index...");
-	GL_ASSERT(glEnableVertexAttribArray(1), "failed to enable vertex attrib array...");
-
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind 3d geometry vertex array...");
+	vertexBufferObject_ = GLResourceUtils::CreateBuffer(VertexPositionColor::GetStride() * vertices_.size(), reinterpret_cast<const void*>(vertices_.data()), GL_DYNAMIC_STORAGE_BIT);
+	vertexArrayObject_ = GLResourceUtils::CreateVertexArray(vertexBufferObject_, VertexPositionColor::GetStride(), {
+		{ 0, 3, static_cast<uint32_t>(offsetof(VertexPositionColor, position)) },
+		{ 1, 4, static_cast<uint32_t>(offsetof(VertexPositionColor, color))    },
+	});
 }
 
 void GeometryShader3D::Release()
@@ -49,7 +38,7 @@ void GeometryShader3D::Release()
 	GL_ASSERT(glDeleteVertexArrays(1, &vertexArrayObject_), "failed to delete 3d geometry vertex array object...");
 }
 
-void GeometryShader3D::DrawPoints3D(const Matrix4x4f& view, const Matrix4x4f& projection, const std::vector<Vector3f>& positions, const Vector4f& color)
+void GeometryShader3D::DrawPoints3D(uint32_t drawIndex, const std::vector<Vector3f>& positions, const Vector4f& color)
 {
 	ASSERT(positions.size() <= MAX_VERTEX_SIZE, "overflow 3d point count : %d", static_cast<int32_t>(positions.size()));
 
@@ -58,10 +47,10 @@ void GeometryShader3D::DrawPoints3D(const Matrix4x4f& view, const Matrix4x4f& pr
 		vertices_[index] = VertexPositionColor(positions[index], color);
 	}
 	
-	DrawGeometry3D(Matrix4x4f::GetIdentity(), view, projection, EDrawType::Points, static_cast<uint32_t>(positions.size()));
+	DrawGeometry3D(drawIndex, EDrawType::Points, static_cast<uint32_t>(positions.size()));
 }
 
-void GeometryShader3D::DrawConnectPoints3D(const Matrix4x4f& view, const Matrix4x4f& projection, const std::vector<Vector3f>& positions, const Vector4f& color)
+void GeometryShader3D::DrawConnectPoints3D(uint32_t drawIndex, const std::vector<Vector3f>& positions, const Vector4f& color)
 {
 	ASSERT(positions.size() <= MAX_VERTEX_SIZE, "overflow 3d point count : %d", static_cast<int32_t>(positions.size()));
 
@@ -70,30 +59,30 @@ void GeometryShader3D::DrawConnectPoints3D(const Matrix4x4f& view, const Matrix4
 		vertices_[index] = VertexPositionColor(positions[index], color);
 	}
 
-	DrawGeometry3D(Matrix4x4f::GetIdentity(), view, projection, EDrawType::LineStrip, static_cast<uint32_t>(positions.size()));
+	DrawGeometry3D(drawIndex, EDrawType::LineStrip, static_cast<uint32_t>(positions.size()));
 }
 
-void GeometryShader3D::DrawLine3D(const Matrix4x4f& view, const Matrix4x4f& projection, const Vector3f& fromPosition, const Vector3f& toPosition, const Vector4f& color)
+void GeometryShader3D::DrawLine3D(uint32_t drawIndex, const Vector3f& fromPosition, const Vector3f& toPosition, const Vector4f& color)
 {
 	uint32_t vertexCount = 0;
 
 	vertices_[vertexCount++] = VertexPositionColor(fromPosition, color);
 	vertices_[vertexCount++] = VertexPositionColor(toPosition, color);
 
-	DrawGeometry3D(Matrix4x4f::GetIdentity(), view, projection, EDrawType::LineStrip, vertexCount);
+	DrawGeometry3D(drawIndex, EDrawType::LineStrip, vertexCount);
 }
 
-void GeometryShader3D::DrawLine3D(const Matrix4x4f& view, const Matrix4x4f& projection, const Vector3f& fromPosition, const Vector4f& fromColor, const Vector3f& toPosition, const Vector4f& toColor)
+void GeometryShader3D::DrawLine3D(uint32_t drawIndex, const Vector3f& fromPosition, const Vector4f& fromColor, const Vector3f& toPosition, const Vector4f& toColor)
 {
 	uint32_t vertexCount = 0;
 
 	vertices_[vertexCount++] = VertexPositionColor(fromPosition, fromColor);
 	vertices_[vertexCount++] = VertexPositionColor(toPosition, toColor);
 
-	DrawGeometry3D(Matrix4x4f::GetIdentity(), view, projection, EDrawType::LineStrip, vertexCount);
+	DrawGeometry3D(drawIndex, EDrawType::LineStrip, vertexCount);
 }
 
-void GeometryShader3D::DrawAxisAlignedBoundingBox3D(const Matrix4x4f& view, const Matrix4x4f& projection, const Vector3f& minPosition, const Vector3f& maxPosition, const Vector4f& color)
+void GeometryShader3D::DrawAxisAlignedBoundingBox3D(uint32_t drawIndex, const Vector3f& minPosition, const Vector3f& maxPosition, const Vector4f& color)
 {
 	uint32_t vertexCount = 0;
 
@@ -133,10 +122,10 @@ void GeometryShader3D::DrawAxisAlignedBoundingBox3D(const Matrix4x4f& view, cons
 	vertices_[vertexCount++] = VertexPositionColor(Vector3f(maxPosition.x, maxPosition.y, minPosition.z), color);
 	vertices_[vertexCount++] = VertexPositionColor(Vector3f(maxPosition.x, minPosition.y, minPosition.z), color);
 
-	DrawGeometry3D(Matrix4x4f::GetIdentity(), view, projection, EDrawType::Lines, vertexCount);
+	DrawGeometry3D(drawIndex, EDrawType::Lines, vertexCount);
 }
 
-void GeometryShader3D::DrawGrid3D(const Matrix4x4f& view, const Matrix4x4f& projection, float minX, float maxX, float strideX, float minZ, float maxZ, float strideZ, const Vector4f& color)
+void GeometryShader3D::DrawGrid3D(uint32_t drawIndex, float minX, float maxX, float strideX, float minZ, float maxZ, float strideZ, const Vector4f& color)
 {
 	ASSERT((strideX >= 1.0f && strideZ >= 1.0f), "The values of strideX and strideZ are too small : %f, %f", strideX, strideZ);
 
@@ -164,25 +153,26 @@ void GeometryShader3D::DrawGrid3D(const Matrix4x4f& view, const Matrix4x4f& proj
 		vertices_[vertexCount++] = VertexPositionColor(Vector3f(maxXPosition, 0.0f, z), color);
 	}
 	
-	DrawGeometry3D(Matrix4x4f::GetIdentity(), view, projection, EDrawType::Lines, static_cast<uint32_t>(vertexCount));
+	DrawGeometry3D(drawIndex, EDrawType::Lines, static_cast<uint32_t>(vertexCount));
 }
 
-void GeometryShader3D::DrawGeometry3D(const Matrix4x4f& world, const Matrix4x4f& view, const Matrix4x4f& projection, const EDrawType& drawType, uint32_t vertexCount)
+void GeometryShader3D::DrawGeometry3D(uint32_t drawIndex, const EDrawType& drawType, uint32_t vertexCount)
 {
 	ASSERT(drawType != EDrawType::None, "invalid draw type...");
 
+	if (!IsReady())
+	{
+		return;
+	}
+
 	const void* bufferPtr = reinterpret_cast<const void*>(vertices_.data());
 	uint32_t bufferByteSize = static_cast<uint32_t>(VertexPositionColor::GetStride() * vertices_.size());
 	WriteDynamicVertexBuffer(vertexBufferObject_, bufferPtr, bufferByteSize);
 
 	Shader::Bind();
 
-	Shader::SetUniform("world", world);
-	Shader::SetUniform("view", view);
-	Shader::SetUniform("projection", projection);
-
 	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind 3d geometry vertex array...");
-	GL_ASSERT(glDrawArrays(static_cast<GLenum>(drawType), 0, vertexCount), "failed to draw 3d geometry...");
+	GL_ASSERT(glDrawArraysInstancedBaseInstance(static_cast<GLenum>(drawType), 0, vertexCount, 1, drawIndex), "failed to draw 3d geometry...");
 	GL_ASSERT(glBindVertexArray(0), "failed to unbind 3d geometry vertex array...");
 
 	Shader::Unbind();
@@ -52,54 +52,49 @@ public:
 	/**
 	 * @brief ȭ鿡 3D  ׸ϴ.
 	 * 
-	 * @param view þ Դϴ.
-	 * @param projection  Դϴ.
+	 * @param drawIndex     ׸  εԴϴ.
 	 * @param positions ȭ  3D Դϴ.
 	 * @param color  Դϴ.
 	 * 
 	 * @note 3D   MAX_VERTEX_SIZE(10000) ũ⸦   ϴ.
 	 */
-	void DrawPoints3D(const Matrix4x4f& view, const Matrix4x4f& projection, const std::vector<Vector3f>& positions, const Vector4f& color);
+	void DrawPoints3D(uint32_t drawIndex, const std::vector<Vector3f>& positions, const Vector4f& color);
 
 
 	/**
 	 * @brief ȭ鿡   3D  ׸ϴ.
 	 *
-	 * @param view þ Դϴ.
-	 * @param projection  Դϴ.
+	 * @param drawIndex     ׸  εԴϴ.
 	 * @param positions ȭ  3D Դϴ.
 	 * @param color  Դϴ.
 	 *
 	 * @note 2D   MAX_VERTEX_SIZE(10000) ũ⸦   ϴ.
 	 */
-	void DrawConnectPoints3D(const Matrix4x4f& view, const Matrix4x4f& projection, const std::vector<Vector3f>& positions, const Vector4f& color);
+	void DrawConnectPoints3D(uint32_t drawIndex, const std::vector<Vector3f>& positions, const Vector4f& color);
 
 
 	/**
 	 * @brief ȭ鿡 3D  ׸ϴ.
 	 * 
-	 * @param view þ Դϴ.
-	 * @param projection  Դϴ.
+	 * @param drawIndex     ׸  εԴϴ.
 	 * @param fromPosition  Դϴ.
 	 * @param toPosition  Դϴ.
 	 * @param color  Դϴ.
 	 */
-	void DrawLine3D(const Matrix4x4f& view, const Matrix4x4f& projection, const Vector3f& fromPosition, const Vector3f& toPosition, const Vector4f& color);
+	void DrawLine3D(uint32_t drawIndex, const Vector3f& fromPosition, const Vector3f& toPosition, const Vector4f& color);
 
 
 	/**
 	 * @brief ȭ鿡 3D  ׸ϴ.
 	 *
-	 * @param view þ Դϴ.
-	 * @param projection  Դϴ.
+	 * @param drawIndex     ׸  εԴϴ.
 	 * @param fromPosition  Դϴ.
 	 * @param fromColor   Դϴ.
 	 * @param toPosition  Դϴ.
 	 * @param toColor   Դϴ.
 	 */
 	void DrawLine3D(
-		const Matrix4x4f& view, 
-		const Matrix4x4f& projection, 
+		uint32_t drawIndex,
 		const Vector3f& fromPosition,
 		const Vector4f& fromColor,
 		const Vector3f& toPosition,
@@ -110,15 +105,13 @@ public:
 	/**
 	 * @brief 3D    (Axis Aligned Bounding Box, AABB) ȭ鿡 ׸ϴ.
 	 *
-	 * @param view þ Դϴ.
-	 * @param projection  Դϴ.
+	 * @param drawIndex     ׸  εԴϴ.
 	 * @param minPosition   ּڰԴϴ.
 	 * @param maxPosition   ִԴϴ.
 	 * @param color   Դϴ.
 	 */
 	void DrawAxisAlignedBoundingBox3D(
-		const Matrix4x4f& view, 
-		const Matrix4x4f& projection, 
+		uint32_t drawIndex,
 		const Vector3f& minPosition,
 		const Vector3f& maxPosition,
 		const Vector4f& color
@@ -128,8 +121,7 @@ public:
 	/**
 	 * @brief ȭ鿡 XZ  ڸ ׸ϴ.
 	 * 
-	 * @param view þ Դϴ.
-	 * @param projection  Դϴ.
+	 * @param drawIndex     ׸  εԴϴ.
 	 * @param minX Xǥ ּҰԴϴ.
 	 * @param maxX Xǥ ִԴϴ.
 	 * @param strideX X  Դϴ.
@@ -138,7 +130,7 @@ public:
 	 * @param strideZ Z  Դϴ.
 	 * @param color  Դϴ.
 	 */
-	void DrawGrid3D(const Matrix4x4f& view, const Matrix4x4f& projection, float minX, float maxX, float strideX, float minZ, float maxZ, float strideZ, const Vector4f& color);
+	void DrawGrid3D(uint32_t drawIndex, float minX, float maxX, float strideX, float minZ, float maxZ, float strideZ, const Vector4f& color);
 
 	
 private:
@@ -293,13 +285,13 @@ private:
 	/**
 	 * @brief 3D ⺻  ׸⸦ մϴ.
 	 *
-	 * @param world  Դϴ.
-	 * @param view þ Դϴ.
-	 * @param projection  Դϴ.
+	 * @param drawIndex ׸  εԴϴ. ̴ gl_BaseInstance ޵˴ϴ.
 	 * @param drawType ׸ ŸԴϴ.
 	 * @param vertexCount  Դϴ.
+	 *
+	 * @note þ İ   ShaderDataUtils::PASS_BUFFER_BINDING ġ н ͸ մϴ.
 	 */
-	void DrawGeometry3D(const Matrix4x4f& world, const Matrix4x4f& view, const Matrix4x4f& projection, const EDrawType& drawType, uint32_t vertexCount);
+	void DrawGeometry3D(uint32_t drawIndex, const EDrawType& drawType, uint32_t vertexCount);
 
 
 private:
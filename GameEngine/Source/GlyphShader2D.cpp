@@ -2,6 +2,7 @@
 
 #include "Assertion.h"
 #include "GLAssertion.h"
+#include "GLResourceUtils.h"
 #include "TTFont.h"
 
 #include <glad/glad.h>
@@ -21,28 +22,11 @@ void GlyphShader2D::Initialize(const std::wstring& vsPath, const std::wstring& f
 
 	Shader::Initialize(vsPath, fsPath);
 
-	GL_ASSERT(glGenVertexArrays(1, &vertexArrayObject_), "failed to generate glyph vertex array...");
-	GL_ASSERT(glGenBuffers(1, &vertexBufferObject_), "failed to generate glyph vertex buffer...");
-
-	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind glyph vertex array...");
-	GL_ASSERT(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind glyph vertex buffer...");
-	GL_ASSERT(glBufferData(GL_ARRAY_BUFFER, VertexPositionTexture::GetStride() * vertices_.size(), reinterpret_cast<const void*>(vertices_.data()), GL_DYNAMIC_DRAW),
-		"failed to create a new data store for a glyph buffer object...");
-
-	GL_ASSERT(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, VertexPositionTexture::GetStride(), (void*)(offsetof(VertexPositionTexture, position))),
-		"failed to specify the location and data format of the array of generic vertex attributes at index...");
-	GL_ASSERT(glEnableVertexAttribArray(0), "failed to enable vertex attrib array...");
-
-	GL_ASSERT(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, VertexPositionTexture::GetStride(), (void*)(offsetof(VertexPositionTexture, texture))),
-		"failed to specify the location and data format of the array of generic vertex attributes at index...");
-	GL_ASSERT(glEnableVertexAttribArray(1), "failed to enable vertex attrib array...");
-
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind glyph vertex array...");
-
-	Shader::Bind();
-	orthoLocation_ = GetUniformLocation("ortho");
-	glyphColorLocation_ = GetUniformLocation("glyphColor");
-	Shader::Unbind();
+	vertexBufferObject_ = GLResourceUtils::CreateBuffer(VertexPositionTexture::GetStride() * vertices_.size(), reinterpret_cast<const void*>(vertices_.data()), GL_DYNAMIC_STORAGE_BIT);
+	vertexArrayObject_ = GLResourceUtils::CreateVertexArray(vertexBufferObject_, VertexPositionTexture::GetStride(), {
+		{ 0, 3, static_cast<uint32_t>(offsetof(VertexPositionTexture, position)) },
+		{ 1, 2, static_cast<uint32_t>(offsetof(VertexPositionTexture, texture))  },
+	});
 }
 
 void GlyphShader2D::Release()
@@ -55,11 +39,22 @@ void GlyphShader2D::Release()
 	GL_ASSERT(glDeleteVertexArrays(1, &vertexArrayObject_), "failed to delete glyph vertex array object...");
 }
 
+void GlyphShader2D::OnReady()
+{
+	orthoHandle_ = GetUniformHandle("ortho");
+	glyphColorHandle_ = GetUniformHandle("glyphColor");
+}
+
 void GlyphShader2D::DrawText2D(const Matrix4x4f& ortho, const TTFont* font, const std::wstring& text, const Vector2f& center, const Vector4f& color)
 {
 	ASSERT(text.length() <= MAX_STRING_LEN, L"overflow text length for draw %d...", text.length());
 	ASSERT(font != nullptr, "invalid font resource...");
 
+	if (!IsReady())
+	{
+		return;
+	}
+
 	int32_t vertexCount = UpdateGlyphVertexBuffer(font, text, center);
 
 	const void* bufferPtr = reinterpret_cast<const void*>(vertices_.data());
@@ -68,11 +63,10 @@ void GlyphShader2D::DrawText2D(const Matrix4x4f& ortho, const TTFont* font, cons
 
 	Shader::Bind();
 
-	GL_ASSERT(glActiveTexture(GL_TEXTURE0), "failed to active glyph texture atlas...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, font->GetGlyphAtlasID()), "failed to bind glyph texture atlas...");
+	GL_ASSERT(glBindTextureUnit(0, font->GetGlyphAtlasID()), "failed to bind glyph texture atlas...");
 
-	Shader::SetUniform("ortho", ortho);
-	Shader::SetUniform("glyphColor", color);
+	Shader::SetUniform(orthoHandle_, ortho);
+	Shader::SetUniform(glyphColorHandle_, color);
 
 	glBindVertexArray(vertexArrayObject_);
 	glDrawArrays(GL_TRIANGLES, 0, vertexCount);
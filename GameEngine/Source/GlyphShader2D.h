@@ -66,6 +66,13 @@ public:
 	void DrawText2D(const Matrix4x4f& ortho, const TTFont* font, const std::wstring& text, const Vector2f& center, const Vector4f& color);
 
 
+protected:
+	/**
+	 * @brief ̴ α׷ ũ    ڵ ϴ.
+	 */
+	virtual void OnReady() override;
+
+
 private:
 	/**
 	 * @brief ؽƮ ׸⸦ ϴ ̴ ο ϴ Դϴ.
@@ -248,13 +255,13 @@ private:
 
 
 	/**
-	 * @brief ũ    Ÿ   ġԴϴ.
+	 * @brief ũ      ڵԴϴ.
 	 */
-	int32_t orthoLocation_ = -1;
+	UniformHandle orthoHandle_;
 
 
 	/**
-	 * @brief ۸  Ÿ   ġԴϴ.
+	 * @brief ۸    ڵԴϴ.
 	 */
-	int32_t glyphColorLocation_ = -1;
+	UniformHandle glyphColorHandle_;
 };
\ No newline at end of file
@@ -34,9 +34,28 @@ void IApplication::Setup()
 	InputManager::Get().SetInputControlWindow(window_.get());
 	RenderManager::Get().SetRenderTargetWindow(window_.get());
 
+	TaskManager::Get().Startup();
 	InputManager::Get().Startup();
 	ResourceManager::Get().Startup();
 	RenderManager::Get().Startup();
+	TextureStreamManager::Get().Startup();
+	TextureResidencyManager::Get().Startup();
+	GPUProfileManager::Get().Startup();
+	FrameCaptureManager::Get().Startup();
+
+	std::wstring capturePath;
+	if (CommandLineUtils::GetStringValue(L"capture", capturePath))
+	{
+		std::wstring captureFormat;
+		bool bIsRawFormat = CommandLineUtils::GetStringValue(L"captureFormat", captureFormat) && StringUtils::ToLower(captureFormat) == L"raw";
+		FrameCaptureManager::Get().BeginSequence(capturePath, bIsRawFormat ? FrameCaptureManager::EFormat::Raw : FrameCaptureManager::EFormat::Png);
+	}
+
+	std::wstring gpuTracePath;
+	if (CommandLineUtils::GetStringValue(L"gpuTrace", gpuTracePath))
+	{
+		GPUProfileManager::Get().BeginTrace(gpuTracePath);
+	}
 
 	auto defaultLoopDoneEvent = [&]() { bIsDoneLoop_ = true; };
 	auto defaultResizeEvent = [&]() { RenderManager::Get().Resize(); };
@@ -54,9 +73,14 @@ void IApplication::Shutdown()
 {
 	if (bIsSetup_)
 	{
+		FrameCaptureManager::Get().Shutdown();
+		GPUProfileManager::Get().Shutdown();
 		ResourceManager::Get().Shutdown();
+		TextureResidencyManager::Get().Shutdown();
+		TextureStreamManager::Get().Shutdown();
 		RenderManager::Get().Shutdown();
 		InputManager::Get().Shutdown();
+		TaskManager::Get().Shutdown();
 
 		window_->Destroy();
 		window_.reset();
@@ -66,4 +90,4 @@ void IApplication::Shutdown()
 
 		bIsSetup_ = false;
 	}
-}
+}
\ No newline at end of file
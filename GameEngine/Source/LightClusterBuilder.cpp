@@ -0,0 +1,251 @@
+#include "LightClusterBuilder.h"
+
+#include <cmath>
+#include <emmintrin.h>
+#include <limits>
+
+#include "Assertion.h"
+#include "MathUtils.h"
+#include "TaskManager.h"
+
+void LightClusterBuilder::SetProjection(float fov, float aspect, float nearZ, float farZ)
+{
+	ASSERT(0.0f < nearZ && nearZ < farZ, "invalid light cluster depth range : (near : %f, far : %f)", nearZ, farZ);
+
+	if (!clusterBounds_.empty() && fov_ == fov && aspect_ == aspect && nearZ_ == nearZ && farZ_ == farZ)
+	{
+		return;
+	}
+
+	fov_ = fov;
+	aspect_ = aspect;
+	nearZ_ = nearZ;
+	farZ_ = farZ;
+
+	float tanHalfFovY = std::tan(fov_ * 0.5f);
+	float tanHalfFovX = tanHalfFovY * aspect_;
+
+	clusterBounds_.resize(CLUSTER_COUNT);
+	for (uint32_t z = 0; z < CLUSTER_COUNT_Z; ++z)
+	{
+		float depths[2] =
+		{
+			nearZ_ * std::pow(farZ_ / nearZ_, static_cast<float>(z + 0) / static_cast<float>(CLUSTER_COUNT_Z)),
+			nearZ_ * std::pow(farZ_ / nearZ_, static_cast<float>(z + 1) / static_cast<float>(CLUSTER_COUNT_Z)),
+		};
+
+		for (uint32_t y = 0; y < CLUSTER_COUNT_Y; ++y)
+		{
+			float ndcMinY = -1.0f + 2.0f * static_cast<float>(y + 0) / static_cast<float>(CLUSTER_COUNT_Y);
+			float ndcMaxY = -1.0f + 2.0f * static_cast<float>(y + 1) / static_cast<float>(CLUSTER_COUNT_Y);
+
+			for (uint32_t x = 0; x < CLUSTER_COUNT_X; ++x)
+			{
+				float ndcMinX = -1.0f + 2.0f * static_cast<float>(x + 0) / static_cast<float>(CLUSTER_COUNT_X);
+				float ndcMaxX = -1.0f + 2.0f * static_cast<float>(x + 1) / static_cast<float>(CLUSTER_COUNT_X);
+
+				AxisAlignedBoundingBox bound;
+				for (const auto& depth : depths)
+				{
+					bound.Expand(Vector3f(ndcMinX * tanHalfFovX * depth, ndcMinY * tanHalfFovY * depth, -depth));
+					bound.Expand(Vector3f(ndcMaxX * tanHalfFovX * depth, ndcMinY * tanHalfFovY * depth, -depth));
+					bound.Expand(Vector3f(ndcMinX * tanHalfFovX * depth, ndcMaxY * tanHalfFovY * depth, -depth));
+					bound.Expand(Vector3f(ndcMaxX * tanHalfFovX * depth, ndcMaxY * tanHalfFovY * depth, -depth));
+				}
+
+				clusterBounds_[GetClusterIndex(x, y, z)] = bound;
+			}
+		}
+	}
+}
+
+void LightClusterBuilder::Build(const Matrix4x4f& view, const std::vector<PointLight>& pointLights, const std::vector<SpotLight>& spotLights)
+{
+	ASSERT(!clusterBounds_.empty(), "not set light cluster projection...");
+
+	lightBounds_.clear();
+	for (const auto& pointLight : pointLights)
+	{
+		Vector3f color = pointLight.GetAmbientRGB() + pointLight.GetDiffuseRGB() + pointLight.GetSpecularRGB();
+		float intensity = MathUtils::Max<float>(color.x, MathUtils::Max<float>(color.y, color.z));
+
+		LightBound lightBound;
+		lightBound.position = pointLight.GetPosition();
+		lightBound.radius = ComputeLightRange(pointLight.GetConstant(), pointLight.GetLinear(), pointLight.GetQuadratic(), intensity);
+
+		lightBounds_.push_back(lightBound);
+	}
+
+	for (const auto& spotLight : spotLights)
+	{
+		Vector3f color = spotLight.GetAmbientRGB() + spotLight.GetDiffuseRGB() + spotLight.GetSpecularRGB();
+		float intensity = MathUtils::Max<float>(color.x, MathUtils::Max<float>(color.y, color.z));
+
+		LightBound lightBound;
+		lightBound.position = spotLight.GetPosition();
+		lightBound.radius = ComputeLightRange(spotLight.GetConstant(), spotLight.GetLinear(), spotLight.GetQuadratic(), intensity);
+
+		lightBounds_.push_back(lightBound);
+	}
+
+	clusterEntries_.resize(CLUSTER_COUNT);
+	sliceLights_.resize(CLUSTER_COUNT_Z);
+	sliceLightIndices_.resize(CLUSTER_COUNT_Z);
+	sliceScratches_.resize(CLUSTER_COUNT_Z);
+	for (auto& sliceLight : sliceLights_)
+	{
+		sliceLight.clear();
+	}
+
+	viewLightBounds_.resize(lightBounds_.size());
+	for (uint32_t index = 0; index < static_cast<uint32_t>(lightBounds_.size()); ++index)
+	{
+		LightBound& viewLightBound = viewLightBounds_[index];
+		viewLightBound.position = MathUtils::TransformPosition(lightBounds_[index].position, view);
+		viewLightBound.radius = lightBounds_[index].radius;
+
+		float depth = -viewLightBound.position.z;
+		if (depth + viewLightBound.radius < nearZ_ || depth - viewLightBound.radius > farZ_)
+		{
+			continue;
+		}
+
+		/** Ŭ (pow)  (log) ݿø ̷ 迡   ġ ʵ   ϴ. */
+		int32_t minSlice = MathUtils::Max<int32_t>(ComputeSlice(depth - viewLightBound.radius) - 1, 0);
+		int32_t maxSlice = MathUtils::Min<int32_t>(ComputeSlice(depth + viewLightBound.radius) + 1, static_cast<int32_t>(CLUSTER_COUNT_Z) - 1);
+		for (int32_t slice = minSlice; slice <= maxSlice; ++slice)
+		{
+			sliceLights_[slice].push_back(index);
+		}
+	}
+
+	TaskManager::Get().ParallelFor(CLUSTER_COUNT_Z, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t slice = begin; slice < end; ++slice)
+			{
+				BuildSlice(slice);
+			}
+		});
+
+	lightIndices_.clear();
+	for (uint32_t slice = 0; slice < CLUSTER_COUNT_Z; ++slice)
+	{
+		uint32_t baseOffset = static_cast<uint32_t>(lightIndices_.size());
+		for (uint32_t cluster = GetClusterIndex(0, 0, slice); cluster < GetClusterIndex(0, 0, slice + 1); ++cluster)
+		{
+			clusterEntries_[cluster].offset += baseOffset;
+		}
+
+		lightIndices_.insert(lightIndices_.end(), sliceLightIndices_[slice].begin(), sliceLightIndices_[slice].end());
+	}
+}
+
+float LightClusterBuilder::ComputeLightRange(float constant, float linear, float quadratic, float intensity, float threshold)
+{
+	float target = intensity / threshold - constant;
+	if (target <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	if (quadratic > Epsilon)
+	{
+		return (-linear + std::sqrt(linear * linear + 4.0f * quadratic * target)) / (2.0f * quadratic);
+	}
+
+	if (linear > Epsilon)
+	{
+		return target / linear;
+	}
+
+	return std::numeric_limits<float>::max();
+}
+
+int32_t LightClusterBuilder::ComputeSlice(float depth) const
+{
+	if (depth <= nearZ_)
+	{
+		return 0;
+	}
+
+	/** 谡     ϹǷ,  ȯ     ε մϴ. */
+	if (depth >= farZ_)
+	{
+		return static_cast<int32_t>(CLUSTER_COUNT_Z) - 1;
+	}
+
+	float rate = std::log(depth / nearZ_) / std::log(farZ_ / nearZ_);
+	int32_t slice = static_cast<int32_t>(rate * static_cast<float>(CLUSTER_COUNT_Z));
+
+	return MathUtils::Clamp<int32_t>(slice, 0, static_cast<int32_t>(CLUSTER_COUNT_Z) - 1);
+}
+
+void LightClusterBuilder::BuildSlice(uint32_t slice)
+{
+	const std::vector<uint32_t>& sliceLights = sliceLights_[slice];
+	std::vector<uint32_t>& sliceLightIndices = sliceLightIndices_[slice];
+	sliceLightIndices.clear();
+
+	uint32_t lightCount = static_cast<uint32_t>(sliceLights.size());
+	uint32_t paddedCount = (lightCount + 3) & ~3u;
+
+	SliceScratch& scratch = sliceScratches_[slice];
+	std::vector<float>& positionX = scratch.positionX;
+	std::vector<float>& positionY = scratch.positionY;
+	std::vector<float>& positionZ = scratch.positionZ;
+	std::vector<float>& radiusSquare = scratch.radiusSquare;
+
+	/** assign 뷮 ϸ ٽ Ҵ ʽϴ. */
+	positionX.assign(paddedCount, 0.0f);
+	positionY.assign(paddedCount, 0.0f);
+	positionZ.assign(paddedCount, 0.0f);
+	radiusSquare.assign(paddedCount, -1.0f);
+	for (uint32_t index = 0; index < lightCount; ++index)
+	{
+		const LightBound& viewLightBound = viewLightBounds_[sliceLights[index]];
+		positionX[index] = viewLightBound.position.x;
+		positionY[index] = viewLightBound.position.y;
+		positionZ[index] = viewLightBound.position.z;
+		radiusSquare[index] = viewLightBound.radius * viewLightBound.radius;
+	}
+
+	const __m128 zero = _mm_setzero_ps();
+
+	for (uint32_t cluster = GetClusterIndex(0, 0, slice); cluster < GetClusterIndex(0, 0, slice + 1); ++cluster)
+	{
+		const AxisAlignedBoundingBox& bound = clusterBounds_[cluster];
+
+		const __m128 minX = _mm_set1_ps(bound.minPosition.x);
+		const __m128 minY = _mm_set1_ps(bound.minPosition.y);
+		const __m128 minZ = _mm_set1_ps(bound.minPosition.z);
+		const __m128 maxX = _mm_set1_ps(bound.maxPosition.x);
+		const __m128 maxY = _mm_set1_ps(bound.maxPosition.y);
+		const __m128 maxZ = _mm_set1_ps(bound.maxPosition.z);
+
+		ClusterEntry& entry = clusterEntries_[cluster];
+		entry.offset = static_cast<uint32_t>(sliceLightIndices.size());
+
+		for (uint32_t index = 0; index < paddedCount; index += 4)
+		{
+			__m128 x = _mm_loadu_ps(&positionX[index]);
+			__m128 y = _mm_loadu_ps(&positionY[index]);
+			__m128 z = _mm_loadu_ps(&positionZ[index]);
+
+			__m128 dx = _mm_max_ps(zero, _mm_max_ps(_mm_sub_ps(minX, x), _mm_sub_ps(x, maxX)));
+			__m128 dy = _mm_max_ps(zero, _mm_max_ps(_mm_sub_ps(minY, y), _mm_sub_ps(y, maxY)));
+			__m128 dz = _mm_max_ps(zero, _mm_max_ps(_mm_sub_ps(minZ, z), _mm_sub_ps(z, maxZ)));
+			__m128 distanceSquare = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_add_ps(_mm_mul_ps(dy, dy), _mm_mul_ps(dz, dz)));
+
+			int32_t mask = _mm_movemask_ps(_mm_cmple_ps(distanceSquare, _mm_loadu_ps(&radiusSquare[index])));
+			for (uint32_t lane = 0; mask != 0; ++lane, mask >>= 1)
+			{
+				if (mask & 1)
+				{
+					sliceLightIndices.push_back(sliceLights[index + lane]);
+				}
+			}
+		}
+
+		entry.count = static_cast<uint32_t>(sliceLightIndices.size()) - entry.offset;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include "MaterialPool.h"
+
+#include "Assertion.h"
+#include "ShaderDataUtils.h"
+
+MaterialPool::~MaterialPool()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void MaterialPool::Initialize(uint32_t maxMaterialCount)
+{
+	ASSERT(!bIsInitialized_, "already initialize material pool resource...");
+
+	materialPool_.Initialize(ShaderBufferPool::EType::Uniform, sizeof(ShaderDataUtils::MaterialData), maxMaterialCount);
+	materialIDs_ = std::unordered_map<const Material*, int32_t>();
+
+	bIsInitialized_ = true;
+}
+
+void MaterialPool::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+	bIsInitialized_ = false;
+
+	materialIDs_.clear();
+	materialPool_.Release();
+}
+
+void MaterialPool::Add(const Material* material)
+{
+	ASSERT(bIsInitialized_, "not initialized material pool resource...");
+
+	if (materialIDs_.find(material) == materialIDs_.end())
+	{
+		materialIDs_.insert({ material, materialPool_.Allocate() });
+	}
+
+	Update(material);
+}
+
+void MaterialPool::Remove(const Material* material)
+{
+	auto materialID = materialIDs_.find(material);
+	ASSERT(materialID != materialIDs_.end(), "not added material to material pool...");
+
+	materialPool_.Free(materialID->second);
+	materialIDs_.erase(materialID);
+}
+
+void MaterialPool::Update(const Material* material)
+{
+	auto materialID = materialIDs_.find(material);
+	ASSERT(materialID != materialIDs_.end(), "not added material to material pool...");
+
+	ShaderDataUtils::MaterialData data = ShaderDataUtils::Pack(*material);
+	materialPool_.Update(materialID->second, &data);
+}
+
+void MaterialPool::Flush()
+{
+	ASSERT(bIsInitialized_, "not initialized material pool resource...");
+
+	materialPool_.Flush();
+}
+
+void MaterialPool::Bind(const Material* material)
+{
+	auto materialID = materialIDs_.find(material);
+	ASSERT(materialID != materialIDs_.end(), "not added material to material pool...");
+
+	materialPool_.BindElement(ShaderDataUtils::MATERIAL_BUFFER_BINDING, materialID->second);
+}
\ No newline at end of file
@@ -0,0 +1,440 @@
+#include "OcclusionCuller.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <emmintrin.h>
+
+#include "Assertion.h"
+#include "MathUtils.h"
+#include "TaskManager.h"
+#include "Vector4.h"
+
+/**
+ * @brief       տ ִٰ Ǵ Ŭ  w ּڰԴϴ.
+ */
+static const float MIN_CLIP_W = 1.0e-4f;
+
+/**
+ * @brief ȭ  ﰢ ּ ȭ  Դϴ.
+ */
+static const float MIN_TRIANGLE_AREA = 1.0e-6f;
+
+/**
+ * @brief ġ Ŭ  ȯմϴ.
+ */
+static inline Vector4f TransformToClip(const Vector3f& position, const Matrix4x4f& matrix)
+{
+	return Vector4f(
+		position.x * matrix.m[0][0] + position.y * matrix.m[1][0] + position.z * matrix.m[2][0] + matrix.m[3][0],
+		position.x * matrix.m[0][1] + position.y * matrix.m[1][1] + position.z * matrix.m[2][1] + matrix.m[3][1],
+		position.x * matrix.m[0][2] + position.y * matrix.m[1][2] + position.z * matrix.m[2][2] + matrix.m[3][2],
+		position.x * matrix.m[0][3] + position.y * matrix.m[1][3] + position.z * matrix.m[2][3] + matrix.m[3][3]
+	);
+}
+
+OcclusionCuller::OcclusionCuller(int32_t width, int32_t height)
+	: width_(width)
+	, height_(height)
+{
+	ASSERT(width > 0 && height > 0, "invalid occlusion depth buffer size : (width : %d, height : %d)", width, height);
+	ASSERT((width % TILE_SIZE) == 0 && (height % TILE_SIZE) == 0, "occlusion depth buffer size must be multiple of tile size...");
+
+	tileCountX_ = width_ / TILE_SIZE;
+	tileCountY_ = height_ / TILE_SIZE;
+	tileBins_.resize(tileCountX_ * tileCountY_);
+
+	int32_t levelWidth = width_;
+	int32_t levelHeight = height_;
+	while (true)
+	{
+		DepthLevel level;
+		level.width = levelWidth;
+		level.height = levelHeight;
+		level.depth.resize(levelWidth * levelHeight, 1.0f);
+
+		depthPyramid_.push_back(level);
+
+		if (levelWidth == 1 && levelHeight == 1)
+		{
+			break;
+		}
+
+		levelWidth = (levelWidth + 1) / 2;
+		levelHeight = (levelHeight + 1) / 2;
+	}
+}
+
+void OcclusionCuller::Begin(const Matrix4x4f& view, const Matrix4x4f& projection)
+{
+	viewProjection_ = view * projection;
+
+	occluders_.clear();
+	statistics_ = { 0, 0, 0, 0 };
+}
+
+void OcclusionCuller::AddOccluder(const StaticMesh* mesh, const Matrix4x4f& world)
+{
+	ASSERT(mesh != nullptr && mesh->IsInitialized(), "invalid static mesh for occluder...");
+	ASSERT(mesh->HasGeometry(), "static mesh for occluder must keep cpu geometry...");
+
+	AddOccluder(mesh->GetVertices(), mesh->GetIndices(), world);
+}
+
+void OcclusionCuller::AddOccluder(const std::vector<StaticMesh::Vertex>& vertices, const std::vector<uint32_t>& indices, const Matrix4x4f& world)
+{
+	Occluder occluder;
+	occluder.vertices = &vertices;
+	occluder.indices = &indices;
+	occluder.world = world;
+
+	occluders_.push_back(occluder);
+}
+
+void OcclusionCuller::Rasterize()
+{
+	uint32_t occluderCount = static_cast<uint32_t>(occluders_.size());
+	if (occluderTriangles_.size() < occluderCount)
+	{
+		occluderTriangles_.resize(occluderCount);
+	}
+
+	TaskManager::Get().ParallelFor(occluderCount, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t index = begin; index < end; ++index)
+			{
+				occluderTriangles_[index].clear();
+				SetupTriangles(occluders_[index], occluderTriangles_[index]);
+			}
+		});
+
+	for (auto& tileBin : tileBins_)
+	{
+		tileBin.clear();
+	}
+
+	for (uint32_t occluderIndex = 0; occluderIndex < occluderCount; ++occluderIndex)
+	{
+		const std::vector<Triangle>& triangles = occluderTriangles_[occluderIndex];
+		for (uint32_t triangleIndex = 0; triangleIndex < static_cast<uint32_t>(triangles.size()); ++triangleIndex)
+		{
+			const Triangle& triangle = triangles[triangleIndex];
+			for (int32_t tileY = triangle.minY / TILE_SIZE; tileY <= triangle.maxY / TILE_SIZE; ++tileY)
+			{
+				for (int32_t tileX = triangle.minX / TILE_SIZE; tileX <= triangle.maxX / TILE_SIZE; ++tileX)
+				{
+					tileBins_[tileY * tileCountX_ + tileX].push_back({ occluderIndex, triangleIndex });
+				}
+			}
+		}
+
+		statistics_.occluderTriangleCount += static_cast<uint32_t>(occluders_[occluderIndex].indices->size() / 3);
+		statistics_.rasterizedTriangleCount += static_cast<uint32_t>(triangles.size());
+	}
+
+	TaskManager::Get().ParallelFor(static_cast<uint32_t>(tileBins_.size()), [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t tile = begin; tile < end; ++tile)
+			{
+				RasterizeTile(static_cast<int32_t>(tile) % tileCountX_, static_cast<int32_t>(tile) / tileCountX_);
+			}
+		});
+
+	BuildDepthPyramid();
+}
+
+bool OcclusionCuller::IsVisible(const AxisAlignedBoundingBox& bound) const
+{
+	float minX = +FLT_MAX, minY = +FLT_MAX, minDepth = +1.0f;
+	float maxX = -FLT_MAX, maxY = -FLT_MAX;
+
+	for (int32_t corner = 0; corner < 8; ++corner)
+	{
+		Vector3f position(
+			(corner & 1) ? bound.maxPosition.x : bound.minPosition.x,
+			(corner & 2) ? bound.maxPosition.y : bound.minPosition.y,
+			(corner & 4) ? bound.maxPosition.z : bound.minPosition.z
+		);
+
+		Vector4f clip = TransformToClip(position, viewProjection_);
+		if (clip.w < MIN_CLIP_W || clip.z < -clip.w)
+		{
+			return true;
+		}
+
+		float x = clip.x / clip.w;
+		float y = clip.y / clip.w;
+		float depth = clip.z / clip.w * 0.5f + 0.5f;
+
+		minX = (x < minX) ? x : minX;
+		maxX = (x > maxX) ? x : maxX;
+		minY = (y < minY) ? y : minY;
+		maxY = (y > maxY) ? y : maxY;
+		minDepth = (depth < minDepth) ? depth : minDepth;
+	}
+
+	if (maxX < -1.0f || minX > 1.0f || maxY < -1.0f || minY > 1.0f)
+	{
+		return false;
+	}
+
+	int32_t pixelMinX = MathUtils::Clamp<int32_t>(static_cast<int32_t>(std::floor((minX * 0.5f + 0.5f) * static_cast<float>(width_))), 0, width_ - 1);
+	int32_t pixelMaxX = MathUtils::Clamp<int32_t>(static_cast<int32_t>(std::floor((maxX * 0.5f + 0.5f) * static_cast<float>(width_))), 0, width_ - 1);
+	int32_t pixelMinY = MathUtils::Clamp<int32_t>(static_cast<int32_t>(std::floor((minY * 0.5f + 0.5f) * static_cast<float>(height_))), 0, height_ - 1);
+	int32_t pixelMaxY = MathUtils::Clamp<int32_t>(static_cast<int32_t>(std::floor((maxY * 0.5f + 0.5f) * static_cast<float>(height_))), 0, height_ - 1);
+
+	int32_t levelIndex = 0;
+	while (levelIndex + 1 < static_cast<int32_t>(depthPyramid_.size()))
+	{
+		if ((pixelMaxX >> levelIndex) - (pixelMinX >> levelIndex) <= 1 && (pixelMaxY >> levelIndex) - (pixelMinY >> levelIndex) <= 1)
+		{
+			break;
+		}
+
+		levelIndex++;
+	}
+
+	const DepthLevel& level = depthPyramid_[levelIndex];
+	for (int32_t y = (pixelMinY >> levelIndex); y <= (pixelMaxY >> levelIndex); ++y)
+	{
+		for (int32_t x = (pixelMinX >> levelIndex); x <= (pixelMaxX >> levelIndex); ++x)
+		{
+			if (minDepth <= level.depth[y * level.width + x])
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+void OcclusionCuller::Cull(const std::vector<AxisAlignedBoundingBox>& bounds, std::vector<uint32_t>& inOutIndices)
+{
+	uint32_t count = static_cast<uint32_t>(inOutIndices.size());
+	visibleFlags_.resize(count);
+
+	TaskManager::Get().ParallelFor(count, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t index = begin; index < end; ++index)
+			{
+				visibleFlags_[index] = IsVisible(bounds[inOutIndices[index]]) ? 1 : 0;
+			}
+		}, 64);
+
+	uint32_t visibleCount = 0;
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		if (visibleFlags_[index])
+		{
+			inOutIndices[visibleCount++] = inOutIndices[index];
+		}
+	}
+	inOutIndices.resize(visibleCount);
+
+	statistics_.testedCount += count;
+	statistics_.occludedCount += count - visibleCount;
+}
+
+void OcclusionCuller::SetupTriangles(const Occluder& occluder, std::vector<Triangle>& outTriangles) const
+{
+	const std::vector<StaticMesh::Vertex>& vertices = *occluder.vertices;
+	const std::vector<uint32_t>& indices = *occluder.indices;
+
+	Matrix4x4f worldViewProjection = occluder.world * viewProjection_;
+
+	std::vector<Vector4f> clips(vertices.size());
+	for (std::size_t index = 0; index < vertices.size(); ++index)
+	{
+		clips[index] = TransformToClip(vertices[index].position, worldViewProjection);
+	}
+
+	for (std::size_t index = 0; index + 2 < indices.size(); index += 3)
+	{
+		const Vector4f* clip[3] = { &clips[indices[index + 0]], &clips[indices[index + 1]], &clips[indices[index + 2]] };
+
+		bool bIsClipped = false;
+		for (int32_t vertex = 0; vertex < 3; ++vertex)
+		{
+			if (clip[vertex]->w < MIN_CLIP_W || clip[vertex]->z < -clip[vertex]->w)
+			{
+				bIsClipped = true;
+			}
+		}
+
+		if (bIsClipped)
+		{
+			continue;
+		}
+
+		Triangle triangle;
+		float depth[3];
+		for (int32_t vertex = 0; vertex < 3; ++vertex)
+		{
+			triangle.x[vertex] = (clip[vertex]->x / clip[vertex]->w * 0.5f + 0.5f) * static_cast<float>(width_);
+			triangle.y[vertex] = (clip[vertex]->y / clip[vertex]->w * 0.5f + 0.5f) * static_cast<float>(height_);
+			depth[vertex] = clip[vertex]->z / clip[vertex]->w * 0.5f + 0.5f;
+		}
+
+		float area = (triangle.x[1] - triangle.x[0]) * (triangle.y[2] - triangle.y[0]) - (triangle.x[2] - triangle.x[0]) * (triangle.y[1] - triangle.y[0]);
+		if (std::abs(area) < MIN_TRIANGLE_AREA)
+		{
+			continue;
+		}
+
+		if (area < 0.0f)
+		{
+			std::swap(triangle.x[1], triangle.x[2]);
+			std::swap(triangle.y[1], triangle.y[2]);
+			std::swap(depth[1], depth[2]);
+			area = -area;
+		}
+
+		float minX = std::fmin(triangle.x[0], std::fmin(triangle.x[1], triangle.x[2]));
+		float maxX = std::fmax(triangle.x[0], std::fmax(triangle.x[1], triangle.x[2]));
+		float minY = std::fmin(triangle.y[0], std::fmin(triangle.y[1], triangle.y[2]));
+		float maxY = std::fmax(triangle.y[0], std::fmax(triangle.y[1], triangle.y[2]));
+
+		if (maxX < 0.0f || minX >= static_cast<float>(width_) || maxY < 0.0f || minY >= static_cast<float>(height_))
+		{
+			continue;
+		}
+
+		triangle.minX = MathUtils::Clamp<int32_t>(static_cast<int32_t>(minX), 0, width_ - 1);
+		triangle.maxX = MathUtils::Clamp<int32_t>(static_cast<int32_t>(maxX), 0, width_ - 1);
+		triangle.minY = MathUtils::Clamp<int32_t>(static_cast<int32_t>(minY), 0, height_ - 1);
+		triangle.maxY = MathUtils::Clamp<int32_t>(static_cast<int32_t>(maxY), 0, height_ - 1);
+
+		float deltaX1 = triangle.x[1] - triangle.x[0];
+		float deltaY1 = triangle.y[1] - triangle.y[0];
+		float deltaX2 = triangle.x[2] - triangle.x[0];
+		float deltaY2 = triangle.y[2] - triangle.y[0];
+
+		triangle.depthX = ((depth[1] - depth[0]) * deltaY2 - (depth[2] - depth[0]) * deltaY1) / area;
+		triangle.depthY = ((depth[2] - depth[0]) * deltaX1 - (depth[1] - depth[0]) * deltaX2) / area;
+		triangle.depthC = depth[0] - triangle.depthX * triangle.x[0] - triangle.depthY * triangle.y[0];
+
+		outTriangles.push_back(triangle);
+	}
+}
+
+void OcclusionCuller::RasterizeTile(int32_t tileX, int32_t tileY)
+{
+	int32_t tileMinX = tileX * TILE_SIZE;
+	int32_t tileMinY = tileY * TILE_SIZE;
+	int32_t tileMaxX = tileMinX + TILE_SIZE - 1;
+	int32_t tileMaxY = tileMinY + TILE_SIZE - 1;
+
+	float* depthBuffer = depthPyramid_.front().depth.data();
+	for (int32_t y = tileMinY; y <= tileMaxY; ++y)
+	{
+		std::fill(depthBuffer + y * width_ + tileMinX, depthBuffer + y * width_ + tileMaxX + 1, 1.0f);
+	}
+
+	const __m128 pixelOffset = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+	const __m128 zero = _mm_setzero_ps();
+
+	for (const auto& bin : tileBins_[tileY * tileCountX_ + tileX])
+	{
+		const Triangle& triangle = occluderTriangles_[bin.first][bin.second];
+
+		int32_t minX = ((triangle.minX > tileMinX) ? triangle.minX : tileMinX) & ~3;
+		int32_t maxX = (triangle.maxX < tileMaxX) ? triangle.maxX : tileMaxX;
+		int32_t minY = (triangle.minY > tileMinY) ? triangle.minY : tileMinY;
+		int32_t maxY = (triangle.maxY < tileMaxY) ? triangle.maxY : tileMaxY;
+
+		float edgeA[3], edgeB[3], edgeC[3];
+		__m128 edgeTopLeft[3];
+		for (int32_t edge = 0; edge < 3; ++edge)
+		{
+			int32_t from = edge;
+			int32_t to = (edge + 1) % 3;
+
+			edgeA[edge] = triangle.y[from] - triangle.y[to];
+			edgeB[edge] = triangle.x[to] - triangle.x[from];
+
+			/**  ﰢ ϴ   Լ  Ȯ ȣ ݴ밡 ǵ,       մϴ. */
+			bool bIsFromAnchor = (triangle.x[from] < triangle.x[to]) || (triangle.x[from] == triangle.x[to] && triangle.y[from] < triangle.y[to]);
+			int32_t anchor = bIsFromAnchor ? from : to;
+			edgeC[edge] = -(edgeA[edge] * triangle.x[anchor] + edgeB[edge] * triangle.y[anchor]);
+
+			/** Top-Left ĢԴϴ. ݽð  ﰢ      ȼ ϹǷ, ϴ  ȼ Ȯ  ﰢ մϴ. */
+			bool bIsTopLeft = (edgeA[edge] > 0.0f) || (edgeA[edge] == 0.0f && edgeB[edge] < 0.0f);
+			edgeTopLeft[edge] = _mm_castsi128_ps(_mm_set1_epi32(bIsTopLeft ? -1 : 0));
+		}
+
+		const __m128 edgeA0 = _mm_set1_ps(edgeA[0]);
+		const __m128 edgeA1 = _mm_set1_ps(edgeA[1]);
+		const __m128 edgeA2 = _mm_set1_ps(edgeA[2]);
+		const __m128 depthX = _mm_set1_ps(triangle.depthX);
+
+		for (int32_t y = minY; y <= maxY; ++y)
+		{
+			float pixelY = static_cast<float>(y) + 0.5f;
+
+			const __m128 rowEdge0 = _mm_set1_ps(edgeB[0] * pixelY + edgeC[0]);
+			const __m128 rowEdge1 = _mm_set1_ps(edgeB[1] * pixelY + edgeC[1]);
+			const __m128 rowEdge2 = _mm_set1_ps(edgeB[2] * pixelY + edgeC[2]);
+			const __m128 rowDepth = _mm_set1_ps(triangle.depthY * pixelY + triangle.depthC);
+
+			float* row = depthBuffer + y * width_;
+			for (int32_t x = minX; x <= maxX; x += 4)
+			{
+				__m128 pixelX = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), pixelOffset);
+
+				__m128 edge0 = _mm_add_ps(_mm_mul_ps(edgeA0, pixelX), rowEdge0);
+				__m128 edge1 = _mm_add_ps(_mm_mul_ps(edgeA1, pixelX), rowEdge1);
+				__m128 edge2 = _mm_add_ps(_mm_mul_ps(edgeA2, pixelX), rowEdge2);
+
+				__m128 inside0 = _mm_or_ps(_mm_cmpgt_ps(edge0, zero), _mm_and_ps(_mm_cmpeq_ps(edge0, zero), edgeTopLeft[0]));
+				__m128 inside1 = _mm_or_ps(_mm_cmpgt_ps(edge1, zero), _mm_and_ps(_mm_cmpeq_ps(edge1, zero), edgeTopLeft[1]));
+				__m128 inside2 = _mm_or_ps(_mm_cmpgt_ps(edge2, zero), _mm_and_ps(_mm_cmpeq_ps(edge2, zero), edgeTopLeft[2]));
+
+				__m128 mask = _mm_and_ps(inside0, _mm_and_ps(inside1, inside2));
+				if (_mm_movemask_ps(mask) == 0)
+				{
+					continue;
+				}
+
+				__m128 depth = _mm_add_ps(_mm_mul_ps(depthX, pixelX), rowDepth);
+				__m128 prevDepth = _mm_loadu_ps(row + x);
+				__m128 nearDepth = _mm_min_ps(prevDepth, depth);
+
+				_mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(mask, nearDepth), _mm_andnot_ps(mask, prevDepth)));
+			}
+		}
+	}
+}
+
+void OcclusionCuller::BuildDepthPyramid()
+{
+	for (std::size_t levelIndex = 1; levelIndex < depthPyramid_.size(); ++levelIndex)
+	{
+		const DepthLevel& src = depthPyramid_[levelIndex - 1];
+		DepthLevel& dst = depthPyramid_[levelIndex];
+
+		TaskManager::Get().ParallelFor(static_cast<uint32_t>(dst.height), [&](uint32_t begin, uint32_t end)
+			{
+				for (int32_t y = static_cast<int32_t>(begin); y < static_cast<int32_t>(end); ++y)
+				{
+					int32_t srcY0 = y * 2;
+					int32_t srcY1 = (srcY0 + 1 < src.height) ? srcY0 + 1 : srcY0;
+
+					for (int32_t x = 0; x < dst.width; ++x)
+					{
+						int32_t srcX0 = x * 2;
+						int32_t srcX1 = (srcX0 + 1 < src.width) ? srcX0 + 1 : srcX0;
+
+						float depth0 = src.depth[srcY0 * src.width + srcX0];
+						float depth1 = src.depth[srcY0 * src.width + srcX1];
+						float depth2 = src.depth[srcY1 * src.width + srcX0];
+						float depth3 = src.depth[srcY1 * src.width + srcX1];
+
+						float farDepth01 = (depth0 > depth1) ? depth0 : depth1;
+						float farDepth23 = (depth2 > depth3) ? depth2 : depth3;
+						dst.depth[y * dst.width + x] = (farDepth01 > farDepth23) ? farDepth01 : farDepth23;
+					}
+				}
+			}, 8);
+	}
+}
\ No newline at end of file
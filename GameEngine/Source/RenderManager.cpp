@@ -1,25 +1,38 @@
 #include "RenderManager.h"
 
+#include <algorithm>
 #include <array>
+#include <cstring>
 
 #include <glad/glad_wgl.h>
 #include <glad/glad.h>
 
 #include "Assertion.h"
 #include "CommandLineUtils.h"
+#include "EmbeddedShaderUtils.h"
+#include "FrameCaptureManager.h"
 #include "GLAssertion.h"
+#include "GPUProfileManager.h"
+#include "GeometryPool.h"
 #include "GeometryShader2D.h"
 #include "GeometryShader3D.h"
 #include "GlyphShader2D.h"
 #include "MathUtils.h"
+#include "RenderQueue.h"
 #include "ResourceManager.h"
+#include "RingBuffer.h"
 #include "Shader.h"
+#include "ShaderCacheUtils.h"
+#include "ShaderPreprocessUtils.h"
 #include "Skybox.h"
+#include "StaticBatch.h"
 #include "StaticMesh.h"
 #include "ShadowMap.h"
 #include "StringUtils.h"
 #include "Texture2D.h"
+#include "TextureResidencyManager.h"
 #include "TextureShader2D.h"
+#include "TextureStreamManager.h"
 #include "Window.h"
 #include "WindowsAssertion.h"
 
@@ -31,6 +44,33 @@
 #define FIX_OPENGL_MAJOR_VERSION 4 // OpenGL (4) Դϴ.
 #define FIX_OPENGL_MINOR_VERSION 6 // OpenGL (6) Դϴ.
 
+/**
+ * @brief   ̺귯 Ե ̴   Դϴ.
+ */
+#define EMBEDDED_SHADER_PATH L"Embedded:/"
+
+/**
+ * @brief  Ϳ н ͸      ũԴϴ.
+ */
+static const uint32_t MAX_UNIFORM_RING_BUFFER_SIZE = 256 * 1024;
+
+/**
+ * @brief  ӿ ߰  ִ ִ ׸  Դϴ.
+ */
+static const uint32_t MAX_DRAW_DATA_COUNT = 16384;
+
+/**
+ * @brief  ӿ ߰  ִ ִ  ׸  Դϴ.
+ */
+static const uint32_t MAX_DRAW_COMMAND_COUNT = 16384;
+
+/**
+ * @brief ̹ ̴ Ͽ    ϴ Լ ŸԴϴ.
+ *
+ * @note glad ε ʴ GL_KHR_parallel_shader_compile(GL_ARB_parallel_shader_compile) Ȯ ԼԴϴ.
+ */
+typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSPROC)(GLuint count);
+
 void RenderManager::Startup()
 {
 	ASSERT(!bIsStartup_, "already startup render manager...");
@@ -80,10 +120,37 @@ void RenderManager::Startup()
 	SetStencilMode(bIsEnableStencil_);
 	SetAlphaBlendMode(bIsEnableAlphaBlend_);
 
-	std::wstring rootPath;
-	ASSERT(CommandLineUtils::GetStringValue(L"rootPath", rootPath), "can't find root path...");
+	ShaderCacheUtils::Initialize();
+
+	PFNGLMAXSHADERCOMPILERTHREADSPROC glMaxShaderCompilerThreads = nullptr;
+	if (IsSupportExtension("GL_KHR_parallel_shader_compile"))
+	{
+		glMaxShaderCompilerThreads = reinterpret_cast<PFNGLMAXSHADERCOMPILERTHREADSPROC>(wglGetProcAddress("glMaxShaderCompilerThreadsKHR"));
+	}
+	else if (IsSupportExtension("GL_ARB_parallel_shader_compile"))
+	{
+		glMaxShaderCompilerThreads = reinterpret_cast<PFNGLMAXSHADERCOMPILERTHREADSPROC>(wglGetProcAddress("glMaxShaderCompilerThreadsARB"));
+	}
+
+	if (glMaxShaderCompilerThreads != nullptr)
+	{
+		glMaxShaderCompilerThreads(0xFFFFFFFF); // ̹    մϴ.
+		Shader::SetParallelCompileMode(true);
+	}
+
+	if (!CommandLineUtils::GetStringValue(L"shaderPath", shaderPath_)) //  ߿ ̴ θ Ͽ ũ ̴   ֽϴ.
+	{
+		shaderPath_ = EMBEDDED_SHADER_PATH;
+
+		const EmbeddedShaderUtils::File* files = EmbeddedShaderUtils::GetFiles();
+		for (uint32_t index = 0; index < EmbeddedShaderUtils::GetFileCount(); ++index)
+		{
+			ShaderPreprocessUtils::AddMemoryFile(shaderPath_ + StringUtils::Convert(files[index].name), files[index].code, files[index].size);
+		}
+	}
+
+	ShaderPreprocessUtils::AddIncludePath(shaderPath_);
 
-	shaderPath_ = rootPath + L"GameEngine/Shader/";
 	shaderCache_ = std::unordered_map<std::wstring, Shader*>();
 
 	shaderCache_.insert({ L"Geometry2D", ResourceManager::Get().CreateResource<GeometryShader2D>("Geometry2D") });
@@ -101,12 +168,34 @@ void RenderManager::Startup()
 		);
 	}
 
+	Shader* varianceShadowMap = ResourceManager::Get().CreateResource<Shader>("VarianceShadowMap");
+	varianceShadowMap->Initialize(
+		StringUtils::PrintF(L"%sShadowMap.vert", shaderPath_.c_str()),
+		StringUtils::PrintF(L"%sShadowMap.frag", shaderPath_.c_str()),
+		{ "VARIANCE_SHADOW_MAP" }
+	);
+	shaderCache_.insert({ L"VarianceShadowMap", varianceShadowMap });
+
+	bIsReportShaderStartup_ = false;
+
 	float farZ = 1.0f;
 	float nearZ = -1.0f;
 	int32_t screenWidth;
 	int32_t screenHeight;
 	renderTargetWindow_->GetSize(screenWidth, screenHeight);
 	screenOrtho_ = MathUtils::CreateOrtho(0.0f, static_cast<float>(screenWidth), static_cast<float>(screenHeight), 0.0f, nearZ, farZ);
+
+	int32_t uniformBufferOffsetAlignment = 0;
+	GL_ASSERT(glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformBufferOffsetAlignment), "failed to get uniform buffer offset alignment...");
+
+	uniformRingBuffer_ = ResourceManager::Get().CreateResource<RingBuffer>("UniformRingBuffer");
+	uniformRingBuffer_->Initialize(MAX_UNIFORM_RING_BUFFER_SIZE, static_cast<uint32_t>(uniformBufferOffsetAlignment));
+
+	drawRingBuffer_ = ResourceManager::Get().CreateResource<RingBuffer>("DrawRingBuffer");
+	drawRingBuffer_->Initialize(MAX_DRAW_DATA_COUNT * sizeof(ShaderDataUtils::DrawData), sizeof(ShaderDataUtils::DrawData));
+
+	drawCommandRingBuffer_ = ResourceManager::Get().CreateResource<RingBuffer>("DrawCommandRingBuffer");
+	drawCommandRingBuffer_->Initialize(MAX_DRAW_COMMAND_COUNT * sizeof(GeometryPool::DrawElementsIndirectCommand), sizeof(uint32_t));
 	
 	bIsStartup_ = true;
 }
@@ -125,18 +214,97 @@ void RenderManager::Shutdown()
 
 void RenderManager::BeginFrame(float red, float green, float blue, float alpha, float depth, uint8_t stencil)
 {
+	GPUProfileManager::Get().BeginFrame();
+	GPUProfileManager::Get().BeginScope("Frame");
+
 	glClearColor(red, green, blue, alpha);
 	glClearDepth(depth);
 	glClearStencil(stencil);
 
 	GL_ASSERT(glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT), "failed to clear back buffer...");
+
+	if (!bIsReportShaderStartup_)
+	{
+		ReportShaderStartup();
+	}
+
+	TextureStreamManager::Get().Tick();
+	TextureResidencyManager::Get().Tick();
+
+	uniformRingBuffer_->BeginFrame();
+	drawRingBuffer_->BeginFrame();
+	drawCommandRingBuffer_->BeginFrame();
+
+	bHasPassData_ = false;
+
+	GL_ASSERT(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, ShaderDataUtils::DRAW_BUFFER_BINDING, drawRingBuffer_->GetBufferObject()), "failed to bind draw data buffer...");
 }
 
 void RenderManager::EndFrame()
 {
+	uniformRingBuffer_->EndFrame();
+	drawRingBuffer_->EndFrame();
+	drawCommandRingBuffer_->EndFrame();
+
+	GPUProfileManager::Get().BeginScope("FrameCapture");
+	FrameCaptureManager::Get().Tick();
+	GPUProfileManager::Get().EndScope();
+
+	GPUProfileManager::Get().EndScope();
+	GPUProfileManager::Get().EndFrame();
+
 	WINDOWS_ASSERT(SwapBuffers(deviceContext_), "failed to swap back and front buffer...");
 }
 
+void RenderManager::SetFrameData(const ShaderDataUtils::FrameData& frameData)
+{
+	uint32_t offset = uniformRingBuffer_->Write(&frameData, sizeof(ShaderDataUtils::FrameData));
+	GL_ASSERT(glBindBufferRange(GL_UNIFORM_BUFFER, ShaderDataUtils::FRAME_BUFFER_BINDING, uniformRingBuffer_->GetBufferObject(), offset, sizeof(ShaderDataUtils::FrameData)), "failed to bind frame data buffer...");
+}
+
+void RenderManager::SetDirectionalLight(const DirectionalLight& light)
+{
+	ShaderDataUtils::DirectionalLightData directionalLightData = ShaderDataUtils::Pack(light);
+
+	uint32_t offset = uniformRingBuffer_->Write(&directionalLightData, sizeof(ShaderDataUtils::DirectionalLightData));
+	GL_ASSERT(glBindBufferRange(GL_UNIFORM_BUFFER, ShaderDataUtils::DIRECTIONAL_LIGHT_BUFFER_BINDING, uniformRingBuffer_->GetBufferObject(), offset, sizeof(ShaderDataUtils::DirectionalLightData)), "failed to bind directional light data buffer...");
+}
+
+void RenderManager::SetPassData(const Matrix4x4f& view, const Matrix4x4f& projection)
+{
+	passDataOffset_ = WritePassData(view, projection);
+	bHasPassData_ = true;
+
+	BindPassData(passDataOffset_);
+}
+
+uint32_t RenderManager::PushDrawData(const Matrix4x4f& world)
+{
+	ShaderDataUtils::DrawData drawData = ShaderDataUtils::Pack(world);
+
+	uint32_t offset = drawRingBuffer_->Write(&drawData, sizeof(ShaderDataUtils::DrawData));
+	return offset / sizeof(ShaderDataUtils::DrawData);
+}
+
+uint32_t RenderManager::WritePassData(const Matrix4x4f& view, const Matrix4x4f& projection)
+{
+	ShaderDataUtils::PassData passData = ShaderDataUtils::Pack(view, projection);
+	return uniformRingBuffer_->Write(&passData, sizeof(ShaderDataUtils::PassData));
+}
+
+void RenderManager::BindPassData(uint32_t offset)
+{
+	GL_ASSERT(glBindBufferRange(GL_UNIFORM_BUFFER, ShaderDataUtils::PASS_BUFFER_BINDING, uniformRingBuffer_->GetBufferObject(), offset, sizeof(ShaderDataUtils::PassData)), "failed to bind pass data buffer...");
+}
+
+void RenderManager::RestorePassData()
+{
+	if (bHasPassData_)
+	{
+		BindPassData(passDataOffset_);
+	}
+}
+
 void RenderManager::SetViewport(int32_t x, int32_t y, int32_t width, int32_t height)
 {
 	glViewport(x, y, width, height);
@@ -208,8 +376,27 @@ void RenderManager::Resize()
 	screenOrtho_ = MathUtils::CreateOrtho(0.0f, static_cast<float>(screenWidth), static_cast<float>(screenHeight), 0.0f, nearZ, farZ);
 }
 
+bool RenderManager::IsSupportExtension(const char* extension) const
+{
+	int32_t extensionCount = 0;
+	GL_ASSERT(glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount), "failed to get extension count...");
+
+	for (int32_t index = 0; index < extensionCount; ++index)
+	{
+		const char* name = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, index));
+		if (std::strcmp(name, extension) == 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void RenderManager::RenderPoints2D(const std::vector<Vector2f>& positions, const Vector4f& color, float pointSize)
 {
+	GPUProfileManager::Get().MarkScope("Geometry2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
@@ -221,6 +408,8 @@ void RenderManager::RenderPoints2D(const std::vector<Vector2f>& positions, const
 
 void RenderManager::RenderConnectPoints2D(const std::vector<Vector2f>& positions, const Vector4f& color)
 {
+	GPUProfileManager::Get().MarkScope("Geometry2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
@@ -232,6 +421,8 @@ void RenderManager::RenderConnectPoints2D(const std::vector<Vector2f>& positions
 
 void RenderManager::RenderLine2D(const Vector2f& fromPosition, const Vector2f& toPosition, const Vector4f& color)
 {
+	GPUProfileManager::Get().MarkScope("Geometry2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
@@ -243,6 +434,8 @@ void RenderManager::RenderLine2D(const Vector2f& fromPosition, const Vector2f& t
 
 void RenderManager::RenderLine2D(const Vector2f& fromPosition, const Vector4f& fromColor, const Vector2f& toPosition, const Vector4f& toColor)
 {
+	GPUProfileManager::Get().MarkScope("Geometry2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
@@ -254,6 +447,8 @@ void RenderManager::RenderLine2D(const Vector2f& fromPosition, const Vector4f& f
 
 void RenderManager::RenderTriangle2D(const Vector2f& fromPosition, const Vector2f& byPosition, const Vector2f& toPosition, const Vector4f& color)
 {
+	GPUProfileManager::Get().MarkScope("Geometry2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
@@ -265,6 +460,8 @@ void RenderManager::RenderTriangle2D(const Vector2f& fromPosition, const Vector2
 
 void RenderManager::RenderTriangle2D(const Vector2f& fromPosition, const Vector4f& fromColor, const Vector2f& byPosition, const Vector4f& byColor, const Vector2f& toPosition, const Vector4f& toColor)
 {
+	GPUProfileManager::Get().MarkScope("Geometry2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
@@ -280,6 +477,8 @@ void RenderManager::RenderTriangle2D(const Vector2f& fromPosition, const Vector4
 
 void RenderManager::RenderWireframeTriangle2D(const Vector2f& fromPosition, const Vector2f& byPosition, const Vector2f& toPosition, const Vector4f& color)
 {
+	GPUProfileManager::Get().MarkScope("Geometry2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
@@ -291,6 +490,8 @@ void RenderManager::RenderWireframeTriangle2D(const Vector2f& fromPosition, cons
 
 void RenderManager::RenderWireframeTriangle2D(const Vector2f& fromPosition, const Vector4f& fromColor, const Vector2f& byPosition, const Vector4f& byColor, const Vector2f& toPosition, const Vector4f& toColor)
 {
+	GPUProfileManager::Get().MarkScope("Geometry2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
@@ -302,6 +503,8 @@ void RenderManager::RenderWireframeTriangle2D(const Vector2f& fromPosition, cons
 
 void RenderManager::RenderRectangle2D(const Vector2f& center, float width, float height, float rotate, const Vector4f& color)
 {
+	GPUProfileManager::Get().MarkScope("Geometry2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
@@ -313,6 +516,8 @@ void RenderManager::RenderRectangle2D(const Vector2f& center, float width, float
 
 void RenderManager::RenderWireframeRectangle2D(const Vector2f& center, float width, float height, float rotate, const Vector4f& color)
 {
+	GPUProfileManager::Get().MarkScope("Geometry2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
@@ -324,6 +529,8 @@ void RenderManager::RenderWireframeRectangle2D(const Vector2f& center, float wid
 
 void RenderManager::RenderCircle2D(const Vector2f& center, float radius, const Vector4f& color, int32_t sliceCount)
 {
+	GPUProfileManager::Get().MarkScope("Geometry2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
@@ -335,6 +542,8 @@ void RenderManager::RenderCircle2D(const Vector2f& center, float radius, const V
 
 void RenderManager::RenderWireframeCircle2D(const Vector2f& center, float radius, const Vector4f& color, int32_t sliceCount)
 {
+	GPUProfileManager::Get().MarkScope("Geometry2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
@@ -346,6 +555,8 @@ void RenderManager::RenderWireframeCircle2D(const Vector2f& center, float radius
 
 void RenderManager::RenderEllipse2D(const Vector2f& center, float xAxis, float yAxis, const Vector4f& color, int32_t sliceCount)
 {
+	GPUProfileManager::Get().MarkScope("Geometry2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
@@ -357,6 +568,8 @@ void RenderManager::RenderEllipse2D(const Vector2f& center, float xAxis, float y
 
 void RenderManager::RenderWireframeEllipse2D(const Vector2f& center, float xAxis, float yAxis, const Vector4f& color, int32_t sliceCount)
 {
+	GPUProfileManager::Get().MarkScope("Geometry2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
@@ -368,83 +581,122 @@ void RenderManager::RenderWireframeEllipse2D(const Vector2f& center, float xAxis
 
 void RenderManager::RenderTexture2D(const Texture2D* texture, const Vector2f& center, float width, float height, float rotate, float transparent)
 {
+	GPUProfileManager::Get().MarkScope("Texture2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
 	}
 
+	TextureResidencyManager::Get().SetRequestedSize(texture, std::max(width, height));
+
 	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(L"Texture2D"));
 	shader->DrawTexture2D(screenOrtho_, texture, center, width, height, rotate, transparent);
 }
 
 void RenderManager::RenderTexture2D(const Texture2D* texture, float transparent)
 {
+	GPUProfileManager::Get().MarkScope("Texture2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
 	}
 
+	int32_t screenWidth = 0;
+	int32_t screenHeight = 0;
+	renderTargetWindow_->GetSize(screenWidth, screenHeight);
+	TextureResidencyManager::Get().SetRequestedSize(texture, static_cast<float>(std::max(screenWidth, screenHeight)));
+
 	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(L"Texture2D"));
 	shader->DrawTexture2D(texture, transparent);
 }
 
 void RenderManager::RenderHorizonScrollTexture2D(const Texture2D* texture, float rate, float transparent)
 {
+	GPUProfileManager::Get().MarkScope("Texture2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
 	}
 
+	int32_t screenWidth = 0;
+	int32_t screenHeight = 0;
+	renderTargetWindow_->GetSize(screenWidth, screenHeight);
+	TextureResidencyManager::Get().SetRequestedSize(texture, static_cast<float>(std::max(screenWidth, screenHeight)));
+
 	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(L"Texture2D"));
 	shader->DrawHorizonScrollTexture2D(texture, rate, transparent);
 }
 
 void RenderManager::RenderHorizonScrollTexture2D(const Texture2D* texture, const Vector2f& center, float width, float height, float rotate, float rate, float transparent)
 {
+	GPUProfileManager::Get().MarkScope("Texture2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
 	}
 
+	TextureResidencyManager::Get().SetRequestedSize(texture, std::max(width, height));
+
 	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(L"Texture2D"));
 	shader->DrawHorizonScrollTexture2D(screenOrtho_, texture, center, width, height, rotate, rate, transparent);
 }
 
 void RenderManager::RenderVerticalScrollTexture2D(const Texture2D* texture, float rate, float transparent)
 {
+	GPUProfileManager::Get().MarkScope("Texture2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
 	}
 
+	int32_t screenWidth = 0;
+	int32_t screenHeight = 0;
+	renderTargetWindow_->GetSize(screenWidth, screenHeight);
+	TextureResidencyManager::Get().SetRequestedSize(texture, static_cast<float>(std::max(screenWidth, screenHeight)));
+
 	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(L"Texture2D"));
 	shader->DrawVerticalScrollTexture2D(texture, rate, transparent);
 }
 
 void RenderManager::RenderVerticalScrollTexture2D(const Texture2D* texture, const Vector2f& center, float width, float height, float rotate, float rate, float transparent)
 {
+	GPUProfileManager::Get().MarkScope("Texture2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
 	}
 
+	TextureResidencyManager::Get().SetRequestedSize(texture, std::max(width, height));
+
 	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(L"Texture2D"));
 	shader->DrawVerticalScrollTexture2D(screenOrtho_, texture, center, width, height, rotate, rate, transparent);
 }
 
 void RenderManager::RenderOutlineTexture2D(const Texture2D* texture, const Vector2f& center, float width, float height, float rotate, const Vector4f& outline, float transparent)
 {
+	GPUProfileManager::Get().MarkScope("Texture2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
 	}
 
+	TextureResidencyManager::Get().SetRequestedSize(texture, std::max(width, height));
+
 	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(L"Texture2D"));
 	shader->DrawOutlineTexture2D(screenOrtho_, texture, center, width, height, rotate, outline, transparent);
 }
 
 void RenderManager::RenderGrid2D(float minX, float maxX, float strideX, float minY, float maxY, float strideY, const Vector4f& color)
 {
+	GPUProfileManager::Get().MarkScope("Geometry2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
@@ -456,6 +708,8 @@ void RenderManager::RenderGrid2D(float minX, float maxX, float strideX, float mi
 
 void RenderManager::RenderText2D(const TTFont* font, const std::wstring& text, const Vector2f& center, const Vector4f& color)
 {
+	GPUProfileManager::Get().MarkScope("Text2D");
+
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
@@ -467,96 +721,327 @@ void RenderManager::RenderText2D(const TTFont* font, const std::wstring& text, c
 
 void RenderManager::RenderPoints3D(const Matrix4x4f& view, const Matrix4x4f& projection, const std::vector<Vector3f>& positions, const Vector4f& color)
 {
+	GPUProfileManager::Get().MarkScope("Geometry3D");
+
 	if (!bIsEnableDepth_)
 	{
 		SetDepthMode(true);
 	}
 
 	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(L"Geometry3D"));
-	shader->DrawPoints3D(view, projection, positions, color);
+
+	BindPassData(WritePassData(view, projection));
+
+	shader->DrawPoints3D(PushDrawData(Matrix4x4f::GetIdentity()), positions, color);
+
+	RestorePassData();
 }
 
 void RenderManager::RenderConnectPoints3D(const Matrix4x4f& view, const Matrix4x4f& projection, const std::vector<Vector3f>& positions, const Vector4f& color)
 {
+	GPUProfileManager::Get().MarkScope("Geometry3D");
+
 	if (!bIsEnableDepth_)
 	{
 		SetDepthMode(true);
 	}
 
 	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(L"Geometry3D"));
-	shader->DrawConnectPoints3D(view, projection, positions, color);
+
+	BindPassData(WritePassData(view, projection));
+
+	shader->DrawConnectPoints3D(PushDrawData(Matrix4x4f::GetIdentity()), positions, color);
+
+	RestorePassData();
 }
 
 void RenderManager::RenderLine3D(const Matrix4x4f& view, const Matrix4x4f& projection, const Vector3f& fromPosition, const Vector3f& toPosition, const Vector4f& color)
 {
+	GPUProfileManager::Get().MarkScope("Geometry3D");
+
 	if (!bIsEnableDepth_)
 	{
 		SetDepthMode(true);
 	}
 
 	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(L"Geometry3D"));
-	shader->DrawLine3D(view, projection, fromPosition, toPosition, color);
+
+	BindPassData(WritePassData(view, projection));
+
+	shader->DrawLine3D(PushDrawData(Matrix4x4f::GetIdentity()), fromPosition, toPosition, color);
+
+	RestorePassData();
 }
 
 void RenderManager::RenderLine3D(const Matrix4x4f& view, const Matrix4x4f& projection, const Vector3f& fromPosition, const Vector4f& fromColor, const Vector3f& toPosition, const Vector4f& toColor)
 {
+	GPUProfileManager::Get().MarkScope("Geometry3D");
+
 	if (!bIsEnableDepth_)
 	{
 		SetDepthMode(true);
 	}
 
 	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(L"Geometry3D"));
-	shader->DrawLine3D(view, projection, fromPosition, fromColor, toPosition, toColor);
+
+	BindPassData(WritePassData(view, projection));
+
+	shader->DrawLine3D(PushDrawData(Matrix4x4f::GetIdentity()), fromPosition, fromColor, toPosition, toColor);
+
+	RestorePassData();
 }
 
 void RenderManager::RenderAxisAlignedBoundingBox3D(const Matrix4x4f& view, const Matrix4x4f& projection, const Vector3f& minPosition, const Vector3f& maxPosition, const Vector4f& color)
 {
+	GPUProfileManager::Get().MarkScope("Geometry3D");
+
 	if (!bIsEnableDepth_)
 	{
 		SetDepthMode(true);
 	}
 
 	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(L"Geometry3D"));
-	shader->DrawAxisAlignedBoundingBox3D(view, projection, minPosition, maxPosition, color);
+
+	BindPassData(WritePassData(view, projection));
+
+	shader->DrawAxisAlignedBoundingBox3D(PushDrawData(Matrix4x4f::GetIdentity()), minPosition, maxPosition, color);
+
+	RestorePassData();
 }
 
 void RenderManager::RenderGrid3D(const Matrix4x4f& view, const Matrix4x4f& projection, float minX, float maxX, float strideX, float minZ, float maxZ, float strideZ, const Vector4f& color)
 {
+	GPUProfileManager::Get().MarkScope("Geometry3D");
+
 	if (!bIsEnableDepth_)
 	{
 		SetDepthMode(true);
 	}
 
 	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(L"Geometry3D"));
-	shader->DrawGrid3D(view, projection, minX, maxX, strideX, minZ, maxZ, strideZ, color);
+
+	BindPassData(WritePassData(view, projection));
+
+	shader->DrawGrid3D(PushDrawData(Matrix4x4f::GetIdentity()), minX, maxX, strideX, minZ, maxZ, strideZ, color);
+
+	RestorePassData();
 }
 
 void RenderManager::RenderStaticMesh3D(const StaticMesh* mesh)
 {
+	GPUProfileManager::Get().MarkScope("StaticMesh3D");
+
 	if (!bIsEnableDepth_)
 	{
 		SetDepthMode(true);
 	}
 
+	uint32_t drawIndex = PushDrawData(Matrix4x4f::GetIdentity());
+
 	GL_ASSERT(glBindVertexArray(mesh->GetVertexArrayObject()), "failed to bind static mesh vertex array...");
-	GL_ASSERT(glDrawElements(GL_TRIANGLES, mesh->GetIndexCount(), GL_UNSIGNED_INT, 0), "failed to draw static mesh...");
+	GL_ASSERT(glDrawElementsInstancedBaseInstance(GL_TRIANGLES, mesh->GetIndexCount(), GL_UNSIGNED_INT, 0, 1, drawIndex), "failed to draw static mesh...");
 	GL_ASSERT(glBindVertexArray(0), "failed to unbind static mesh vertex array...");
 }
 
+void RenderManager::RenderStaticMesh3D(const StaticMesh* mesh, const Matrix4x4f& world)
+{
+	GPUProfileManager::Get().MarkScope("StaticMesh3D");
+
+	if (!bIsEnableDepth_)
+	{
+		SetDepthMode(true);
+	}
+
+	uint32_t drawIndex = PushDrawData(world);
+
+	GL_ASSERT(glBindVertexArray(mesh->GetVertexArrayObject()), "failed to bind static mesh vertex array...");
+	GL_ASSERT(glDrawElementsInstancedBaseInstance(GL_TRIANGLES, mesh->GetIndexCount(), GL_UNSIGNED_INT, 0, 1, drawIndex), "failed to draw static mesh...");
+	GL_ASSERT(glBindVertexArray(0), "failed to unbind static mesh vertex array...");
+}
+
+void RenderManager::RenderGeometryPool3D(GeometryPool* geometryPool)
+{
+	uint32_t drawCommandCount = geometryPool->GetDrawCommandCount();
+	if (drawCommandCount == 0)
+	{
+		return;
+	}
+
+	GPUProfileManager::Get().MarkScope("GeometryPool3D");
+
+	if (!bIsEnableDepth_)
+	{
+		SetDepthMode(true);
+	}
+
+	const std::vector<ShaderDataUtils::DrawData>& drawDatas = geometryPool->GetDrawDatas();
+	uint32_t drawDataOffset = drawRingBuffer_->Write(drawDatas.data(), static_cast<uint32_t>(drawDatas.size() * sizeof(ShaderDataUtils::DrawData)));
+	geometryPool->FlushDrawCommands(drawDataOffset / sizeof(ShaderDataUtils::DrawData));
+
+	GL_ASSERT(glBindVertexArray(geometryPool->GetVertexArrayObject()), "failed to bind geometry pool vertex array...");
+	GL_ASSERT(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, geometryPool->GetDrawIndirectBufferObject()), "failed to bind geometry pool draw indirect buffer...");
+
+	GL_ASSERT(glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, drawCommandCount, 0), "failed to draw geometry pool...");
+
+	GL_ASSERT(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0), "failed to unbind geometry pool draw indirect buffer...");
+	GL_ASSERT(glBindVertexArray(0), "failed to unbind geometry pool vertex array...");
+}
+
+void RenderManager::RenderStaticBatch3D(const StaticBatch* staticBatch)
+{
+	GPUProfileManager::Get().MarkScope("StaticBatch3D");
+
+	if (!bIsEnableDepth_)
+	{
+		SetDepthMode(true);
+	}
+
+	uint32_t drawIndex = PushDrawData(Matrix4x4f::GetIdentity());
+
+	GL_ASSERT(glBindVertexArray(staticBatch->GetVertexArrayObject()), "failed to bind static batch vertex array...");
+	GL_ASSERT(glDrawElementsInstancedBaseInstance(GL_TRIANGLES, staticBatch->GetIndexCount(), GL_UNSIGNED_INT, 0, 1, drawIndex), "failed to draw static batch...");
+	GL_ASSERT(glBindVertexArray(0), "failed to unbind static batch vertex array...");
+}
+
+void RenderManager::RenderStaticBatch3D(const StaticBatch* staticBatch, const std::vector<uint32_t>& subMeshIndices)
+{
+	if (subMeshIndices.empty())
+	{
+		return;
+	}
+
+	GPUProfileManager::Get().MarkScope("StaticBatch3D");
+
+	if (!bIsEnableDepth_)
+	{
+		SetDepthMode(true);
+	}
+
+	const std::vector<StaticBatch::SubMesh>& subMeshes = staticBatch->GetSubMeshes();
+	uint32_t drawIndex = PushDrawData(Matrix4x4f::GetIdentity());
+
+	std::vector<GeometryPool::DrawElementsIndirectCommand> commands;
+	commands.reserve(subMeshIndices.size());
+
+	for (const auto& subMeshIndex : subMeshIndices)
+	{
+		const StaticBatch::SubMesh& subMesh = subMeshes[subMeshIndex];
+
+		GeometryPool::DrawElementsIndirectCommand command;
+		command.count = subMesh.indexCount;
+		command.instanceCount = 1;
+		command.firstIndex = subMesh.firstIndex;
+		command.baseVertex = 0;
+		command.baseInstance = drawIndex;
+
+		commands.push_back(command);
+	}
+
+	uint32_t commandOffset = drawCommandRingBuffer_->Write(commands.data(), static_cast<uint32_t>(commands.size() * sizeof(GeometryPool::DrawElementsIndirectCommand)));
+
+	GL_ASSERT(glBindVertexArray(staticBatch->GetVertexArrayObject()), "failed to bind static batch vertex array...");
+	GL_ASSERT(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, drawCommandRingBuffer_->GetBufferObject()), "failed to bind draw command buffer...");
+
+	GL_ASSERT(glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, reinterpret_cast<const void*>(static_cast<std::size_t>(commandOffset)), static_cast<GLsizei>(commands.size()), 0), "failed to draw static batch...");
+
+	GL_ASSERT(glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0), "failed to unbind draw command buffer...");
+	GL_ASSERT(glBindVertexArray(0), "failed to unbind static batch vertex array...");
+}
+
+void RenderManager::RenderQueue3D(const RenderQueue* renderQueue, const std::function<void(Shader*, const Material*)>& bindMaterial)
+{
+	const std::vector<RenderQueue::DrawItem>& drawItems = renderQueue->GetDrawItems();
+	if (drawItems.empty())
+	{
+		return;
+	}
+
+	GPUProfileManager::Get().MarkScope("RenderQueue3D");
+
+	if (!bIsEnableDepth_)
+	{
+		SetDepthMode(true);
+	}
+
+	bool bIsEnableAlphaBlend = bIsEnableAlphaBlend_;
+	bool bIsTranslucentPass = false;
+
+	Shader* shader = nullptr;
+	const Material* material = nullptr;
+	const StaticMesh* mesh = nullptr;
+
+	for (const auto& drawItem : drawItems)
+	{
+		if (!bIsTranslucentPass && drawItem.pass == ERenderPass::Translucent)
+		{
+			bIsTranslucentPass = true;
+
+			SetAlphaBlendMode(true);
+			GL_ASSERT(glDepthMask(GL_FALSE), "failed to disable depth write...");
+		}
+
+		/** ũ   ̴ ׸ ׸ ǳʶݴϴ. ̴ غǸ  Ӻ ׷ϴ. */
+		if (!drawItem.shader->IsReady())
+		{
+			continue;
+		}
+
+		bool bIsChangeShader = (shader != drawItem.shader);
+		if (bIsChangeShader)
+		{
+			shader = drawItem.shader;
+			shader->Bind();
+		}
+
+		if ((bIsChangeShader || material != drawItem.material) && bindMaterial)
+		{
+			bindMaterial(shader, drawItem.material);
+		}
+		material = drawItem.material;
+
+		if (mesh != drawItem.mesh)
+		{
+			mesh = drawItem.mesh;
+			GL_ASSERT(glBindVertexArray(mesh->GetVertexArrayObject()), "failed to bind static mesh vertex array...");
+		}
+
+		uint32_t drawIndex = PushDrawData(drawItem.world);
+		GL_ASSERT(glDrawElementsInstancedBaseInstance(GL_TRIANGLES, mesh->GetIndexCount(), GL_UNSIGNED_INT, 0, 1, drawIndex), "failed to draw static mesh...");
+	}
+
+	GL_ASSERT(glBindVertexArray(0), "failed to unbind static mesh vertex array...");
+	if (shader)
+	{
+		shader->Unbind();
+	}
+
+	if (bIsTranslucentPass)
+	{
+		GL_ASSERT(glDepthMask(GL_TRUE), "failed to enable depth write...");
+		SetAlphaBlendMode(bIsEnableAlphaBlend);
+	}
+}
+
 void RenderManager::RenderSkybox3D(const Matrix4x4f& view, const Matrix4x4f& projection, const Skybox* skybox)
 {
+	GPUProfileManager::Get().MarkScope("Skybox3D");
+
 	if (!bIsEnableDepth_)
 	{
 		SetDepthMode(true);
 	}
 
 	Shader* shader = reinterpret_cast<Shader*>(shaderCache_.at(L"Skybox"));
+	if (!shader->IsReady())
+	{
+		return;
+	}
+
+	BindPassData(WritePassData(view, projection));
+
 	shader->Bind();
 	GL_ASSERT(glDepthFunc(GL_LEQUAL), "failed to set depth test GL_LEQUAL function...");
 
-	shader->SetUniform("view", view);
-	shader->SetUniform("projection", projection);
-
 	skybox->Active(0);
 
 	GL_ASSERT(glBindVertexArray(skybox->GetVertexArrayObject()), "failed to bind skybox vertex array...");
@@ -565,4 +1050,27 @@ void RenderManager::RenderSkybox3D(const Matrix4x4f& view, const Matrix4x4f& pro
 
 	GL_ASSERT(glDepthFunc(GL_LESS), "failed to set depth test GL_LESS function...");
 	shader->Unbind();
+
+	RestorePassData();
+}
+
+void RenderManager::ReportShaderStartup()
+{
+	for (auto& shader : shaderCache_)
+	{
+		if (!shader.second->IsReady())
+		{
+			return;
+		}
+	}
+
+	const ShaderCacheUtils::Statistics& shaderCacheStatistics = ShaderCacheUtils::GetStatistics();
+	OutputDebugStringW(StringUtils::PrintF(
+		L"engine shader startup : %.3f ms (cache hit : %u, %.3f ms / cache miss : %u, %.3f ms)\n",
+		(shaderCacheStatistics.hitSeconds + shaderCacheStatistics.missSeconds) * 1000.0f,
+		shaderCacheStatistics.hitCount, shaderCacheStatistics.hitSeconds * 1000.0f,
+		shaderCacheStatistics.missCount, shaderCacheStatistics.missSeconds * 1000.0f
+	).c_str());
+
+	bIsReportShaderStartup_ = true;
 }
\ No newline at end of file
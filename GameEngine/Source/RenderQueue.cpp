@@ -0,0 +1,222 @@
+#include "RenderQueue.h"
+
+#include <array>
+
+#include "Assertion.h"
+#include "MathUtils.h"
+#include "StaticMesh.h"
+
+/**
+ * @brief  Ű  ʵ尡 ϴ Ʈ Դϴ.
+ */
+static const uint64_t PASS_BITS = 2;
+static const uint64_t ID_BITS = 14;
+static const uint64_t DEPTH_BITS = 20;
+
+/**
+ * @brief  Ű  ʵ ִԴϴ.
+ */
+static const uint64_t MAX_ID = (1ull << ID_BITS) - 1;
+static const uint64_t MAX_DEPTH = (1ull << DEPTH_BITS) - 1;
+
+/**
+ * @brief ̵ ʵ尡 ģ ҽ Բ ϴ  Ű ̵Դϴ.
+ *
+ * @note  Ű ٸ ʵ带 ħ ʵ ̵ ʵ ִ մϴ.
+ */
+static const uint64_t OVERFLOW_ID = MAX_ID;
+
+/**
+ * @brief н ʵ  Ʈ ġԴϴ.
+ */
+static const uint64_t PASS_SHIFT = 64 - PASS_BITS;
+
+void RenderQueue::Begin(const Matrix4x4f& view, float nearZ, float farZ)
+{
+	ASSERT(nearZ < farZ, "invalid render queue depth range : (near : %f, far : %f)", nearZ, farZ);
+
+	view_ = view;
+	nearZ_ = nearZ;
+	farZ_ = farZ;
+
+	drawItems_.clear();
+	statistics_.overflowItemCount = 0;
+}
+
+void RenderQueue::Submit(ERenderPass pass, Shader* shader, const StaticMesh* mesh, const Material* material, const Matrix4x4f& world)
+{
+	Vector3f position(world.m[3][0], world.m[3][1], world.m[3][2]);
+	if (!mesh->GetBoundingBox().IsEmpty())
+	{
+		position = MathUtils::TransformPosition(mesh->GetBoundingBox().GetCenter(), world);
+	}
+
+	Submit(pass, shader, mesh, material, world, position);
+}
+
+void RenderQueue::Submit(ERenderPass pass, Shader* shader, const StaticMesh* mesh, const Material* material, const Matrix4x4f& world, const Vector3f& position)
+{
+	float viewDepth = -MathUtils::TransformPosition(position, view_).z;
+	float depthRate = MathUtils::Clamp<float>((viewDepth - nearZ_) / (farZ_ - nearZ_), 0.0f, 1.0f);
+	uint64_t depth = static_cast<uint64_t>(depthRate * static_cast<float>(MAX_DEPTH));
+
+	uint64_t shaderID = GetSortKeyID(shaderIDs_, shader);
+	uint64_t materialID = GetSortKeyID(materialIDs_, material);
+	uint64_t meshID = GetSortKeyID(meshIDs_, mesh);
+
+	if (shaderID == OVERFLOW_ID || materialID == OVERFLOW_ID || meshID == OVERFLOW_ID)
+	{
+		statistics_.overflowItemCount++;
+	}
+
+	uint64_t key = static_cast<uint64_t>(pass) << PASS_SHIFT;
+	if (pass == ERenderPass::Translucent)
+	{
+		key |= (MAX_DEPTH - depth) << (ID_BITS * 3);
+		key |= shaderID << (ID_BITS * 2);
+		key |= materialID << ID_BITS;
+		key |= meshID;
+	}
+	else
+	{
+		key |= shaderID << (DEPTH_BITS + ID_BITS * 2);
+		key |= materialID << (DEPTH_BITS + ID_BITS);
+		key |= meshID << DEPTH_BITS;
+		key |= depth;
+	}
+
+	DrawItem drawItem;
+	drawItem.key = key;
+	drawItem.pass = pass;
+	drawItem.shader = shader;
+	drawItem.mesh = mesh;
+	drawItem.material = material;
+	drawItem.world = world;
+
+	drawItems_.push_back(drawItem);
+}
+
+void RenderQueue::Sort()
+{
+	uint32_t shaderChangeCount = 0;
+	uint32_t materialChangeCount = 0;
+	uint32_t meshChangeCount = 0;
+
+	statistics_.itemCount = static_cast<uint32_t>(drawItems_.size());
+	statistics_.unsortedStateChangeCount = CountStateChanges(drawItems_, shaderChangeCount, materialChangeCount, meshChangeCount);
+
+	struct SortEntry
+	{
+		uint64_t key;
+		uint32_t index;
+	};
+
+	std::vector<SortEntry> entries(drawItems_.size());
+	std::vector<SortEntry> swapEntries(drawItems_.size());
+	for (std::size_t index = 0; index < drawItems_.size(); ++index)
+	{
+		entries[index].key = drawItems_[index].key;
+		entries[index].index = static_cast<uint32_t>(index);
+	}
+
+	for (uint32_t shift = 0; shift < 64; shift += 8)
+	{
+		std::array<uint32_t, 256> histogram = { 0, };
+		for (const auto& entry : entries)
+		{
+			histogram[(entry.key >> shift) & 0xFF]++;
+		}
+
+		if (histogram[(entries.empty() ? 0 : (entries[0].key >> shift) & 0xFF)] == entries.size())
+		{
+			continue;
+		}
+
+		uint32_t offset = 0;
+		for (auto& count : histogram)
+		{
+			uint32_t bucketCount = count;
+			count = offset;
+			offset += bucketCount;
+		}
+
+		for (const auto& entry : entries)
+		{
+			swapEntries[histogram[(entry.key >> shift) & 0xFF]++] = entry;
+		}
+
+		entries.swap(swapEntries);
+	}
+
+	sortBuffer_.resize(drawItems_.size());
+	for (std::size_t index = 0; index < entries.size(); ++index)
+	{
+		sortBuffer_[index] = drawItems_[entries[index].index];
+	}
+	drawItems_.swap(sortBuffer_);
+
+	statistics_.sortedStateChangeCount = CountStateChanges(drawItems_, shaderChangeCount, materialChangeCount, meshChangeCount);
+	statistics_.sortedShaderChangeCount = shaderChangeCount;
+	statistics_.sortedMaterialChangeCount = materialChangeCount;
+	statistics_.sortedMeshChangeCount = meshChangeCount;
+}
+
+void RenderQueue::ResetSortKeyIDs()
+{
+	shaderIDs_.clear();
+	materialIDs_.clear();
+	meshIDs_.clear();
+}
+
+uint32_t RenderQueue::CountStateChanges(
+	const std::vector<DrawItem>& drawItems,
+	uint32_t& outShaderChangeCount,
+	uint32_t& outMaterialChangeCount,
+	uint32_t& outMeshChangeCount
+)
+{
+	outShaderChangeCount = 0;
+	outMaterialChangeCount = 0;
+	outMeshChangeCount = 0;
+
+	const DrawItem* prevDrawItem = nullptr;
+	for (const auto& drawItem : drawItems)
+	{
+		if (!prevDrawItem || prevDrawItem->shader != drawItem.shader)
+		{
+			outShaderChangeCount++;
+		}
+
+		if (!prevDrawItem || prevDrawItem->material != drawItem.material)
+		{
+			outMaterialChangeCount++;
+		}
+
+		if (!prevDrawItem || prevDrawItem->mesh != drawItem.mesh)
+		{
+			outMeshChangeCount++;
+		}
+
+		prevDrawItem = &drawItem;
+	}
+
+	return outShaderChangeCount + outMaterialChangeCount + outMeshChangeCount;
+}
+
+uint64_t RenderQueue::GetSortKeyID(std::unordered_map<const void*, uint64_t>& ids, const void* ptr)
+{
+	auto id = ids.find(ptr);
+	if (id != ids.end())
+	{
+		return id->second;
+	}
+
+	uint64_t newID = static_cast<uint64_t>(ids.size());
+	if (newID >= OVERFLOW_ID)
+	{
+		return OVERFLOW_ID;
+	}
+
+	ids.insert({ ptr, newID });
+	return newID;
+}
\ No newline at end of file
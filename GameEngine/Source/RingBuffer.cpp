@@ -0,0 +1,105 @@
+#include "RingBuffer.h"
+
+#include <cstring>
+
+#include "Assertion.h"
+#include "GLAssertion.h"
+#include "GLResourceUtils.h"
+
+#include <glad/glad.h>
+
+/**
+ * @brief 潺 ٸ  մϴ.
+ */
+static void WaitAndDeleteFence(void*& fence)
+{
+	if (!fence)
+	{
+		return;
+	}
+
+	GLsync sync = reinterpret_cast<GLsync>(fence);
+	GLenum result = GL_TIMEOUT_EXPIRED;
+	while (result == GL_TIMEOUT_EXPIRED)
+	{
+		result = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+	}
+	ASSERT(result != GL_WAIT_FAILED, "failed to wait ring buffer fence...");
+
+	GL_ASSERT(glDeleteSync(sync), "failed to delete ring buffer fence...");
+	fence = nullptr;
+}
+
+RingBuffer::~RingBuffer()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void RingBuffer::Initialize(uint32_t frameSize, uint32_t alignment)
+{
+	ASSERT(!bIsInitialized_, "already initialize ring buffer resource...");
+	ASSERT(alignment > 0 && frameSize > 0 && (frameSize % alignment) == 0, "invalid ring buffer size : (frame : %d, alignment : %d)", frameSize, alignment);
+
+	frameSize_ = frameSize;
+	alignment_ = alignment;
+	frameIndex_ = 0;
+	frameOffset_ = 0;
+
+	GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+	bufferObject_ = GLResourceUtils::CreateBuffer(GetBufferSize(), nullptr, flags);
+
+	mappedBuffer_ = reinterpret_cast<uint8_t*>(glMapNamedBufferRange(bufferObject_, 0, GetBufferSize(), flags));
+	ASSERT(mappedBuffer_ != nullptr, "failed to map ring buffer...");
+
+	bIsInitialized_ = true;
+}
+
+void RingBuffer::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+	bIsInitialized_ = false;
+
+	for (auto& fence : fences_)
+	{
+		WaitAndDeleteFence(fence);
+	}
+
+	GL_ASSERT(glUnmapNamedBuffer(bufferObject_), "failed to unmap ring buffer...");
+	GL_ASSERT(glDeleteBuffers(1, &bufferObject_), "failed to delete ring buffer...");
+
+	mappedBuffer_ = nullptr;
+}
+
+void RingBuffer::BeginFrame()
+{
+	ASSERT(bIsInitialized_, "not initialized ring buffer resource...");
+
+	frameIndex_ = (frameIndex_ + 1) % FRAME_COUNT;
+	frameOffset_ = 0;
+
+	WaitAndDeleteFence(fences_[frameIndex_]);
+}
+
+void RingBuffer::EndFrame()
+{
+	ASSERT(bIsInitialized_, "not initialized ring buffer resource...");
+	ASSERT(fences_[frameIndex_] == nullptr, "already set ring buffer fence...");
+
+	fences_[frameIndex_] = reinterpret_cast<void*>(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+}
+
+uint32_t RingBuffer::Write(const void* data, uint32_t size)
+{
+	ASSERT(frameOffset_ + size <= frameSize_, "overflow ring buffer frame size : %d", frameSize_);
+
+	uint32_t offset = frameIndex_ * frameSize_ + frameOffset_;
+	std::memcpy(mappedBuffer_ + offset, data, size);
+
+	frameOffset_ += ((size + alignment_ - 1) / alignment_) * alignment_;
+	return offset;
+}
\ No newline at end of file
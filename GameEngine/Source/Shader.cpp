@@ -1,12 +1,30 @@
 #include "Shader.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include "Assertion.h"
-#include "FileUtils.h"
 #include "GLAssertion.h"
+#include "ShaderCacheUtils.h"
+#include "ShaderPreprocessUtils.h"
 #include "StringUtils.h"
 
 #include <glad/glad.h>
 
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+bool Shader::bIsEnableParallelCompile_ = false;
+
+/**
+ * @brief  ڵ Ÿ Ϸ  Ÿ԰ ġϴ Ȯմϴ.
+ */
+static bool IsMatchUniformType(const Shader::UniformHandle& handle, uint32_t type)
+{
+	return !handle.IsValid() || handle.type == type;
+}
+
 Shader::~Shader()
 {
 	if (bIsInitialized_)
@@ -17,42 +35,45 @@ Shader::~Shader()
 
 void Shader::Initialize(const std::wstring& vsPath, const std::wstring& fsPath)
 {
-	ASSERT(!bIsInitialized_, "already initialize shader resource...");
+	Initialize(vsPath, fsPath, std::vector<std::string>());
+}
 
-	uniformLocationCache_ = std::map<std::string, uint32_t>();
-	
-	std::vector<uint8_t> vsSourceBuffer = FileUtils::ReadBufferFromFile(vsPath);
-	std::vector<uint8_t> fsSourceBuffer = FileUtils::ReadBufferFromFile(fsPath);
+void Shader::Initialize(const std::wstring& vsPath, const std::wstring& fsPath, const std::vector<std::string>& defines)
+{
+	ASSERT(!bIsInitialized_, "already initialize shader resource...");
 
-	std::string vsSource(vsSourceBuffer.begin(), vsSourceBuffer.end());
-	std::string fsSource(fsSourceBuffer.begin(), fsSourceBuffer.end());
+	std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
 
-	uint32_t vsID = CreateAndCompileShader(EType::Vertex, vsSource);
-	ASSERT(vsID != 0, L"failed to create and compile %s...", vsPath.c_str());
+	ShaderPreprocessUtils::Source vsSource = ShaderPreprocessUtils::Preprocess(vsPath, defines);
+	ShaderPreprocessUtils::Source fsSource = ShaderPreprocessUtils::Preprocess(fsPath, defines);
 
-	uint32_t fsID = CreateAndCompileShader(EType::Fragment, fsSource);
-	ASSERT(fsID != 0, L"failed to create and compile %s...", fsPath.c_str());
+	vsSource_ = vsSource.code;
+	fsSource_ = fsSource.code;
+	vsFiles_ = vsSource.files;
+	fsFiles_ = fsSource.files;
 
 	programID_ = glCreateProgram();
 	ASSERT(programID_ != 0, "failed to create shader program...");
 
-	GL_ASSERT(glAttachShader(programID_, vsID), "failed to attach vertex shader in shader program...");
-	GL_ASSERT(glAttachShader(programID_, fsID), "failed to attach fragment shader in shader program...");
-	GL_ASSERT(glLinkProgram(programID_), "failed to link shader program...");
-
-	int32_t success;
-	GL_ASSERT(glGetProgramiv(programID_, GL_LINK_STATUS, &success), "failed to get program link info...");
-	if (!success)
+	bIsCacheHit_ = ShaderCacheUtils::LoadProgramBinary(programID_, vsSource_, fsSource_);
+	if (!bIsCacheHit_)
 	{
-		char* buffer = StringUtils::GetCharBufferPtr();
+		vsID_ = CreateAndCompileShader(EType::Vertex, vsSource_);
+		ASSERT(vsID_ != 0, L"failed to create and compile %s...", vsPath.c_str());
+
+		fsID_ = CreateAndCompileShader(EType::Fragment, fsSource_);
+		ASSERT(fsID_ != 0, L"failed to create and compile %s...", fsPath.c_str());
 
-		glGetProgramInfoLog(programID_, StringUtils::STRING_BUFFER_SIZE, nullptr, buffer);
-		ASSERT(false, "failed to link shader program : %s", buffer);
+		GL_ASSERT(glAttachShader(programID_, vsID_), "failed to attach vertex shader in shader program...");
+		GL_ASSERT(glAttachShader(programID_, fsID_), "failed to attach fragment shader in shader program...");
+		GL_ASSERT(glProgramParameteri(programID_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE), "failed to set program binary retrievable hint...");
+		GL_ASSERT(glLinkProgram(programID_), "failed to link shader program...");
 	}
 
-	GL_ASSERT(glDeleteShader(vsID), "invalid delete %d shader...", vsID);
-	GL_ASSERT(glDeleteShader(fsID), "invalid delete %d shader...", fsID);
+	std::chrono::duration<float> elapsedTime = std::chrono::steady_clock::now() - startTime;
+	loadSeconds_ = elapsedTime.count();
 
+	bIsReady_ = false;
 	bIsInitialized_ = true;
 }
 
@@ -60,16 +81,67 @@ void Shader::Release()
 {
 	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
 
+	if (vsID_ != 0)
+	{
+		GL_ASSERT(glDeleteShader(vsID_), "invalid delete %d shader...", vsID_);
+		vsID_ = 0;
+	}
+
+	if (fsID_ != 0)
+	{
+		GL_ASSERT(glDeleteShader(fsID_), "invalid delete %d shader...", fsID_);
+		fsID_ = 0;
+	}
+
 	if (programID_ != 0)
 	{
 		GL_ASSERT(glDeleteProgram(programID_), "failed to delete shader program : %d", programID_);
 	}
 
+	vsSource_.clear();
+	fsSource_.clear();
+	vsFiles_.clear();
+	fsFiles_.clear();
+	uniforms_.clear();
+
+	bIsReady_ = false;
 	bIsInitialized_ = false;
 }
 
+bool Shader::IsReady()
+{
+	if (bIsReady_)
+	{
+		return true;
+	}
+
+	if (bIsEnableParallelCompile_)
+	{
+		int32_t bIsCompleted = GL_FALSE;
+		GL_ASSERT(glGetProgramiv(programID_, GL_COMPLETION_STATUS_KHR, &bIsCompleted), "failed to get program completion status...");
+
+		if (!bIsCompleted)
+		{
+			return false;
+		}
+	}
+
+	FinishLink();
+	return true;
+}
+
+void Shader::WaitForReady()
+{
+	if (!bIsReady_)
+	{
+		FinishLink();
+	}
+}
+
 void Shader::Bind()
 {
+	WaitForReady();
+
 	GL_ASSERT(glUseProgram(programID_), "failed to bind shader program...");
 }
 
@@ -80,314 +152,208 @@ void Shader::Unbind()
 
 void Shader::SetUniform(const std::string& name, bool value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	GL_ASSERT(glUniform1i(location, static_cast<int32_t>(value)), "failed to set bool type uniform value : %d", static_cast<int32_t>(value));
+	SetUniform(GetUniformHandle(name), value);
 }
 
 void Shader::SetUniform(const std::string& name, int32_t value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	GL_ASSERT(glUniform1i(location, static_cast<int32_t>(value)), "faild to set int type uniform value : %d", static_cast<int32_t>(value));
+	SetUniform(GetUniformHandle(name), value);
 }
 
 void Shader::SetUniform(const std::string& name, float value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	GL_ASSERT(glUniform1f(location, value), "failed to set float type uniform value : %f", value);
+	SetUniform(GetUniformHandle(name), value);
 }
 
 void Shader::SetUniform(const std::string& name, const Vector2f& value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	const float* valuePtr = value.GetPtr();
-	GL_ASSERT(glUniform2fv(location, 1, valuePtr), "failed to set Vector2f type uniform value : (%f, %f)", value.x, value.y);
+	SetUniform(GetUniformHandle(name), value);
 }
 
 void Shader::SetUniform(const std::string& name, float x, float y)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	GL_ASSERT(glUniform2f(location, x, y), "failed to set Vector2f type uniform value : (%f, %f)", x, y);
+	SetUniform(GetUniformHandle(name), x, y);
 }
 
 void Shader::SetUniform(const std::string& name, const Vector2i& value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	const int32_t* valuePtr = value.GetPtr();
-	GL_ASSERT(glUniform2iv(location, 1, valuePtr), "failed to set Vector2i type uniform value : (%d, %d)", value.x, value.y);
+	SetUniform(GetUniformHandle(name), value);
 }
 
 void Shader::SetUniform(const std::string& name, int32_t x, int32_t y)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	GL_ASSERT(glUniform2i(location, x, y), "failed to set Vector2i type uniform value : (%d, %d)", x, y);
+	SetUniform(GetUniformHandle(name), x, y);
 }
 
 void Shader::SetUniform(const std::string& name, const Vector3f& value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	const float* valuePtr = value.GetPtr();
-	GL_ASSERT(glUniform3fv(location, 1, valuePtr), "failed to set Vector3f type uniform value : (%f, %f, %f)", value.x, value.y, value.z);
+	SetUniform(GetUniformHandle(name), value);
 }
 
 void Shader::SetUniform(const std::string& name, float x, float y, float z)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	GL_ASSERT(glUniform3f(location, x, y, z), "failed to set Vector3f type uniform value : (%f, %f, %f)", x, y, z);
+	SetUniform(GetUniformHandle(name), x, y, z);
 }
 
 void Shader::SetUniform(const std::string& name, const Vector3i& value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	const int32_t* valuePtr = value.GetPtr();
-	GL_ASSERT(glUniform3iv(location, 1, valuePtr), "failed to set Vector3i type uniform value : (%d, %d, %d)", value.x, value.y, value.z);
+	SetUniform(GetUniformHandle(name), value);
 }
 
 void Shader::SetUniform(const std::string& name, int32_t x, int32_t y, int32_t z)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	GL_ASSERT(glUniform3i(location, x, y, z), "failed to set Vector3i type uniform value : (%d, %d, %d)", x, y, z);
+	SetUniform(GetUniformHandle(name), x, y, z);
 }
 
 void Shader::SetUniform(const std::string& name, const Vector4f& value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
+	SetUniform(GetUniformHandle(name), value);
+}
+
+void Shader::SetUniform(const std::string& name, float x, float y, float z, float w)
+{
+	SetUniform(GetUniformHandle(name), x, y, z, w);
+}
+
+void Shader::SetUniform(const std::string& name, const Vector4i& value)
+{
+	SetUniform(GetUniformHandle(name), value);
+}
+
+void Shader::SetUniform(const std::string& name, int32_t x, int32_t y, int32_t z, int32_t w)
+{
+	SetUniform(GetUniformHandle(name), x, y, z, w);
+}
+
+void Shader::SetUniform(const std::string& name, const Matrix2x2f& value)
+{
+	SetUniform(GetUniformHandle(name), value);
+}
+
+void Shader::SetUniform(const std::string& name, const Matrix3x3f& value)
+{
+	SetUniform(GetUniformHandle(name), value);
+}
+
+void Shader::SetUniform(const std::string& name, const Matrix4x4f& value)
+{
+	SetUniform(GetUniformHandle(name), value);
+}
+
+void Shader::SetUniform(const UniformHandle& handle, bool value)
+{
+	GL_ASSERT(glUniform1i(handle.location, static_cast<int32_t>(value)), "failed to set bool type uniform value : %d", static_cast<int32_t>(value));
+}
+
+void Shader::SetUniform(const UniformHandle& handle, int32_t value)
+{
+	GL_ASSERT(glUniform1i(handle.location, static_cast<int32_t>(value)), "faild to set int type uniform value : %d", static_cast<int32_t>(value));
+}
+
+void Shader::SetUniform(const UniformHandle& handle, float value)
+{
+	ASSERT(IsMatchUniformType(handle, GL_FLOAT), "mismatch uniform type : %d", handle.type);
+
+	GL_ASSERT(glUniform1f(handle.location, value), "failed to set float type uniform value : %f", value);
+}
+
+void Shader::SetUniform(const UniformHandle& handle, const Vector2f& value)
+{
+	ASSERT(IsMatchUniformType(handle, GL_FLOAT_VEC2), "mismatch uniform type : %d", handle.type);
 
 	const float* valuePtr = value.GetPtr();
-	GL_ASSERT(glUniform4fv(location, 1, valuePtr), "failed to set Vector4f type uniform value : (%f, %f, %f, %f)", value.x, value.y, value.z, value.w);
+	GL_ASSERT(glUniform2fv(handle.location, 1, valuePtr), "failed to set Vector2f type uniform value : (%f, %f)", value.x, value.y);
 }
 
-void Shader::SetUniform(const std::string& name, float x, float y, float z, float w)
+void Shader::SetUniform(const UniformHandle& handle, float x, float y)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
+	ASSERT(IsMatchUniformType(handle, GL_FLOAT_VEC2), "mismatch uniform type : %d", handle.type);
 
-	GL_ASSERT(glUniform4f(location, x, y, z, w), "failed to set Vector4f type uniform value : (%f, %f, %f, %f)", x, y, z, w);
+	GL_ASSERT(glUniform2f(handle.location, x, y), "failed to set Vector2f type uniform value : (%f, %f)", x, y);
 }
 
-void Shader::SetUniform(const std::string& name, const Vector4i& value)
+void Shader::SetUniform(const UniformHandle& handle, const Vector2i& value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
+	const int32_t* valuePtr = value.GetPtr();
+	GL_ASSERT(glUniform2iv(handle.location, 1, valuePtr), "failed to set Vector2i type uniform value : (%d, %d)", value.x, value.y);
+}
+
+void Shader::SetUniform(const UniformHandle& handle, int32_t x, int32_t y)
+{
+	GL_ASSERT(glUniform2i(handle.location, x, y), "failed to set Vector2i type uniform value : (%d, %d)", x, y);
+}
 
+void Shader::SetUniform(const UniformHandle& handle, const Vector3f& value)
+{
+	ASSERT(IsMatchUniformType(handle, GL_FLOAT_VEC3), "mismatch uniform type : %d", handle.type);
+
+	const float* valuePtr = value.GetPtr();
+	GL_ASSERT(glUniform3fv(handle.location, 1, valuePtr), "failed to set Vector3f type uniform value : (%f, %f, %f)", value.x, value.y, value.z);
+}
+
+void Shader::SetUniform(const UniformHandle& handle, float x, float y, float z)
+{
+	ASSERT(IsMatchUniformType(handle, GL_FLOAT_VEC3), "mismatch uniform type : %d", handle.type);
+
+	GL_ASSERT(glUniform3f(handle.location, x, y, z), "failed to set Vector3f type uniform value : (%f, %f, %f)", x, y, z);
+}
+
+void Shader::SetUniform(const UniformHandle& handle, const Vector3i& value)
+{
 	const int32_t* valuePtr = value.GetPtr();
-	GL_ASSERT(glUniform4iv(location, 1, valuePtr), "failed to set Vector4i type uniform value : (%d, %d, %d, %d)", value.x, value.y, value.z, value.w);
+	GL_ASSERT(glUniform3iv(handle.location, 1, valuePtr), "failed to set Vector3i type uniform value : (%d, %d, %d)", value.x, value.y, value.z);
 }
 
-void Shader::SetUniform(const std::string& name, int32_t x, int32_t y, int32_t z, int32_t w)
+void Shader::SetUniform(const UniformHandle& handle, int32_t x, int32_t y, int32_t z)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
+	GL_ASSERT(glUniform3i(handle.location, x, y, z), "failed to set Vector3i type uniform value : (%d, %d, %d)", x, y, z);
+}
+
+void Shader::SetUniform(const UniformHandle& handle, const Vector4f& value)
+{
+	ASSERT(IsMatchUniformType(handle, GL_FLOAT_VEC4), "mismatch uniform type : %d", handle.type);
 
-	GL_ASSERT(glUniform4i(location, x, y, z, w), "failed to set Vector4i type uniform value : (%d, %d, %d, %d)", x, y, z, w);
+	const float* valuePtr = value.GetPtr();
+	GL_ASSERT(glUniform4fv(handle.location, 1, valuePtr), "failed to set Vector4f type uniform value : (%f, %f, %f, %f)", value.x, value.y, value.z, value.w);
 }
 
-void Shader::SetUniform(const std::string& name, const Matrix2x2f& value)
+void Shader::SetUniform(const UniformHandle& handle, float x, float y, float z, float w)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
+	ASSERT(IsMatchUniformType(handle, GL_FLOAT_VEC4), "mismatch uniform type : %d", handle.type);
 
-	GL_ASSERT(glUniformMatrix2fv(location, 1, GL_FALSE, value.GetPtr()), "failed to set Matrix2x2f type uniform value...");
+	GL_ASSERT(glUniform4f(handle.location, x, y, z, w), "failed to set Vector4f type uniform value : (%f, %f, %f, %f)", x, y, z, w);
 }
 
-void Shader::SetUniform(const std::string& name, const Matrix3x3f& value)
+void Shader::SetUniform(const UniformHandle& handle, const Vector4i& value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
+	const int32_t* valuePtr = value.GetPtr();
+	GL_ASSERT(glUniform4iv(handle.location, 1, valuePtr), "failed to set Vector4i type uniform value : (%d, %d, %d, %d)", value.x, value.y, value.z, value.w);
+}
 
-	GL_ASSERT(glUniformMatrix3fv(location, 1, GL_FALSE, value.GetPtr()), "failed to set Matrix3x3f type uniform value...");
+void Shader::SetUniform(const UniformHandle& handle, int32_t x, int32_t y, int32_t z, int32_t w)
+{
+	GL_ASSERT(glUniform4i(handle.location, x, y, z, w), "failed to set Vector4i type uniform value : (%d, %d, %d, %d)", x, y, z, w);
 }
 
-void Shader::SetUniform(const std::string& name, const Matrix4x4f& value)
+void Shader::SetUniform(const UniformHandle& handle, const Matrix2x2f& value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
+	ASSERT(IsMatchUniformType(handle, GL_FLOAT_MAT2), "mismatch uniform type : %d", handle.type);
+
+	GL_ASSERT(glUniformMatrix2fv(handle.location, 1, GL_FALSE, value.GetPtr()), "failed to set Matrix2x2f type uniform value...");
+}
+
+void Shader::SetUniform(const UniformHandle& handle, const Matrix3x3f& value)
+{
+	ASSERT(IsMatchUniformType(handle, GL_FLOAT_MAT3), "mismatch uniform type : %d", handle.type);
+
+	GL_ASSERT(glUniformMatrix3fv(handle.location, 1, GL_FALSE, value.GetPtr()), "failed to set Matrix3x3f type uniform value...");
+}
+
+void Shader::SetUniform(const UniformHandle& handle, const Matrix4x4f& value)
+{
+	ASSERT(IsMatchUniformType(handle, GL_FLOAT_MAT4), "mismatch uniform type : %d", handle.type);
 
-	GL_ASSERT(glUniformMatrix4fv(location, 1, GL_FALSE, value.GetPtr()), "failed to set Matrix4x4f type uniform value...");
+	GL_ASSERT(glUniformMatrix4fv(handle.location, 1, GL_FALSE, value.GetPtr()), "failed to set Matrix4x4f type uniform value...");
 }
 
 int32_t Shader::GetUniformLocation(const std::string& uniformName)
@@ -395,19 +361,32 @@ int32_t Shader::GetUniformLocation(const std::string& uniformName)
 	return glGetUniformLocation(programID_, uniformName.c_str());
 }
 
+Shader::UniformHandle Shader::GetUniformHandle(const std::string& uniformName)
+{
+	return GetUniformHandle(GetUniformID(uniformName.c_str()));
+}
+
+Shader::UniformHandle Shader::GetUniformHandle(uint32_t uniformID)
+{
+	WaitForReady();
+
+	auto uniform = std::lower_bound(uniforms_.begin(), uniforms_.end(), uniformID,
+		[](const UniformInfo& info, uint32_t id) { return info.id < id; }
+	);
+
+	if (uniform == uniforms_.end() || uniform->id != uniformID)
+	{
+		return UniformHandle();
+	}
+
+	return uniform->handle;
+}
+
 void Shader::WriteDynamicVertexBuffer(uint32_t vertexBufferID, const void* vertexPtr, uint32_t bufferByteSize)
 {
 	ASSERT(vertexPtr != nullptr, "invalid vertex buffer pointer...");
 
-	GL_ASSERT(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferID), "failed to dynamic vertex buffer...");
-	void* bufferPtr = glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY);
-	ASSERT(bufferPtr != nullptr, "failed to map the entire data store of a specified buffer object into the client's address space...");
-	
-	std::memcpy(bufferPtr, vertexPtr, bufferByteSize);
-	GLboolean bSuccssed = glUnmapBuffer(GL_ARRAY_BUFFER);
-	ASSERT(bSuccssed, "failed to unmap the entire data store of a specified buffer object into the client's address space...");
-
-	GL_ASSERT(glBindBuffer(GL_ARRAY_BUFFER, 0), "failed to unbind dynamic vertex buffer...");
+	GL_ASSERT(glNamedBufferSubData(vertexBufferID, 0, bufferByteSize, vertexPtr), "failed to write dynamic vertex buffer...");
 }
 
 uint32_t Shader::CreateAndCompileShader(const EType& type, const std::string& source)
@@ -435,15 +414,126 @@ uint32_t Shader::CreateAndCompileShader(const EType& type, const std::string& so
 	GL_ASSERT(glShaderSource(shaderID, 1, &sourcePtr, nullptr), "failed to set source code in shader...");
 	GL_ASSERT(glCompileShader(shaderID), "failed to compile %s shader...", type == EType::Vertex ? "Vertex" : "Fragment");
 
-	int32_t success;
-	GL_ASSERT(glGetShaderiv(shaderID, GL_COMPILE_STATUS, &success), "failed to get shader compile status...");
-	if (!success)
+	return shaderID;
+}
+
+void Shader::FinishLink()
+{
+	std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+	if (!bIsCacheHit_)
 	{
-		char* buffer = StringUtils::GetCharBufferPtr();
+		int32_t success;
+		GL_ASSERT(glGetProgramiv(programID_, GL_LINK_STATUS, &success), "failed to get program link info...");
+		if (!success)
+		{
+			char* buffer = StringUtils::GetCharBufferPtr();
+
+			for (const auto& shaderID : { vsID_, fsID_ })
+			{
+				GL_ASSERT(glGetShaderiv(shaderID, GL_COMPILE_STATUS, &success), "failed to get shader compile status...");
+				if (!success)
+				{
+					glGetShaderInfoLog(shaderID, StringUtils::STRING_BUFFER_SIZE, nullptr, buffer);
+
+					std::string log = ShaderPreprocessUtils::RemapLog(buffer, shaderID == vsID_ ? vsFiles_ : fsFiles_);
+					ASSERT(false, "failed to compile %s shader : %s", shaderID == vsID_ ? "Vertex" : "Fragment", log.c_str());
+				}
+			}
 
-		glGetShaderInfoLog(shaderID, StringUtils::STRING_BUFFER_SIZE, nullptr, buffer);
-		ASSERT(false, "failed to compile shader : %s", buffer);
+			glGetProgramInfoLog(programID_, StringUtils::STRING_BUFFER_SIZE, nullptr, buffer);
+			ASSERT(false, "failed to link shader program : %s", buffer);
+		}
+
+		GL_ASSERT(glDetachShader(programID_, vsID_), "failed to detach vertex shader in shader program...");
+		GL_ASSERT(glDetachShader(programID_, fsID_), "failed to detach fragment shader in shader program...");
+		GL_ASSERT(glDeleteShader(vsID_), "invalid delete %d shader...", vsID_);
+		GL_ASSERT(glDeleteShader(fsID_), "invalid delete %d shader...", fsID_);
+		vsID_ = 0;
+		fsID_ = 0;
+
+		ShaderCacheUtils::SaveProgramBinary(programID_, vsSource_, fsSource_);
 	}
 
-	return shaderID;
+	vsSource_ = std::string();
+	fsSource_ = std::string();
+	vsFiles_.clear();
+	fsFiles_.clear();
+
+	ReflectUniforms();
+	bIsReady_ = true;
+
+	std::chrono::duration<float> elapsedTime = std::chrono::steady_clock::now() - startTime;
+	loadSeconds_ += elapsedTime.count();
+	ShaderCacheUtils::RecordProgramLoad(bIsCacheHit_, loadSeconds_);
+
+	OnReady();
+}
+
+void Shader::ReflectUniforms()
+{
+	uniforms_.clear();
+
+	int32_t uniformCount = 0;
+	GL_ASSERT(glGetProgramInterfaceiv(programID_, GL_UNIFORM, GL_ACTIVE_RESOURCES, &uniformCount), "failed to get active uniform count...");
+
+	int32_t maxNameLength = 0;
+	GL_ASSERT(glGetProgramInterfaceiv(programID_, GL_UNIFORM, GL_MAX_NAME_LENGTH, &maxNameLength), "failed to get max uniform name length...");
+
+	static const uint32_t properties[] = { GL_BLOCK_INDEX, GL_LOCATION, GL_TYPE, GL_ARRAY_SIZE, };
+	static const int32_t propertyCount = static_cast<int32_t>(sizeof(properties) / sizeof(properties[0]));
+
+	std::vector<char> nameBuffer(static_cast<std::size_t>(maxNameLength) + 1, '\0');
+	for (int32_t index = 0; index < uniformCount; ++index)
+	{
+		int32_t values[propertyCount] = { -1, -1, 0, 0, };
+		GL_ASSERT(glGetProgramResourceiv(programID_, GL_UNIFORM, index, propertyCount, properties, propertyCount, nullptr, values), "failed to get uniform properties...");
+
+		int32_t blockIndex = values[0];
+		if (blockIndex != -1)
+		{
+			continue; //    ۷ ϹǷ մϴ.
+		}
+
+		int32_t length = 0;
+		GL_ASSERT(glGetProgramResourceName(programID_, GL_UNIFORM, index, maxNameLength, &length, nameBuffer.data()), "failed to get uniform name...");
+
+		UniformInfo info;
+		info.name = std::string(nameBuffer.data(), length);
+		info.id = GetUniformID(info.name.c_str());
+		info.handle.location = values[1];
+		info.handle.type = static_cast<uint32_t>(values[2]);
+		info.arraySize = values[3];
+		uniforms_.push_back(info);
+
+		static const std::string arraySuffix = "[0]";
+		if (info.name.size() <= arraySuffix.size() || info.name.compare(info.name.size() - arraySuffix.size(), arraySuffix.size(), arraySuffix) != 0)
+		{
+			continue;
+		}
+
+		std::string arrayName = info.name.substr(0, info.name.size() - arraySuffix.size());
+
+		UniformInfo arrayInfo = info;
+		arrayInfo.name = arrayName;
+		arrayInfo.id = GetUniformID(arrayName.c_str());
+		uniforms_.push_back(arrayInfo);
+
+		for (int32_t element = 1; element < info.arraySize; ++element)
+		{
+			UniformInfo elementInfo = info;
+			elementInfo.name = arrayName + "[" + std::to_string(element) + "]";
+			elementInfo.id = GetUniformID(elementInfo.name.c_str());
+			elementInfo.handle.location = glGetProgramResourceLocation(programID_, GL_UNIFORM, elementInfo.name.c_str());
+			elementInfo.arraySize = 1;
+			uniforms_.push_back(elementInfo);
+		}
+	}
+
+	std::sort(uniforms_.begin(), uniforms_.end(), [](const UniformInfo& lhs, const UniformInfo& rhs) { return lhs.id < rhs.id; });
+
+	for (std::size_t index = 1; index < uniforms_.size(); ++index)
+	{
+		ASSERT(uniforms_[index - 1].id != uniforms_[index].id, "collision uniform name hash : %s, %s", uniforms_[index - 1].name.c_str(), uniforms_[index].name.c_str());
+	}
 }
\ No newline at end of file
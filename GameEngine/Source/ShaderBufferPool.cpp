@@ -0,0 +1,179 @@
+#include "ShaderBufferPool.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Assertion.h"
+#include "GLAssertion.h"
+#include "GLResourceUtils.h"
+
+#include <glad/glad.h>
+
+/**
+ * @brief  Ǯ   ϴ OpenGL  Ÿ ϴ.
+ */
+static GLenum GetBufferTarget(const ShaderBufferPool::EType& type)
+{
+	return (type == ShaderBufferPool::EType::Uniform) ? GL_UNIFORM_BUFFER : GL_SHADER_STORAGE_BUFFER;
+}
+
+ShaderBufferPool::~ShaderBufferPool()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void ShaderBufferPool::Initialize(const EType& type, uint32_t elementSize, uint32_t capacity)
+{
+	ASSERT(!bIsInitialized_, "already initialize shader buffer pool resource...");
+	ASSERT(elementSize > 0 && (elementSize % 16) == 0, "invalid shader buffer pool element size : %d", elementSize);
+	ASSERT(capacity > 0, "invalid shader buffer pool capacity : %d", capacity);
+
+	type_ = type;
+	elementSize_ = elementSize;
+	capacity_ = capacity;
+	elementCount_ = 0;
+	stride_ = elementSize_;
+
+	if (type_ == EType::Uniform)
+	{
+		int32_t offsetAlignment = 0;
+		GL_ASSERT(glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &offsetAlignment), "failed to get uniform buffer offset alignment...");
+
+		uint32_t alignment = static_cast<uint32_t>(offsetAlignment);
+		stride_ = ((elementSize_ + alignment - 1) / alignment) * alignment;
+	}
+
+	shadowBuffer_.assign(static_cast<std::size_t>(stride_) * capacity_, 0);
+	allocatedFlags_.assign(capacity_, 0);
+	dirtyFlags_.assign(capacity_, 0);
+	dirtyElements_.clear();
+	freeElements_ = std::priority_queue<int32_t, std::vector<int32_t>, std::greater<int32_t>>();
+
+	bufferObject_ = GLResourceUtils::CreateBuffer(shadowBuffer_.size(), shadowBuffer_.data(), GL_DYNAMIC_STORAGE_BIT);
+
+	bIsInitialized_ = true;
+}
+
+void ShaderBufferPool::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+	bIsInitialized_ = false;
+
+	GL_ASSERT(glDeleteBuffers(1, &bufferObject_), "failed to delete shader buffer pool buffer...");
+}
+
+int32_t ShaderBufferPool::Allocate()
+{
+	ASSERT(bIsInitialized_, "not initialized shader buffer pool resource...");
+
+	int32_t elementID = -1;
+	if (!freeElements_.empty())
+	{
+		elementID = freeElements_.top();
+		freeElements_.pop();
+	}
+	else
+	{
+		ASSERT(elementCount_ < capacity_, "overflow shader buffer pool capacity : %d", capacity_);
+		elementID = static_cast<int32_t>(elementCount_++);
+	}
+
+	allocatedFlags_[elementID] = 1;
+	return elementID;
+}
+
+void ShaderBufferPool::Free(int32_t elementID)
+{
+	ASSERT(IsValidElement(elementID), "invalid shader buffer pool element id : %d", elementID);
+
+	std::memset(&shadowBuffer_[static_cast<std::size_t>(elementID) * stride_], 0, elementSize_);
+	allocatedFlags_[elementID] = 0;
+	freeElements_.push(elementID);
+
+	if (!dirtyFlags_[elementID])
+	{
+		dirtyFlags_[elementID] = 1;
+		dirtyElements_.push_back(elementID);
+	}
+}
+
+void ShaderBufferPool::Update(int32_t elementID, const void* data)
+{
+	ASSERT(IsValidElement(elementID), "invalid shader buffer pool element id : %d", elementID);
+
+	uint8_t* element = &shadowBuffer_[static_cast<std::size_t>(elementID) * stride_];
+	if (std::memcmp(element, data, elementSize_) == 0)
+	{
+		return;
+	}
+
+	std::memcpy(element, data, elementSize_);
+
+	if (!dirtyFlags_[elementID])
+	{
+		dirtyFlags_[elementID] = 1;
+		dirtyElements_.push_back(elementID);
+	}
+}
+
+void ShaderBufferPool::Flush()
+{
+	ASSERT(bIsInitialized_, "not initialized shader buffer pool resource...");
+
+	if (dirtyElements_.empty())
+	{
+		return;
+	}
+
+	std::sort(dirtyElements_.begin(), dirtyElements_.end());
+
+	std::size_t begin = 0;
+	while (begin < dirtyElements_.size())
+	{
+		std::size_t end = begin + 1;
+		while (end < dirtyElements_.size() && dirtyElements_[end] == dirtyElements_[end - 1] + 1)
+		{
+			++end;
+		}
+
+		int32_t firstElement = dirtyElements_[begin];
+		uint32_t elementCount = static_cast<uint32_t>(end - begin);
+		std::size_t offset = static_cast<std::size_t>(firstElement) * stride_;
+		std::size_t size = static_cast<std::size_t>(elementCount - 1) * stride_ + elementSize_;
+
+		GL_ASSERT(glNamedBufferSubData(bufferObject_, offset, size, &shadowBuffer_[offset]), "failed to write shader buffer pool buffer...");
+
+		for (std::size_t index = begin; index < end; ++index)
+		{
+			dirtyFlags_[dirtyElements_[index]] = 0;
+		}
+
+		begin = end;
+	}
+
+	dirtyElements_.clear();
+}
+
+void ShaderBufferPool::Bind(uint32_t binding)
+{
+	ASSERT(bIsInitialized_, "not initialized shader buffer pool resource...");
+
+	GL_ASSERT(glBindBufferBase(GetBufferTarget(type_), binding, bufferObject_), "failed to bind shader buffer pool buffer...");
+}
+
+void ShaderBufferPool::BindElement(uint32_t binding, int32_t elementID)
+{
+	ASSERT(IsValidElement(elementID), "invalid shader buffer pool element id : %d", elementID);
+
+	GLintptr offset = static_cast<GLintptr>(elementID) * stride_;
+	GL_ASSERT(glBindBufferRange(GetBufferTarget(type_), binding, bufferObject_, offset, elementSize_), "failed to bind shader buffer pool element...");
+}
+
+bool ShaderBufferPool::IsValidElement(int32_t elementID) const
+{
+	return 0 <= elementID && elementID < static_cast<int32_t>(elementCount_) && allocatedFlags_[elementID];
+}
\ No newline at end of file
@@ -0,0 +1,239 @@
+#include "ShaderCacheUtils.h"
+
+#include <cstring>
+#include <pathcch.h>
+#include <vector>
+
+#include "Assertion.h"
+#include "FileUtils.h"
+#include "GLAssertion.h"
+#include "StringUtils.h"
+#include "WindowsAssertion.h"
+
+#include <glad/glad.h>
+
+/**
+ * @brief ĳ  ĺ ("PBIN")Դϴ.
+ */
+static const uint32_t CACHE_FILE_MAGIC = 0x4E494250;
+
+/**
+ * @brief ĳ   Դϴ.   ٲ ÷ մϴ.
+ */
+static const uint32_t CACHE_FILE_VERSION = 1;
+
+/**
+ * @brief ĳ  Դϴ.  ڿ α׷ ̳ʸ ̾ϴ.
+ */
+struct CacheFileHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint64_t driverHash;
+	uint64_t sourceHash;
+	uint32_t binaryFormat;
+	uint32_t binarySize;
+};
+
+/**
+ * @brief FNV-1a 64Ʈ ؽ ʱ Դϴ.
+ */
+static const uint64_t HASH_OFFSET_BASIS = 14695981039346656037ull;
+
+static bool bIsEnableCache = false;
+static std::wstring cachePath;
+static uint64_t driverHash = 0;
+static ShaderCacheUtils::Statistics statistics = { 0, 0, 0.0f, 0.0f };
+
+/**
+ * @brief  FNV-1a 64Ʈ ؽ  մϴ.
+ */
+static uint64_t ComputeHash(const void* data, std::size_t size, uint64_t hash)
+{
+	const uint8_t* bytePtr = reinterpret_cast<const uint8_t*>(data);
+	for (std::size_t index = 0; index < size; ++index)
+	{
+		hash = (hash ^ bytePtr[index]) * 1099511628211ull;
+	}
+
+	return hash;
+}
+
+/**
+ * @brief ڿ  ڱ Ͽ ؽ  մϴ.
+ */
+static uint64_t ComputeStringHash(const char* text, uint64_t hash)
+{
+	return ComputeHash(text, std::strlen(text) + 1, hash);
+}
+
+/**
+ * @brief ̴ ҽ ؽ  մϴ.
+ */
+static uint64_t ComputeSourceHash(const std::string& vsSource, const std::string& fsSource)
+{
+	uint64_t hash = ComputeStringHash(vsSource.c_str(), HASH_OFFSET_BASIS);
+	return ComputeStringHash(fsSource.c_str(), hash);
+}
+
+/**
+ * @brief ĳ  θ ϴ.
+ */
+static std::wstring GetCacheFilePath(uint64_t sourceHash)
+{
+	uint64_t key = ComputeHash(&sourceHash, sizeof(uint64_t), driverHash);
+	return StringUtils::PrintF(L"%s%016llX.bin", cachePath.c_str(), key);
+}
+
+/**
+ * @brief OpenGL  ť    ϴ.
+ *
+ * @return    ȯմϴ.
+ */
+static uint32_t ClearGLErrors()
+{
+	uint32_t errorCount = 0;
+	while (glGetError() != GL_NO_ERROR)
+	{
+		errorCount++;
+	}
+
+	return errorCount;
+}
+
+void ShaderCacheUtils::Initialize()
+{
+	ASSERT(!bIsEnableCache, "already initialize shader cache...");
+
+	int32_t binaryFormatCount = 0;
+	GL_ASSERT(glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormatCount), "failed to get program binary format count...");
+	if (binaryFormatCount <= 0)
+	{
+		return;
+	}
+
+	wchar_t* bufferPtr = StringUtils::GetWideCharBufferPtr();
+	WINDOWS_ASSERT(GetModuleFileNameW(nullptr, bufferPtr, StringUtils::STRING_BUFFER_SIZE), "failed to get execute file name...");
+	ASSERT(SUCCEEDED(PathCchRemoveFileSpec(bufferPtr, StringUtils::STRING_BUFFER_SIZE)), "failed to remove execute file name...");
+
+	cachePath = StringUtils::PrintF(L"%s\\ShaderCache\\", bufferPtr);
+	if (!FileUtils::IsValidPath(cachePath))
+	{
+		WINDOWS_ASSERT(CreateDirectoryW(cachePath.c_str(), nullptr), L"failed to create %s directory...", cachePath.c_str());
+	}
+
+	driverHash = HASH_OFFSET_BASIS;
+	driverHash = ComputeStringHash(reinterpret_cast<const char*>(glGetString(GL_VENDOR)), driverHash);
+	driverHash = ComputeStringHash(reinterpret_cast<const char*>(glGetString(GL_RENDERER)), driverHash);
+	driverHash = ComputeStringHash(reinterpret_cast<const char*>(glGetString(GL_VERSION)), driverHash);
+
+	bIsEnableCache = true;
+}
+
+bool ShaderCacheUtils::IsEnable()
+{
+	return bIsEnableCache;
+}
+
+bool ShaderCacheUtils::LoadProgramBinary(uint32_t programID, const std::string& vsSource, const std::string& fsSource)
+{
+	if (!bIsEnableCache)
+	{
+		return false;
+	}
+
+	uint64_t sourceHash = ComputeSourceHash(vsSource, fsSource);
+	std::wstring path = GetCacheFilePath(sourceHash);
+	if (!FileUtils::IsValidPath(path))
+	{
+		return false;
+	}
+
+	std::vector<uint8_t> buffer = FileUtils::ReadBufferFromFile(path);
+	if (buffer.size() < sizeof(CacheFileHeader))
+	{
+		return false;
+	}
+
+	CacheFileHeader header;
+	std::memcpy(&header, buffer.data(), sizeof(CacheFileHeader));
+
+	if (header.magic != CACHE_FILE_MAGIC || header.version != CACHE_FILE_VERSION || header.driverHash != driverHash || header.sourceHash != sourceHash)
+	{
+		return false;
+	}
+
+	if (buffer.size() != sizeof(CacheFileHeader) + header.binarySize)
+	{
+		return false;
+	}
+
+	glProgramBinary(programID, header.binaryFormat, buffer.data() + sizeof(CacheFileHeader), header.binarySize);
+
+	/**  ʴ ̳ʸ   ǹǷ, Ϸ ǵư   ϴ. */
+	if (ClearGLErrors() > 0)
+	{
+		return false;
+	}
+
+	int32_t success = 0;
+	GL_ASSERT(glGetProgramiv(programID, GL_LINK_STATUS, &success), "failed to get program link info...");
+
+	return success == GL_TRUE;
+}
+
+void ShaderCacheUtils::SaveProgramBinary(uint32_t programID, const std::string& vsSource, const std::string& fsSource)
+{
+	if (!bIsEnableCache)
+	{
+		return;
+	}
+
+	int32_t binarySize = 0;
+	GL_ASSERT(glGetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &binarySize), "failed to get program binary length...");
+	if (binarySize <= 0)
+	{
+		return;
+	}
+
+	std::vector<uint8_t> buffer(sizeof(CacheFileHeader) + static_cast<std::size_t>(binarySize));
+
+	uint32_t binaryFormat = 0;
+	GL_ASSERT(glGetProgramBinary(programID, binarySize, nullptr, &binaryFormat, buffer.data() + sizeof(CacheFileHeader)), "failed to get program binary...");
+
+	CacheFileHeader header;
+	header.magic = CACHE_FILE_MAGIC;
+	header.version = CACHE_FILE_VERSION;
+	header.driverHash = driverHash;
+	header.sourceHash = ComputeSourceHash(vsSource, fsSource);
+	header.binaryFormat = binaryFormat;
+	header.binarySize = static_cast<uint32_t>(binarySize);
+	std::memcpy(buffer.data(), &header, sizeof(CacheFileHeader));
+
+	std::wstring path = GetCacheFilePath(header.sourceHash);
+	if (FileUtils::IsValidPath(path))
+	{
+		WINDOWS_ASSERT(DeleteFileW(path.c_str()), L"failed to delete %s...", path.c_str());
+	}
+
+	FileUtils::WriteBufferToFile(path, buffer);
+}
+
+void ShaderCacheUtils::RecordProgramLoad(bool bIsCacheHit, float seconds)
+{
+	if (bIsCacheHit)
+	{
+		statistics.hitCount++;
+		statistics.hitSeconds += seconds;
+	}
+	else
+	{
+		statistics.missCount++;
+		statistics.missSeconds += seconds;
+	}
+}
+
+const ShaderCacheUtils::Statistics& ShaderCacheUtils::GetStatistics()
+{
+	return statistics;
+}
\ No newline at end of file
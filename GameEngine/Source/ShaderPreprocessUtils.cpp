@@ -0,0 +1,539 @@
+#include "ShaderPreprocessUtils.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <regex>
+#include <set>
+#include <string_view>
+#include <unordered_map>
+
+#include "Assertion.h"
+#include "FileUtils.h"
+#include "StringUtils.h"
+
+static std::vector<std::wstring> includePaths;
+static std::unordered_map<std::wstring, std::string_view> memoryFiles;
+
+/**
+ * @brief ̴ ҽ  ޸ Ȥ ũ ϴ Ȯմϴ.
+ */
+static bool IsValidFile(const std::wstring& path)
+{
+	return memoryFiles.find(path) != memoryFiles.end() || FileUtils::IsValidPath(path);
+}
+
+/**
+ * @brief ̴ ҽ    нϴ.
+ */
+static std::vector<std::string> ReadLines(const std::wstring& path)
+{
+	std::string text;
+
+	auto memoryFile = memoryFiles.find(path);
+	if (memoryFile != memoryFiles.end())
+	{
+		text = std::string(memoryFile->second);
+	}
+	else
+	{
+		std::vector<uint8_t> buffer = FileUtils::ReadBufferFromFile(path);
+		text = std::string(buffer.begin(), buffer.end());
+	}
+
+	std::vector<std::string> lines;
+	std::size_t begin = 0;
+	while (begin <= text.size())
+	{
+		std::size_t end = text.find('\n', begin);
+		if (end == std::string::npos)
+		{
+			end = text.size();
+		}
+
+		std::string line = text.substr(begin, end - begin);
+		if (!line.empty() && line.back() == '\r')
+		{
+			line.pop_back();
+		}
+
+		lines.push_back(line);
+		begin = end + 1;
+	}
+
+	return lines;
+}
+
+/**
+ * @brief  ó ù̸ ù ̸   ϴ.
+ */
+static bool GetDirective(const std::string& line, const std::string& directive, std::string& outArgument)
+{
+	std::size_t begin = line.find_first_not_of(" \t");
+	if (begin == std::string::npos || line.compare(begin, directive.size(), directive) != 0)
+	{
+		return false;
+	}
+
+	outArgument = line.substr(begin + directive.size());
+	return true;
+}
+
+/**
+ * @brief #include ù  θ ãϴ.
+ */
+static std::wstring FindIncludeFile(const std::wstring& currentPath, const std::string& argument)
+{
+	std::size_t begin = argument.find('"');
+	std::size_t end = argument.find('"', begin + 1);
+	ASSERT(begin != std::string::npos && end != std::string::npos, "invalid include directive : %s", argument.c_str());
+
+	std::wstring name = StringUtils::Convert(argument.substr(begin + 1, end - begin - 1));
+
+	std::size_t separator = currentPath.find_last_of(L"/\\");
+	std::wstring path = (separator == std::wstring::npos ? L"" : currentPath.substr(0, separator + 1)) + name;
+	if (IsValidFile(path))
+	{
+		return path;
+	}
+
+	for (const auto& includePath : includePaths)
+	{
+		path = includePath + name;
+		if (IsValidFile(path))
+		{
+			return path;
+		}
+	}
+
+	ASSERT(false, L"failed to find include file %s...", name.c_str());
+	return L"";
+}
+
+/**
+ * @brief ó   ̿ ϴ Դϴ.
+ */
+struct ExpandContext
+{
+	std::set<std::wstring> includedFiles;
+	std::unordered_map<std::string, std::string> macros;
+};
+
+/**
+ * @brief   Ǻ ù(#if, #ifdef, #ifndef)  ܰ Դϴ.
+ */
+struct ConditionalBranch
+{
+	bool bIsParentActive = true;
+	bool bIsActive = true;
+	bool bHasTaken = false;
+};
+
+/**
+ * @brief #if, #elif ù ǽ մϴ.
+ *
+ * @note
+ * - , ũ, defined,  (!, -),  ,  , ȣ մϴ.
+ * -   ũο  ƴ ũδ 0 մϴ.
+ * - ǽ  ּ մϴ.
+ */
+class ConditionEvaluator
+{
+public:
+	ConditionEvaluator(const std::string& expression, const std::unordered_map<std::string, std::string>& macros)
+		: expression_(expression)
+		, macros_(macros) {}
+
+	int64_t Evaluate()
+	{
+		int64_t value = ParseOr();
+
+		SkipSpace();
+		bool bIsEnd = position_ >= expression_.size() || expression_.compare(position_, 2, "//") == 0 || expression_.compare(position_, 2, "/*") == 0;
+		ASSERT(bIsEnd, "invalid conditional expression : %s", expression_.c_str());
+
+		return value;
+	}
+
+private:
+	void SkipSpace()
+	{
+		while (position_ < expression_.size() && std::isspace(static_cast<unsigned char>(expression_[position_])))
+		{
+			position_++;
+		}
+	}
+
+	bool Accept(const char* token)
+	{
+		SkipSpace();
+
+		std::size_t length = std::strlen(token);
+		if (expression_.compare(position_, length, token) != 0)
+		{
+			return false;
+		}
+
+		position_ += length;
+		return true;
+	}
+
+	std::string ParseIdentifier()
+	{
+		SkipSpace();
+
+		std::size_t begin = position_;
+		while (position_ < expression_.size() && (std::isalnum(static_cast<unsigned char>(expression_[position_])) || expression_[position_] == '_'))
+		{
+			position_++;
+		}
+
+		return expression_.substr(begin, position_ - begin);
+	}
+
+	int64_t ParseOr()
+	{
+		int64_t value = ParseAnd();
+		while (Accept("||"))
+		{
+			int64_t rhs = ParseAnd();
+			value = (value != 0 || rhs != 0) ? 1 : 0;
+		}
+
+		return value;
+	}
+
+	int64_t ParseAnd()
+	{
+		int64_t value = ParseEquality();
+		while (Accept("&&"))
+		{
+			int64_t rhs = ParseEquality();
+			value = (value != 0 && rhs != 0) ? 1 : 0;
+		}
+
+		return value;
+	}
+
+	int64_t ParseEquality()
+	{
+		int64_t value = ParseRelation();
+		while (true)
+		{
+			if (Accept("=="))
+			{
+				value = (value == ParseRelation()) ? 1 : 0;
+			}
+			else if (Accept("!="))
+			{
+				value = (value != ParseRelation()) ? 1 : 0;
+			}
+			else
+			{
+				return value;
+			}
+		}
+	}
+
+	int64_t ParseRelation()
+	{
+		int64_t value = ParseUnary();
+		while (true)
+		{
+			if (Accept("<="))
+			{
+				value = (value <= ParseUnary()) ? 1 : 0;
+			}
+			else if (Accept(">="))
+			{
+				value = (value >= ParseUnary()) ? 1 : 0;
+			}
+			else if (Accept("<"))
+			{
+				value = (value < ParseUnary()) ? 1 : 0;
+			}
+			else if (Accept(">"))
+			{
+				value = (value > ParseUnary()) ? 1 : 0;
+			}
+			else
+			{
+				return value;
+			}
+		}
+	}
+
+	int64_t ParseUnary()
+	{
+		if (Accept("!"))
+		{
+			return ParseUnary() == 0 ? 1 : 0;
+		}
+
+		if (Accept("-"))
+		{
+			return -ParseUnary();
+		}
+
+		if (Accept("("))
+		{
+			int64_t value = ParseOr();
+
+			bool bIsClosed = Accept(")");
+			ASSERT(bIsClosed, "invalid conditional expression : %s", expression_.c_str());
+
+			return value;
+		}
+
+		SkipSpace();
+		if (position_ < expression_.size() && std::isdigit(static_cast<unsigned char>(expression_[position_])))
+		{
+			return static_cast<int64_t>(std::stoll(ParseIdentifier(), nullptr, 0));
+		}
+
+		std::string name = ParseIdentifier();
+		ASSERT(!name.empty(), "invalid conditional expression : %s", expression_.c_str());
+
+		if (name == "defined")
+		{
+			bool bHasParenthesis = Accept("(");
+			std::string macro = ParseIdentifier();
+
+			bool bIsClosed = !bHasParenthesis || Accept(")");
+			ASSERT(bIsClosed, "invalid conditional expression : %s", expression_.c_str());
+
+			return macros_.find(macro) != macros_.end() ? 1 : 0;
+		}
+
+		auto macro = macros_.find(name);
+		if (macro == macros_.end() || macro->second.empty() || !std::isdigit(static_cast<unsigned char>(macro->second[0])))
+		{
+			return 0;
+		}
+
+		return static_cast<int64_t>(std::stoll(macro->second, nullptr, 0));
+	}
+
+private:
+	const std::string& expression_;
+	const std::unordered_map<std::string, std::string>& macros_;
+	std::size_t position_ = 0;
+};
+
+/**
+ * @brief ũ Ǹ ̸  ϴ.
+ */
+static void SplitMacro(const std::string& definition, char separator, std::string& outName, std::string& outValue)
+{
+	std::size_t begin = definition.find_first_not_of(" \t");
+	if (begin == std::string::npos)
+	{
+		outName.clear();
+		outValue.clear();
+		return;
+	}
+
+	std::size_t end = definition.find_first_of(std::string(" \t") + separator, begin);
+	outName = definition.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+
+	std::size_t valueBegin = (end == std::string::npos) ? std::string::npos : definition.find_first_not_of(" \t", end + 1);
+	outValue = (valueBegin == std::string::npos) ? "" : definition.substr(valueBegin);
+	while (!outValue.empty() && std::isspace(static_cast<unsigned char>(outValue.back())))
+	{
+		outValue.pop_back();
+	}
+}
+
+/**
+ * @brief ̴ ҽ   ó  ߰մϴ.
+ *
+ * @note
+ * - Ǻ ù  ״ ,  θ ϱ ؼ մϴ.
+ * - Ȱ б #include ġ ,  Ϸ  ʽϴ.
+ */
+static void ExpandFile(const std::wstring& path, const std::vector<std::string>& defines, ExpandContext& context, ShaderPreprocessUtils::Source& outSource)
+{
+	uint32_t fileIndex = static_cast<uint32_t>(outSource.files.size());
+	outSource.files.push_back(path);
+	context.includedFiles.insert(path);
+
+	if (fileIndex != 0)
+	{
+		outSource.code += StringUtils::PrintF("#line 1 %u\n", fileIndex);
+	}
+
+	std::vector<ConditionalBranch> branches;
+	auto isActive = [&]() { return branches.empty() || branches.back().bIsActive; };
+
+	std::vector<std::string> lines = ReadLines(path);
+	for (std::size_t index = 0; index < lines.size(); ++index)
+	{
+		const std::string& line = lines[index];
+		uint32_t nextLine = static_cast<uint32_t>(index + 2);
+
+		std::string argument;
+		if (GetDirective(line, "#version", argument))
+		{
+			ASSERT(fileIndex == 0, L"include file %s can't have version directive...", path.c_str());
+
+			outSource.code += line + "\n";
+			for (const auto& define : defines)
+			{
+				std::string name;
+				std::string value;
+				SplitMacro(define, '=', name, value);
+				context.macros[name] = value;
+
+				outSource.code += value.empty() ? ("#define " + name + "\n") : ("#define " + name + " " + value + "\n");
+			}
+
+			outSource.code += StringUtils::PrintF("#line %u %u\n", nextLine, fileIndex);
+		}
+		else if (GetDirective(line, "#include", argument))
+		{
+			if (isActive())
+			{
+				std::wstring includePath = FindIncludeFile(path, argument);
+				if (context.includedFiles.find(includePath) == context.includedFiles.end())
+				{
+					ExpandFile(includePath, defines, context, outSource);
+				}
+			}
+
+			outSource.code += StringUtils::PrintF("#line %u %u\n", nextLine, fileIndex);
+		}
+		else
+		{
+			if (GetDirective(line, "#ifdef", argument) || GetDirective(line, "#ifndef", argument))
+			{
+				std::string name;
+				std::string value;
+				SplitMacro(argument, ' ', name, value);
+
+				bool bIsDefined = context.macros.find(name) != context.macros.end();
+				bool bIsTrue = GetDirective(line, "#ifdef", argument) ? bIsDefined : !bIsDefined;
+
+				ConditionalBranch branch;
+				branch.bIsParentActive = isActive();
+				branch.bIsActive = branch.bIsParentActive && bIsTrue;
+				branch.bHasTaken = bIsTrue;
+				branches.push_back(branch);
+			}
+			else if (GetDirective(line, "#if", argument))
+			{
+				ConditionalBranch branch;
+				branch.bIsParentActive = isActive();
+
+				bool bIsTrue = branch.bIsParentActive && ConditionEvaluator(argument, context.macros).Evaluate() != 0;
+				branch.bIsActive = bIsTrue;
+				branch.bHasTaken = bIsTrue;
+				branches.push_back(branch);
+			}
+			else if (GetDirective(line, "#elif", argument))
+			{
+				ASSERT(!branches.empty(), L"unmatched #elif directive in %s...", path.c_str());
+
+				ConditionalBranch& branch = branches.back();
+				bool bIsTrue = branch.bIsParentActive && !branch.bHasTaken && ConditionEvaluator(argument, context.macros).Evaluate() != 0;
+				branch.bIsActive = bIsTrue;
+				branch.bHasTaken = branch.bHasTaken || bIsTrue;
+			}
+			else if (GetDirective(line, "#else", argument))
+			{
+				ASSERT(!branches.empty(), L"unmatched #else directive in %s...", path.c_str());
+
+				ConditionalBranch& branch = branches.back();
+				branch.bIsActive = branch.bIsParentActive && !branch.bHasTaken;
+				branch.bHasTaken = true;
+			}
+			else if (GetDirective(line, "#endif", argument))
+			{
+				ASSERT(!branches.empty(), L"unmatched #endif directive in %s...", path.c_str());
+				branches.pop_back();
+			}
+			else if (isActive() && GetDirective(line, "#define", argument))
+			{
+				std::string name;
+				std::string value;
+				SplitMacro(argument, '(', name, value);
+				context.macros[name] = value;
+			}
+			else if (isActive() && GetDirective(line, "#undef", argument))
+			{
+				std::string name;
+				std::string value;
+				SplitMacro(argument, ' ', name, value);
+				context.macros.erase(name);
+			}
+
+			outSource.code += line + "\n";
+		}
+	}
+
+	ASSERT(branches.empty(), L"unterminated conditional directive in %s...", path.c_str());
+}
+
+void ShaderPreprocessUtils::AddIncludePath(const std::wstring& path)
+{
+	if (std::find(includePaths.begin(), includePaths.end(), path) == includePaths.end())
+	{
+		includePaths.push_back(path);
+	}
+}
+
+void ShaderPreprocessUtils::AddMemoryFile(const std::wstring& path, const char* code, uint32_t size)
+{
+	memoryFiles[path] = std::string_view(code, size);
+}
+
+ShaderPreprocessUtils::Source ShaderPreprocessUtils::Preprocess(const std::wstring& path, const std::vector<std::string>& defines)
+{
+	Source source;
+	ExpandContext context;
+
+	ExpandFile(path, defines, context, source);
+
+	return source;
+}
+
+std::string ShaderPreprocessUtils::RemapLog(const std::string& log, const std::vector<std::wstring>& files)
+{
+	static const std::regex location("^(\\s*(?:ERROR: |WARNING: )?)(\\d+)([:(]\\d+)");
+
+	std::string remapLog;
+	std::size_t begin = 0;
+	while (begin < log.size())
+	{
+		std::size_t end = log.find('\n', begin);
+		end = (end == std::string::npos) ? log.size() : end + 1;
+
+		std::string line = log.substr(begin, end - begin);
+		std::smatch match;
+		if (std::regex_search(line, match, location))
+		{
+			std::size_t fileIndex = static_cast<std::size_t>(std::stoul(match[2].str()));
+			if (fileIndex < files.size())
+			{
+				line = match[1].str() + StringUtils::Convert(files[fileIndex]) + match[3].str() + match.suffix().str();
+			}
+		}
+
+		remapLog += line;
+		begin = end;
+	}
+
+	return remapLog;
+}
+
+std::string ShaderPreprocessUtils::MakePermutationKey(const std::vector<std::string>& defines)
+{
+	std::set<std::string> sortedDefines(defines.begin(), defines.end());
+
+	std::string key;
+	for (const auto& define : sortedDefines)
+	{
+		key += define + ";";
+	}
+
+	return key;
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include "ShaderVariantSet.h"
+
+#include "Assertion.h"
+#include "Shader.h"
+#include "ShaderPreprocessUtils.h"
+
+ShaderVariantSet::~ShaderVariantSet()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void ShaderVariantSet::Initialize(const std::wstring& vsPath, const std::wstring& fsPath)
+{
+	ASSERT(!bIsInitialized_, "already initialize shader variant set resource...");
+
+	vsPath_ = vsPath;
+	fsPath_ = fsPath;
+	variants_ = std::unordered_map<std::string, std::unique_ptr<Shader>>();
+
+	bIsInitialized_ = true;
+}
+
+void ShaderVariantSet::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+	for (auto& variant : variants_)
+	{
+		variant.second->Release();
+	}
+
+	variants_.clear();
+
+	bIsInitialized_ = false;
+}
+
+Shader* ShaderVariantSet::GetVariant(const std::vector<std::string>& defines)
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+	std::string key = ShaderPreprocessUtils::MakePermutationKey(defines);
+
+	auto variant = variants_.find(key);
+	if (variant != variants_.end())
+	{
+		return variant->second.get();
+	}
+
+	std::unique_ptr<Shader> shader = std::make_unique<Shader>();
+	shader->Initialize(vsPath_, fsPath_, defines);
+
+	Shader* shaderPtr = shader.get();
+	variants_.insert({ key, std::move(shader) });
+
+	return shaderPtr;
+}
\ No newline at end of file
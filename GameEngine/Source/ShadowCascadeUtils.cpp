@@ -0,0 +1,119 @@
+#include "ShadowCascadeUtils.h"
+
+#include <cmath>
+
+#include "Assertion.h"
+#include "MathUtils.h"
+
+void ShadowCascadeUtils::ComputeSplitDistances(float nearZ, float farZ, uint32_t cascadeCount, float lambda, std::vector<float>& outSplits)
+{
+	ASSERT(0.0f < nearZ && nearZ < farZ, "invalid cascade split range : (near : %f, far : %f)", nearZ, farZ);
+	ASSERT(cascadeCount > 0, "invalid cascade count : %d", cascadeCount);
+
+	outSplits.resize(cascadeCount + 1);
+	outSplits.front() = nearZ;
+	outSplits.back() = farZ;
+
+	for (uint32_t index = 1; index < cascadeCount; ++index)
+	{
+		float rate = static_cast<float>(index) / static_cast<float>(cascadeCount);
+
+		float logSplit = nearZ * std::pow(farZ / nearZ, rate);
+		float uniformSplit = nearZ + (farZ - nearZ) * rate;
+
+		outSplits[index] = lambda * logSplit + (1.0f - lambda) * uniformSplit;
+	}
+}
+
+ShadowCascadeUtils::Cascade ShadowCascadeUtils::FitCascade(
+	const Matrix4x4f& cameraView,
+	float fov,
+	float aspect,
+	float splitNear,
+	float splitFar,
+	const Vector3f& lightDirection,
+	uint32_t shadowSize,
+	float casterDistance
+)
+{
+	ASSERT(splitNear < splitFar, "invalid cascade range : (near : %f, far : %f)", splitNear, splitFar);
+	ASSERT(shadowSize > 0, "invalid cascade shadow size : %d", shadowSize);
+
+	Matrix4x4f cameraWorld = MathUtils::Inverse(cameraView);
+
+	float tanHalfFovY = std::tan(fov * 0.5f);
+	float tanHalfFovX = tanHalfFovY * aspect;
+
+	Vector3f corners[8];
+	float distances[2] = { splitNear, splitFar };
+	for (int32_t index = 0; index < 8; ++index)
+	{
+		float distance = distances[index / 4];
+		float x = ((index & 1) ? +1.0f : -1.0f) * tanHalfFovX * distance;
+		float y = ((index & 2) ? +1.0f : -1.0f) * tanHalfFovY * distance;
+
+		corners[index] = MathUtils::TransformPosition(Vector3f(x, y, -distance), cameraWorld);
+	}
+
+	Vector3f center(0.0f, 0.0f, 0.0f);
+	for (const auto& corner : corners)
+	{
+		center += corner;
+	}
+	center = Vector3f(center.x / 8.0f, center.y / 8.0f, center.z / 8.0f);
+
+	float radius = 0.0f;
+	for (const auto& corner : corners)
+	{
+		float distance = MathUtils::Length(corner - center);
+		radius = (distance > radius) ? distance : radius;
+	}
+	radius = std::ceil(radius * 16.0f) / 16.0f;
+
+	Vector3f direction = MathUtils::Normalize(lightDirection);
+	Vector3f up = (std::abs(direction.y) > 0.99f) ? Vector3f(0.0f, 0.0f, 1.0f) : Vector3f(0.0f, 1.0f, 0.0f);
+
+	Cascade cascade;
+	cascade.splitNear = splitNear;
+	cascade.splitFar = splitFar;
+	cascade.lightView = MathUtils::CreateLookAt(Vector3f(0.0f, 0.0f, 0.0f), direction, up);
+
+	Vector3f lightCenter = MathUtils::TransformPosition(center, cascade.lightView);
+	float texelSize = (2.0f * radius) / static_cast<float>(shadowSize);
+
+	float left = std::floor((lightCenter.x - radius) / texelSize) * texelSize;
+	float bottom = std::floor((lightCenter.y - radius) / texelSize) * texelSize;
+	float right = left + 2.0f * radius;
+	float top = bottom + 2.0f * radius;
+
+	float zNear = -lightCenter.z - radius - casterDistance;
+	float zFar = -lightCenter.z + radius;
+
+	cascade.lightProjection = MathUtils::CreateOrtho(left, right, bottom, top, zNear, zFar);
+
+	return cascade;
+}
+
+void ShadowCascadeUtils::ComputeCascades(
+	const Matrix4x4f& cameraView,
+	float fov,
+	float aspect,
+	float nearZ,
+	float farZ,
+	const Vector3f& lightDirection,
+	uint32_t cascadeCount,
+	float lambda,
+	uint32_t shadowSize,
+	float casterDistance,
+	std::vector<Cascade>& outCascades
+)
+{
+	std::vector<float> splits;
+	ComputeSplitDistances(nearZ, farZ, cascadeCount, lambda, splits);
+
+	outCascades.resize(cascadeCount);
+	for (uint32_t index = 0; index < cascadeCount; ++index)
+	{
+		outCascades[index] = FitCascade(cameraView, fov, aspect, splits[index], splits[index + 1], lightDirection, shadowSize, casterDistance);
+	}
+}
\ No newline at end of file
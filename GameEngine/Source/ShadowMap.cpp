@@ -2,9 +2,80 @@
 
 #include "Assertion.h"
 #include "GLAssertion.h"
+#include "GLResourceUtils.h"
 
 #include <glad/glad.h>
 
+/**
+ * @brief ε  ̰ ؽó մϴ.
+ *
+ * @note ϵ PCF      ͸ մϴ.
+ */
+static uint32_t CreateDepthTexture(uint32_t shadowWidth, uint32_t shadowHeight)
+{
+	uint32_t textureID = 0;
+	float border[] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+	textureID = GLResourceUtils::CreateTexture(GL_TEXTURE_2D, GL_LINEAR, GL_LINEAR, GL_CLAMP_TO_BORDER);
+	GL_ASSERT(glTextureStorage2D(textureID, 1, GL_DEPTH_COMPONENT32F, shadowWidth, shadowHeight), "failed to allocate shadow map texture...");
+	GL_ASSERT(glTextureParameterfv(textureID, GL_TEXTURE_BORDER_COLOR, border), "failed to set texture border color...");
+	GL_ASSERT(glTextureParameteri(textureID, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE), "failed to set texture compare mode...");
+	GL_ASSERT(glTextureParameteri(textureID, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL), "failed to set texture compare function...");
+
+	return textureID;
+}
+
+/**
+ * @brief Variance  Ʈ(,  ) ؽó մϴ.
+ */
+static uint32_t CreateMomentsTexture(uint32_t shadowWidth, uint32_t shadowHeight, bool bEnableMipmap)
+{
+	uint32_t textureID = 0;
+	float border[] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+	int32_t levels = 1;
+	if (bEnableMipmap)
+	{
+		for (uint32_t size = (shadowWidth > shadowHeight) ? shadowWidth : shadowHeight; size > 1; size >>= 1)
+		{
+			levels++;
+		}
+	}
+
+	textureID = GLResourceUtils::CreateTexture(GL_TEXTURE_2D, bEnableMipmap ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR, GL_LINEAR, GL_CLAMP_TO_BORDER);
+	GL_ASSERT(glTextureStorage2D(textureID, levels, GL_RG32F, shadowWidth, shadowHeight), "failed to allocate shadow map moments texture...");
+	GL_ASSERT(glTextureParameterfv(textureID, GL_TEXTURE_BORDER_COLOR, border), "failed to set texture border color...");
+
+	return textureID;
+}
+
+/**
+ * @brief ̰ ؽó( Ʈ ؽó)  ϴ  ۸ մϴ.
+ */
+static uint32_t CreateShadowFramebuffer(uint32_t depthID, uint32_t momentsID)
+{
+	uint32_t framebufferID = 0;
+
+	GL_ASSERT(glCreateFramebuffers(1, &framebufferID), "failed to create shaodw map framebuffer...");
+	GL_ASSERT(glNamedFramebufferTexture(framebufferID, GL_DEPTH_ATTACHMENT, depthID, 0), "failed to set framebuffer depth buffer..");
+
+	if (momentsID != 0)
+	{
+		GL_ASSERT(glNamedFramebufferTexture(framebufferID, GL_COLOR_ATTACHMENT0, momentsID, 0), "failed to set framebuffer moments buffer...");
+		GL_ASSERT(glNamedFramebufferDrawBuffer(framebufferID, GL_COLOR_ATTACHMENT0), "failed to set moments buffer to draw buffer...");
+	}
+	else
+	{
+		GL_ASSERT(glNamedFramebufferDrawBuffer(framebufferID, GL_NONE), "failed to no color buffers are written...");
+	}
+	GL_ASSERT(glNamedFramebufferReadBuffer(framebufferID, GL_NONE), "failed to select a color buffer source for pixels...");
+
+	GLenum state = glCheckNamedFramebufferStatus(framebufferID, GL_FRAMEBUFFER);
+	ASSERT(state == GL_FRAMEBUFFER_COMPLETE, "not complete framebuffer state : %x...", static_cast<int32_t>(state));
+
+	return framebufferID;
+}
+
 ShadowMap::~ShadowMap()
 {
 	if (bIsInitialized_)
@@ -13,33 +84,34 @@ ShadowMap::~ShadowMap()
 	}
 }
 
-void ShadowMap::Initialize(uint32_t shadowWidth, uint32_t shadowHeight)
+void ShadowMap::Initialize(uint32_t shadowWidth, uint32_t shadowHeight, bool bEnableStaticCache, EShadowFilter filter)
 {
 	ASSERT(!bIsInitialized_, "already initialize shadow map...");
 	ASSERT((shadowWidth >= 0 && shadowHeight >= 0), "%d, %d is invlid shadow map size...", shadowWidth, shadowHeight);
 
-	float border[] = { 1.0f, 1.0f, 1.0f, 1.0f };
-
-	GL_ASSERT(glGenFramebuffers(1, &shadowMapFBO_), "failed to generate shaodw map framebuffer...");
-	GL_ASSERT(glBindFramebuffer(GL_FRAMEBUFFER, shadowMapFBO_), "failed to bind shadow map framebuffer...");
-
-	GL_ASSERT(glGenTextures(1, &shadowMapID_), "filed to generate shadow map texture...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, shadowMapID_), "failed to bind shadow map texture...");
-	GL_ASSERT(glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, shadowWidth, shadowHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr), "failed to allows elements of an image array to be read by shaders...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST), "failed to set texture object min filter...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST), "failed to set texture object mag filter...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER), "failed to set texture object warp s...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER), "failed to set texture object warp t...");
-	GL_ASSERT(glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, border), "failed to set texture border color...");
-
-	GL_ASSERT(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, shadowMapID_, 0), "failed to set framebuffer depth buffer..");
-	GL_ASSERT(glDrawBuffer(GL_NONE), "failed to no color buffers are written...");
-	GL_ASSERT(glReadBuffer(GL_NONE), "failed to select a color buffer source for pixels...");
+	shadowWidth_ = shadowWidth;
+	shadowHeight_ = shadowHeight;
+	filter_ = filter;
 
-	GLenum state = glCheckFramebufferStatus(GL_FRAMEBUFFER);
-	ASSERT(state == GL_FRAMEBUFFER_COMPLETE, "not complete framebuffer state : %x...", static_cast<int32_t>(state));
+	shadowMapID_ = CreateDepthTexture(shadowWidth_, shadowHeight_);
+	if (filter_ == EShadowFilter::Variance)
+	{
+		momentsID_ = CreateMomentsTexture(shadowWidth_, shadowHeight_, true);
+	}
+	shadowMapFBO_ = CreateShadowFramebuffer(shadowMapID_, momentsID_);
 
-	GL_ASSERT(glBindFramebuffer(GL_FRAMEBUFFER, 0), "failed to unbind shadow map framebuffer...");
+	bIsEnableStaticCache_ = bEnableStaticCache;
+	if (bIsEnableStaticCache_)
+	{
+		staticCacheID_ = CreateDepthTexture(shadowWidth_, shadowHeight_);
+		if (filter_ == EShadowFilter::Variance)
+		{
+			staticCacheMomentsID_ = CreateMomentsTexture(shadowWidth_, shadowHeight_, false);
+		}
+		staticCacheFBO_ = CreateShadowFramebuffer(staticCacheID_, staticCacheMomentsID_);
+
+		bIsStaticCacheDirty_ = true;
+	}
 
 	bIsInitialized_ = true;
 }
@@ -48,6 +120,24 @@ void ShadowMap::Release()
 {
 	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
 
+	if (bIsEnableStaticCache_)
+	{
+		if (staticCacheMomentsID_ != 0)
+		{
+			GL_ASSERT(glDeleteTextures(1, &staticCacheMomentsID_), "failed to delete shadow map static cache moments texture...");
+			staticCacheMomentsID_ = 0;
+		}
+
+		GL_ASSERT(glDeleteTextures(1, &staticCacheID_), "failed to delete shadow map static cache texture...");
+		GL_ASSERT(glDeleteFramebuffers(1, &staticCacheFBO_), "failed to delete shadow map static cache framebuffer...");
+	}
+
+	if (momentsID_ != 0)
+	{
+		GL_ASSERT(glDeleteTextures(1, &momentsID_), "failed to delete shadow map moments texture...");
+		momentsID_ = 0;
+	}
+
 	GL_ASSERT(glDeleteTextures(1, &shadowMapID_), "failed to delete shaodw map texture...");
 	GL_ASSERT(glDeleteFramebuffers(1, &shadowMapFBO_), "failed to delete shadow map framebuffer...");
 
@@ -58,6 +148,12 @@ void ShadowMap::Clear()
 {
 	ASSERT(bIsBind_, "unbind this shadow map...");
 	glClear(GL_DEPTH_BUFFER_BIT);
+
+	if (filter_ == EShadowFilter::Variance)
+	{
+		float moments[] = { 1.0f, 1.0f, 0.0f, 0.0f };
+		GL_ASSERT(glClearBufferfv(GL_COLOR, 0, moments), "failed to clear moments buffer...");
+	}
 }
 
 void ShadowMap::Bind()
@@ -75,11 +171,53 @@ void ShadowMap::Unbind()
 	{
 		bIsBind_ = false;
 		GL_ASSERT(glBindFramebuffer(GL_FRAMEBUFFER, 0), "failed to unbind shadow map framebuffer...");
+
+		if (momentsID_ != 0)
+		{
+			GL_ASSERT(glGenerateTextureMipmap(momentsID_), "failed to generate shadow map moments mipmap...");
+		}
+	}
+}
+
+void ShadowMap::BindStaticCache()
+{
+	ASSERT(bIsEnableStaticCache_, "disable shadow map static cache...");
+	ASSERT(!bIsBind_, "already bind shadow map...");
+
+	bIsBind_ = true;
+	GL_ASSERT(glBindFramebuffer(GL_FRAMEBUFFER, staticCacheFBO_), "failed to bind shadow map static cache framebuffer...");
+
+	bIsStaticCacheDirty_ = false;
+}
+
+void ShadowMap::RestoreStaticCache()
+{
+	ASSERT(bIsBind_, "unbind this shadow map...");
+	ASSERT(bIsEnableStaticCache_, "disable shadow map static cache...");
+	ASSERT(!bIsStaticCacheDirty_, "shadow map static cache is dirty...");
+
+	GL_ASSERT(glCopyImageSubData(
+		staticCacheID_, GL_TEXTURE_2D, 0, 0, 0, 0,
+		shadowMapID_, GL_TEXTURE_2D, 0, 0, 0, 0,
+		shadowWidth_, shadowHeight_, 1
+	), "failed to copy static cache depth...");
+
+	if (staticCacheMomentsID_ != 0)
+	{
+		GL_ASSERT(glCopyImageSubData(
+			staticCacheMomentsID_, GL_TEXTURE_2D, 0, 0, 0, 0,
+			momentsID_, GL_TEXTURE_2D, 0, 0, 0, 0,
+			shadowWidth_, shadowHeight_, 1
+		), "failed to copy static cache moments...");
 	}
 }
 
 void ShadowMap::Active(uint32_t unit)
 {
-	GL_ASSERT(glActiveTexture(GL_TEXTURE0 + unit), "failed to active %d texture unit...", (GL_TEXTURE0 + unit));
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, shadowMapID_), "failed to bind shadow map texture...");
+	GL_ASSERT(glBindTextureUnit(unit, shadowMapID_), "failed to bind shadow map texture to %d texture unit...", unit);
+
+	if (momentsID_ != 0)
+	{
+		GL_ASSERT(glBindTextureUnit(unit + 1, momentsID_), "failed to bind shadow map moments texture to %d texture unit...", (unit + 1));
+	}
 }
\ No newline at end of file
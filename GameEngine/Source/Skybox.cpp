@@ -3,6 +3,7 @@
 #include "Assertion.h"
 #include "FileUtils.h"
 #include "GLAssertion.h"
+#include "GLResourceUtils.h"
 #include "StringUtils.h"
 #include "TextureUtils.h"
 
@@ -35,9 +36,9 @@ void Skybox::Initialize(const std::wstring& rightPath, const std::wstring& leftP
 	{
 		cubeMapID_ = CreateAstcCompressionCubemap(resourcePaths);
 	}
-	else if (extension == L"dds")
+	else if (extension == L"dds" || extension == L"ktx2")
 	{
-		cubeMapID_ = CreateDxtCompressionCubemap(resourcePaths);
+		cubeMapID_ = CreateContainerCubemap(resourcePaths);
 	}
 	else
 	{
@@ -49,6 +50,21 @@ void Skybox::Initialize(const std::wstring& rightPath, const std::wstring& leftP
 	bIsInitialized_ = true;
 }
 
+void Skybox::Initialize(const std::wstring& path)
+{
+	ASSERT(!bIsInitialized_, "already initialize cube map texture resource...");
+
+	TextureContainer container;
+	TextureUtils::LoadContainerFromFile(path, container);
+	ASSERT(container.GetTarget() == GL_TEXTURE_CUBE_MAP, L"%s is not cube map texture container...", path.c_str());
+
+	cubeMapID_ = TextureUtils::CreateTextureFromContainer(container);
+
+	CreateSkyboxVertexObject();
+
+	bIsInitialized_ = true;
+}
+
 void Skybox::Release()
 {
 	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
@@ -62,8 +78,7 @@ void Skybox::Release()
 
 void Skybox::Active(uint32_t unit) const
 {
-	GL_ASSERT(glActiveTexture(GL_TEXTURE0 + unit), "failed to active %d texture unit...", (GL_TEXTURE0 + unit));
-	GL_ASSERT(glBindTexture(GL_TEXTURE_CUBE_MAP, cubeMapID_), "failed to bind cube map texture...");
+	GL_ASSERT(glBindTextureUnit(unit, cubeMapID_), "failed to bind cube map texture to %d texture unit...", unit);
 }
 
 std::wstring Skybox::GetCubemapExtension(const std::vector<std::wstring>& resourcePaths)
@@ -86,41 +101,30 @@ std::wstring Skybox::GetCubemapExtension(const std::vector<std::wstring>& resour
 
 uint32_t Skybox::CreateNonCompressionCubemap(const std::vector<std::wstring>& resourcePaths)
 {
-	uint32_t cubeMapID;
-	GL_ASSERT(glGenTextures(1, &cubeMapID), "failed to generate texture object...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_CUBE_MAP, cubeMapID), "failed to bind texture object...");
-
-	for (std::size_t index = 0; index < resourcePaths.size(); ++index)
-	{
-		int32_t width = 0;
-		int32_t height = 0;
-		int32_t channels = 0;
-		std::vector<uint8_t> buffer;
-		TextureUtils::LoadImageFromFile(resourcePaths[index], width, height, channels, buffer);
+	std::vector<DecodedImage> images = TextureUtils::LoadImagesFromFiles(resourcePaths);
 
-		GLenum target = static_cast<GLenum>(GL_TEXTURE_CUBE_MAP_POSITIVE_X + index);
-		GLenum format = TextureUtils::FindTextureFormatFromChannel(channels);
-		ASSERT(format != 0xFFFF, "%d is not support image channel...", channels);
+	const DecodedImage& front = images.front();
+	GLenum internalFormat = TextureUtils::FindInternalFormatFromChannel(front.channels);
+	ASSERT(internalFormat != 0xFFFF, "%d is not support image channel...", front.channels);
 
-		GL_ASSERT(glTexImage2D(target, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, buffer.data()), "failed to allows elements of an image array to be read by shaders...");
-	}
+	uint32_t cubeMapID = GLResourceUtils::CreateTexture(GL_TEXTURE_CUBE_MAP, GL_LINEAR, GL_LINEAR, GL_CLAMP_TO_EDGE);
+	GL_ASSERT(glTextureStorage2D(cubeMapID, 1, internalFormat, front.width, front.height), "failed to allocate texture storage...");
 
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR), "failed to set texture object min filter...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR), "failed to set texture object mag filter...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE), "failed to set texture object warp s...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE), "failed to set texture object warp t...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE), "failed to set texture object warp r...");
+	for (std::size_t index = 0; index < images.size(); ++index)
+	{
+		const DecodedImage& image = images[index];
+		ASSERT(image.channels == front.channels && image.width == front.width && image.height == front.height, "cube map faces must have the same format and size...");
 
-	GL_ASSERT(glBindTexture(GL_TEXTURE_CUBE_MAP, 0), "failed to unbind texture object...");
+		GLenum format = TextureUtils::FindTextureFormatFromChannel(image.channels);
+		GL_ASSERT(glTextureSubImage3D(cubeMapID, 0, 0, 0, static_cast<GLint>(index), image.width, image.height, 1, format, GL_UNSIGNED_BYTE, image.buffer.get()), "failed to upload cube map face...");
+	}
 
 	return cubeMapID;
 }
 
 uint32_t Skybox::CreateAstcCompressionCubemap(const std::vector<std::wstring>& resourcePaths)
 {
-	uint32_t cubeMapID;
-	GL_ASSERT(glGenTextures(1, &cubeMapID), "failed to generate texture object...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_CUBE_MAP, cubeMapID), "failed to bind texture object...");
+	uint32_t cubeMapID = GLResourceUtils::CreateTexture(GL_TEXTURE_CUBE_MAP, GL_LINEAR, GL_LINEAR, GL_CLAMP_TO_EDGE);
 
 	for (std::size_t index = 0; index < resourcePaths.size(); ++index)
 	{
@@ -140,63 +144,47 @@ uint32_t Skybox::CreateAstcCompressionCubemap(const std::vector<std::wstring>& r
 
 		uint32_t byteToRead = (xblocks * yblocks * zblocks) << 4;
 
-		GLenum target = static_cast<GLenum>(GL_TEXTURE_CUBE_MAP_POSITIVE_X + index);
-		GL_ASSERT(glCompressedTexImage2D(target, 0, compressionFormat, xsize, ysize, 0, byteToRead, reinterpret_cast<const void*>(&astcDataPtr[1])), "failed to compress texture...");
-	}
-
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR), "failed to set texture object min filter...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR), "failed to set texture object mag filter...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE), "failed to set texture object warp s...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE), "failed to set texture object warp t...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE), "failed to set texture object warp r...");
+		if (index == 0)
+		{
+			GL_ASSERT(glTextureStorage2D(cubeMapID, 1, compressionFormat, xsize, ysize), "failed to allocate texture storage...");
+		}
 
-	GL_ASSERT(glBindTexture(GL_TEXTURE_CUBE_MAP, 0), "failed to unbind texture object...");
+		GL_ASSERT(glCompressedTextureSubImage3D(cubeMapID, 0, 0, 0, static_cast<GLint>(index), xsize, ysize, 1, compressionFormat, byteToRead, reinterpret_cast<const void*>(&astcDataPtr[1])), "failed to compress texture...");
+	}
 
 	return cubeMapID;
 }
 
-uint32_t Skybox::CreateDxtCompressionCubemap(const std::vector<std::wstring>& resourcePaths)
+uint32_t Skybox::CreateContainerCubemap(const std::vector<std::wstring>& resourcePaths)
 {
-	uint32_t cubeMapID;
-	GL_ASSERT(glGenTextures(1, &cubeMapID), "failed to generate texture object...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_CUBE_MAP, cubeMapID), "failed to bind texture object...");
-
+	std::vector<TextureContainer> containers(resourcePaths.size());
 	for (std::size_t index = 0; index < resourcePaths.size(); ++index)
 	{
-		std::vector<uint8_t> dxtData;
-		GLenum format;
-		uint32_t blockSize;
-		TextureUtils::LoadDxtFromFile(resourcePaths[index], dxtData, format, blockSize);
-
-		DDSFileHeader* dxtDataPtr = reinterpret_cast<DDSFileHeader*>(dxtData.data());
-		uint32_t width = dxtDataPtr->dwWidth;
-		uint32_t height = dxtDataPtr->dwHeight;
-		uint32_t linearSize = dxtDataPtr->dwPitchOrLinearSize;
-		uint32_t mipMapCount = dxtDataPtr->dwMipMapCount;
-		uint32_t bufferSize = mipMapCount > 1 ? linearSize * 2 : linearSize;
-		uint8_t* bufferPtr = reinterpret_cast<uint8_t*>(&dxtDataPtr[1]);
-
-		GL_ASSERT(glPixelStorei(GL_UNPACK_ALIGNMENT, 1), "failed to set pixel storage modes...");
-
-		GLenum target = static_cast<GLenum>(GL_TEXTURE_CUBE_MAP_POSITIVE_X + index);
-		for (uint32_t level = 0, offset = 0; level < mipMapCount; ++level)
+		TextureUtils::LoadContainerFromFile(resourcePaths[index], containers[index]);
+		ASSERT(containers[index].GetTarget() == GL_TEXTURE_2D, L"%s is not 2d texture container...", resourcePaths[index].c_str());
+	}
+
+	const TextureContainer& front = containers.front();
+	for (const auto& container : containers)
+	{
+		bool bIsMatch = container.internalFormat == front.internalFormat && container.width == front.width && container.height == front.height && container.levelCount == front.levelCount;
+		ASSERT(bIsMatch, "cube map faces must have the same format, size and mip level count...");
+	}
+
+	GLenum minFilter = (front.levelCount > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR;
+	uint32_t cubeMapID = GLResourceUtils::CreateTexture(GL_TEXTURE_CUBE_MAP, minFilter, GL_LINEAR, GL_CLAMP_TO_EDGE);
+	GL_ASSERT(glTextureStorage2D(cubeMapID, static_cast<GLsizei>(front.levelCount), front.internalFormat, front.width, front.height), "failed to allocate texture storage...");
+	GL_ASSERT(glPixelStorei(GL_UNPACK_ALIGNMENT, 1), "failed to set pixel storage modes...");
+
+	for (std::size_t index = 0; index < containers.size(); ++index)
+	{
+		for (const auto& subImage : containers[index].subImages)
 		{
-			if (width == 0 || height == 0)
-			{
-				mipMapCount--;
-				continue;
-			}
-
-			uint32_t size = ((width + 3) / 4) * ((height + 3) / 4) * blockSize;
-			GL_ASSERT(glCompressedTexImage2D(target, level, format, width, height, 0, size, bufferPtr + offset), "failed to compression texture...");
-
-			offset += size;
-			width /= 2;
-			height /= 2;
+			TextureUtils::UploadContainerSubImage(cubeMapID, GL_TEXTURE_CUBE_MAP, static_cast<int32_t>(index), containers[index], subImage);
 		}
 	}
 
-	GL_ASSERT(glBindTexture(GL_TEXTURE_CUBE_MAP, 0), "failed to unbind texture object...");
+	GL_ASSERT(glPixelStorei(GL_UNPACK_ALIGNMENT, 4), "failed to set pixel storage modes...");
 
 	return cubeMapID;
 }
@@ -248,14 +236,6 @@ void Skybox::CreateSkyboxVertexObject()
 	};
 	vertexCount_ = static_cast<uint32_t>(vertices.size());
 
-	GL_ASSERT(glGenVertexArrays(1, &vertexArrayObject_), "failed to generate skybox vertex array...");
-	GL_ASSERT(glGenBuffers(1, &vertexBufferObject_), "failed to generate skybox vertex buffer...");
-	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind skybox vertex array...");
-	GL_ASSERT(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind skybox vertex buffer...");
-	GL_ASSERT(glBufferData(GL_ARRAY_BUFFER, sizeof(float) * static_cast<uint32_t>(vertices.size()), vertices.data(), GL_STATIC_DRAW), "failed to create a new data store for a skybox vertex buffer object...");
-
-	GL_ASSERT(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)(0)), "failed to specify the location and data format of the array of generic vertex attributes at index...");
-	GL_ASSERT(glEnableVertexAttribArray(0), "failed to enable vertex attrib array...");
-
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind skybox vertex array...");
+	vertexBufferObject_ = GLResourceUtils::CreateBuffer(sizeof(float) * vertices.size(), vertices.data(), 0);
+	vertexArrayObject_ = GLResourceUtils::CreateVertexArray(vertexBufferObject_, 3 * sizeof(float), { { 0, 3, 0 } });
 }
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include "StaticBatch.h"
+
+#include "Assertion.h"
+#include "GLAssertion.h"
+#include "GLResourceUtils.h"
+
+#include <glad/glad.h>
+
+StaticBatch::~StaticBatch()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void StaticBatch::Initialize(
+	const Material* material,
+	const std::vector<StaticMesh::Vertex>& vertices,
+	const std::vector<uint32_t>& indices,
+	const std::vector<SubMesh>& subMeshes
+)
+{
+	ASSERT(!bIsInitialized_, "already initialize static batch resource...");
+
+	material_ = material;
+	subMeshes_ = subMeshes;
+	indexCount_ = static_cast<uint32_t>(indices.size());
+
+	boundingBox_ = AxisAlignedBoundingBox();
+	for (const auto& subMesh : subMeshes_)
+	{
+		boundingBox_.Expand(subMesh.boundingBox);
+	}
+
+	uint32_t vertexBufferSize = static_cast<uint32_t>(vertices.size()) * StaticMesh::Vertex::GetStride();
+	uint32_t indexBufferSize = static_cast<uint32_t>(indices.size()) * sizeof(uint32_t);
+
+	vertexBufferObject_ = GLResourceUtils::CreateBuffer(vertexBufferSize, vertices.data(), 0);
+	indexBufferObject_ = GLResourceUtils::CreateBuffer(indexBufferSize, indices.data(), 0);
+	vertexArrayObject_ = GLResourceUtils::CreateVertexArray(vertexBufferObject_, StaticMesh::Vertex::GetStride(), {
+		{ 0, 3, static_cast<uint32_t>(offsetof(StaticMesh::Vertex, position)) },
+		{ 1, 3, static_cast<uint32_t>(offsetof(StaticMesh::Vertex, normal))   },
+		{ 2, 2, static_cast<uint32_t>(offsetof(StaticMesh::Vertex, texture))  },
+	}, indexBufferObject_);
+
+	bIsInitialized_ = true;
+}
+
+void StaticBatch::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+	GL_ASSERT(glDeleteBuffers(1, &indexBufferObject_), "failed to delete static batch index buffer...");
+	GL_ASSERT(glDeleteBuffers(1, &vertexBufferObject_), "failed to delete static batch vertex buffer...");
+	GL_ASSERT(glDeleteVertexArrays(1, &vertexArrayObject_), "failed to delete static batch vertex array object...");
+
+	material_ = nullptr;
+	subMeshes_.clear();
+	indexCount_ = 0;
+
+	bIsInitialized_ = false;
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include "StaticBatchBuilder.h"
+
+#include <unordered_map>
+
+#include "Assertion.h"
+#include "MathUtils.h"
+#include "TaskManager.h"
+
+void StaticBatchBuilder::AddEntry(const StaticMesh* mesh, const Matrix4x4f& world, const Material* material)
+{
+	ASSERT(mesh != nullptr && mesh->IsInitialized(), "invalid static mesh for static batch...");
+	ASSERT(mesh->HasGeometry(), "static mesh for static batch must keep cpu geometry...");
+
+	Entry entry;
+	entry.mesh = mesh;
+	entry.world = world;
+	entry.material = material;
+
+	entries_.push_back(entry);
+}
+
+void StaticBatchBuilder::Build()
+{
+	batches_.clear();
+
+	struct Placement
+	{
+		uint32_t batchIndex;
+		uint32_t subMeshIndex;
+		uint32_t baseVertex;
+		uint32_t firstIndex;
+	};
+
+	std::unordered_map<const Material*, uint32_t> batchIndices;
+	std::vector<Placement> placements(entries_.size());
+	std::vector<uint32_t> vertexCounts;
+	std::vector<uint32_t> indexCounts;
+
+	for (std::size_t index = 0; index < entries_.size(); ++index)
+	{
+		const Entry& entry = entries_[index];
+
+		auto batchIndex = batchIndices.find(entry.material);
+		if (batchIndex == batchIndices.end())
+		{
+			batchIndex = batchIndices.insert({ entry.material, static_cast<uint32_t>(batches_.size()) }).first;
+
+			Batch batch;
+			batch.material = entry.material;
+			batches_.push_back(std::move(batch));
+
+			vertexCounts.push_back(0);
+			indexCounts.push_back(0);
+		}
+
+		uint32_t batch = batchIndex->second;
+
+		Placement& placement = placements[index];
+		placement.batchIndex = batch;
+		placement.subMeshIndex = static_cast<uint32_t>(batches_[batch].subMeshes.size());
+		placement.baseVertex = vertexCounts[batch];
+		placement.firstIndex = indexCounts[batch];
+
+		StaticBatch::SubMesh subMesh;
+		subMesh.firstIndex = placement.firstIndex;
+		subMesh.indexCount = static_cast<uint32_t>(entry.mesh->GetIndices().size());
+		batches_[batch].subMeshes.push_back(subMesh);
+
+		vertexCounts[batch] += static_cast<uint32_t>(entry.mesh->GetVertices().size());
+		indexCounts[batch] += subMesh.indexCount;
+	}
+
+	for (std::size_t batch = 0; batch < batches_.size(); ++batch)
+	{
+		batches_[batch].vertices.resize(vertexCounts[batch]);
+		batches_[batch].indices.resize(indexCounts[batch]);
+	}
+
+	TaskManager::Get().ParallelFor(static_cast<uint32_t>(entries_.size()), [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t index = begin; index < end; ++index)
+			{
+				const Entry& entry = entries_[index];
+				const Placement& placement = placements[index];
+				Batch& batch = batches_[placement.batchIndex];
+
+				Matrix4x4f normalMatrix = MathUtils::Transpose(MathUtils::Inverse(entry.world));
+				AxisAlignedBoundingBox boundingBox;
+
+				const std::vector<StaticMesh::Vertex>& vertices = entry.mesh->GetVertices();
+				for (std::size_t vertex = 0; vertex < vertices.size(); ++vertex)
+				{
+					StaticMesh::Vertex& target = batch.vertices[placement.baseVertex + vertex];
+
+					target.position = MathUtils::TransformPosition(vertices[vertex].position, entry.world);
+					target.normal = MathUtils::Normalize(MathUtils::TransformDirection(vertices[vertex].normal, normalMatrix));
+					target.texture = vertices[vertex].texture;
+
+					boundingBox.Expand(target.position);
+				}
+
+				const std::vector<uint32_t>& indices = entry.mesh->GetIndices();
+				for (std::size_t element = 0; element < indices.size(); ++element)
+				{
+					batch.indices[placement.firstIndex + element] = indices[element] + placement.baseVertex;
+				}
+
+				batch.subMeshes[placement.subMeshIndex].boundingBox = boundingBox;
+			}
+		}, 4);
+
+	for (auto& batch : batches_)
+	{
+		batch.boundingBox = AxisAlignedBoundingBox();
+		for (const auto& subMesh : batch.subMeshes)
+		{
+			batch.boundingBox.Expand(subMesh.boundingBox);
+		}
+	}
+}
+
+void StaticBatchBuilder::Clear()
+{
+	entries_.clear();
+	batches_.clear();
+}
\ No newline at end of file
@@ -2,7 +2,9 @@
 
 #include "Assertion.h"
 #include "GLAssertion.h"
+#include "GLResourceUtils.h"
 #include "FileUtils.h"
+#include "TextureUtils.h"
 
 #include <glad/glad.h>
 #include <stb_rect_pack.h>
@@ -139,21 +141,14 @@ std::shared_ptr<uint8_t[]> TTFont::GenerateGlyphAtlasBitmap(const std::vector<ui
 
 uint32_t TTFont::CreateGlyphAtlasFromBitmap(const std::shared_ptr<uint8_t[]>& bitmap, const int32_t& glyphAtlasSize)
 {
-	uint32_t textureAtlas;
-	GL_ASSERT(glGenTextures(1, &textureAtlas), "failed to generate true type font glyph atlas...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, textureAtlas), "failed to bind glyph atlas object...");
+	int32_t levelCount = TextureUtils::ComputeMipLevelCount(glyphAtlasSize, glyphAtlasSize);
 
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE), "failed to set glyph atlas object warp s...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE), "failed to set glyph atlas object warp t...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR), "failed to set glyph atlas object min filter...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR), "failed to set glyph atlas object mag filter...");
+	uint32_t textureAtlas = GLResourceUtils::CreateTexture(GL_TEXTURE_2D, GL_LINEAR, GL_LINEAR, GL_CLAMP_TO_EDGE);
+	GL_ASSERT(glTextureStorage2D(textureAtlas, levelCount, GL_R8, glyphAtlasSize, glyphAtlasSize), "failed to allocate glyph atlas storage...");
 
 	const void* bufferPtr = reinterpret_cast<const void*>(&bitmap[0]);
-	GL_ASSERT(glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, glyphAtlasSize, glyphAtlasSize, 0, GL_RED, GL_UNSIGNED_BYTE, bufferPtr),
-		"failed to allows elements of an image array to be read by shaders...");
-	GL_ASSERT(glGenerateMipmap(GL_TEXTURE_2D), "failed to generate glyph atlas mipmap...");
-
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, 0), "failed to unbind glyph atlas object...");
+	GL_ASSERT(glTextureSubImage2D(textureAtlas, 0, 0, 0, glyphAtlasSize, glyphAtlasSize, GL_RED, GL_UNSIGNED_BYTE, bufferPtr), "failed to upload glyph atlas...");
+	GL_ASSERT(glGenerateTextureMipmap(textureAtlas), "failed to generate glyph atlas mipmap...");
 
 	return textureAtlas;
 }
\ No newline at end of file
@@ -0,0 +1,163 @@
+#include "TaskManager.h"
+
+#include <atomic>
+#include <memory>
+
+#include "Assertion.h"
+
+/**
+ * @brief  尡 ۾  Դϴ.
+ */
+static thread_local bool bIsWorkerThread = false;
+
+void TaskManager::Startup()
+{
+	ASSERT(!bIsStartup_, "already startup task manager...");
+
+	uint32_t hardwareThreadCount = static_cast<uint32_t>(std::thread::hardware_concurrency());
+	uint32_t workerCount = (hardwareThreadCount > 1) ? hardwareThreadCount - 1 : 1;
+
+	bIsRequestStop_ = false;
+	for (uint32_t index = 0; index < workerCount; ++index)
+	{
+		workers_.emplace_back([&]() { RunWorkerLoop(); });
+	}
+
+	bIsStartup_ = true;
+}
+
+void TaskManager::Shutdown()
+{
+	ASSERT(bIsStartup_, "not startup before or has already been shutdowned...");
+
+	{
+		std::unique_lock<std::mutex> lock(taskMutex_);
+		bIsRequestStop_ = true;
+	}
+	taskCondition_.notify_all();
+
+	for (auto& worker : workers_)
+	{
+		worker.join();
+	}
+	workers_.clear();
+
+	bIsStartup_ = false;
+}
+
+std::future<void> TaskManager::Submit(const std::function<void()>& task)
+{
+	std::shared_ptr<std::packaged_task<void()>> packagedTask = std::make_shared<std::packaged_task<void()>>(task);
+	std::future<void> future = packagedTask->get_future();
+
+	if (!bIsStartup_)
+	{
+		(*packagedTask)();
+		return future;
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(taskMutex_);
+		tasks_.push([packagedTask]() { (*packagedTask)(); });
+	}
+	taskCondition_.notify_one();
+
+	return future;
+}
+
+void TaskManager::ParallelFor(uint32_t count, const std::function<void(uint32_t, uint32_t)>& task, uint32_t minBatchSize)
+{
+	if (count == 0)
+	{
+		return;
+	}
+
+	uint32_t threadCount = GetWorkerCount() + 1;
+	uint32_t batchSize = (count + threadCount * 4 - 1) / (threadCount * 4);
+	batchSize = (batchSize < minBatchSize) ? minBatchSize : batchSize;
+
+	if (!bIsStartup_ || IsWorkerThread() || batchSize >= count)
+	{
+		task(0, count);
+		return;
+	}
+
+	/** ȣ 尡 ȯ ڿ ϴ ۾ 嵵   ֵ   ¸ մϴ. */
+	struct ParallelForState
+	{
+		std::function<void(uint32_t, uint32_t)> task;
+		uint32_t count;
+		uint32_t batchSize;
+		uint32_t batchCount;
+		std::atomic<uint32_t> nextBatch;
+		std::atomic<uint32_t> completeBatchCount;
+		std::mutex completeMutex;
+		std::condition_variable completeCondition;
+	};
+
+	std::shared_ptr<ParallelForState> state = std::make_shared<ParallelForState>();
+	state->task = task;
+	state->count = count;
+	state->batchSize = batchSize;
+	state->batchCount = (count + batchSize - 1) / batchSize;
+	state->nextBatch = 0;
+	state->completeBatchCount = 0;
+
+	auto runBatches = [state]()
+		{
+			for (uint32_t batch = state->nextBatch++; batch < state->batchCount; batch = state->nextBatch++)
+			{
+				uint32_t begin = batch * state->batchSize;
+				uint32_t end = (begin + state->batchSize < state->count) ? begin + state->batchSize : state->count;
+				state->task(begin, end);
+
+				if (++state->completeBatchCount == state->batchCount)
+				{
+					std::unique_lock<std::mutex> lock(state->completeMutex);
+					state->completeCondition.notify_all();
+				}
+			}
+		};
+
+	uint32_t helperCount = (state->batchCount - 1 < GetWorkerCount()) ? state->batchCount - 1 : GetWorkerCount();
+	for (uint32_t index = 0; index < helperCount; ++index)
+	{
+		Submit(runBatches);
+	}
+
+	runBatches();
+
+	/** ȣ 尡 ݺ ġ   ó ۵ ̹Ƿ, ̹ ٸ 尡   ϷḸ ٸϴ. */
+	std::unique_lock<std::mutex> lock(state->completeMutex);
+	state->completeCondition.wait(lock, [&]() { return state->completeBatchCount == state->batchCount; });
+}
+
+bool TaskManager::IsWorkerThread() const
+{
+	return bIsWorkerThread;
+}
+
+void TaskManager::RunWorkerLoop()
+{
+	bIsWorkerThread = true;
+
+	for (;;)
+	{
+		std::function<void()> task;
+
+		{
+			std::unique_lock<std::mutex> lock(taskMutex_);
+			taskCondition_.wait(lock, [&]() { return bIsRequestStop_ || !tasks_.empty(); });
+
+			if (tasks_.empty())
+			{
+				return;
+			}
+
+			task = std::move(tasks_.front());
+			tasks_.pop();
+		}
+
+		task();
+	}
+}
\ No newline at end of file
@@ -3,7 +3,10 @@
 #include "Assertion.h"
 #include "FileUtils.h"
 #include "GLAssertion.h"
+#include "GLResourceUtils.h"
 #include "StringUtils.h"
+#include "TextureResidencyManager.h"
+#include "TextureStreamManager.h"
 #include "TextureUtils.h"
 
 #include <array>
@@ -24,20 +27,39 @@ void Texture2D::Initialize(const std::wstring& path)
 	ASSERT(!bIsInitialized_, "already initialize 2d texture resource...");
 	ASSERT(TextureUtils::IsSupportExtension(path), L"%s is not support extension...", path.c_str());
 
+	target_ = GL_TEXTURE_2D;
+	path_ = path;
+
 	std::wstring extension = StringUtils::ToLower(FileUtils::GetFileExtension(path));
 	if (extension == L"astc")
 	{
 		textureID_ = CreateAstcCompressionTexture(path);
 	}
-	else if (extension == L"dds")
+	else if (extension == L"dds" || extension == L"ktx2")
 	{
-		textureID_ = CreateDxtCompressionTexture(path);
+		textureID_ = CreateContainerTexture(path);
 	}
 	else
 	{
 		textureID_ = CreateNonCompressionTexture(path);
 	}
 
+	bIsReady_ = true;
+	bIsInitialized_ = true;
+
+	TextureResidencyManager::Get().Register(this);
+}
+
+void Texture2D::InitializeAsync(const std::wstring& path)
+{
+	ASSERT(!bIsInitialized_, "already initialize 2d texture resource...");
+
+	textureID_ = 0;
+	bIsReady_ = false;
+	path_ = path;
+
+	TextureStreamManager::Get().Request(this, path);
+
 	bIsInitialized_ = true;
 }
 
@@ -45,39 +67,45 @@ void Texture2D::Release()
 {
 	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
 
-	GL_ASSERT(glDeleteTextures(1, &textureID_), "failed to delete texture object...");
+	if (!bIsReady_)
+	{
+		TextureStreamManager::Get().Cancel(this);
+	}
+
+	TextureResidencyManager::Get().Unregister(this);
+
+	if (textureID_ != 0)
+	{
+		GL_ASSERT(glDeleteTextures(1, &textureID_), "failed to delete texture object...");
+		textureID_ = 0;
+	}
 
+	bIsReady_ = false;
 	bIsInitialized_ = false;
 }
 
 void Texture2D::Active(uint32_t unit) const
 {
-	GL_ASSERT(glActiveTexture(GL_TEXTURE0 + unit), "failed to active %d texture unit...", (GL_TEXTURE0 + unit));
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, textureID_), "failed to bind texture...");
+	uint32_t textureID = bIsReady_ ? textureID_ : TextureStreamManager::Get().GetPlaceholderTextureID();
+	GL_ASSERT(glBindTextureUnit(unit, textureID), "failed to bind texture to %d texture unit...", unit);
 }
 
 uint32_t Texture2D::CreateNonCompressionTexture(const std::wstring& path)
 {
-	int32_t width;
-	int32_t height;
-	int32_t channels;
-	std::vector<uint8_t> buffer;
-	TextureUtils::LoadImageFromFile(path, width, height, channels, buffer);
-
-	GLenum format = TextureUtils::FindTextureFormatFromChannel(channels);
-	ASSERT(format != 0xFFFF, "%d is not support image channel...", channels);
-
-	uint32_t textureID;
-	GL_ASSERT(glGenTextures(1, &textureID), "failed to generate texture object...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, textureID), "failed to bind texture object...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE), "failed to set texture object warp s...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE), "failed to set texture object warp t...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR), "failed to set texture object min filter...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR), "failed to set texture object mag filter...");
-	GL_ASSERT(glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, buffer.data()), "failed to allows elements of an image array to be read by shaders...");
-	GL_ASSERT(glGenerateMipmap(GL_TEXTURE_2D), "failed to generate texture mipmap...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, 0), "failed to unbind texture object...");
-	
+	DecodedImage image;
+	TextureUtils::LoadImageFromFile(path, image);
+
+	GLenum format = TextureUtils::FindTextureFormatFromChannel(image.channels);
+	GLenum internalFormat = TextureUtils::FindInternalFormatFromChannel(image.channels);
+	ASSERT(format != 0xFFFF && internalFormat != 0xFFFF, "%d is not support image channel...", image.channels);
+
+	int32_t levelCount = TextureUtils::ComputeMipLevelCount(image.width, image.height);
+
+	uint32_t textureID = GLResourceUtils::CreateTexture(GL_TEXTURE_2D, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR, GL_CLAMP_TO_EDGE);
+	GL_ASSERT(glTextureStorage2D(textureID, levelCount, internalFormat, image.width, image.height), "failed to allocate texture storage...");
+	GL_ASSERT(glTextureSubImage2D(textureID, 0, 0, 0, image.width, image.height, format, GL_UNSIGNED_BYTE, image.buffer.get()), "failed to upload texture level...");
+	GL_ASSERT(glGenerateTextureMipmap(textureID), "failed to generate texture mipmap...");
+
 	return textureID;
 }
 
@@ -99,61 +127,20 @@ uint32_t Texture2D::CreateAstcCompressionTexture(const std::wstring& path)
 
 	uint32_t byteToRead = (xblocks * yblocks * zblocks) << 4;
 
-	uint32_t textureID;
-	GL_ASSERT(glGenTextures(1, &textureID), "failed to generate texture object...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, textureID), "failed to bind texture object...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE), "failed to set texture object warp s...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE), "failed to set texture object warp t...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR), "failed to set texture object min filter...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR), "failed to set texture object mag filter...");
-	GL_ASSERT(glCompressedTexImage2D(GL_TEXTURE_2D, 0, compressionFormat, xsize, ysize, 0, byteToRead, reinterpret_cast<const void*>(&astcDataPtr[1])), "failed to compress texture...");
-	GL_ASSERT(glGenerateMipmap(GL_TEXTURE_2D), "failed to generate texture mipmap...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, 0), "failed to unbind texture object...");
+	uint32_t textureID = GLResourceUtils::CreateTexture(GL_TEXTURE_2D, GL_LINEAR, GL_LINEAR, GL_CLAMP_TO_EDGE);
+	GL_ASSERT(glTextureParameteri(textureID, GL_TEXTURE_MAX_LEVEL, 0), "failed to set texture object max level...");
+	GL_ASSERT(glTextureStorage2D(textureID, 1, compressionFormat, xsize, ysize), "failed to allocate texture storage...");
+	GL_ASSERT(glCompressedTextureSubImage2D(textureID, 0, 0, 0, xsize, ysize, compressionFormat, byteToRead, reinterpret_cast<const void*>(&astcDataPtr[1])), "failed to compress texture...");
 
 	return textureID;
 }
 
-uint32_t Texture2D::CreateDxtCompressionTexture(const std::wstring& path)
+uint32_t Texture2D::CreateContainerTexture(const std::wstring& path)
 {
-	std::vector<uint8_t> dxtData;
-	GLenum format;
-	uint32_t blockSize;
-	TextureUtils::LoadDxtFromFile(path, dxtData, format, blockSize);
-
-	DDSFileHeader* dxtDataPtr = reinterpret_cast<DDSFileHeader*>(dxtData.data());
-	uint32_t width = dxtDataPtr->dwWidth;
-	uint32_t height = dxtDataPtr->dwHeight;
-	uint32_t linearSize = dxtDataPtr->dwPitchOrLinearSize;
-	uint32_t mipMapCount = dxtDataPtr->dwMipMapCount;
-	uint32_t bufferSize = mipMapCount > 1 ? linearSize * 2 : linearSize;
-	uint8_t* bufferPtr = reinterpret_cast<uint8_t*>(&dxtDataPtr[1]);
-
-	uint32_t textureID;
-	GL_ASSERT(glGenTextures(1, &textureID), "failed to generate texture object...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, textureID), "failed to bind texture object...");
-	GL_ASSERT(glPixelStorei(GL_UNPACK_ALIGNMENT, 1), "failed to set pixel storage modes...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE), "failed to set texture object warp s...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE), "failed to set texture object warp t...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR), "failed to set texture object min filter...");
-	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR), "failed to set texture object mag filter...");
-
-	for (uint32_t level = 0, offset = 0; level < mipMapCount; ++level)
-	{
-		if (width == 0 || height == 0)
-		{
-			mipMapCount--;
-			continue;
-		}
-
-		uint32_t size = ((width + 3) / 4) * ((height + 3) / 4) * blockSize;
-		GL_ASSERT(glCompressedTexImage2D(GL_TEXTURE_2D, level, format, width, height, 0, size, bufferPtr + offset), "failed to compression texture...");
-
-		offset += size;
-		width /= 2;
-		height /= 2;
-	}
-
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, 0), "failed to unbind texture object...");
+	TextureContainer container;
+	TextureUtils::LoadContainerFromFile(path, container);
+	ASSERT(container.faceCount == 1, L"%s is cube map texture, use skybox instead...", path.c_str());
 
-	return textureID;
+	target_ = container.GetTarget();
+	return TextureUtils::CreateTextureFromContainer(container);
 }
\ No newline at end of file
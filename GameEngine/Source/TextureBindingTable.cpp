@@ -0,0 +1,306 @@
+#include "TextureBindingTable.h"
+
+#include <algorithm>
+
+#include "Assertion.h"
+#include "GLAssertion.h"
+#include "GLResourceUtils.h"
+#include "RenderManager.h"
+#include "Texture2D.h"
+#include "TextureResidencyManager.h"
+
+#include <glad/glad.h>
+
+/**
+ * @brief ؽó ε帮 ڵ  Լ ŸԴϴ.
+ *
+ * @note glad ε ʴ GL_ARB_bindless_texture Ȯ ԼԴϴ.
+ */
+typedef GLuint64 (APIENTRYP PFNGLGETTEXTUREHANDLEARBPROC)(GLuint texture);
+
+/**
+ * @brief ε帮 ڵ ̴   ֵ ֽŰ Լ ŸԴϴ.
+ *
+ * @note glad ε ʴ GL_ARB_bindless_texture Ȯ ԼԴϴ.
+ */
+typedef void (APIENTRYP PFNGLMAKETEXTUREHANDLERESIDENTARBPROC)(GLuint64 handle);
+
+/**
+ * @brief ε帮 ڵ ָ ϴ Լ ŸԴϴ.
+ *
+ * @note glad ε ʴ GL_ARB_bindless_texture Ȯ ԼԴϴ.
+ */
+typedef void (APIENTRYP PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)(GLuint64 handle);
+
+static PFNGLGETTEXTUREHANDLEARBPROC glGetTextureHandleARB = nullptr;
+static PFNGLMAKETEXTUREHANDLERESIDENTARBPROC glMakeTextureHandleResidentARB = nullptr;
+static PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC glMakeTextureHandleNonResidentARB = nullptr;
+
+TextureBindingTable::~TextureBindingTable()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void TextureBindingTable::Initialize(uint32_t maxTextureCount, uint32_t layerCount, bool bIsForceTextureArray)
+{
+	ASSERT(!bIsInitialized_, "already initialize texture binding table resource...");
+	ASSERT(maxTextureCount > 0, "invalid texture binding table max texture count : %d", maxTextureCount);
+	ASSERT(layerCount > 0, "invalid texture binding table layer count : %d", layerCount);
+
+	backend_ = EBackend::TextureArray;
+	if (!bIsForceTextureArray && RenderManager::Get().IsSupportExtension("GL_ARB_bindless_texture"))
+	{
+		glGetTextureHandleARB = reinterpret_cast<PFNGLGETTEXTUREHANDLEARBPROC>(wglGetProcAddress("glGetTextureHandleARB"));
+		glMakeTextureHandleResidentARB = reinterpret_cast<PFNGLMAKETEXTUREHANDLERESIDENTARBPROC>(wglGetProcAddress("glMakeTextureHandleResidentARB"));
+		glMakeTextureHandleNonResidentARB = reinterpret_cast<PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC>(wglGetProcAddress("glMakeTextureHandleNonResidentARB"));
+
+		if (glGetTextureHandleARB != nullptr && glMakeTextureHandleResidentARB != nullptr && glMakeTextureHandleNonResidentARB != nullptr)
+		{
+			backend_ = EBackend::Bindless;
+		}
+	}
+
+	slotPool_.Initialize(ShaderBufferPool::EType::ShaderStorage, sizeof(SlotData), maxTextureCount);
+	slots_.assign(maxTextureCount, Slot());
+	textureSlots_ = std::unordered_map<const Texture2D*, int32_t>();
+	pendingSlots_.clear();
+	textureArrays_.clear();
+	layerCount_ = layerCount;
+
+	bIsInitialized_ = true;
+}
+
+void TextureBindingTable::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+	bIsInitialized_ = false;
+
+	if (backend_ == EBackend::Bindless)
+	{
+		for (const auto& slot : slots_)
+		{
+			if (slot.refCount > 0 && slot.bIsReady)
+			{
+				GL_ASSERT(glMakeTextureHandleNonResidentARB(slot.handle), "failed to make texture handle non resident...");
+			}
+		}
+	}
+
+	for (auto& textureArray : textureArrays_)
+	{
+		GL_ASSERT(glDeleteTextures(1, &textureArray.textureID), "failed to delete texture array object...");
+	}
+
+	textureArrays_.clear();
+	pendingSlots_.clear();
+	textureSlots_.clear();
+	slots_.clear();
+
+	slotPool_.Release();
+}
+
+int32_t TextureBindingTable::Add(const Texture2D* texture)
+{
+	ASSERT(bIsInitialized_, "not initialized texture binding table resource...");
+	ASSERT(texture->target_ == GL_TEXTURE_2D, "texture binding table only support GL_TEXTURE_2D target...");
+
+	auto textureSlot = textureSlots_.find(texture);
+	if (textureSlot != textureSlots_.end())
+	{
+		slots_[textureSlot->second].refCount++;
+		return textureSlot->second;
+	}
+
+	int32_t slot = slotPool_.Allocate();
+
+	Slot& info = slots_[slot];
+	info = Slot();
+	info.texture = texture;
+	info.refCount = 1;
+
+	textureSlots_.insert({ texture, slot });
+
+	SlotData data = { { 0, 0 }, -1, -1 };
+	slotPool_.Update(slot, &data);
+
+	if (!Resolve(slot))
+	{
+		pendingSlots_.push_back(slot);
+	}
+
+	return slot;
+}
+
+void TextureBindingTable::Remove(int32_t slot)
+{
+	ASSERT(slotPool_.IsValidElement(slot), "invalid texture binding table slot : %d", slot);
+
+	Slot& info = slots_[slot];
+	if (--info.refCount > 0)
+	{
+		return;
+	}
+
+	if (info.bIsReady)
+	{
+		if (backend_ == EBackend::Bindless)
+		{
+			GL_ASSERT(glMakeTextureHandleNonResidentARB(info.handle), "failed to make texture handle non resident...");
+		}
+		else
+		{
+			textureArrays_[info.arrayIndex].freeLayers.push(info.layer);
+		}
+	}
+	else
+	{
+		pendingSlots_.erase(std::find(pendingSlots_.begin(), pendingSlots_.end(), slot));
+	}
+
+	if (backend_ == EBackend::TextureArray || !info.bIsReady)
+	{
+		TextureResidencyManager::Get().SetStreamable(info.texture, true);
+	}
+
+	textureSlots_.erase(info.texture);
+	info = Slot();
+
+	slotPool_.Free(slot);
+}
+
+void TextureBindingTable::Bind()
+{
+	ASSERT(bIsInitialized_, "not initialized texture binding table resource...");
+
+	std::size_t pendingCount = 0;
+	for (std::size_t index = 0; index < pendingSlots_.size(); ++index)
+	{
+		if (!Resolve(pendingSlots_[index]))
+		{
+			pendingSlots_[pendingCount++] = pendingSlots_[index];
+		}
+	}
+	pendingSlots_.resize(pendingCount);
+
+	slotPool_.Flush();
+	slotPool_.Bind(SLOT_BUFFER_BINDING);
+
+	for (uint32_t index = 0; index < static_cast<uint32_t>(textureArrays_.size()); ++index)
+	{
+		GL_ASSERT(glBindTextureUnit(TEXTURE_ARRAY_UNIT + index, textureArrays_[index].textureID), "failed to bind texture array to %d texture unit...", (TEXTURE_ARRAY_UNIT + index));
+	}
+}
+
+const char* TextureBindingTable::GetShaderDefine() const
+{
+	return (backend_ == EBackend::Bindless) ? "TEXTURE_BINDLESS" : "TEXTURE_ARRAY";
+}
+
+bool TextureBindingTable::Resolve(int32_t slot)
+{
+	Slot& info = slots_[slot];
+	const Texture2D* texture = info.texture;
+
+	/** ε尡  ڿ ϵǴ ؽó Ƿ, غ  Ź Ʈ ϴ. */
+	TextureResidencyManager::Get().SetStreamable(texture, false);
+	if (!texture->IsReady() || TextureResidencyManager::Get().GetBaseLevel(texture) != 0)
+	{
+		return false;
+	}
+
+	SlotData data = { { 0, 0 }, 0, 0 };
+	if (backend_ == EBackend::Bindless)
+	{
+		info.handle = glGetTextureHandleARB(texture->textureID_);
+		ASSERT(info.handle != 0, "failed to get texture handle...");
+		GL_ASSERT(glMakeTextureHandleResidentARB(info.handle), "failed to make texture handle resident...");
+
+		data.handle[0] = static_cast<uint32_t>(info.handle & 0xFFFFFFFF);
+		data.handle[1] = static_cast<uint32_t>(info.handle >> 32);
+	}
+	else
+	{
+		AllocateLayer(texture->textureID_, info.arrayIndex, info.layer);
+
+		data.arrayIndex = info.arrayIndex;
+		data.layer = info.layer;
+
+		/** ̾ Ƿ  ؽó ٽ Ʈ  ֽϴ. */
+		TextureResidencyManager::Get().SetStreamable(texture, true);
+	}
+
+	info.bIsReady = true;
+	slotPool_.Update(slot, &data);
+
+	return true;
+}
+
+void TextureBindingTable::AllocateLayer(uint32_t textureID, int32_t& outArrayIndex, int32_t& outLayer)
+{
+	GLint internalFormat = 0;
+	GLint width = 0;
+	GLint height = 0;
+	GLint levelCount = 0;
+	GL_ASSERT(glGetTextureLevelParameteriv(textureID, 0, GL_TEXTURE_INTERNAL_FORMAT, &internalFormat), "failed to get texture internal format...");
+	GL_ASSERT(glGetTextureLevelParameteriv(textureID, 0, GL_TEXTURE_WIDTH, &width), "failed to get texture level width...");
+	GL_ASSERT(glGetTextureLevelParameteriv(textureID, 0, GL_TEXTURE_HEIGHT, &height), "failed to get texture level height...");
+	GL_ASSERT(glGetTextureParameteriv(textureID, GL_TEXTURE_IMMUTABLE_LEVELS, &levelCount), "failed to get texture immutable levels...");
+	levelCount = std::max<GLint>(levelCount, 1);
+
+	int32_t arrayIndex = -1;
+	for (std::size_t index = 0; index < textureArrays_.size(); ++index)
+	{
+		const TextureArray& textureArray = textureArrays_[index];
+		if (textureArray.internalFormat == static_cast<uint32_t>(internalFormat) && textureArray.width == width && textureArray.height == height && textureArray.levelCount == levelCount && !textureArray.freeLayers.empty())
+		{
+			arrayIndex = static_cast<int32_t>(index);
+			break;
+		}
+	}
+
+	if (arrayIndex < 0)
+	{
+		ASSERT(textureArrays_.size() < MAX_TEXTURE_ARRAY_COUNT, "overflow texture binding table texture array count : %d", MAX_TEXTURE_ARRAY_COUNT);
+
+		TextureArray textureArray;
+		textureArray.internalFormat = static_cast<uint32_t>(internalFormat);
+		textureArray.width = width;
+		textureArray.height = height;
+		textureArray.levelCount = levelCount;
+
+		for (int32_t layer = 0; layer < static_cast<int32_t>(layerCount_); ++layer)
+		{
+			textureArray.freeLayers.push(layer);
+		}
+
+		GLenum minFilter = (levelCount > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR;
+		textureArray.textureID = GLResourceUtils::CreateTexture(GL_TEXTURE_2D_ARRAY, minFilter, GL_LINEAR, GL_CLAMP_TO_EDGE);
+		GL_ASSERT(glTextureStorage3D(textureArray.textureID, levelCount, internalFormat, width, height, layerCount_), "failed to allocate texture array storage...");
+
+		arrayIndex = static_cast<int32_t>(textureArrays_.size());
+		textureArrays_.push_back(std::move(textureArray));
+	}
+
+	TextureArray& textureArray = textureArrays_[arrayIndex];
+	int32_t layer = textureArray.freeLayers.top();
+	textureArray.freeLayers.pop();
+
+	for (GLint level = 0; level < levelCount; ++level)
+	{
+		GLsizei levelWidth = std::max<GLsizei>(1, width >> level);
+		GLsizei levelHeight = std::max<GLsizei>(1, height >> level);
+
+		GL_ASSERT(glCopyImageSubData(
+			textureID, GL_TEXTURE_2D, level, 0, 0, 0,
+			textureArray.textureID, GL_TEXTURE_2D_ARRAY, level, 0, 0, layer,
+			levelWidth, levelHeight, 1
+		), "failed to copy texture to texture array layer...");
+	}
+
+	outArrayIndex = arrayIndex;
+	outLayer = layer;
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include "TextureBudgetUtils.h"
+
+#include <algorithm>
+#include <cmath>
+
+uint32_t TextureBudgetUtils::ComputeDesiredBaseLevel(const Entry& entry)
+{
+	uint32_t levelCount = static_cast<uint32_t>(entry.levelSizes.size());
+	if (!entry.bIsStreamable || levelCount <= 1)
+	{
+		return 0;
+	}
+
+	float maxSize = static_cast<float>(std::max(entry.width, entry.height));
+	if (entry.requestedSize >= maxSize)
+	{
+		return 0;
+	}
+
+	if (entry.requestedSize <= 1.0f)
+	{
+		return levelCount - 1;
+	}
+
+	uint32_t baseLevel = static_cast<uint32_t>(std::floor(std::log2(maxSize / entry.requestedSize)));
+	return std::min(baseLevel, levelCount - 1);
+}
+
+uint64_t TextureBudgetUtils::ComputeResidentSize(const Entry& entry, uint32_t baseLevel)
+{
+	uint64_t size = 0;
+	for (std::size_t level = baseLevel; level < entry.levelSizes.size(); ++level)
+	{
+		size += entry.levelSizes[level];
+	}
+
+	return size;
+}
+
+uint64_t TextureBudgetUtils::Solve(const std::vector<Entry>& entries, uint64_t budget, std::vector<uint32_t>& outBaseLevels)
+{
+	outBaseLevels.resize(entries.size());
+
+	uint64_t totalSize = 0;
+	for (std::size_t index = 0; index < entries.size(); ++index)
+	{
+		outBaseLevels[index] = ComputeDesiredBaseLevel(entries[index]);
+		totalSize += ComputeResidentSize(entries[index], outBaseLevels[index]);
+	}
+
+	while (totalSize > budget)
+	{
+		int32_t dropIndex = -1;
+		float dropDeficit = 0.0f;
+		uint64_t dropSize = 0;
+
+		for (std::size_t index = 0; index < entries.size(); ++index)
+		{
+			const Entry& entry = entries[index];
+			uint32_t baseLevel = outBaseLevels[index];
+			if (!entry.bIsStreamable || baseLevel + 1 >= entry.levelSizes.size())
+			{
+				continue;
+			}
+
+			/** Ӹ  ϳ  , û ũⰡ ϴ ػ     Ÿϴ. */
+			int32_t droppedSize = std::max(1, std::max(entry.width, entry.height) >> (baseLevel + 1));
+			float deficit = entry.requestedSize / static_cast<float>(droppedSize);
+			uint64_t levelSize = entry.levelSizes[baseLevel];
+
+			if (dropIndex < 0 || deficit < dropDeficit || (deficit == dropDeficit && levelSize > dropSize))
+			{
+				dropIndex = static_cast<int32_t>(index);
+				dropDeficit = deficit;
+				dropSize = levelSize;
+			}
+		}
+
+		if (dropIndex < 0)
+		{
+			break;
+		}
+
+		totalSize -= dropSize;
+		outBaseLevels[dropIndex]++;
+	}
+
+	return totalSize;
+}
\ No newline at end of file
@@ -0,0 +1,255 @@
+#include "TextureResidencyManager.h"
+
+#include <algorithm>
+
+#include "Assertion.h"
+#include "GLAssertion.h"
+#include "Texture2D.h"
+#include "TextureStreamManager.h"
+
+#include <glad/glad.h>
+
+/**
+ * @brief ؽó ޸ Ʈ  ⺻Դϴ.
+ */
+static const uint64_t DEFAULT_TEXTURE_BUDGET = 512ULL * 1024ULL * 1024ULL;
+
+void TextureResidencyManager::Startup()
+{
+	ASSERT(!bIsStartup_, "already startup texture residency manager...");
+
+	records_ = std::unordered_map<Texture2D*, Record>();
+	budget_ = DEFAULT_TEXTURE_BUDGET;
+	bIsDirty_ = false;
+
+	bIsStartup_ = true;
+}
+
+void TextureResidencyManager::Shutdown()
+{
+	ASSERT(bIsStartup_, "not startup before or has already been shutdowned...");
+
+	records_.clear(); // ؽó ҽ ҽ Ŵ մϴ.
+
+	bIsStartup_ = false;
+}
+
+void TextureResidencyManager::Register(Texture2D* texture)
+{
+	ASSERT(bIsStartup_, "not startup texture residency manager...");
+	ASSERT(records_.find(texture) == records_.end(), "already register texture...");
+
+	Record record;
+
+	GLint levelCount = 0;
+	GL_ASSERT(glGetTextureParameteriv(texture->textureID_, GL_TEXTURE_IMMUTABLE_LEVELS, &levelCount), "failed to get texture immutable levels...");
+	levelCount = std::max<GLint>(levelCount, 1);
+
+	for (GLint level = 0; level < levelCount; ++level)
+	{
+		GLint width = 0;
+		GLint height = 0;
+		GLint depth = 0;
+		GLint bIsCompressed = GL_FALSE;
+		GL_ASSERT(glGetTextureLevelParameteriv(texture->textureID_, level, GL_TEXTURE_WIDTH, &width), "failed to get texture level width...");
+		GL_ASSERT(glGetTextureLevelParameteriv(texture->textureID_, level, GL_TEXTURE_HEIGHT, &height), "failed to get texture level height...");
+		GL_ASSERT(glGetTextureLevelParameteriv(texture->textureID_, level, GL_TEXTURE_DEPTH, &depth), "failed to get texture level depth...");
+		GL_ASSERT(glGetTextureLevelParameteriv(texture->textureID_, level, GL_TEXTURE_COMPRESSED, &bIsCompressed), "failed to get texture level compressed...");
+
+		uint64_t size = 0;
+		if (bIsCompressed == GL_TRUE)
+		{
+			GLint compressedSize = 0;
+			GL_ASSERT(glGetTextureLevelParameteriv(texture->textureID_, level, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &compressedSize), "failed to get texture level compressed size...");
+			size = static_cast<uint64_t>(compressedSize);
+		}
+		else
+		{
+			static const GLenum channelSizes[] = { GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE, GL_TEXTURE_DEPTH_SIZE, GL_TEXTURE_STENCIL_SIZE };
+
+			GLint bitCount = 0;
+			for (GLenum channelSize : channelSizes)
+			{
+				GLint channelBitCount = 0;
+				GL_ASSERT(glGetTextureLevelParameteriv(texture->textureID_, level, channelSize, &channelBitCount), "failed to get texture level channel size...");
+				bitCount += channelBitCount;
+			}
+
+			size = static_cast<uint64_t>(width) * static_cast<uint64_t>(height) * static_cast<uint64_t>(std::max<GLint>(depth, 1)) * static_cast<uint64_t>((bitCount + 7) / 8);
+		}
+
+		record.entry.levelSizes.push_back(size);
+
+		if (level == 0)
+		{
+			record.entry.width = width;
+			record.entry.height = height;
+		}
+	}
+
+	record.entry.requestedSize = static_cast<float>(std::max(record.entry.width, record.entry.height));
+	record.entry.bIsStreamable = (texture->target_ == GL_TEXTURE_2D) && (levelCount > 1);
+
+	records_.insert({ texture, record });
+	bIsDirty_ = true;
+}
+
+void TextureResidencyManager::Unregister(Texture2D* texture)
+{
+	auto record = records_.find(texture);
+	if (record == records_.end())
+	{
+		return;
+	}
+
+	if (record->second.pendingBaseLevel != record->second.baseLevel)
+	{
+		TextureStreamManager::Get().Cancel(texture);
+	}
+
+	records_.erase(record);
+	bIsDirty_ = true;
+}
+
+void TextureResidencyManager::SetRequestedSize(const Texture2D* texture, float size)
+{
+	auto record = records_.find(const_cast<Texture2D*>(texture));
+	if (record != records_.end())
+	{
+		record->second.frameRequestedSize = std::max(record->second.frameRequestedSize, size);
+	}
+}
+
+void TextureResidencyManager::SetStreamable(const Texture2D* texture, bool bIsStreamable)
+{
+	auto record = records_.find(const_cast<Texture2D*>(texture));
+	if (record == records_.end())
+	{
+		return;
+	}
+
+	TextureBudgetUtils::Entry& entry = record->second.entry;
+	bIsStreamable = bIsStreamable && (texture->target_ == GL_TEXTURE_2D) && (entry.levelSizes.size() > 1);
+
+	bIsDirty_ |= (entry.bIsStreamable != bIsStreamable);
+	entry.bIsStreamable = bIsStreamable;
+}
+
+void TextureResidencyManager::Tick()
+{
+	ASSERT(bIsStartup_, "not startup texture residency manager...");
+
+	for (auto& record : records_)
+	{
+		Record& info = record.second;
+
+		if (info.frameRequestedSize >= 0.0f)
+		{
+			bIsDirty_ |= (info.frameRequestedSize != info.entry.requestedSize);
+			info.entry.requestedSize = info.frameRequestedSize;
+			info.frameRequestedSize = -1.0f;
+		}
+
+		/** ؽó Ʈ Ŵ ε带 ġ鼭  Ӹ  ߽ϴ. */
+		if (info.pendingBaseLevel != info.baseLevel && !TextureStreamManager::Get().IsPending(record.first))
+		{
+			info.baseLevel = info.pendingBaseLevel;
+		}
+	}
+
+	if (!bIsDirty_)
+	{
+		return;
+	}
+
+	bIsDirty_ = false;
+
+	std::vector<Texture2D*> textures;
+	std::vector<TextureBudgetUtils::Entry> entries;
+	textures.reserve(records_.size());
+	entries.reserve(records_.size());
+
+	for (const auto& record : records_)
+	{
+		textures.push_back(record.first);
+		entries.push_back(record.second.entry);
+	}
+
+	std::vector<uint32_t> baseLevels;
+	TextureBudgetUtils::Solve(entries, budget_, baseLevels);
+
+	for (std::size_t index = 0; index < textures.size(); ++index)
+	{
+		Texture2D* texture = textures[index];
+		Record& record = records_.at(texture);
+		uint32_t baseLevel = baseLevels[index];
+
+		if (baseLevel == record.pendingBaseLevel)
+		{
+			continue;
+		}
+
+		if (record.pendingBaseLevel != record.baseLevel)
+		{
+			TextureStreamManager::Get().Cancel(texture);
+			record.pendingBaseLevel = record.baseLevel;
+		}
+
+		if (baseLevel > record.baseLevel)
+		{
+			Evict(texture, record, baseLevel);
+		}
+		else if (baseLevel < record.baseLevel)
+		{
+			TextureStreamManager::Get().RequestLevels(texture, baseLevel, record.baseLevel);
+			record.pendingBaseLevel = baseLevel;
+		}
+	}
+}
+
+void TextureResidencyManager::SetBudget(uint64_t budget)
+{
+	bIsDirty_ |= (budget_ != budget);
+	budget_ = budget;
+}
+
+uint64_t TextureResidencyManager::GetResidentSize() const
+{
+	uint64_t size = 0;
+	for (const auto& record : records_)
+	{
+		size += TextureBudgetUtils::ComputeResidentSize(record.second.entry, record.second.baseLevel);
+	}
+
+	return size;
+}
+
+uint64_t TextureResidencyManager::GetTotalSize() const
+{
+	uint64_t size = 0;
+	for (const auto& record : records_)
+	{
+		size += TextureBudgetUtils::ComputeResidentSize(record.second.entry, 0);
+	}
+
+	return size;
+}
+
+uint32_t TextureResidencyManager::GetBaseLevel(const Texture2D* texture) const
+{
+	auto record = records_.find(const_cast<Texture2D*>(texture));
+	return (record != records_.end()) ? record->second.baseLevel : 0;
+}
+
+void TextureResidencyManager::Evict(const Texture2D* texture, Record& record, uint32_t baseLevel)
+{
+	GL_ASSERT(glTextureParameteri(texture->textureID_, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(baseLevel)), "failed to set texture object base level...");
+
+	for (uint32_t level = record.baseLevel; level < baseLevel; ++level)
+	{
+		GL_ASSERT(glInvalidateTexImage(texture->textureID_, static_cast<GLint>(level)), "failed to invalidate texture level...");
+	}
+
+	record.baseLevel = baseLevel;
+	record.pendingBaseLevel = baseLevel;
+}
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "Assertion.h"
 #include "GLAssertion.h"
+#include "GLResourceUtils.h"
 #include "MathUtils.h"
 #include "Texture2D.h"
 
@@ -21,23 +22,11 @@ void TextureShader2D::Initialize(const std::wstring& vsPath, const std::wstring&
 
 	Shader::Initialize(vsPath, fsPath);
 
-	GL_ASSERT(glGenVertexArrays(1, &vertexArrayObject_), "failed to generate 2d texture vertex array...");
-	GL_ASSERT(glGenBuffers(1, &vertexBufferObject_), "failed to generate 2d texture vertex buffer...");
-
-	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind 2d texture vertex array...");
-	GL_ASSERT(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind 2d texture vertex buffer...");
-	GL_ASSERT(glBufferData(GL_ARRAY_BUFFER, VertexPositionTexture::GetStride() * vertices_.size(), reinterpret_cast<const void*>(vertices_.data()), GL_DYNAMIC_DRAW),
-		"failed to create a new data store for a 2d texture buffer object...");
-
-	GL_ASSERT(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, VertexPositionTexture::GetStride(), (void*)(offsetof(VertexPositionTexture, position_))),
-		"failed to specify the location and data format of the array of generic vertex attributes at index...");
-	GL_ASSERT(glEnableVertexAttribArray(0), "failed to enable vertex attrib array...");
-
-	GL_ASSERT(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, VertexPositionTexture::GetStride(), (void*)(offsetof(VertexPositionTexture, uv_))),
-		"failed to specify the location and data format of the array of generic vertex attributes at index...");
-	GL_ASSERT(glEnableVertexAttribArray(1), "failed to enable vertex attrib array...");
-
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind 2d texture vertex array...");
+	vertexBufferObject_ = GLResourceUtils::CreateBuffer(VertexPositionTexture::GetStride() * vertices_.size(), reinterpret_cast<const void*>(vertices_.data()), GL_DYNAMIC_STORAGE_BIT);
+	vertexArrayObject_ = GLResourceUtils::CreateVertexArray(vertexBufferObject_, VertexPositionTexture::GetStride(), {
+		{ 0, 3, static_cast<uint32_t>(offsetof(VertexPositionTexture, position_)) },
+		{ 1, 2, static_cast<uint32_t>(offsetof(VertexPositionTexture, uv_))       },
+	});
 }
 
 void TextureShader2D::Release()
@@ -50,6 +39,15 @@ void TextureShader2D::Release()
 	GL_ASSERT(glDeleteVertexArrays(1, &vertexArrayObject_), "failed to delete 2d texture vertex array object...");
 }
 
+void TextureShader2D::OnReady()
+{
+	transformHandle_ = GetUniformHandle("transform");
+	orthoHandle_ = GetUniformHandle("ortho");
+	activeOutlineHandle_ = GetUniformHandle("bIsActiveOutline");
+	transparentHandle_ = GetUniformHandle("transparent");
+	outlineRGBAHandle_ = GetUniformHandle("outlineRGBA");
+}
+
 void TextureShader2D::DrawTexture2D(const Matrix4x4f& ortho, const Texture2D* texture, const Vector2f& center, float width, float height, float rotate, float transparent)
 {
 	uint32_t vertexCount = 0;
@@ -222,6 +220,11 @@ void TextureShader2D::DrawOutlineTexture2D(const Matrix4x4f& ortho, const Textur
 
 void TextureShader2D::DrawTexture2D(const Matrix4x4f& transform, const Matrix4x4f& ortho, uint32_t vertexCount, const Texture2D* texture, bool bIsActiveOutline, float transparent, const Vector4f& outline)
 {
+	if (!IsReady())
+	{
+		return;
+	}
+
 	const void* bufferPtr = reinterpret_cast<const void*>(vertices_.data());
 	uint32_t bufferByteSize = static_cast<uint32_t>(VertexPositionTexture::GetStride() * vertices_.size());
 	WriteDynamicVertexBuffer(vertexBufferObject_, bufferPtr, bufferByteSize);
@@ -230,11 +233,11 @@ void TextureShader2D::DrawTexture2D(const Matrix4x4f& transform, const Matrix4x4
 
 	texture->Active(0);
 
-	Shader::SetUniform("transform", transform);
-	Shader::SetUniform("ortho", ortho);
-	Shader::SetUniform("bIsActiveOutline", bIsActiveOutline);
-	Shader::SetUniform("transparent", transparent);
-	Shader::SetUniform("outlineRGBA", outline);
+	Shader::SetUniform(transformHandle_, transform);
+	Shader::SetUniform(orthoHandle_, ortho);
+	Shader::SetUniform(activeOutlineHandle_, bIsActiveOutline);
+	Shader::SetUniform(transparentHandle_, transparent);
+	Shader::SetUniform(outlineRGBAHandle_, outline);
 
 	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind 2d texture vertex array...");
 	GL_ASSERT(glDrawArrays(GL_TRIANGLES, 0, vertexCount), "failed to draw 2d texture...");
@@ -235,6 +235,13 @@ public:
 	);
 
 
+protected:
+	/**
+	 * @brief ̴ α׷ ũ    ڵ ϴ.
+	 */
+	virtual void OnReady() override;
+
+
 private:
 	/**
 	 * @brief 2D ؽó ׸⸦ ϴ ̴ ο ϴ Դϴ.
@@ -405,4 +412,34 @@ private:
 	 * @brief    ƮԴϴ.
 	 */
 	uint32_t vertexArrayObject_ = 0;
+
+
+	/**
+	 * @brief 2 ؽó ȯ    ڵԴϴ.
+	 */
+	UniformHandle transformHandle_;
+
+
+	/**
+	 * @brief ũ      ڵԴϴ.
+	 */
+	UniformHandle orthoHandle_;
+
+
+	/**
+	 * @brief ܰ Ȱȭ    ڵԴϴ.
+	 */
+	UniformHandle activeOutlineHandle_;
+
+
+	/**
+	 * @brief ؽó    ڵԴϴ.
+	 */
+	UniformHandle transparentHandle_;
+
+
+	/**
+	 * @brief ܰ    ڵԴϴ.
+	 */
+	UniformHandle outlineRGBAHandle_;
 };
\ No newline at end of file
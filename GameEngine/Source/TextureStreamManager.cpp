@@ -0,0 +1,360 @@
+#include "TextureStreamManager.h"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "Assertion.h"
+#include "FileUtils.h"
+#include "GLAssertion.h"
+#include "GLResourceUtils.h"
+#include "ResourceManager.h"
+#include "RingBuffer.h"
+#include "StringUtils.h"
+#include "TaskManager.h"
+#include "Texture2D.h"
+#include "TextureResidencyManager.h"
+#include "TextureUtils.h"
+
+#include <glad/glad.h>
+
+/**
+ * @brief ¡    ũԴϴ.
+ *
+ * @note  ũ⺸ ū Ӹ  ¡ ۸ ġ ʰ ٷ εմϴ.
+ */
+static const uint32_t STAGING_FRAME_SIZE = 8 * 1024 * 1024;
+
+/**
+ * @brief Ӵ ε Ʈ  ⺻Դϴ.
+ */
+static const uint32_t DEFAULT_UPLOAD_BUDGET = 4 * 1024 * 1024;
+
+struct TextureStreamManager::Level
+{
+	int32_t level;
+	uint32_t offset;
+	uint32_t size;
+	int32_t width;
+	int32_t height;
+};
+
+/**
+ * @note bIsDecoded true Ǳ  û  ʹ ۾ 常 մϴ.
+ */
+struct TextureStreamManager::LoadRequest
+{
+	Texture2D* texture = nullptr;
+	std::wstring path;
+	std::atomic<bool> bIsDecoded = false;
+	bool bIsRestore = false;
+	uint32_t baseLevel = 0;
+	uint32_t endLevel = UINT32_MAX;
+	bool bIsCompressed = false;
+	bool bIsGenerateMipmap = false;
+	uint32_t internalFormat = 0;
+	uint32_t format = 0;
+	uint32_t type = 0;
+	int32_t width = 0;
+	int32_t height = 0;
+	int32_t storageLevelCount = 0;
+	DecodedImage image;
+	std::vector<uint8_t> buffer;
+	const uint8_t* data = nullptr;
+	std::vector<Level> levels;
+	uint32_t nextLevel = 0;
+	uint32_t textureID = 0;
+};
+
+void TextureStreamManager::Startup()
+{
+	ASSERT(!bIsStartup_, "already startup texture stream manager...");
+
+	requests_ = std::deque<std::shared_ptr<LoadRequest>>();
+	uploadBudget_ = DEFAULT_UPLOAD_BUDGET;
+
+	stagingBuffer_ = ResourceManager::Get().CreateResource<RingBuffer>("TextureStagingBuffer");
+	stagingBuffer_->Initialize(STAGING_FRAME_SIZE, 16);
+
+	const uint8_t placeholder[4] = { 128, 128, 128, 255 };
+	placeholderTextureID_ = GLResourceUtils::CreateTexture(GL_TEXTURE_2D, GL_NEAREST, GL_NEAREST, GL_REPEAT);
+	GL_ASSERT(glTextureStorage2D(placeholderTextureID_, 1, GL_RGBA8, 1, 1), "failed to allocate placeholder texture storage...");
+	GL_ASSERT(glTextureSubImage2D(placeholderTextureID_, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, placeholder), "failed to upload placeholder texture...");
+
+	bIsStartup_ = true;
+}
+
+void TextureStreamManager::Shutdown()
+{
+	ASSERT(bIsStartup_, "not startup before or has already been shutdowned...");
+
+	requests_.clear(); // ε  ؽó ҽ ؽó մϴ.
+
+	GL_ASSERT(glDeleteTextures(1, &placeholderTextureID_), "failed to delete placeholder texture object...");
+	placeholderTextureID_ = 0;
+
+	stagingBuffer_ = nullptr; // ¡ ۴ ҽ Ŵ մϴ.
+
+	bIsStartup_ = false;
+}
+
+void TextureStreamManager::Request(Texture2D* texture, const std::wstring& path)
+{
+	ASSERT(bIsStartup_, "not startup texture stream manager...");
+	ASSERT(TextureUtils::IsSupportExtension(path), L"%s is not support extension...", path.c_str());
+
+	std::shared_ptr<LoadRequest> request = std::make_shared<LoadRequest>();
+	request->texture = texture;
+	request->path = path;
+
+	requests_.push_back(request);
+
+	TaskManager::Get().Submit([request]() { Decode(*request); });
+}
+
+void TextureStreamManager::RequestLevels(Texture2D* texture, uint32_t baseLevel, uint32_t endLevel)
+{
+	ASSERT(bIsStartup_, "not startup texture stream manager...");
+	ASSERT(texture->IsReady(), "texture is not ready to restore levels...");
+	ASSERT(baseLevel < endLevel, "invalid restore level range : (base : %d, end : %d)", baseLevel, endLevel);
+
+	std::shared_ptr<LoadRequest> request = std::make_shared<LoadRequest>();
+	request->texture = texture;
+	request->path = texture->path_;
+	request->bIsRestore = true;
+	request->baseLevel = baseLevel;
+	request->endLevel = endLevel;
+	request->textureID = texture->textureID_;
+
+	requests_.push_back(request);
+
+	TaskManager::Get().Submit([request]() { Decode(*request); });
+}
+
+void TextureStreamManager::Cancel(Texture2D* texture)
+{
+	auto request = std::find_if(requests_.begin(), requests_.end(), [&](const std::shared_ptr<LoadRequest>& request) { return request->texture == texture; });
+	if (request != requests_.end())
+	{
+		requests_.erase(request); // ڵ  û ۾ 尡    Ͱ մϴ.
+	}
+}
+
+bool TextureStreamManager::IsPending(const Texture2D* texture) const
+{
+	return std::any_of(requests_.begin(), requests_.end(), [&](const std::shared_ptr<LoadRequest>& request) { return request->texture == texture; });
+}
+
+void TextureStreamManager::Tick()
+{
+	ASSERT(bIsStartup_, "not startup texture stream manager...");
+
+	if (requests_.empty())
+	{
+		return;
+	}
+
+	stagingBuffer_->BeginFrame();
+
+	GL_ASSERT(glPixelStorei(GL_UNPACK_ALIGNMENT, 1), "failed to set pixel storage modes...");
+
+	uint32_t uploadSize = 0;
+	for (auto it = requests_.begin(); it != requests_.end() && uploadSize < uploadBudget_;)
+	{
+		LoadRequest& request = **it;
+		if (!request.bIsDecoded.load(std::memory_order_acquire))
+		{
+			++it;
+			continue;
+		}
+
+		if (request.textureID == 0)
+		{
+			GLenum minFilter = (request.storageLevelCount > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR;
+
+			request.textureID = GLResourceUtils::CreateTexture(GL_TEXTURE_2D, minFilter, GL_LINEAR, GL_CLAMP_TO_EDGE);
+			GL_ASSERT(glTextureStorage2D(request.textureID, request.storageLevelCount, request.internalFormat, request.width, request.height), "failed to allocate texture storage...");
+
+			request.texture->textureID_ = request.textureID;
+		}
+
+		while (request.nextLevel < request.levels.size())
+		{
+			const Level& level = request.levels[request.nextLevel];
+			bool bIsFitStagingBuffer = level.size <= stagingBuffer_->GetFrameRemainSize();
+
+			if (uploadSize > 0 && (uploadSize + level.size > uploadBudget_ || (!bIsFitStagingBuffer && level.size <= STAGING_FRAME_SIZE)))
+			{
+				break;
+			}
+
+			UploadLevel(request, level, bIsFitStagingBuffer);
+
+			uploadSize += level.size;
+			request.nextLevel++;
+		}
+
+		if (request.nextLevel < request.levels.size())
+		{
+			break;
+		}
+
+		if (request.bIsGenerateMipmap)
+		{
+			GL_ASSERT(glTextureParameteri(request.textureID, GL_TEXTURE_BASE_LEVEL, 0), "failed to set texture object base level...");
+			GL_ASSERT(glGenerateTextureMipmap(request.textureID), "failed to generate texture mipmap...");
+		}
+
+		if (request.bIsRestore)
+		{
+			GL_ASSERT(glTextureParameteri(request.textureID, GL_TEXTURE_BASE_LEVEL, request.baseLevel), "failed to set texture object base level...");
+		}
+		else
+		{
+			request.texture->bIsReady_ = true;
+			TextureResidencyManager::Get().Register(request.texture);
+		}
+
+		it = requests_.erase(it);
+	}
+
+	GL_ASSERT(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0), "failed to unbind pixel unpack buffer...");
+	GL_ASSERT(glPixelStorei(GL_UNPACK_ALIGNMENT, 4), "failed to set pixel storage modes...");
+
+	stagingBuffer_->EndFrame();
+}
+
+void TextureStreamManager::Decode(LoadRequest& request)
+{
+	std::wstring extension = StringUtils::ToLower(FileUtils::GetFileExtension(request.path));
+	if (extension == L"astc")
+	{
+		EAstcBlockSize blockSize = EAstcBlockSize::None;
+		TextureUtils::LoadAstcFromFile(request.path, request.buffer, blockSize);
+		request.data = request.buffer.data();
+
+		const AstcFileHeader* header = reinterpret_cast<const AstcFileHeader*>(request.buffer.data());
+		int32_t xsize = header->xsize[0] + (header->xsize[1] << 8) + (header->xsize[2] << 16);
+		int32_t ysize = header->ysize[0] + (header->ysize[1] << 8) + (header->ysize[2] << 16);
+		int32_t zsize = header->zsize[0] + (header->zsize[1] << 8) + (header->zsize[2] << 16);
+		int32_t xblocks = (xsize + header->blockdimX - 1) / header->blockdimX;
+		int32_t yblocks = (ysize + header->blockdimY - 1) / header->blockdimY;
+		int32_t zblocks = (zsize + header->blockdimZ - 1) / header->blockdimZ;
+
+		request.bIsCompressed = true;
+		request.internalFormat = static_cast<uint32_t>(blockSize);
+		request.width = xsize;
+		request.height = ysize;
+		request.storageLevelCount = 1; //  ؽó Ӹ   ϴ.
+		request.levels.push_back(Level{ 0, sizeof(AstcFileHeader), static_cast<uint32_t>((xblocks * yblocks * zblocks) << 4), xsize, ysize });
+	}
+	else if (extension == L"dds" || extension == L"ktx2")
+	{
+		TextureContainer container;
+		TextureUtils::LoadContainerFromFile(request.path, container);
+		ASSERT(container.GetTarget() == GL_TEXTURE_2D, L"%s is not 2d texture container...", request.path.c_str());
+
+		request.bIsCompressed = container.bIsCompressed;
+		request.internalFormat = container.internalFormat;
+		request.format = container.format;
+		request.type = container.type;
+		request.width = container.width;
+		request.height = container.height;
+		request.storageLevelCount = static_cast<int32_t>(container.levelCount);
+
+		for (const auto& subImage : container.subImages)
+		{
+			if (request.baseLevel <= subImage.level && subImage.level < request.endLevel)
+			{
+				request.levels.push_back(Level{ static_cast<int32_t>(subImage.level), static_cast<uint32_t>(subImage.offset), static_cast<uint32_t>(subImage.size), subImage.width, subImage.height });
+			}
+		}
+
+		request.buffer = std::move(container.buffer);
+		request.data = request.buffer.data();
+	}
+	else
+	{
+		TextureUtils::LoadImageFromFile(request.path, request.image);
+
+		request.data = request.image.buffer.get();
+		request.width = request.image.width;
+		request.height = request.image.height;
+		request.format = TextureUtils::FindTextureFormatFromChannel(request.image.channels);
+		request.type = GL_UNSIGNED_BYTE;
+		request.internalFormat = TextureUtils::FindInternalFormatFromChannel(request.image.channels);
+		ASSERT(request.internalFormat != 0xFFFF, "%d is not support image channel...", request.image.channels);
+
+		request.storageLevelCount = TextureUtils::ComputeMipLevelCount(request.width, request.height);
+
+		if (request.bIsRestore)
+		{
+			/** Ӹ  0 ü Ӹ ٽ  ʰ,  Ӹ  CPU ٿ εմϴ. */
+			uint32_t endLevel = std::min<uint32_t>(request.endLevel, static_cast<uint32_t>(request.storageLevelCount));
+			int32_t channels = request.image.channels;
+
+			std::size_t bufferSize = 0;
+			for (uint32_t level = request.baseLevel; level < endLevel; ++level)
+			{
+				int32_t width = std::max<int32_t>(1, request.width >> level);
+				int32_t height = std::max<int32_t>(1, request.height >> level);
+				uint32_t size = static_cast<uint32_t>(width * height * channels);
+
+				request.levels.push_back(Level{ static_cast<int32_t>(level), static_cast<uint32_t>(bufferSize), size, width, height });
+				bufferSize += size;
+			}
+
+			request.buffer.resize(bufferSize);
+
+			const uint8_t* src = request.image.buffer.get();
+			int32_t srcWidth = request.width;
+			int32_t srcHeight = request.height;
+			for (const auto& level : request.levels)
+			{
+				uint8_t* dst = request.buffer.data() + level.offset;
+				TextureUtils::ResizeImage(src, srcWidth, srcHeight, channels, dst, level.width, level.height);
+
+				src = dst;
+				srcWidth = level.width;
+				srcHeight = level.height;
+			}
+
+			request.image.buffer.reset();
+			request.data = request.buffer.data();
+		}
+		else
+		{
+			request.bIsGenerateMipmap = true;
+			request.levels.push_back(Level{ 0, 0, static_cast<uint32_t>(request.image.GetSize()), request.width, request.height });
+		}
+	}
+
+	request.bIsDecoded.store(true, std::memory_order_release);
+}
+
+void TextureStreamManager::UploadLevel(LoadRequest& request, const Level& level, bool bIsUseStagingBuffer)
+{
+	int32_t levelIndex = level.level;
+	const void* pixels = request.data + level.offset;
+
+	if (bIsUseStagingBuffer)
+	{
+		uint32_t offset = stagingBuffer_->Write(pixels, level.size);
+		pixels = reinterpret_cast<const void*>(static_cast<std::size_t>(offset));
+
+		GL_ASSERT(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stagingBuffer_->GetBufferObject()), "failed to bind pixel unpack buffer...");
+	}
+	else
+	{
+		GL_ASSERT(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0), "failed to unbind pixel unpack buffer...");
+	}
+
+	if (request.bIsCompressed)
+	{
+		GL_ASSERT(glCompressedTextureSubImage2D(request.textureID, levelIndex, 0, 0, level.width, level.height, request.internalFormat, level.size, pixels), "failed to upload compressed texture level...");
+	}
+	else
+	{
+		GL_ASSERT(glTextureSubImage2D(request.textureID, levelIndex, 0, 0, level.width, level.height, request.format, request.type, pixels), "failed to upload texture level...");
+	}
+}
\ No newline at end of file
@@ -2,12 +2,18 @@
 
 #include "Assertion.h"
 #include "FileUtils.h"
+#include "GLAssertion.h"
+#include "GLResourceUtils.h"
 #include "StringUtils.h"
+#include "TaskManager.h"
 
+#include <algorithm>
 #include <array>
+#include <cstring>
 #include <unordered_map>
 
 #include <stb_image.h>
+#include <stb_image_resize.h>
 
 std::unordered_map<EAstcBlockSize, std::wstring> blockSizeMaps = {
 	{ EAstcBlockSize::ASTC_4x4,   L"4x4"   },
@@ -26,16 +32,306 @@ std::unordered_map<EAstcBlockSize, std::wstring> blockSizeMaps = {
 	{ EAstcBlockSize::ASTC_12x12, L"12x12" },
 };
 
-std::array<std::wstring, 7> supportExtensions = {
+std::array<std::wstring, 8> supportExtensions = {
 	L"jpeg",
 	L"jpg",
 	L"png",
 	L"tga",
 	L"bmp",
 	L"astc", //  
-	L"dds",  //  
+	L"dds",  // ؽó ̳
+	L"ktx2", // ؽó ̳
 };
 
+/**
+ * @brief ؽó ̳ ȼ 信 ϴ OpenGL Դϴ.
+ *
+ * @note blockSize  ̸ 4x4  ϳ Ʈ ũ,  ̸ ȼ ϳ Ʈ ũԴϴ.
+ */
+struct ContainerFormat
+{
+	uint32_t code;
+	bool bIsCompressed;
+	GLenum internalFormat;
+	GLenum format;
+	GLenum type;
+	uint32_t blockSize;
+};
+
+/**
+ * @brief DXGI_FORMAT OpenGL   ǥԴϴ.
+ *
+ * @see https://learn.microsoft.com/en-us/windows/win32/api/dxgiformat/ne-dxgiformat-dxgi_format
+ */
+static const ContainerFormat dxgiFormats[] = {
+	{ 28, false, GL_RGBA8,         GL_RGBA, GL_UNSIGNED_BYTE, 4  }, // R8G8B8A8_UNORM
+	{ 29, false, GL_SRGB8_ALPHA8,  GL_RGBA, GL_UNSIGNED_BYTE, 4  }, // R8G8B8A8_UNORM_SRGB
+	{ 71, true,  0x83F1,           0,       0,                8  }, // BC1_UNORM
+	{ 72, true,  0x8C4D,           0,       0,                8  }, // BC1_UNORM_SRGB
+	{ 74, true,  0x83F2,           0,       0,                16 }, // BC2_UNORM
+	{ 75, true,  0x8C4E,           0,       0,                16 }, // BC2_UNORM_SRGB
+	{ 77, true,  0x83F3,           0,       0,                16 }, // BC3_UNORM
+	{ 78, true,  0x8C4F,           0,       0,                16 }, // BC3_UNORM_SRGB
+	{ 80, true,  0x8DBB,           0,       0,                8  }, // BC4_UNORM
+	{ 81, true,  0x8DBC,           0,       0,                8  }, // BC4_SNORM
+	{ 83, true,  0x8DBD,           0,       0,                16 }, // BC5_UNORM
+	{ 84, true,  0x8DBE,           0,       0,                16 }, // BC5_SNORM
+	{ 95, true,  0x8E8F,           0,       0,                16 }, // BC6H_UF16
+	{ 96, true,  0x8E8E,           0,       0,                16 }, // BC6H_SF16
+	{ 98, true,  0x8E8C,           0,       0,                16 }, // BC7_UNORM
+	{ 99, true,  0x8E8D,           0,       0,                16 }, // BC7_UNORM_SRGB
+};
+
+/**
+ * @brief DDS ȼ  FourCC OpenGL   ǥԴϴ.
+ */
+static const ContainerFormat fourCCFormats[] = {
+	{ FOURCC_DXT1, true, 0x83F1, 0, 0, 8  },
+	{ FOURCC_DXT3, true, 0x83F2, 0, 0, 16 },
+	{ FOURCC_DXT5, true, 0x83F3, 0, 0, 16 },
+	{ FOURCC_ATI1, true, 0x8DBB, 0, 0, 8  },
+	{ FOURCC_BC4U, true, 0x8DBB, 0, 0, 8  },
+	{ FOURCC_BC4S, true, 0x8DBC, 0, 0, 8  },
+	{ FOURCC_ATI2, true, 0x8DBD, 0, 0, 16 },
+	{ FOURCC_BC5U, true, 0x8DBD, 0, 0, 16 },
+	{ FOURCC_BC5S, true, 0x8DBE, 0, 0, 16 },
+};
+
+/**
+ * @brief VkFormat OpenGL   ǥԴϴ.
+ *
+ * @note ASTC  Ģ ϹǷ FindVkFormat մϴ.
+ *
+ * @see https://registry.khronos.org/vulkan/specs/1.3/html/vkspec.html#VkFormat
+ */
+static const ContainerFormat vkFormats[] = {
+	{ 9,   false, GL_R8,           GL_RED,  GL_UNSIGNED_BYTE, 1  }, // R8_UNORM
+	{ 16,  false, GL_RG8,          GL_RG,   GL_UNSIGNED_BYTE, 2  }, // R8G8_UNORM
+	{ 23,  false, GL_RGB8,         GL_RGB,  GL_UNSIGNED_BYTE, 3  }, // R8G8B8_UNORM
+	{ 29,  false, GL_SRGB8,        GL_RGB,  GL_UNSIGNED_BYTE, 3  }, // R8G8B8_SRGB
+	{ 37,  false, GL_RGBA8,        GL_RGBA, GL_UNSIGNED_BYTE, 4  }, // R8G8B8A8_UNORM
+	{ 43,  false, GL_SRGB8_ALPHA8, GL_RGBA, GL_UNSIGNED_BYTE, 4  }, // R8G8B8A8_SRGB
+	{ 97,  false, GL_RGBA16F,      GL_RGBA, GL_HALF_FLOAT,    8  }, // R16G16B16A16_SFLOAT
+	{ 109, false, GL_RGBA32F,      GL_RGBA, GL_FLOAT,         16 }, // R32G32B32A32_SFLOAT
+	{ 131, true,  0x83F0,          0,       0,                8  }, // BC1_RGB_UNORM_BLOCK
+	{ 132, true,  0x8C4C,          0,       0,                8  }, // BC1_RGB_SRGB_BLOCK
+	{ 133, true,  0x83F1,          0,       0,                8  }, // BC1_RGBA_UNORM_BLOCK
+	{ 134, true,  0x8C4D,          0,       0,                8  }, // BC1_RGBA_SRGB_BLOCK
+	{ 135, true,  0x83F2,          0,       0,                16 }, // BC2_UNORM_BLOCK
+	{ 136, true,  0x8C4E,          0,       0,                16 }, // BC2_SRGB_BLOCK
+	{ 137, true,  0x83F3,          0,       0,                16 }, // BC3_UNORM_BLOCK
+	{ 138, true,  0x8C4F,          0,       0,                16 }, // BC3_SRGB_BLOCK
+	{ 139, true,  0x8DBB,          0,       0,                8  }, // BC4_UNORM_BLOCK
+	{ 140, true,  0x8DBC,          0,       0,                8  }, // BC4_SNORM_BLOCK
+	{ 141, true,  0x8DBD,          0,       0,                16 }, // BC5_UNORM_BLOCK
+	{ 142, true,  0x8DBE,          0,       0,                16 }, // BC5_SNORM_BLOCK
+	{ 143, true,  0x8E8F,          0,       0,                16 }, // BC6H_UFLOAT_BLOCK
+	{ 144, true,  0x8E8E,          0,       0,                16 }, // BC6H_SFLOAT_BLOCK
+	{ 145, true,  0x8E8C,          0,       0,                16 }, // BC7_UNORM_BLOCK
+	{ 146, true,  0x8E8D,          0,       0,                16 }, // BC7_SRGB_BLOCK
+};
+
+/**
+ * @brief KTX2  ĺԴϴ.
+ */
+static const uint8_t KTX2_IDENTIFIER[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+/**
+ * @brief  ǥ ڵ忡 شϴ  ãϴ.
+ */
+template <std::size_t Size>
+static const ContainerFormat* FindContainerFormat(const ContainerFormat (&formats)[Size], uint32_t code)
+{
+	for (const auto& format : formats)
+	{
+		if (format.code == code)
+		{
+			return &format;
+		}
+	}
+
+	return nullptr;
+}
+
+/**
+ * @brief VkFormat ϴ OpenGL  ãϴ.
+ */
+static bool FindVkFormat(uint32_t vkFormat, ContainerFormat& outFormat)
+{
+	static const uint32_t VK_FORMAT_ASTC_4x4_UNORM_BLOCK = 157;
+	static const uint32_t VK_FORMAT_ASTC_12x12_SRGB_BLOCK = 184;
+
+	if (VK_FORMAT_ASTC_4x4_UNORM_BLOCK <= vkFormat && vkFormat <= VK_FORMAT_ASTC_12x12_SRGB_BLOCK)
+	{
+		uint32_t blockIndex = (vkFormat - VK_FORMAT_ASTC_4x4_UNORM_BLOCK) / 2;
+		bool bIsSrgb = ((vkFormat - VK_FORMAT_ASTC_4x4_UNORM_BLOCK) % 2) == 1;
+
+		outFormat = ContainerFormat{ vkFormat, true, (bIsSrgb ? 0x93D0u : 0x93B0u) + blockIndex, 0, 0, 16 };
+		return true;
+	}
+
+	const ContainerFormat* format = FindContainerFormat(vkFormats, vkFormat);
+	if (format == nullptr)
+	{
+		return false;
+	}
+
+	outFormat = *format;
+	return true;
+}
+
+/**
+ * @brief ؽó ̳ʿ   մϴ.
+ */
+static void SetContainerFormat(const ContainerFormat& format, TextureContainer& outContainer)
+{
+	outContainer.bIsCompressed = format.bIsCompressed;
+	outContainer.internalFormat = format.internalFormat;
+	outContainer.format = format.format;
+	outContainer.type = format.type;
+}
+
+/**
+ * @brief DDS  а  ̹ մϴ.
+ */
+static void LoadDDSContainer(const std::wstring& path, TextureContainer& outContainer)
+{
+	static const uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+	static const uint32_t DDPF_FOURCC = 0x4;
+	static const uint32_t DDPF_RGB = 0x40;
+	static const uint32_t DDSCAPS2_CUBEMAP = 0x200;
+	static const uint32_t DDS_RESOURCE_MISC_TEXTURECUBE = 0x4;
+	static const uint32_t DDS_DIMENSION_TEXTURE3D = 4;
+
+	const std::vector<uint8_t>& buffer = outContainer.buffer;
+	ASSERT(buffer.size() >= sizeof(DDSFileHeader) && std::memcmp(buffer.data(), "DDS ", 4) == 0, L"invalid %s dds file code...", path.c_str());
+
+	const DDSFileHeader* header = reinterpret_cast<const DDSFileHeader*>(buffer.data());
+	std::size_t offset = sizeof(DDSFileHeader);
+
+	ContainerFormat format = {};
+	uint32_t layerCount = 1;
+	uint32_t faceCount = (header->dwCaps2 & DDSCAPS2_CUBEMAP) ? 6 : 1;
+
+	if ((header->dwPixelFlags & DDPF_FOURCC) && header->dwFourCC == FOURCC_DX10)
+	{
+		ASSERT(buffer.size() >= offset + sizeof(DDSHeaderDX10), L"invalid %s dds dx10 header...", path.c_str());
+
+		const DDSHeaderDX10* headerDX10 = reinterpret_cast<const DDSHeaderDX10*>(buffer.data() + offset);
+		offset += sizeof(DDSHeaderDX10);
+
+		ASSERT(headerDX10->resourceDimension != DDS_DIMENSION_TEXTURE3D, L"%s is 3d texture, not support...", path.c_str());
+
+		const ContainerFormat* dxgiFormat = FindContainerFormat(dxgiFormats, headerDX10->dxgiFormat);
+		ASSERT(dxgiFormat != nullptr, "%d is not support dxgi format...", headerDX10->dxgiFormat);
+
+		format = *dxgiFormat;
+		layerCount = (headerDX10->arraySize == 0) ? 1 : headerDX10->arraySize;
+		faceCount = (headerDX10->miscFlag & DDS_RESOURCE_MISC_TEXTURECUBE) ? 6 : 1;
+	}
+	else if (header->dwPixelFlags & DDPF_FOURCC)
+	{
+		const ContainerFormat* fourCCFormat = FindContainerFormat(fourCCFormats, header->dwFourCC);
+		ASSERT(fourCCFormat != nullptr, "%d is not support dds four cc...", header->dwFourCC);
+
+		format = *fourCCFormat;
+	}
+	else
+	{
+		bool bIsRGBA8 = (header->dwPixelFlags & DDPF_RGB) && header->dwRGBBitCount == 32
+			&& header->dwRBitMask == 0x000000FF && header->dwGBitMask == 0x0000FF00 && header->dwBBitMask == 0x00FF0000 && header->dwABitMask == 0xFF000000;
+		ASSERT(bIsRGBA8, L"%s is not support dds pixel format...", path.c_str());
+
+		format = *FindContainerFormat(dxgiFormats, 28);
+	}
+
+	SetContainerFormat(format, outContainer);
+	outContainer.width = static_cast<int32_t>(header->dwWidth);
+	outContainer.height = static_cast<int32_t>(header->dwHeight);
+	outContainer.levelCount = ((header->dwFlags & DDSD_MIPMAPCOUNT) && header->dwMipMapCount > 0) ? header->dwMipMapCount : 1;
+	outContainer.layerCount = layerCount;
+	outContainer.faceCount = faceCount;
+
+	for (uint32_t layer = 0; layer < layerCount; ++layer)
+	{
+		for (uint32_t face = 0; face < faceCount; ++face)
+		{
+			for (uint32_t level = 0; level < outContainer.levelCount; ++level)
+			{
+				int32_t width = std::max<int32_t>(1, outContainer.width >> level);
+				int32_t height = std::max<int32_t>(1, outContainer.height >> level);
+
+				std::size_t size = format.bIsCompressed
+					? static_cast<std::size_t>((width + 3) / 4) * static_cast<std::size_t>((height + 3) / 4) * format.blockSize
+					: static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * format.blockSize;
+				ASSERT(offset + size <= buffer.size(), L"%s dds file is truncated...", path.c_str());
+
+				outContainer.subImages.push_back(TextureContainer::SubImage{ level, layer, face, width, height, offset, size });
+				offset += size;
+			}
+		}
+	}
+}
+
+/**
+ * @brief KTX2  а  ̹ մϴ.
+ */
+static void LoadKTX2Container(const std::wstring& path, TextureContainer& outContainer)
+{
+	const std::vector<uint8_t>& buffer = outContainer.buffer;
+	ASSERT(buffer.size() >= sizeof(KTX2FileHeader) && std::memcmp(buffer.data(), KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) == 0, L"invalid %s ktx2 file identifier...", path.c_str());
+
+	const KTX2FileHeader* header = reinterpret_cast<const KTX2FileHeader*>(buffer.data());
+	ASSERT(header->supercompressionScheme == 0, L"%s is supercompressed ktx2 file, not support...", path.c_str());
+	ASSERT(header->pixelDepth <= 1, L"%s is 3d texture, not support...", path.c_str());
+
+	ContainerFormat format = {};
+	ASSERT(FindVkFormat(header->vkFormat, format), "%d is not support vk format...", header->vkFormat);
+
+	SetContainerFormat(format, outContainer);
+	outContainer.width = static_cast<int32_t>(header->pixelWidth);
+	outContainer.height = static_cast<int32_t>(header->pixelHeight);
+	outContainer.levelCount = (header->levelCount == 0) ? 1 : header->levelCount;
+	outContainer.layerCount = (header->layerCount == 0) ? 1 : header->layerCount;
+	outContainer.faceCount = header->faceCount;
+	ASSERT(outContainer.faceCount == 1 || outContainer.faceCount == 6, "invalid ktx2 face count : %d", outContainer.faceCount);
+
+	std::size_t levelIndexOffset = sizeof(KTX2FileHeader);
+	ASSERT(buffer.size() >= levelIndexOffset + sizeof(KTX2LevelIndex) * outContainer.levelCount, L"invalid %s ktx2 level index...", path.c_str());
+
+	const KTX2LevelIndex* levelIndices = reinterpret_cast<const KTX2LevelIndex*>(buffer.data() + levelIndexOffset);
+	uint32_t imageCount = outContainer.layerCount * outContainer.faceCount;
+
+	for (uint32_t level = 0; level < outContainer.levelCount; ++level)
+	{
+		const KTX2LevelIndex& levelIndex = levelIndices[level];
+		ASSERT(levelIndex.byteOffset + levelIndex.byteLength <= buffer.size(), L"%s ktx2 file is truncated...", path.c_str());
+
+		int32_t width = std::max<int32_t>(1, outContainer.width >> level);
+		int32_t height = std::max<int32_t>(1, outContainer.height >> level);
+		std::size_t size = static_cast<std::size_t>(levelIndex.byteLength / imageCount);
+
+		for (uint32_t layer = 0; layer < outContainer.layerCount; ++layer)
+		{
+			for (uint32_t face = 0; face < outContainer.faceCount; ++face)
+			{
+				std::size_t offset = static_cast<std::size_t>(levelIndex.byteOffset) + (layer * outContainer.faceCount + face) * size;
+				outContainer.subImages.push_back(TextureContainer::SubImage{ level, layer, face, width, height, offset, size });
+			}
+		}
+	}
+}
+
+GLenum TextureContainer::GetTarget() const
+{
+	if (faceCount == 6)
+	{
+		return (layerCount > 1) ? GL_TEXTURE_CUBE_MAP_ARRAY : GL_TEXTURE_CUBE_MAP;
+	}
+
+	return (layerCount > 1) ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D;
+}
+
 bool TextureUtils::IsSupportExtension(const std::wstring& path)
 {
 	std::wstring extension = StringUtils::ToLower(FileUtils::GetFileExtension(path));
@@ -75,6 +371,48 @@ GLenum TextureUtils::FindTextureFormatFromChannel(uint32_t channel)
 	return format;
 }
 
+GLenum TextureUtils::FindInternalFormatFromChannel(uint32_t channel)
+{
+	GLenum internalFormat = 0;
+
+	switch (channel)
+	{
+	case 1:
+		internalFormat = static_cast<GLenum>(GL_R8);
+		break;
+
+	case 3:
+		internalFormat = static_cast<GLenum>(GL_RGB8);
+		break;
+
+	case 4:
+		internalFormat = static_cast<GLenum>(GL_RGBA8);
+		break;
+
+	default:
+		internalFormat = static_cast<GLenum>(0xFFFF);
+	}
+
+	return internalFormat;
+}
+
+int32_t TextureUtils::ComputeMipLevelCount(int32_t width, int32_t height)
+{
+	int32_t levelCount = 1;
+	for (int32_t size = std::max<int32_t>(width, height); size > 1; size /= 2)
+	{
+		levelCount++;
+	}
+
+	return levelCount;
+}
+
+void TextureUtils::ResizeImage(const uint8_t* src, int32_t srcWidth, int32_t srcHeight, int32_t channels, uint8_t* outDst, int32_t dstWidth, int32_t dstHeight)
+{
+	int32_t result = stbir_resize_uint8(src, srcWidth, srcHeight, 0, outDst, dstWidth, dstHeight, 0, channels);
+	ASSERT(result != 0, "failed to resize image : (%d x %d) -> (%d x %d)", srcWidth, srcHeight, dstWidth, dstHeight);
+}
+
 EAstcBlockSize TextureUtils::FindAstcBlockSizeFromFile(const std::wstring& path)
 {
 	std::wstring filename = FileUtils::RemoveBasePath(path);
@@ -90,20 +428,32 @@ EAstcBlockSize TextureUtils::FindAstcBlockSizeFromFile(const std::wstring& path)
 	return EAstcBlockSize::None;
 }
 
-void TextureUtils::LoadImageFromFile(const std::wstring& path, int32_t& outWidth, int32_t& outHeight, int32_t& outChannels, std::vector<uint8_t>& outBuffer)
+void StbImageDeleter::operator()(uint8_t* buffer) const
+{
+	stbi_image_free(buffer);
+}
+
+void TextureUtils::LoadImageFromFile(const std::wstring& path, DecodedImage& outImage)
 {
 	std::string convertPath = StringUtils::Convert(path);
 
-	uint8_t* bufferPtr = stbi_load(convertPath.c_str(), &outWidth, &outHeight, &outChannels, 0);
-	ASSERT(bufferPtr != nullptr, "failed to load %s image file...", convertPath.c_str());
+	outImage.buffer.reset(stbi_load(convertPath.c_str(), &outImage.width, &outImage.height, &outImage.channels, 0));
+	ASSERT(outImage.buffer != nullptr, "failed to load %s image file...", convertPath.c_str());
+}
 
-	std::size_t bufferSize = static_cast<std::size_t>(outWidth * outHeight * outChannels);
-	outBuffer.resize(bufferSize);
+std::vector<DecodedImage> TextureUtils::LoadImagesFromFiles(const std::vector<std::wstring>& paths)
+{
+	std::vector<DecodedImage> images(paths.size());
 
-	std::copy(bufferPtr, bufferPtr + bufferSize, &outBuffer[0]);
+	TaskManager::Get().ParallelFor(static_cast<uint32_t>(paths.size()), [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t index = begin; index < end; ++index)
+			{
+				LoadImageFromFile(paths[index], images[index]);
+			}
+		});
 
-	stbi_image_free(bufferPtr);
-	bufferPtr = nullptr;
+	return images;
 }
 
 void TextureUtils::LoadAstcFromFile(const std::wstring& path, std::vector<uint8_t>& outAstcBuffer, EAstcBlockSize& outBlockSize)
@@ -114,34 +464,73 @@ void TextureUtils::LoadAstcFromFile(const std::wstring& path, std::vector<uint8_
 	outAstcBuffer = FileUtils::ReadBufferFromFile(path);
 }
 
-void TextureUtils::LoadDxtFromFile(const std::wstring& path, std::vector<uint8_t>& outDxtBuffer, uint32_t& outFormat, uint32_t& outBlockSize)
+void TextureUtils::LoadContainerFromFile(const std::wstring& path, TextureContainer& outContainer)
 {
-	outDxtBuffer = FileUtils::ReadBufferFromFile(path);
-	DDSFileHeader* dxtDataPtr = reinterpret_cast<DDSFileHeader*>(outDxtBuffer.data());
+	outContainer.buffer = FileUtils::ReadBufferFromFile(path);
+	outContainer.subImages.clear();
 
-	std::string ddsFileCode;
-	for (std::size_t index = 0; index < 4; ++index)
+	std::wstring extension = StringUtils::ToLower(FileUtils::GetFileExtension(path));
+	if (extension == L"ktx2")
 	{
-		ddsFileCode += dxtDataPtr->magic[index];
+		LoadKTX2Container(path, outContainer);
 	}
-	ASSERT(ddsFileCode == "DDS ", L"invalid  %s dds file code...", path.c_str());
-
-	switch (dxtDataPtr->dwFourCC)
+	else
 	{
-	case FOURCC_DXT1:
-		outFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
-		outBlockSize = 8;
-		return;
+		ASSERT(extension == L"dds", L"%s is not texture container file...", path.c_str());
+		LoadDDSContainer(path, outContainer);
+	}
+}
 
-	case FOURCC_DXT3:
-		outFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
-		outBlockSize = 16;
-		return;
+void TextureUtils::UploadContainerSubImage(uint32_t textureID, GLenum target, int32_t zoffset, const TextureContainer& container, const TextureContainer::SubImage& subImage)
+{
+	int32_t level = static_cast<int32_t>(subImage.level);
+	GLsizei size = static_cast<GLsizei>(subImage.size);
+	const void* pixels = container.buffer.data() + subImage.offset;
+	bool bIsLayered = (target != GL_TEXTURE_2D);
 
-	case FOURCC_DXT5:
-		outFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
-		outBlockSize = 16;
-		return;
+	if (container.bIsCompressed && bIsLayered)
+	{
+		GL_ASSERT(glCompressedTextureSubImage3D(textureID, level, 0, 0, zoffset, subImage.width, subImage.height, 1, container.internalFormat, size, pixels), "failed to upload compressed texture sub image...");
+	}
+	else if (container.bIsCompressed)
+	{
+		GL_ASSERT(glCompressedTextureSubImage2D(textureID, level, 0, 0, subImage.width, subImage.height, container.internalFormat, size, pixels), "failed to upload compressed texture sub image...");
+	}
+	else if (bIsLayered)
+	{
+		GL_ASSERT(glTextureSubImage3D(textureID, level, 0, 0, zoffset, subImage.width, subImage.height, 1, container.format, container.type, pixels), "failed to upload texture sub image...");
+	}
+	else
+	{
+		GL_ASSERT(glTextureSubImage2D(textureID, level, 0, 0, subImage.width, subImage.height, container.format, container.type, pixels), "failed to upload texture sub image...");
 	}
-	ASSERT(false, " %d is not support DXT format or invalid DDS file format...", dxtDataPtr->dwFourCC);
 }
+
+uint32_t TextureUtils::CreateTextureFromContainer(const TextureContainer& container)
+{
+	GLenum target = container.GetTarget();
+	GLsizei levelCount = static_cast<GLsizei>(container.levelCount);
+	GLenum minFilter = (container.levelCount > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR;
+
+	uint32_t textureID = GLResourceUtils::CreateTexture(target, minFilter, GL_LINEAR, GL_CLAMP_TO_EDGE);
+
+	if (target == GL_TEXTURE_2D || target == GL_TEXTURE_CUBE_MAP)
+	{
+		GL_ASSERT(glTextureStorage2D(textureID, levelCount, container.internalFormat, container.width, container.height), "failed to allocate texture storage...");
+	}
+	else
+	{
+		GLsizei depth = static_cast<GLsizei>(container.layerCount * container.faceCount);
+		GL_ASSERT(glTextureStorage3D(textureID, levelCount, container.internalFormat, container.width, container.height, depth), "failed to allocate texture storage...");
+	}
+
+	GL_ASSERT(glPixelStorei(GL_UNPACK_ALIGNMENT, 1), "failed to set pixel storage modes...");
+	for (const auto& subImage : container.subImages)
+	{
+		int32_t zoffset = static_cast<int32_t>(subImage.layer * container.faceCount + subImage.face);
+		UploadContainerSubImage(textureID, target, zoffset, container, subImage);
+	}
+	GL_ASSERT(glPixelStorei(GL_UNPACK_ALIGNMENT, 4), "failed to set pixel storage modes...");
+
+	return textureID;
+}
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <glad/glad.h>
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -11,6 +12,13 @@
 #define FOURCC_DXT1 0x31545844
 #define FOURCC_DXT3 0x33545844
 #define FOURCC_DXT5 0x35545844
+#define FOURCC_ATI1 0x31495441
+#define FOURCC_ATI2 0x32495441
+#define FOURCC_BC4U 0x55344342
+#define FOURCC_BC4S 0x53344342
+#define FOURCC_BC5U 0x55354342
+#define FOURCC_BC5S 0x53354342
+#define FOURCC_DX10 0x30315844
 
 
 /**
@@ -64,6 +72,62 @@ struct DDSFileHeader
 };
 
 
+/**
+ * @brief DDS   ڿ  DX10 Ȯ Դϴ.
+ *
+ * @note ȼ  FourCC DX10  մϴ.
+ *
+ * @see https://learn.microsoft.com/en-us/windows/win32/direct3ddds/dds-header-dxt10
+ */
+struct DDSHeaderDX10
+{
+	uint32_t dxgiFormat;
+	uint32_t resourceDimension;
+	uint32_t miscFlag;
+	uint32_t arraySize;
+	uint32_t miscFlags2;
+};
+
+
+/**
+ * @brief KTX2  Դϴ.
+ *
+ * @note  ٷ ڿ levelCount(0̸ 1) KTX2LevelIndex ɴϴ.
+ *
+ * @see https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html
+ */
+struct KTX2FileHeader
+{
+	uint8_t  identifier[12];
+	uint32_t vkFormat;
+	uint32_t typeSize;
+	uint32_t pixelWidth;
+	uint32_t pixelHeight;
+	uint32_t pixelDepth;
+	uint32_t layerCount;
+	uint32_t faceCount;
+	uint32_t levelCount;
+	uint32_t supercompressionScheme;
+	uint32_t dfdByteOffset;
+	uint32_t dfdByteLength;
+	uint32_t kvdByteOffset;
+	uint32_t kvdByteLength;
+	uint64_t sgdByteOffset;
+	uint64_t sgdByteLength;
+};
+
+
+/**
+ * @brief KTX2  Ӹ  εԴϴ.
+ */
+struct KTX2LevelIndex
+{
+	uint64_t byteOffset;
+	uint64_t byteLength;
+	uint64_t uncompressedByteLength;
+};
+
+
 /**
  * @brief ASTC  ũ⸦ Ÿ Դϴ.
  *
@@ -91,6 +155,67 @@ enum class EAstcBlockSize
 };
 
 
+/**
+ * @brief stb_image Ҵ ȼ ۸ մϴ.
+ */
+struct StbImageDeleter
+{
+	void operator()(uint8_t* buffer) const;
+};
+
+
+/**
+ * @brief ڵ ̹Դϴ.
+ *
+ * @note ȼ ۴ stb_image Ҵ ۸   ϸ, ̹ Ҹ  մϴ.
+ */
+struct DecodedImage
+{
+	int32_t width = 0;
+	int32_t height = 0;
+	int32_t channels = 0;
+	std::unique_ptr<uint8_t, StbImageDeleter> buffer;
+
+	std::size_t GetSize() const { return static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * static_cast<std::size_t>(channels); }
+};
+
+
+/**
+ * @brief ؽó ̳(DDS, KTX2)   Դϴ.
+ *
+ * @note
+ * - Ͽ   Ӹ , 迭 ̾, ť   ̹ ϴ.
+ * -  ̹ ʹ     ŰǷ, ε  糪 ȯ ʿ ϴ.
+ */
+struct TextureContainer
+{
+	struct SubImage
+	{
+		uint32_t level;
+		uint32_t layer;
+		uint32_t face;
+		int32_t width;
+		int32_t height;
+		std::size_t offset;
+		std::size_t size;
+	};
+
+	bool bIsCompressed = false;
+	uint32_t internalFormat = 0;
+	uint32_t format = 0;
+	uint32_t type = 0;
+	int32_t width = 0;
+	int32_t height = 0;
+	uint32_t levelCount = 0;
+	uint32_t layerCount = 0;
+	uint32_t faceCount = 0;
+	std::vector<uint8_t> buffer;
+	std::vector<SubImage> subImages;
+
+	GLenum GetTarget() const;
+};
+
+
 /**
  * @brief ؽó  Ȯ  մϴ.
  */
@@ -106,9 +231,8 @@ public:
 	 * 
 	 * @note
 	 * - ̹  .jpeg, .jpg, .png, .tga, .bmp  մϴ.
-	 * -   ASTC DXT(S3TC)  մϴ.
-	 * - ASTC    ݵ astcenc.exe ̿ؼ  ̿ մϴ.
-	 * - DXT    ݵ texconv.exe ̿ؼ  ̿ մϴ.
+	 * -   ASTC  մϴ. ASTC    ݵ astcenc.exe ̿ؼ  ̿ մϴ.
+	 * - ؽó ̳ʴ .dds .ktx2  մϴ.
 	 */
 	static bool IsSupportExtension(const std::wstring& path);
 
@@ -129,6 +253,48 @@ public:
 	static GLenum FindTextureFormatFromChannel(uint32_t channel);
 
 
+	/**
+	 * @brief ̹ äο ϴ ũⰡ  OpenGL   enum  ãϴ.
+	 * 
+	 * @param channel ̹ äΰԴϴ.
+	 * 
+	 * @return      ȯմϴ.
+	 * 
+	 * @note
+	 * - Һ (glTextureStorage2D) Ҵ  մϴ.
+	 * - channels  1, 3, 4̸  GL_R8, GL_RGB8, GL_RGBA8 ȯմϴ.
+	 * -   channels  0xFFFF ȯմϴ.
+	 */
+	static GLenum FindInternalFormatFromChannel(uint32_t channel);
+
+
+	/**
+	 * @brief 1x1 ũ Ӹ   մϴ.
+	 * 
+	 * @param width Ӹ  0  ũԴϴ.
+	 * @param height Ӹ  0  ũԴϴ.
+	 * 
+	 * @return Ӹ  0  Ӹ   ȯմϴ.
+	 */
+	static int32_t ComputeMipLevelCount(int32_t width, int32_t height);
+
+
+	/**
+	 * @brief 8Ʈ ̹ ũ⸦ ٲߴϴ.
+	 *
+	 * @param src ũ⸦ ٲ ̹ ȼ Դϴ.
+	 * @param srcWidth ũ⸦ ٲ ̹  ũԴϴ.
+	 * @param srcHeight ũ⸦ ٲ ̹  ũԴϴ.
+	 * @param channels ̹ ä Դϴ.
+	 * @param outDst ũ⸦ ٲ ̹  ȼ Դϴ. dstWidth * dstHeight * channels Ʈ ̻̾ մϴ.
+	 * @param dstWidth ũ⸦ ٲ ̹  ũԴϴ.
+	 * @param dstHeight ũ⸦ ٲ ̹  ũԴϴ.
+	 *
+	 * @note Ӹ  CPU   մϴ.
+	 */
+	static void ResizeImage(const uint8_t* src, int32_t srcWidth, int32_t srcHeight, int32_t channels, uint8_t* outDst, int32_t dstWidth, int32_t dstHeight);
+
+
 	/**
 	 * @brief  ̸κ ASTC   ũ⸦ ϴ.
 	 * 
@@ -146,14 +312,25 @@ public:
 	 * @brief ̹  εմϴ.
 	 * 
 	 * @param path ̹  Դϴ.
-	 * @param outWidth ̹  ũԴϴ.
-	 * @param outHeight ̹  ũԴϴ.
-	 * @param outChannels ̹ ȼ üԴϴ.
-	 * @param outBuffer ̹ Դϴ.
+	 * @param outImage ڵ ̹Դϴ.
 	 * 
 	 * @note ̹  .jpeg, .jpg, .png, .tga, .bmp  մϴ.
 	 */
-	static void LoadImageFromFile(const std::wstring& path, int32_t& outWidth, int32_t& outHeight, int32_t& outChannels, std::vector<uint8_t>& outBuffer);
+	static void LoadImageFromFile(const std::wstring& path, DecodedImage& outImage);
+
+
+	/**
+	 * @brief  ̹  ۾ 忡 ÿ εմϴ.
+	 *
+	 * @param paths ̹   Դϴ.
+	 *
+	 * @return  ϰ   ڵ ̹  ȯմϴ.
+	 *
+	 * @note
+	 * - TaskManager::ParallelFor ڵϹǷ, ȣ 嵵 ڵ ϸ    ȯ ʽϴ.
+	 * - ۾ 忡 ȣϸ ȣ 忡 ʷ ڵմϴ.
+	 */
+	static std::vector<DecodedImage> LoadImagesFromFiles(const std::vector<std::wstring>& paths);
 
 
 	/**
@@ -172,16 +349,41 @@ public:
 
 
 	/**
-	 * @brief DXT  ؽó  εմϴ.
-	 * 
-	 * @param path DXT  ؽó  Դϴ.
-	 * @param outFormat DXT  ؽó Դϴ.
-	 * @param outBlockSize DXT  ؽó  ũԴϴ.
-	 * 
+	 * @brief ؽó ̳  εմϴ.
+	 *
+	 * @param path ؽó ̳  Դϴ.
+	 * @param outContainer ؽó ̳   Դϴ.
+	 *
 	 * @note
-	 * -  ̸ ο ݵ DXT   ԵǾ ־ մϴ.
-	 * - ex. example_dxt1.dds, example_dxt3.dds
-	 * - ݵ texconv.exe Ϸ  ̿ մϴ.
+	 * - .dds  DXT1/3/5, ATI1/ATI2(BC4/BC5) FourCC, 32Ʈ RGBA, DX10 Ȯ (BC1~BC7, 迭, ť) մϴ.
+	 * - .ktx2  ʾ(Supercompression)  BC1~BC7, ASTC, 8Ʈ ȭ , 16/32Ʈ ε Ҽ RGBA  մϴ.
+	 * - 3D ؽó  ʽϴ.
+	 */
+	static void LoadContainerFromFile(const std::wstring& path, TextureContainer& outContainer);
+
+
+	/**
+	 * @brief ؽó ̳  ̹ ϳ ؽó εմϴ.
+	 *
+	 * @param textureID ε ؽó ҽ IDԴϴ.
+	 * @param target ε ؽó ŸԴϴ. ) GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP
+	 * @param zoffset ̾ Դϴ. ť  ȣ, 迭 ؽó (̾ *   + )̸, GL_TEXTURE_2D մϴ.
+	 * @param container  ̹  ؽó ̳Դϴ.
+	 * @param subImage ε  ̹Դϴ.
+	 *
+	 * @note ؽó ε ʰ DSA Լ εմϴ.
+	 */
+	static void UploadContainerSubImage(uint32_t textureID, GLenum target, int32_t zoffset, const TextureContainer& container, const TextureContainer::SubImage& subImage);
+
+
+	/**
+	 * @brief ؽó ̳ʷκ  Ұ (Immutable Storage) ؽó ҽ մϴ.
+	 *
+	 * @param container ؽó  ؽó ̳Դϴ.
+	 *
+	 * @return ؽó ҽ ID ȯմϴ.
+	 *
+	 * @note  Ӹ  Ͽ ٷ εϸ, glGenerateMipmap ȣ ʽϴ.
 	 */
-	static void LoadDxtFromFile(const std::wstring& path, std::vector<uint8_t>& outDxtBuffer, uint32_t& outFormat, uint32_t& outBlockSize);
+	static uint32_t CreateTextureFromContainer(const TextureContainer& container);
 };
\ No newline at end of file
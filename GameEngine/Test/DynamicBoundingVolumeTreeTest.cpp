@@ -0,0 +1,253 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "DynamicBoundingVolumeTree.h"
+#include "Frustum.h"
+#include "MathUtils.h"
+
+/**
+ * @brief  ˻ Դϴ.
+ */
+static int32_t failCount = 0;
+
+/**
+ * @brief  ˻ϰ, ϸ ޽ մϴ.
+ */
+static void Check(bool bIsPassed, const char* message)
+{
+	if (!bIsPassed)
+	{
+		std::printf("[FAILED] %s\n", message);
+		failCount++;
+	}
+}
+
+/**
+ * @brief  ð ݱ 帥 ð и  ϴ.
+ */
+static double GetElapsedMilliseconds(const std::chrono::steady_clock::time_point& startTime)
+{
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+/**
+ * @brief ߽ center̰    extent  ڸ ϴ.
+ */
+static AxisAlignedBoundingBox CreateBox(const Vector3f& center, float extent)
+{
+	return AxisAlignedBoundingBox(Vector3f(center.x - extent, center.y - extent, center.z - extent), Vector3f(center.x + extent, center.y + extent, center.z + extent));
+}
+
+/**
+ * @brief ġũ   νϽԴϴ.
+ */
+struct Instance
+{
+	Vector3f center;
+	float extent;
+	int32_t proxyID;
+};
+
+/**
+ * @brief Ʈ ü    νϽ ˻ϴ  մϴ.
+ *
+ * @note
+ * - Ʈ Fat  ڷ ϹǷ,  Fat  ڸ  ˻  Ȯ ƾ մϴ.
+ * -   ڰ ü ġ νϽ ϳ  ʾƾ մϴ.
+ *
+ * @return  ˻ ٸų  νϽ  ȯմϴ.
+ */
+static int32_t CountFrustumMismatches(const DynamicBoundingVolumeTree& tree, const std::vector<Instance>& instances, const Frustum& frustum, std::vector<uint32_t> actual)
+{
+	std::sort(actual.begin(), actual.end());
+
+	std::vector<uint32_t> expected;
+	int32_t missCount = 0;
+	for (uint32_t index = 0; index < static_cast<uint32_t>(instances.size()); ++index)
+	{
+		const Instance& instance = instances[index];
+		if (instance.proxyID == DynamicBoundingVolumeTree::NULL_NODE)
+		{
+			continue;
+		}
+
+		if (frustum.Intersect(tree.GetFatBoundingBox(instance.proxyID)))
+		{
+			expected.push_back(index);
+		}
+
+		if (frustum.Intersect(CreateBox(instance.center, instance.extent)) && !std::binary_search(actual.begin(), actual.end(), index))
+		{
+			missCount++;
+		}
+	}
+
+	return missCount + ((actual == expected) ? 0 : 1);
+}
+
+/**
+ * @brief Ʈ      νϽ ˻ϴ  մϴ.
+ *
+ * @return  ٸ true, ׷  false ȯմϴ.
+ */
+static bool MatchBoundQuery(DynamicBoundingVolumeTree& tree, const std::vector<Instance>& instances, const AxisAlignedBoundingBox& bound)
+{
+	std::vector<uint32_t> actual;
+	tree.Query(bound, actual);
+	std::sort(actual.begin(), actual.end());
+
+	std::vector<uint32_t> expected;
+	for (uint32_t index = 0; index < static_cast<uint32_t>(instances.size()); ++index)
+	{
+		if (instances[index].proxyID != DynamicBoundingVolumeTree::NULL_NODE && tree.GetFatBoundingBox(instances[index].proxyID).Intersect(bound))
+		{
+			expected.push_back(index);
+		}
+	}
+
+	return actual == expected;
+}
+
+/**
+ * @brief  ī޶󿡼 ü Ǹ ϰ  ˻ մϴ.  ð  ˻ ð մϴ.
+ *
+ * @return  ˻ ٸų  νϽ  ȯմϴ.
+ */
+static int32_t RunFrustumQueries(DynamicBoundingVolumeTree& tree, const std::vector<Instance>& instances, const char* label)
+{
+	static const int32_t CAMERA_COUNT = 16;
+
+	Matrix4x4f projection = MathUtils::CreatePerspective(MathUtils::ToRadian(60.0f), 16.0f / 9.0f, 0.1f, 400.0f);
+
+	int32_t mismatchCount = 0;
+	double queryTime = 0.0;
+	double bruteForceTime = 0.0;
+	uint64_t visibleCount = 0;
+	uint64_t testNodeCount = 0;
+	std::vector<uint32_t> visibleObjects;
+	for (int32_t camera = 0; camera < CAMERA_COUNT; ++camera)
+	{
+		float angle = TwoPi * static_cast<float>(camera) / static_cast<float>(CAMERA_COUNT);
+		Vector3f eyePosition = Vector3f(300.0f * MathUtils::Cos(angle), 20.0f + 5.0f * static_cast<float>(camera % 4), 300.0f * MathUtils::Sin(angle));
+		Vector3f focusPosition = Vector3f(100.0f * MathUtils::Sin(angle), 0.0f, 0.0f);
+		Frustum frustum = Frustum::Extract(MathUtils::CreateLookAt(eyePosition, focusPosition, Vector3f(0.0f, 1.0f, 0.0f)), projection);
+
+		visibleObjects.clear();
+		auto startTime = std::chrono::steady_clock::now();
+		tree.Query(frustum, visibleObjects);
+		queryTime += GetElapsedMilliseconds(startTime);
+
+		visibleCount += tree.GetQueryStatistics().visibleCount;
+		testNodeCount += tree.GetQueryStatistics().testNodeCount;
+
+		startTime = std::chrono::steady_clock::now();
+		uint32_t bruteForceCount = 0;
+		for (const auto& instance : instances)
+		{
+			if (instance.proxyID != DynamicBoundingVolumeTree::NULL_NODE && frustum.Intersect(tree.GetFatBoundingBox(instance.proxyID)))
+			{
+				bruteForceCount++;
+			}
+		}
+		bruteForceTime += GetElapsedMilliseconds(startTime);
+
+		Check(bruteForceCount == static_cast<uint32_t>(visibleObjects.size()), "frustum query count must match brute force");
+		mismatchCount += CountFrustumMismatches(tree, instances, frustum, visibleObjects);
+	}
+
+	std::printf("%-8s query : %8.3f ms/query (brute force %8.3f ms/query), %llu visible, %llu node tests, %d mismatch(es)\n",
+		label,
+		queryTime / static_cast<double>(CAMERA_COUNT),
+		bruteForceTime / static_cast<double>(CAMERA_COUNT),
+		static_cast<unsigned long long>(visibleCount / CAMERA_COUNT),
+		static_cast<unsigned long long>(testNodeCount / CAMERA_COUNT),
+		mismatchCount
+	);
+
+	return mismatchCount;
+}
+
+int main(void)
+{
+	static const uint32_t INSTANCE_COUNT = 100000;
+
+	/** õ带  ึ  νϽ ġ ˻մϴ. */
+	std::mt19937 generator(29);
+	std::uniform_real_distribution<float> horizontal(-500.0f, 500.0f);
+	std::uniform_real_distribution<float> vertical(-50.0f, 50.0f);
+	std::uniform_real_distribution<float> extent(0.5f, 2.0f);
+
+	std::vector<Instance> instances(INSTANCE_COUNT);
+	for (auto& instance : instances)
+	{
+		instance.center = Vector3f(horizontal(generator), vertical(generator), horizontal(generator));
+		instance.extent = extent(generator);
+		instance.proxyID = DynamicBoundingVolumeTree::NULL_NODE;
+	}
+
+	DynamicBoundingVolumeTree tree(0.1f);
+
+	auto startTime = std::chrono::steady_clock::now();
+	for (uint32_t index = 0; index < INSTANCE_COUNT; ++index)
+	{
+		instances[index].proxyID = tree.Insert(CreateBox(instances[index].center, instances[index].extent), index);
+	}
+	std::printf("insert   %u instances : %8.3f ms, height %d\n", INSTANCE_COUNT, GetElapsedMilliseconds(startTime), tree.GetHeight());
+
+	Check(tree.GetProxyCount() == INSTANCE_COUNT, "proxy count must match inserted instance count");
+	Check(tree.GetHeight() <= 48, "rotations must keep the tree balanced");
+	Check(RunFrustumQueries(tree, instances, "insert") == 0, "frustum query after insert must match brute force");
+
+	/** Fat    ũ⺸ ۰ ̸ Ʈ  ٲ ʾƾ մϴ. */
+	uint32_t changeCount = 0;
+	startTime = std::chrono::steady_clock::now();
+	for (auto& instance : instances)
+	{
+		instance.center = instance.center + Vector3f(0.05f, -0.05f, 0.05f);
+		changeCount += tree.Refit(instance.proxyID, CreateBox(instance.center, instance.extent)) ? 1 : 0;
+	}
+	std::printf("refit    %u small moves : %8.3f ms, %u rebuilt\n", INSTANCE_COUNT, GetElapsedMilliseconds(startTime), changeCount);
+	Check(changeCount == 0, "moves within the fat margin must not change the tree");
+
+	/** νϽ 10% ũ ̸ ش νϽ ٽ ԵǾ մϴ. */
+	std::uniform_real_distribution<float> offset(-20.0f, 20.0f);
+	changeCount = 0;
+	startTime = std::chrono::steady_clock::now();
+	for (uint32_t index = 0; index < INSTANCE_COUNT; index += 10)
+	{
+		Instance& instance = instances[index];
+		instance.center = instance.center + Vector3f(offset(generator), 1.0f, offset(generator));
+		changeCount += tree.Refit(instance.proxyID, CreateBox(instance.center, instance.extent)) ? 1 : 0;
+	}
+	std::printf("refit    %u large moves : %8.3f ms, %u rebuilt, height %d\n", INSTANCE_COUNT / 10, GetElapsedMilliseconds(startTime), changeCount, tree.GetHeight());
+	Check(changeCount == INSTANCE_COUNT / 10, "moves outside the fat margin must reinsert the instance");
+	Check(RunFrustumQueries(tree, instances, "refit") == 0, "frustum query after refit must match brute force");
+
+	/**   ڿ  νϽ ǵǾ մϴ. */
+	for (uint32_t index = 0; index < INSTANCE_COUNT; index += 2)
+	{
+		tree.Remove(instances[index].proxyID);
+		instances[index].proxyID = DynamicBoundingVolumeTree::NULL_NODE;
+	}
+
+	Check(tree.GetProxyCount() == INSTANCE_COUNT / 2, "proxy count must match remaining instance count");
+	Check(RunFrustumQueries(tree, instances, "remove") == 0, "frustum query after remove must match brute force");
+
+	Check(MatchBoundQuery(tree, instances, AxisAlignedBoundingBox(Vector3f(-50.0f, -10.0f, -50.0f), Vector3f(50.0f, 10.0f, 50.0f))), "bound query must match brute force");
+	Check(MatchBoundQuery(tree, instances, AxisAlignedBoundingBox(Vector3f(600.0f, 0.0f, 600.0f), Vector3f(700.0f, 10.0f, 700.0f))), "bound query outside the world must be empty");
+
+	tree.Clear();
+	Check(tree.GetProxyCount() == 0 && tree.GetHeight() == 0, "clear must remove every instance");
+
+	if (failCount > 0)
+	{
+		std::printf("%d check(s) failed.\n", failCount);
+		return 1;
+	}
+
+	std::printf("all checks passed.\n");
+	return 0;
+}
\ No newline at end of file
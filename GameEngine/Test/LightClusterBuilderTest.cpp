@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "LightClusterBuilder.h"
+#include "MathUtils.h"
+#include "TaskManager.h"
+
+/**
+ * @brief  ˻ Դϴ.
+ */
+static int32_t failCount = 0;
+
+/**
+ * @brief  ˻ϰ, ϸ ޽ մϴ.
+ */
+static void Check(bool bIsPassed, const char* message)
+{
+	if (!bIsPassed)
+	{
+		std::printf("[FAILED] %s\n", message);
+		failCount++;
+	}
+}
+
+/**
+ * @brief     θ Į  ˻մϴ.
+ */
+static bool IntersectSphereBox(const Vector3f& center, float radius, const AxisAlignedBoundingBox& box)
+{
+	float distanceSquare = 0.0f;
+	for (uint32_t axis = 0; axis < 3; ++axis)
+	{
+		float distance = 0.0f;
+		if (center.data[axis] < box.minPosition.data[axis])
+		{
+			distance = box.minPosition.data[axis] - center.data[axis];
+		}
+		else if (center.data[axis] > box.maxPosition.data[axis])
+		{
+			distance = center.data[axis] - box.maxPosition.data[axis];
+		}
+
+		distanceSquare += distance * distance;
+	}
+
+	return distanceSquare <= radius * radius;
+}
+
+/**
+ * @brief  Ŭ   Į  ˻   Ȯմϴ.
+ *
+ * @return  ٸ Ŭ  ȯմϴ.
+ */
+static int32_t CountMismatchedClusters(const LightClusterBuilder& builder, const Matrix4x4f& view)
+{
+	const std::vector<LightClusterBuilder::LightBound>& lightBounds = builder.GetLightBounds();
+	const std::vector<LightClusterBuilder::ClusterEntry>& entries = builder.GetClusterEntries();
+	const std::vector<uint32_t>& lightIndices = builder.GetLightIndices();
+
+	int32_t mismatchCount = 0;
+	std::vector<uint32_t> expected;
+	std::vector<uint32_t> actual;
+	for (uint32_t cluster = 0; cluster < LightClusterBuilder::CLUSTER_COUNT; ++cluster)
+	{
+		const AxisAlignedBoundingBox& box = builder.GetClusterBoundingBox(cluster);
+
+		expected.clear();
+		for (uint32_t index = 0; index < static_cast<uint32_t>(lightBounds.size()); ++index)
+		{
+			Vector3f center = MathUtils::TransformPosition(lightBounds[index].position, view);
+			if (IntersectSphereBox(center, lightBounds[index].radius, box))
+			{
+				expected.push_back(index);
+			}
+		}
+
+		const LightClusterBuilder::ClusterEntry& entry = entries[cluster];
+		if (entry.offset + entry.count > static_cast<uint32_t>(lightIndices.size()))
+		{
+			mismatchCount++;
+			continue;
+		}
+
+		actual.assign(lightIndices.begin() + entry.offset, lightIndices.begin() + entry.offset + entry.count);
+		std::sort(actual.begin(), actual.end());
+
+		mismatchCount += (actual != expected) ? 1 : 0;
+	}
+
+	return mismatchCount;
+}
+
+int main(void)
+{
+	TaskManager::Get().Startup();
+
+	const float nearZ = 0.1f;
+	const float farZ = 100.0f;
+
+	LightClusterBuilder builder;
+	builder.SetProjection(MathUtils::ToRadian(60.0f), 16.0f / 9.0f, nearZ, farZ);
+
+	Vector3f eyePosition = Vector3f(0.0f, 3.0f, 30.0f);
+	Matrix4x4f view = MathUtils::CreateLookAt(eyePosition, Vector3f(0.0f, 0.0f, 0.0f), Vector3f(0.0f, 1.0f, 0.0f));
+
+	/** õ带  ึ   ġ ˻մϴ. */
+	std::mt19937 generator(7);
+	std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+	std::uniform_real_distribution<float> color(0.1f, 1.0f);
+	std::uniform_real_distribution<float> attenuation(0.0f, 2.0f);
+
+	std::vector<PointLight> pointLights;
+	for (uint32_t index = 0; index < 300; ++index)
+	{
+		Vector3f diffuse = Vector3f(color(generator), color(generator), color(generator));
+		pointLights.push_back(PointLight(Vector3f(position(generator), 0.2f * position(generator), position(generator)), Vector3f(0.05f, 0.05f, 0.05f), diffuse, diffuse, 1.0f, attenuation(generator), attenuation(generator)));
+	}
+
+	std::vector<SpotLight> spotLights;
+	for (uint32_t index = 0; index < 200; ++index)
+	{
+		Vector3f diffuse = Vector3f(color(generator), color(generator), color(generator));
+		spotLights.push_back(SpotLight(Vector3f(position(generator), 5.0f, position(generator)), Vector3f(0.0f, -1.0f, 0.0f), 0.9f, 0.8f, Vector3f(0.0f, 0.0f, 0.0f), diffuse, diffuse, 1.0f, attenuation(generator), attenuation(generator)));
+	}
+
+	builder.Build(view, pointLights, spotLights);
+	Check(builder.GetLightBounds().size() == pointLights.size() + spotLights.size(), "light bounds must list point lights then spot lights");
+	Check(CountMismatchedClusters(builder, view) == 0, "random lights must match scalar sphere-box assignment");
+
+	/** ī޶      鿡 ģ Դϴ. */
+	Vector3f forward = MathUtils::Normalize(Vector3f(0.0f, 0.0f, 0.0f) - eyePosition);
+	std::vector<PointLight> straddleLights;
+	for (const auto& depth : { 0.05f, nearZ, 0.15f, 99.0f, farZ, 101.0f, 104.0f })
+	{
+		straddleLights.push_back(PointLight(eyePosition + forward * depth, Vector3f(0.0f, 0.0f, 0.0f), Vector3f(1.0f, 1.0f, 1.0f), Vector3f(0.0f, 0.0f, 0.0f), 1.0f, 0.7f, 1.8f));
+	}
+
+	builder.Build(view, straddleLights, {});
+	Check(CountMismatchedClusters(builder, view) == 0, "lights straddling near and far planes must match scalar sphere-box assignment");
+
+	const std::vector<LightClusterBuilder::ClusterEntry>& entries = builder.GetClusterEntries();
+	Check(entries[LightClusterBuilder::GetClusterIndex(8, 4, 0)].count > 0, "light straddling near plane must reach first depth slice");
+	Check(entries[LightClusterBuilder::GetClusterIndex(8, 4, LightClusterBuilder::CLUSTER_COUNT_Z - 1)].count > 0, "light straddling far plane must reach last depth slice");
+
+	/**  װ   0̸   ϹǷ  ŬͿ ҴǾ մϴ. */
+	std::vector<PointLight> unboundedLights = { PointLight(Vector3f(0.0f, 0.0f, 0.0f), Vector3f(0.0f, 0.0f, 0.0f), Vector3f(1.0f, 1.0f, 1.0f), Vector3f(0.0f, 0.0f, 0.0f), 1.0f, 0.0f, 0.0f) };
+	std::vector<SpotLight> unboundedSpotLights = { SpotLight(Vector3f(0.0f, 5.0f, 0.0f), Vector3f(0.0f, -1.0f, 0.0f), 0.9f, 0.8f, Vector3f(0.0f, 0.0f, 0.0f), Vector3f(1.0f, 1.0f, 1.0f), Vector3f(0.0f, 0.0f, 0.0f), 1.0f, 0.0f, 0.0f) };
+
+	builder.Build(view, unboundedLights, unboundedSpotLights);
+	Check(CountMismatchedClusters(builder, view) == 0, "lights without linear and quadratic attenuation must match scalar sphere-box assignment");
+
+	uint32_t unboundedClusterCount = 0;
+	for (const auto& entry : builder.GetClusterEntries())
+	{
+		unboundedClusterCount += (entry.count == 2) ? 1 : 0;
+	}
+	Check(unboundedClusterCount == LightClusterBuilder::CLUSTER_COUNT, "lights without linear and quadratic attenuation must reach every cluster");
+
+	TaskManager::Get().Shutdown();
+
+	if (failCount > 0)
+	{
+		std::printf("%d check(s) failed.\n", failCount);
+		return 1;
+	}
+
+	std::printf("all checks passed.\n");
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include <cstdio>
+#include <vector>
+
+#include "AxisAlignedBoundingBox.h"
+#include "MathUtils.h"
+#include "OcclusionCuller.h"
+#include "StaticMesh.h"
+#include "TaskManager.h"
+
+/**
+ * @brief  ˻ Դϴ.
+ */
+static int32_t failCount = 0;
+
+/**
+ * @brief  ˻ϰ, ϸ ޽ մϴ.
+ */
+static void Check(bool bIsPassed, const char* message)
+{
+	if (!bIsPassed)
+	{
+		std::printf("[FAILED] %s\n", message);
+		failCount++;
+	}
+}
+
+/**
+ * @brief ߽ center̰    extent  ڸ ϴ.
+ */
+static AxisAlignedBoundingBox CreateBox(const Vector3f& center, float extent)
+{
+	AxisAlignedBoundingBox box;
+	box.minPosition = Vector3f(center.x - extent, center.y - extent, center.z - extent);
+	box.maxPosition = Vector3f(center.x + extent, center.y + extent, center.z + extent);
+
+	return box;
+}
+
+int main(void)
+{
+	TaskManager::Get().Startup();
+
+	/**  ﰢ 밢 ϴ 簢 Դϴ. 밢   ȼ ߽ Ȯ ϴ. */
+	std::vector<StaticMesh::Vertex> vertices(4);
+	vertices[0].position = Vector3f(-2.0f, -2.0f, 0.0f);
+	vertices[1].position = Vector3f(+2.0f, -2.0f, 0.0f);
+	vertices[2].position = Vector3f(+2.0f, +2.0f, 0.0f);
+	vertices[3].position = Vector3f(-2.0f, +2.0f, 0.0f);
+
+	std::vector<uint32_t> indices = { 0, 1, 2, 0, 2, 3 };
+
+	Matrix4x4f view = MathUtils::CreateLookAt(Vector3f(0.0f, 0.0f, 5.0f), Vector3f(0.0f, 0.0f, 0.0f), Vector3f(0.0f, 1.0f, 0.0f));
+	Matrix4x4f projection = MathUtils::CreatePerspective(MathUtils::ToRadian(60.0f), 2.0f, 0.1f, 100.0f);
+
+	OcclusionCuller culler(256, 128);
+	culler.Begin(view, projection);
+	culler.AddOccluder(vertices, indices, Matrix4x4f::GetIdentity());
+	culler.Rasterize();
+
+	/** 簢   ȼ ä մϴ. 簢 ȭ ߾ӿ  44 ȼ ũ ˴ϴ. */
+	int32_t holeCount = 0;
+	const std::vector<float>& depthBuffer = culler.GetDepthBuffer();
+	for (int32_t y = 64 - 40; y < 64 + 40; ++y)
+	{
+		for (int32_t x = 128 - 40; x < 128 + 40; ++x)
+		{
+			holeCount += (depthBuffer[y * culler.GetWidth() + x] >= 1.0f) ? 1 : 0;
+		}
+	}
+	Check(holeCount == 0, "quad occluder must cover every pixel including its shared diagonal");
+
+	Check(!culler.IsVisible(CreateBox(Vector3f(0.0f, 0.0f, -5.0f), 0.5f)), "box behind quad occluder must be occluded");
+	Check(!culler.IsVisible(CreateBox(Vector3f(1.0f, 1.0f, -5.0f), 0.1f)), "box behind quad diagonal must be occluded");
+	Check(culler.IsVisible(CreateBox(Vector3f(0.0f, 0.0f, 2.0f), 0.5f)), "box in front of quad occluder must be visible");
+	Check(culler.IsVisible(CreateBox(Vector3f(8.0f, 0.0f, -5.0f), 0.5f)), "box beside quad occluder must be visible");
+	Check(!culler.IsVisible(CreateBox(Vector3f(100.0f, 0.0f, 0.0f), 0.5f)), "box outside of screen must be rejected");
+
+	TaskManager::Get().Shutdown();
+
+	if (failCount > 0)
+	{
+		std::printf("%d check(s) failed.\n", failCount);
+		return 1;
+	}
+
+	std::printf("all checks passed.\n");
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,297 @@
+#include <cstdio>
+#include <set>
+#include <tuple>
+#include <vector>
+
+#include "MathUtils.h"
+#include "RenderQueue.h"
+
+/**
+ * @brief  ˻ Դϴ.
+ */
+static int32_t failCount = 0;
+
+/**
+ * @brief  ˻ϰ, ϸ ޽ մϴ.
+ */
+static void Check(bool bIsPassed, const char* message)
+{
+	if (!bIsPassed)
+	{
+		std::printf("[FAILED] %s\n", message);
+		failCount++;
+	}
+}
+
+/**
+ * @brief  Ű ʵ ġԴϴ.  Ʈ (н 2Ʈ, ̵ 14Ʈ x 3,  20Ʈ)Դϴ.
+ */
+static const uint64_t PASS_SHIFT = 62;
+static const uint64_t MAX_ID = (1ull << 14) - 1;
+static const uint64_t MAX_DEPTH = (1ull << 20) - 1;
+
+/**
+ * @brief     ŸԴϴ.
+ */
+static const float NEAR_Z = 1.0f;
+static const float FAR_Z = 101.0f;
+
+/**
+ * @brief  ť ҽ ͸ 񱳸 ϹǷ,  ٸ ּҸ    ҽ  մϴ.
+ */
+static uint8_t shaderStorage[2];
+static uint8_t materialStorage[2];
+static std::vector<uint8_t> meshStorage(MAX_ID + 8);
+
+static Shader* GetShader(int32_t index) { return reinterpret_cast<Shader*>(&shaderStorage[index]); }
+static const Material* GetMaterial(int32_t index) { return reinterpret_cast<const Material*>(&materialStorage[index]); }
+static const StaticMesh* GetMesh(int32_t index) { return reinterpret_cast<const StaticMesh*>(&meshStorage[index]); }
+
+/**
+ * @brief ī޶  depthŭ  ġ ׸ ׸ ߰մϴ.
+ */
+static void Submit(RenderQueue& renderQueue, ERenderPass pass, int32_t shader, int32_t material, int32_t mesh, float depth)
+{
+	Vector3f position(0.0f, 0.0f, -depth);
+	renderQueue.Submit(pass, GetShader(shader), GetMesh(mesh), GetMaterial(material), MathUtils::CreateTranslation(position), position);
+}
+
+/**
+ * @brief ׸ ׸ ̸ ϴ.
+ */
+static float GetDepth(const RenderQueue::DrawItem& drawItem)
+{
+	return -drawItem.world.m[3][2];
+}
+
+/**
+ * @brief  ť ϴ ȭ ̸ ϴ.
+ */
+static uint64_t QuantizeDepth(float depth)
+{
+	return static_cast<uint64_t>(MathUtils::Clamp<float>((depth - NEAR_Z) / (FAR_Z - NEAR_Z), 0.0f, 1.0f) * static_cast<float>(MAX_DEPTH));
+}
+
+/**
+ * @brief ̵ ̸ ˰ ִ ׸ ׸     踦 ˻մϴ.
+ */
+static void CheckKnownOrder(const Matrix4x4f& view)
+{
+	struct KnownItem
+	{
+		ERenderPass pass;
+		int32_t shader;
+		int32_t material;
+		int32_t mesh;
+		float depth;
+	};
+
+	/** ̵ ó ߰  ҴǹǷ ̴ 1,  1, ޽ 1  ̵ 0 ޽ϴ. */
+	static const KnownItem items[] =
+	{
+		{ ERenderPass::Translucent, 1, 1, 1, 10.0f },
+		{ ERenderPass::Opaque,      0, 0, 0, 50.0f },
+		{ ERenderPass::Opaque,      1, 0, 0,  5.0f },
+		{ ERenderPass::Opaque,      0, 1, 1, 30.0f },
+		{ ERenderPass::Translucent, 1, 1, 0, 40.0f },
+		{ ERenderPass::Opaque,      0, 0, 0, 20.0f },
+		{ ERenderPass::Opaque,      0, 1, 1,  8.0f },
+		{ ERenderPass::Opaque,      1, 0, 0, 60.0f },
+		{ ERenderPass::Translucent, 0, 0, 0, 25.0f },
+	};
+
+	/**
+	 *  ׸ (̴, , ޽) ̵    տ ڷ ĵǰ,
+	 *  ׸  ׸    ĵ˴ϴ.
+	 */
+	static const int32_t expectedOrder[] = { 2, 7, 6, 3, 5, 1, 4, 8, 0 };
+
+	RenderQueue renderQueue;
+	renderQueue.Begin(view, NEAR_Z, FAR_Z);
+	for (const auto& item : items)
+	{
+		Submit(renderQueue, item.pass, item.shader, item.material, item.mesh, item.depth);
+	}
+	renderQueue.Sort();
+
+	const std::vector<RenderQueue::DrawItem>& drawItems = renderQueue.GetDrawItems();
+	Check(drawItems.size() == sizeof(items) / sizeof(items[0]), "sort must keep every draw item");
+
+	bool bIsExpectedOrder = (drawItems.size() == sizeof(expectedOrder) / sizeof(expectedOrder[0]));
+	for (std::size_t index = 0; bIsExpectedOrder && index < drawItems.size(); ++index)
+	{
+		const KnownItem& item = items[expectedOrder[index]];
+		bIsExpectedOrder = drawItems[index].pass == item.pass
+			&& drawItems[index].shader == GetShader(item.shader)
+			&& drawItems[index].material == GetMaterial(item.material)
+			&& drawItems[index].mesh == GetMesh(item.mesh)
+			&& GetDepth(drawItems[index]) == item.depth;
+	}
+	Check(bIsExpectedOrder, "known draw items must follow pass, shader, material, mesh and depth order");
+
+	/** ߰ δ 20,  δ 15(̴ 5,  6, ޽ 4)   Ͼϴ. */
+	const RenderQueue::Statistics& statistics = renderQueue.GetStatistics();
+	Check(statistics.itemCount == 9, "statistics must count every draw item");
+	Check(statistics.unsortedStateChangeCount == 20, "unsorted state change count must match the submission order");
+	Check(statistics.sortedStateChangeCount == 15, "sorted state change count must match the sorted order");
+	Check(statistics.sortedShaderChangeCount == 5, "sorted shader change count must match the sorted order");
+	Check(statistics.sortedMaterialChangeCount == 6, "sorted material change count must match the sorted order");
+	Check(statistics.sortedMeshChangeCount == 4, "sorted mesh change count must match the sorted order");
+	Check(statistics.overflowItemCount == 0, "known draw items must not overflow sort key ids");
+}
+
+/**
+ * @brief  ׸ ׸񿡼 н ,  ׸   ,  ׸   ˻մϴ.
+ */
+static void CheckGrouping(const Matrix4x4f& view)
+{
+	RenderQueue renderQueue;
+	renderQueue.Begin(view, NEAR_Z, FAR_Z);
+
+	uint32_t seed = 0x2468ACEu;
+	for (int32_t index = 0; index < 512; ++index)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		ERenderPass pass = ((seed >> 8) % 4 == 0) ? ERenderPass::Translucent : ERenderPass::Opaque;
+		float depth = NEAR_Z + 0.1f + 0.19f * static_cast<float>(index * 97 % 512);
+
+		Submit(renderQueue, pass, (seed >> 12) % 2, (seed >> 16) % 2, (seed >> 20) % 6, depth);
+	}
+	renderQueue.Sort();
+
+	const std::vector<RenderQueue::DrawItem>& drawItems = renderQueue.GetDrawItems();
+
+	bool bIsPassOrdered = true;
+	bool bIsGrouped = true;
+	bool bIsFrontToBack = true;
+	bool bIsBackToFront = true;
+
+	using Group = std::tuple<const void*, const void*, const void*>;
+	std::set<Group> closedGroups;
+	for (std::size_t index = 1; index < drawItems.size(); ++index)
+	{
+		const RenderQueue::DrawItem& prev = drawItems[index - 1];
+		const RenderQueue::DrawItem& curr = drawItems[index];
+
+		bIsPassOrdered = bIsPassOrdered && (static_cast<int32_t>(prev.pass) <= static_cast<int32_t>(curr.pass));
+		if (prev.pass != curr.pass)
+		{
+			continue;
+		}
+
+		if (curr.pass == ERenderPass::Translucent)
+		{
+			bIsBackToFront = bIsBackToFront && (GetDepth(prev) > GetDepth(curr));
+			continue;
+		}
+
+		Group prevGroup(prev.shader, prev.material, prev.mesh);
+		Group currGroup(curr.shader, curr.material, curr.mesh);
+		if (prevGroup == currGroup)
+		{
+			bIsFrontToBack = bIsFrontToBack && (GetDepth(prev) <= GetDepth(curr));
+		}
+		else
+		{
+			closedGroups.insert(prevGroup);
+			bIsGrouped = bIsGrouped && (closedGroups.count(currGroup) == 0);
+		}
+	}
+
+	Check(bIsPassOrdered, "opaque items must come before translucent items");
+	Check(bIsGrouped, "opaque items must be grouped by shader, material and mesh");
+	Check(bIsFrontToBack, "opaque items must be front-to-back within a group");
+	Check(bIsBackToFront, "translucent items must be strictly back-to-front");
+
+	const RenderQueue::Statistics& statistics = renderQueue.GetStatistics();
+	Check(statistics.sortedStateChangeCount < statistics.unsortedStateChangeCount, "sorting must reduce state changes");
+}
+
+/**
+ * @brief ޽ ̵ ģ ׸ ׸ н  ʵ尡 Ǵ ˻մϴ.
+ */
+static void CheckOverflow(const Matrix4x4f& view)
+{
+	RenderQueue renderQueue;
+	renderQueue.Begin(view, NEAR_Z, FAR_Z);
+
+	/** ģ ҽ Բ  ִ   ޽ ̵ äϴ. */
+	for (int32_t mesh = 0; mesh < static_cast<int32_t>(MAX_ID); ++mesh)
+	{
+		Submit(renderQueue, ERenderPass::Opaque, 0, 0, mesh, 90.0f);
+	}
+	Check(renderQueue.GetStatistics().overflowItemCount == 0, "ids below the reserved maximum must not overflow");
+
+	static const float opaqueDepths[] = { 70.0f, 10.0f, 40.0f };
+	static const float translucentDepths[] = { 30.0f, 80.0f };
+
+	int32_t overflowMesh = static_cast<int32_t>(MAX_ID);
+	for (const auto& depth : opaqueDepths)
+	{
+		Submit(renderQueue, ERenderPass::Opaque, 0, 0, overflowMesh++, depth);
+	}
+	for (const auto& depth : translucentDepths)
+	{
+		Submit(renderQueue, ERenderPass::Translucent, 0, 0, overflowMesh++, depth);
+	}
+	Check(renderQueue.GetStatistics().overflowItemCount == 5, "new meshes past the id limit must be counted as overflow");
+
+	renderQueue.Sort();
+
+	const std::vector<RenderQueue::DrawItem>& drawItems = renderQueue.GetDrawItems();
+	Check(drawItems.size() == MAX_ID + 5, "sort must keep overflowed draw items");
+
+	bool bIsKeyIntact = true;
+	std::vector<float> overflowOpaqueDepths;
+	std::vector<float> overflowTranslucentDepths;
+	for (const auto& drawItem : drawItems)
+	{
+		if (drawItem.mesh < GetMesh(static_cast<int32_t>(MAX_ID)))
+		{
+			continue;
+		}
+
+		bIsKeyIntact = bIsKeyIntact && ((drawItem.key >> PASS_SHIFT) == static_cast<uint64_t>(drawItem.pass));
+		if (drawItem.pass == ERenderPass::Opaque)
+		{
+			bIsKeyIntact = bIsKeyIntact && ((drawItem.key & MAX_DEPTH) == QuantizeDepth(GetDepth(drawItem)));
+			bIsKeyIntact = bIsKeyIntact && (((drawItem.key >> 20) & MAX_ID) == MAX_ID);
+			overflowOpaqueDepths.push_back(GetDepth(drawItem));
+		}
+		else
+		{
+			bIsKeyIntact = bIsKeyIntact && (((drawItem.key >> 42) & MAX_DEPTH) == MAX_DEPTH - QuantizeDepth(GetDepth(drawItem)));
+			bIsKeyIntact = bIsKeyIntact && ((drawItem.key & MAX_ID) == MAX_ID);
+			overflowTranslucentDepths.push_back(GetDepth(drawItem));
+		}
+	}
+
+	Check(bIsKeyIntact, "overflowed ids must leave pass and depth bits intact");
+	Check(overflowOpaqueDepths == std::vector<float>({ 10.0f, 40.0f, 70.0f }), "overflowed opaque items must stay front-to-back");
+	Check(overflowTranslucentDepths == std::vector<float>({ 80.0f, 30.0f }), "overflowed translucent items must stay back-to-front");
+	Check(drawItems.back().pass == ERenderPass::Translucent && drawItems[MAX_ID + 2].pass == ERenderPass::Opaque, "overflowed items must stay in their pass");
+
+	/** ̵ ٽ Ҵϸ  ҽ  ̻ ġ ʾƾ մϴ. */
+	renderQueue.ResetSortKeyIDs();
+	renderQueue.Begin(view, NEAR_Z, FAR_Z);
+	Submit(renderQueue, ERenderPass::Opaque, 0, 0, static_cast<int32_t>(MAX_ID), 10.0f);
+	Check(renderQueue.GetStatistics().overflowItemCount == 0, "reset must release sort key ids");
+}
+
+int main(void)
+{
+	Matrix4x4f view = MathUtils::CreateLookAt(Vector3f(0.0f, 0.0f, 0.0f), Vector3f(0.0f, 0.0f, -1.0f), Vector3f(0.0f, 1.0f, 0.0f));
+
+	CheckKnownOrder(view);
+	CheckGrouping(view);
+	CheckOverflow(view);
+
+	if (failCount > 0)
+	{
+		std::printf("%d check(s) failed.\n", failCount);
+		return 1;
+	}
+
+	std::printf("all checks passed.\n");
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,226 @@
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "MathUtils.h"
+#include "ShadowCascadeUtils.h"
+
+/**
+ * @brief  ˻ Դϴ.
+ */
+static int32_t failCount = 0;
+
+/**
+ * @brief  ˻ϰ, ϸ ޽ մϴ.
+ */
+static void Check(bool bIsPassed, const char* message)
+{
+	if (!bIsPassed)
+	{
+		std::printf("[FAILED] %s\n", message);
+		failCount++;
+	}
+}
+
+/**
+ * @brief ī޶  þ , / ,     ŸԴϴ.
+ */
+static const float FOV = MathUtils::ToRadian(60.0f);
+static const float ASPECT = 16.0f / 9.0f;
+static const float NEAR_Z = 0.1f;
+static const float FAR_Z = 200.0f;
+
+/**
+ * @brief ĳ̵ ,  ĳ̵ ؼ ,   ø ŸԴϴ.
+ */
+static const uint32_t CASCADE_COUNT = 4;
+static const uint32_t SHADOW_SIZE = 2048;
+static const float CASTER_DISTANCE = 50.0f;
+
+/**
+ * @brief      ű  ؼ  ϴ.
+ *
+ * @note  þ    ̹Ƿ,      ؼ  ߾ Դϴ.
+ */
+static void GetTexelOffset(const Matrix4x4f& lightProjection, float& outX, float& outY)
+{
+	outX = (lightProjection.m[3][0] + 1.0f) * 0.5f * static_cast<float>(SHADOW_SIZE);
+	outY = (lightProjection.m[3][1] + 1.0f) * 0.5f * static_cast<float>(SHADOW_SIZE);
+}
+
+/**
+ * @brief     Ȯմϴ.
+ */
+static bool IsWhole(float value)
+{
+	return std::abs(value - std::round(value)) < 0.01f;
+}
+
+/**
+ * @brief  Ÿ  鿡   鿡   ϴ ˻մϴ.
+ */
+static void CheckSplitDistances()
+{
+	for (const auto& lambda : { 0.0f, 0.5f, 1.0f })
+	{
+		std::vector<float> splits;
+		ShadowCascadeUtils::ComputeSplitDistances(NEAR_Z, FAR_Z, CASCADE_COUNT, lambda, splits);
+
+		Check(splits.size() == CASCADE_COUNT + 1, "split count must be cascade count + 1");
+		Check(splits.front() == NEAR_Z && splits.back() == FAR_Z, "splits must start at near and end at far");
+
+		bool bIsMonotonic = true;
+		for (std::size_t index = 1; index < splits.size(); ++index)
+		{
+			bIsMonotonic = bIsMonotonic && (splits[index - 1] < splits[index]);
+		}
+		Check(bIsMonotonic, "splits must be strictly increasing");
+
+		/** lambda 0̸ յ , 1̸ α Ұ ƾ մϴ. */
+		float rate = 1.0f / static_cast<float>(CASCADE_COUNT);
+		if (lambda == 0.0f)
+		{
+			Check(std::abs(splits[1] - (NEAR_Z + (FAR_Z - NEAR_Z) * rate)) < 1e-3f, "lambda 0 must split uniformly");
+		}
+		else if (lambda == 1.0f)
+		{
+			Check(std::abs(splits[1] - NEAR_Z * std::pow(FAR_Z / NEAR_Z, rate)) < 1e-3f, "lambda 1 must split logarithmically");
+		}
+	}
+}
+
+/**
+ * @brief   ü  ش ĳ̵    ȿ ִ ˻մϴ.
+ *
+ * @note   CASTER_DISTANCEŭ ű   ȿ ־   ü ׸ڸ 帮  ֽϴ.
+ */
+static void CheckCornersInside(const Matrix4x4f& cameraView, const Vector3f& lightDirection)
+{
+	std::vector<ShadowCascadeUtils::Cascade> cascades;
+	ShadowCascadeUtils::ComputeCascades(cameraView, FOV, ASPECT, NEAR_Z, FAR_Z, lightDirection, CASCADE_COUNT, 0.5f, SHADOW_SIZE, CASTER_DISTANCE, cascades);
+	Check(cascades.size() == CASCADE_COUNT, "cascade count must match");
+
+	Matrix4x4f cameraWorld = MathUtils::Inverse(cameraView);
+	Vector3f towardLight = -MathUtils::Normalize(lightDirection) * CASTER_DISTANCE;
+
+	float tanHalfFovY = std::tan(FOV * 0.5f);
+	float tanHalfFovX = tanHalfFovY * ASPECT;
+
+	const float epsilon = 1e-4f;
+	bool bIsInside = true;
+	bool bIsCasterInside = true;
+	for (const auto& cascade : cascades)
+	{
+		for (const auto& distance : { cascade.splitNear, cascade.splitFar })
+		{
+			for (const auto& sx : { -1.0f, +1.0f })
+			{
+				for (const auto& sy : { -1.0f, +1.0f })
+				{
+					Vector3f corner = MathUtils::TransformPosition(Vector3f(sx * tanHalfFovX * distance, sy * tanHalfFovY * distance, -distance), cameraWorld);
+
+					Vector3f clip = MathUtils::TransformPosition(MathUtils::TransformPosition(corner, cascade.lightView), cascade.lightProjection);
+					bIsInside = bIsInside && std::abs(clip.x) <= 1.0f + epsilon && std::abs(clip.y) <= 1.0f + epsilon && std::abs(clip.z) <= 1.0f + epsilon;
+
+					Vector3f casterClip = MathUtils::TransformPosition(MathUtils::TransformPosition(corner + towardLight, cascade.lightView), cascade.lightProjection);
+					bIsCasterInside = bIsCasterInside && std::abs(casterClip.z) <= 1.0f + epsilon;
+				}
+			}
+		}
+	}
+
+	Check(bIsInside, "every sub-frustum corner must lie inside the cascade clip volume");
+	Check(bIsCasterInside, "corners moved toward the light by the caster distance must stay inside the depth range");
+}
+
+/**
+ * @brief ī޶ ؼ ۰ ̰ų ȸص    ؼ  ߾ ˻մϴ.
+ */
+static void CheckTexelSnapping(const Vector3f& lightDirection)
+{
+	Vector3f eyePosition(12.3f, 8.0f, 25.7f);
+	Vector3f focusPosition(0.0f, 0.0f, 0.0f);
+	Vector3f up(0.0f, 1.0f, 0.0f);
+
+	std::vector<ShadowCascadeUtils::Cascade> baseCascades;
+	ShadowCascadeUtils::ComputeCascades(MathUtils::CreateLookAt(eyePosition, focusPosition, up), FOV, ASPECT, NEAR_Z, FAR_Z, lightDirection, CASCADE_COUNT, 0.5f, SHADOW_SIZE, CASTER_DISTANCE, baseCascades);
+
+	bool bIsSnapped = true;
+	bool bIsSizeStable = true;
+	bool bIsShiftBounded = true;
+	for (int32_t step = 1; step <= 16; ++step)
+	{
+		/**   ĳ̵ ؼ ũ⺸  ̵ 0.05  ȸԴϴ. */
+		float rate = static_cast<float>(step) / 16.0f;
+		Vector3f translation(0.0003f * rate, -0.0002f * rate, 0.0004f * rate);
+		float angle = MathUtils::ToRadian(0.05f * rate);
+
+		Vector3f movedEye = eyePosition + translation;
+		Vector3f movedFocus = focusPosition + translation + Vector3f(std::sin(angle), 0.0f, 0.0f) * 10.0f;
+
+		for (const auto& cameraView : { MathUtils::CreateLookAt(movedEye, focusPosition + translation, up), MathUtils::CreateLookAt(eyePosition, movedFocus, up) })
+		{
+			std::vector<ShadowCascadeUtils::Cascade> cascades;
+			ShadowCascadeUtils::ComputeCascades(cameraView, FOV, ASPECT, NEAR_Z, FAR_Z, lightDirection, CASCADE_COUNT, 0.5f, SHADOW_SIZE, CASTER_DISTANCE, cascades);
+
+			for (uint32_t index = 0; index < CASCADE_COUNT; ++index)
+			{
+				float baseX = 0.0f;
+				float baseY = 0.0f;
+				GetTexelOffset(baseCascades[index].lightProjection, baseX, baseY);
+
+				float x = 0.0f;
+				float y = 0.0f;
+				GetTexelOffset(cascades[index].lightProjection, x, y);
+
+				bIsSnapped = bIsSnapped && IsWhole(x) && IsWhole(y);
+				bIsSizeStable = bIsSizeStable
+					&& cascades[index].lightProjection.m[0][0] == baseCascades[index].lightProjection.m[0][0]
+					&& cascades[index].lightProjection.m[1][1] == baseCascades[index].lightProjection.m[1][1];
+				bIsShiftBounded = bIsShiftBounded && std::abs(x - baseX) <= 1.01f && std::abs(y - baseY) <= 1.01f;
+			}
+		}
+	}
+
+	Check(bIsSnapped, "sub-texel camera motion must keep the projection snapped to whole texels");
+	Check(bIsSizeStable, "sub-texel camera motion must not change the projection size");
+	Check(bIsShiftBounded, "sub-texel camera motion must move the projection by at most one texel");
+}
+
+int main(void)
+{
+	CheckSplitDistances();
+
+	Vector3f lightDirections[] =
+	{
+		Vector3f(-0.5f, -1.0f, -0.3f),
+		Vector3f(0.0f, -1.0f, 0.0f),
+		Vector3f(1.0f, -0.2f, 0.0f),
+	};
+
+	Matrix4x4f cameraViews[] =
+	{
+		MathUtils::CreateLookAt(Vector3f(0.0f, 3.0f, 30.0f), Vector3f(0.0f, 0.0f, 0.0f), Vector3f(0.0f, 1.0f, 0.0f)),
+		MathUtils::CreateLookAt(Vector3f(-120.0f, 40.0f, 75.0f), Vector3f(-100.0f, 0.0f, 20.0f), Vector3f(0.0f, 1.0f, 0.0f)),
+		MathUtils::CreateLookAt(Vector3f(5.0f, 2.0f, -5.0f), Vector3f(5.0f, 60.0f, -5.1f), Vector3f(0.0f, 0.0f, 1.0f)),
+	};
+
+	for (const auto& lightDirection : lightDirections)
+	{
+		for (const auto& cameraView : cameraViews)
+		{
+			CheckCornersInside(cameraView, lightDirection);
+		}
+
+		CheckTexelSnapping(lightDirection);
+	}
+
+	if (failCount > 0)
+	{
+		std::printf("%d check(s) failed.\n", failCount);
+		return 1;
+	}
+
+	std::printf("all checks passed.\n");
+	return 0;
+}
\ No newline at end of file
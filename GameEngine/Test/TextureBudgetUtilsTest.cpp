@@ -0,0 +1,195 @@
+#include <cstdio>
+#include <vector>
+
+#include "TextureBudgetUtils.h"
+
+/**
+ * @brief  ˻ Դϴ.
+ */
+static int32_t failCount = 0;
+
+/**
+ * @brief  ˻ϰ, ϸ ޽ մϴ.
+ */
+static void Check(bool bIsPassed, const char* message)
+{
+	if (!bIsPassed)
+	{
+		std::printf("[FAILED] %s\n", message);
+		failCount++;
+	}
+}
+
+/**
+ * @brief   ũⰡ size RGBA8 簢 ؽó  ϴ.
+ *
+ * @param levelCount Ӹ  Դϴ. 0̸ 1x1  Ӹ  ϴ.
+ */
+static TextureBudgetUtils::Entry CreateEntry(int32_t size, float requestedSize, uint32_t levelCount = 0, bool bIsStreamable = true)
+{
+	TextureBudgetUtils::Entry entry;
+	entry.width = size;
+	entry.height = size;
+	entry.requestedSize = requestedSize;
+	entry.bIsStreamable = bIsStreamable;
+
+	for (int32_t levelSize = size; levelSize >= 1; levelSize >>= 1)
+	{
+		if (levelCount > 0 && entry.levelSizes.size() >= levelCount)
+		{
+			break;
+		}
+
+		entry.levelSizes.push_back(static_cast<uint64_t>(levelSize) * static_cast<uint64_t>(levelSize) * 4);
+	}
+
+	return entry;
+}
+
+/**
+ * @brief ؽó  Ӹ  ϴ Ʈ ũ  մϴ.
+ */
+static uint64_t SumResidentSize(const std::vector<TextureBudgetUtils::Entry>& entries, const std::vector<uint32_t>& baseLevels)
+{
+	uint64_t size = 0;
+	for (std::size_t index = 0; index < entries.size(); ++index)
+	{
+		size += TextureBudgetUtils::ComputeResidentSize(entries[index], baseLevels[index]);
+	}
+
+	return size;
+}
+
+/**
+ * @brief  ̶ û ȭ ũ⸦ ϴ  Ӹ  ״ ϴ ˻մϴ.
+ */
+static void CheckUnderBudget()
+{
+	std::vector<TextureBudgetUtils::Entry> entries =
+	{
+		CreateEntry(1024, 300.0f),
+		CreateEntry(512, 600.0f),
+		CreateEntry(256, 10.0f),
+		CreateEntry(64, 0.5f),
+	};
+
+	std::vector<uint32_t> baseLevels;
+	uint64_t residentSize = TextureBudgetUtils::Solve(entries, ~0ull, baseLevels);
+
+	Check(baseLevels == std::vector<uint32_t>({ 1, 0, 4, 6 }), "under budget must keep the desired base levels");
+	Check(residentSize == SumResidentSize(entries, baseLevels), "under budget must return the resident size");
+
+	/**   ũ Ȯ Ƶ Ӹ   ʾƾ մϴ. */
+	std::vector<uint32_t> exactBaseLevels;
+	Check(TextureBudgetUtils::Solve(entries, residentSize, exactBaseLevels) == residentSize, "exact budget must return the resident size");
+	Check(exactBaseLevels == baseLevels, "exact budget must keep the desired base levels");
+
+	std::vector<uint32_t> emptyBaseLevels = { 3 };
+	Check(TextureBudgetUtils::Solve({}, 0, emptyBaseLevels) == 0 && emptyBaseLevels.empty(), "no entries must resolve to nothing");
+}
+
+/**
+ * @brief   ػ    ؽó    ˻մϴ.
+ */
+static void CheckOverBudget()
+{
+	/**    0 1024 / 512 = 2, 1 600 / 512 = 1.17 ϴ. */
+	std::vector<TextureBudgetUtils::Entry> entries =
+	{
+		CreateEntry(1024, 1024.0f),
+		CreateEntry(1024, 600.0f),
+	};
+
+	std::vector<uint32_t> baseLevels;
+	uint64_t fullSize = SumResidentSize(entries, { 0, 0 });
+
+	uint64_t residentSize = TextureBudgetUtils::Solve(entries, fullSize - 1, baseLevels);
+	Check(baseLevels == std::vector<uint32_t>({ 0, 1 }), "over budget must drop the smallest-deficit texture first");
+	Check(residentSize == fullSize - entries[1].levelSizes[0], "over budget must return the resident size after one drop");
+
+	/** 1     600 / 256 = 2.34 Ƿ,  2 0 ϴ. */
+	residentSize = TextureBudgetUtils::Solve(entries, residentSize - 1, baseLevels);
+	Check(baseLevels == std::vector<uint32_t>({ 1, 1 }), "second drop must pick the next smallest deficit");
+	Check(residentSize == SumResidentSize(entries, baseLevels), "second drop must return the resident size");
+
+	/**   ٸ   Ʈ ϴ ؽó  ϴ. */
+	std::vector<TextureBudgetUtils::Entry> tieEntries =
+	{
+		CreateEntry(512, 512.0f),
+		CreateEntry(1024, 1024.0f),
+	};
+
+	uint64_t tieSize = SumResidentSize(tieEntries, { 0, 0 });
+	TextureBudgetUtils::Solve(tieEntries, tieSize - 1, baseLevels);
+	Check(baseLevels == std::vector<uint32_t>({ 0, 1 }), "equal deficit must drop the texture that frees more bytes first");
+
+	/**  ȿ    ϸ,    ʾƾ մϴ. */
+	uint64_t budget = tieSize / 2;
+	residentSize = TextureBudgetUtils::Solve(tieEntries, budget, baseLevels);
+	Check(residentSize <= budget, "reachable budget must be met");
+	Check(residentSize == SumResidentSize(tieEntries, baseLevels), "reachable budget must return the resident size");
+}
+
+/**
+ * @brief Ʈ   ؽó Ӹ  ϳ ؽó  ʴ ˻մϴ.
+ */
+static void CheckPinnedEntries()
+{
+	std::vector<TextureBudgetUtils::Entry> entries =
+	{
+		CreateEntry(2048, 16.0f, 0, false),
+		CreateEntry(1024, 16.0f, 1),
+		CreateEntry(1024, 1024.0f),
+	};
+
+	std::vector<uint32_t> baseLevels;
+	uint64_t residentSize = TextureBudgetUtils::Solve(entries, 0, baseLevels);
+
+	Check(baseLevels[0] == 0, "non-streamable texture must never be dropped");
+	Check(baseLevels[1] == 0, "single-level texture must never be dropped");
+	Check(baseLevels[2] == static_cast<uint32_t>(entries[2].levelSizes.size()) - 1, "streamable texture must drop to its last level");
+	Check(residentSize == SumResidentSize(entries, baseLevels), "pinned textures must still be counted in the resident size");
+}
+
+/**
+ * @brief    ٸ  ؽó  Ӹ    ߴ ˻մϴ.
+ */
+static void CheckImpossibleBudget()
+{
+	std::vector<TextureBudgetUtils::Entry> entries =
+	{
+		CreateEntry(1024, 1024.0f),
+		CreateEntry(256, 200.0f),
+		CreateEntry(2048, 4096.0f, 4),
+	};
+
+	std::vector<uint32_t> baseLevels;
+	uint64_t residentSize = TextureBudgetUtils::Solve(entries, 1, baseLevels);
+
+	bool bIsLastLevel = true;
+	for (std::size_t index = 0; index < entries.size(); ++index)
+	{
+		bIsLastLevel = bIsLastLevel && (baseLevels[index] + 1 == entries[index].levelSizes.size());
+	}
+
+	Check(bIsLastLevel, "impossible budget must drop every texture to its last level");
+	Check(residentSize == SumResidentSize(entries, baseLevels), "impossible budget must return the resident size");
+	Check(residentSize > 1, "impossible budget must report the overshoot");
+}
+
+int main(void)
+{
+	CheckUnderBudget();
+	CheckOverBudget();
+	CheckPinnedEntries();
+	CheckImpossibleBudget();
+
+	if (failCount > 0)
+	{
+		std::printf("%d check(s) failed.\n", failCount);
+		return 1;
+	}
+
+	std::printf("all checks passed.\n");
+	return 0;
+}
\ No newline at end of file
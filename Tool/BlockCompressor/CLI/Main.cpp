@@ -0,0 +1,152 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <stb_image.h>
+
+#include "BlockCompressUtils.h"
+#include "MipmapUtils.h"
+
+/** @brief  մϴ. */
+static void PrintUsage()
+{
+	std::printf(
+		"usage: BlockCompressor input=<image> output=<dds> [format=bc1|bc3|bc4|bc5|bc7] [quality=fast|normal|high]\n"
+		"                       [srgb=true|false] [mips=true|false] [minPSNR=<dB>]\n"
+		"\n"
+		"  format   compression format. (default: bc7)\n"
+		"  quality  compression quality. (default: normal)\n"
+		"  srgb     color data is sRGB. used for gamma-correct mip generation and the DXGI format. (default: true for bc1/bc3/bc7)\n"
+		"  mips     generate a full mip chain. (default: true)\n"
+		"  minPSNR  exit with code 2 when the PSNR of mip level 0 is below this value.\n"
+	);
+}
+
+/** @brief "<key>=<value>"   ڸ Ľմϴ. */
+static std::unordered_map<std::string, std::string> ParseArguments(int32_t argc, char* argv[])
+{
+	std::unordered_map<std::string, std::string> arguments;
+
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+
+		std::size_t separator = argument.find('=');
+		if (separator == std::string::npos)
+		{
+			continue;
+		}
+
+		arguments[argument.substr(0, separator)] = argument.substr(separator + 1);
+	}
+
+	return arguments;
+}
+
+int main(int argc, char* argv[])
+{
+	std::unordered_map<std::string, std::string> arguments = ParseArguments(argc, argv);
+	if (arguments.find("input") == arguments.end() || arguments.find("output") == arguments.end())
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	static const std::unordered_map<std::string, BlockCompressUtils::EFormat> formats =
+	{
+		{ "bc1", BlockCompressUtils::EFormat::BC1 },
+		{ "bc3", BlockCompressUtils::EFormat::BC3 },
+		{ "bc4", BlockCompressUtils::EFormat::BC4 },
+		{ "bc5", BlockCompressUtils::EFormat::BC5 },
+		{ "bc7", BlockCompressUtils::EFormat::BC7 },
+	};
+
+	static const std::unordered_map<std::string, BlockCompressUtils::EQuality> qualities =
+	{
+		{ "fast",   BlockCompressUtils::EQuality::Fast   },
+		{ "normal", BlockCompressUtils::EQuality::Normal },
+		{ "high",   BlockCompressUtils::EQuality::High   },
+	};
+
+	std::string formatName = arguments.count("format") ? arguments["format"] : "bc7";
+	std::string qualityName = arguments.count("quality") ? arguments["quality"] : "normal";
+	if (formats.find(formatName) == formats.end() || qualities.find(qualityName) == qualities.end())
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	BlockCompressUtils::EFormat format = formats.at(formatName);
+	BlockCompressUtils::EQuality quality = qualities.at(qualityName);
+
+	bool bIsColorFormat = (format == BlockCompressUtils::EFormat::BC1 || format == BlockCompressUtils::EFormat::BC3 || format == BlockCompressUtils::EFormat::BC7);
+	bool bIsSrgb = arguments.count("srgb") ? (arguments["srgb"] == "true") : bIsColorFormat;
+	bool bIsGenerateMips = arguments.count("mips") ? (arguments["mips"] == "true") : true;
+	float minPSNR = arguments.count("minPSNR") ? std::stof(arguments["minPSNR"]) : 0.0f;
+
+	int32_t width = 0;
+	int32_t height = 0;
+	int32_t channels = 0;
+	uint8_t* buffer = stbi_load(arguments["input"].c_str(), &width, &height, &channels, 4);
+	if (!buffer)
+	{
+		std::fprintf(stderr, "failed to load %s : %s\n", arguments["input"].c_str(), stbi_failure_reason());
+		return 1;
+	}
+
+	BlockCompressUtils::Image image;
+	image.width = width;
+	image.height = height;
+	image.pixels.assign(buffer, buffer + static_cast<std::size_t>(width) * height * 4);
+	stbi_image_free(buffer);
+
+	std::vector<BlockCompressUtils::Image> levels;
+	if (bIsGenerateMips)
+	{
+		levels = MipmapUtils::GenerateMipChain(image, bIsSrgb);
+	}
+	else
+	{
+		levels.push_back(image);
+	}
+
+	std::vector<std::vector<uint8_t>> compressedLevels;
+	float basePSNR = 0.0f;
+
+	for (std::size_t level = 0; level < levels.size(); ++level)
+	{
+		const BlockCompressUtils::Image& source = levels[level];
+
+		auto start = std::chrono::steady_clock::now();
+		compressedLevels.push_back(BlockCompressUtils::Compress(source, format, quality));
+		auto end = std::chrono::steady_clock::now();
+
+		BlockCompressUtils::Image decoded = BlockCompressUtils::Decompress(compressedLevels.back(), source.width, source.height, format);
+		float psnr = BlockCompressUtils::ComputePSNR(source, decoded, format);
+		if (level == 0)
+		{
+			basePSNR = psnr;
+		}
+
+		double milliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+		std::printf("level %2zu : %5d x %-5d %9.2f ms  PSNR %6.2f dB\n", level, source.width, source.height, milliseconds, psnr);
+	}
+
+	if (!BlockCompressUtils::WriteDDS(arguments["output"], format, bIsSrgb && bIsColorFormat, width, height, compressedLevels))
+	{
+		std::fprintf(stderr, "failed to write %s\n", arguments["output"].c_str());
+		return 1;
+	}
+
+	/**  Ӹ   ϳ  谡 ̹Ƿ, ǰ  Ӹ  0 մϴ. */
+	if (basePSNR < minPSNR)
+	{
+		std::fprintf(stderr, "PSNR %.2f dB is below the threshold %.2f dB\n", basePSNR, minPSNR);
+		return 2;
+	}
+
+	return 0;
+}
\ No newline at end of file
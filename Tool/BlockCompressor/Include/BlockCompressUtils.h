@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+/**
+ * @brief RGBA8 ̹ BC(Block Compression)  ϴ Ȯ  մϴ.
+ *
+ * @note
+ * - ܺ (texconv.exe, astcenc.exe)   ÷ մϴ.
+ * - 4x4   ϵ  ŭ  ķ մϴ.
+ * - SSE2 ϴ ȯ濡 (Endpoint) Ž ε  SIMD մϴ.
+ * - BC7   ( 5, 6)   ( 1, 3, 7) մϴ.     4  ʽϴ.
+ *
+ * @see https://learn.microsoft.com/en-us/windows/win32/direct3d11/texture-block-compression-in-direct3d-11
+ */
+namespace BlockCompressUtils
+{
+	/**
+	 * @brief  Դϴ.
+	 */
+	enum class EFormat : int32_t
+	{
+		BC1 = 0x00, // RGB, ϴ 8Ʈ
+		BC3 = 0x01, // RGBA, ϴ 16Ʈ
+		BC4 = 0x02, // R, ϴ 8Ʈ
+		BC5 = 0x03, // RG, ϴ 16Ʈ
+		BC7 = 0x04, // RGBA, ϴ 16Ʈ
+	};
+
+
+	/**
+	 * @brief  ǰԴϴ.
+	 *
+	 * @note
+	 * - Fast ּ     ٵϴ. BC7  6 մϴ.
+	 * - Normal    ٵϴ. BC7 P Ʈ , ĸ и  5,      4   (ϸ 1, İ  7) Բ Žմϴ.
+	 * - High Normal    ܰ辿 ̸  پ  Žմϴ. BC7   8  1, 3  ڵϰ,  Ͽ  Ž մϴ.
+	 */
+	enum class EQuality : int32_t
+	{
+		Fast   = 0x00,
+		Normal = 0x01,
+		High   = 0x02,
+	};
+
+
+	/**
+	 * @brief RGBA8 ̹Դϴ.
+	 */
+	struct Image
+	{
+		int32_t width = 0;
+		int32_t height = 0;
+		std::vector<uint8_t> pixels;
+	};
+
+
+	/**
+	 * @brief   4x4  ϳ Ʈ ũ⸦ ϴ.
+	 *
+	 * @param format  Դϴ.
+	 *
+	 * @return 4x4  ϳ Ʈ ũ⸦ ȯմϴ.
+	 */
+	uint32_t GetBlockSize(EFormat format);
+
+
+	/**
+	 * @brief ̹ մϴ.
+	 *
+	 * @param image  RGBA8 ̹Դϴ.
+	 * @param format  Դϴ.
+	 * @param quality  ǰԴϴ.
+	 *
+	 * @return  켱     ȯմϴ.
+	 *
+	 * @note ,  ũⰡ 4  ƴϸ ڸ ȼ ݺϿ  äϴ.
+	 */
+	std::vector<uint8_t> Compress(const Image& image, EFormat format, EQuality quality);
+
+
+	/**
+	 * @brief   RGBA8 ̹ մϴ.
+	 *
+	 * @param blocks  켱    Դϴ.
+	 * @param width ̹  ũԴϴ.
+	 * @param height ̹  ũԴϴ.
+	 * @param format  Դϴ.
+	 *
+	 * @return  RGBA8 ̹ ȯմϴ.
+	 *
+	 * @note BC4 R äο, BC5 R, G äο ϸ  ä (0, 0, 255) äϴ.
+	 */
+	Image Decompress(const std::vector<uint8_t>& blocks, int32_t width, int32_t height, EFormat format);
+
+
+	/**
+	 * @brief   ϴ äο   ̹ PSNR մϴ.
+	 *
+	 * @param reference  ̹Դϴ.
+	 * @param image  ̹Դϴ.
+	 * @param format  ä ϴ  Դϴ.
+	 *
+	 * @return ú  PSNR ȯմϴ.  ̹ ٸ 99 ȯմϴ.
+	 */
+	float ComputePSNR(const Image& reference, const Image& image, EFormat format);
+
+
+	/**
+	 * @brief  Ӹ ü DX10 Ȯ   DDS Ϸ մϴ.
+	 *
+	 * @param path  DDS  Դϴ.
+	 * @param format  Դϴ.
+	 * @param bIsSrgb  Ͱ sRGB  Դϴ. BC1, BC3, BC7 ˴ϴ.
+	 * @param width Ӹ  0  ũԴϴ.
+	 * @param height Ӹ  0  ũԴϴ.
+	 * @param levels Ӹ     Դϴ.
+	 *
+	 * @return 忡 ߴٸ true, ׷  false ȯմϴ.
+	 */
+	bool WriteDDS(const std::string& path, EFormat format, bool bIsSrgb, int32_t width, int32_t height, const std::vector<std::vector<uint8_t>>& levels);
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <vector>
+
+#include "BlockCompressUtils.h"
+
+
+/**
+ * @brief   Ӹ ü ϴ Ȯ  մϴ.
+ *
+ * @note
+ * - 2x2 ڽ ͷ ϸ, sRGB ʹ   ȯ   մϴ.
+ * -  ä ׻  ͷ մϴ.
+ * - Ȧ ũ ڸ ȼ ݺϿ óմϴ.
+ */
+namespace MipmapUtils
+{
+	/**
+	 * @brief ̹ ,   ũ մϴ.
+	 *
+	 * @param image  RGBA8 ̹Դϴ.
+	 * @param bIsSrgb  Ͱ sRGB  Դϴ.
+	 *
+	 * @return  ̹ ȯմϴ. ũ ּ 1x1Դϴ.
+	 */
+	BlockCompressUtils::Image Downsample(const BlockCompressUtils::Image& image, bool bIsSrgb);
+
+
+	/**
+	 * @brief 1x1 ũ Ӹ ü մϴ.
+	 *
+	 * @param image Ӹ  0 ̹Դϴ.
+	 * @param bIsSrgb  Ͱ sRGB  Դϴ.
+	 *
+	 * @return Ӹ  0  Ӹ ü ȯմϴ.
+	 */
+	std::vector<BlockCompressUtils::Image> GenerateMipChain(const BlockCompressUtils::Image& image, bool bIsSrgb);
+}
\ No newline at end of file
@@ -0,0 +1,367 @@
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "BlockCodec.h"
+
+void BlockCodec::LoadBlockPixels(const uint8_t* rgba, BlockPixels& outPixels)
+{
+	for (uint32_t index = 0; index < 16; ++index)
+	{
+		for (uint32_t channel = 0; channel < 4; ++channel)
+		{
+			outPixels.channels[channel][index] = static_cast<float>(rgba[index * 4 + channel]);
+		}
+	}
+}
+
+void BlockCodec::ComputePrincipalAxis(const BlockPixels& pixels, uint32_t channelCount, float outMean[4], float outAxis[4], uint16_t mask)
+{
+	float minValue[4] = { FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX };
+	float maxValue[4] = { -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+	uint32_t pixelCount = 0;
+	for (uint32_t index = 0; index < 16; ++index)
+	{
+		pixelCount += (mask >> index) & 0x1;
+	}
+
+	for (uint32_t channel = 0; channel < 4; ++channel)
+	{
+		outMean[channel] = 0.0f;
+		outAxis[channel] = 0.0f;
+
+		if (channel >= channelCount || pixelCount == 0)
+		{
+			continue;
+		}
+
+		for (uint32_t index = 0; index < 16; ++index)
+		{
+			if (((mask >> index) & 0x1) == 0)
+			{
+				continue;
+			}
+
+			float value = pixels.channels[channel][index];
+
+			outMean[channel] += value;
+			minValue[channel] = std::min(minValue[channel], value);
+			maxValue[channel] = std::max(maxValue[channel], value);
+		}
+
+		outMean[channel] /= static_cast<float>(pixelCount);
+	}
+
+	if (pixelCount == 0)
+	{
+		return;
+	}
+
+	float covariance[4][4] = {};
+	for (uint32_t index = 0; index < 16; ++index)
+	{
+		if (((mask >> index) & 0x1) == 0)
+		{
+			continue;
+		}
+
+		float delta[4] = {};
+		for (uint32_t channel = 0; channel < channelCount; ++channel)
+		{
+			delta[channel] = pixels.channels[channel][index] - outMean[channel];
+		}
+
+		for (uint32_t row = 0; row < channelCount; ++row)
+		{
+			for (uint32_t col = row; col < channelCount; ++col)
+			{
+				covariance[row][col] += delta[row] * delta[col];
+			}
+		}
+	}
+
+	for (uint32_t row = 0; row < channelCount; ++row)
+	{
+		for (uint32_t col = 0; col < row; ++col)
+		{
+			covariance[row][col] = covariance[col][row];
+		}
+	}
+
+	/** ٿ ڽ 밢 Ͽ ŵ(Power Iteration) ּ  ãϴ. */
+	float axis[4] = {};
+	float length = 0.0f;
+	for (uint32_t channel = 0; channel < channelCount; ++channel)
+	{
+		axis[channel] = maxValue[channel] - minValue[channel];
+		length += axis[channel] * axis[channel];
+	}
+
+	if (length <= FLT_EPSILON)
+	{
+		return;
+	}
+
+	for (uint32_t iteration = 0; iteration < 8; ++iteration)
+	{
+		float next[4] = {};
+		for (uint32_t row = 0; row < channelCount; ++row)
+		{
+			for (uint32_t col = 0; col < channelCount; ++col)
+			{
+				next[row] += covariance[row][col] * axis[col];
+			}
+		}
+
+		length = 0.0f;
+		for (uint32_t channel = 0; channel < channelCount; ++channel)
+		{
+			length += next[channel] * next[channel];
+		}
+
+		if (length <= FLT_EPSILON)
+		{
+			return;
+		}
+
+		float invLength = 1.0f / std::sqrt(length);
+		for (uint32_t channel = 0; channel < channelCount; ++channel)
+		{
+			axis[channel] = next[channel] * invLength;
+		}
+	}
+
+	for (uint32_t channel = 0; channel < channelCount; ++channel)
+	{
+		outAxis[channel] = axis[channel];
+	}
+}
+
+void BlockCodec::ComputeAxisEndpoints(const BlockPixels& pixels, uint32_t channelCount, float outEndpoint0[4], float outEndpoint1[4], uint16_t mask)
+{
+	float mean[4];
+	float axis[4];
+	ComputePrincipalAxis(pixels, channelCount, mean, axis, mask);
+
+	float minT = 0.0f;
+	float maxT = 0.0f;
+
+#if defined(BLOCK_CODEC_SIMD)
+	__m128 minProject = _mm_set1_ps(FLT_MAX);
+	__m128 maxProject = _mm_set1_ps(-FLT_MAX);
+	const __m128i laneBits = _mm_set_epi32(8, 4, 2, 1);
+
+	for (uint32_t group = 0; group < 4; ++group)
+	{
+		__m128 project = _mm_setzero_ps();
+		for (uint32_t channel = 0; channel < channelCount; ++channel)
+		{
+			__m128 delta = _mm_sub_ps(_mm_load_ps(&pixels.channels[channel][group * 4]), _mm_set1_ps(mean[channel]));
+			project = _mm_add_ps(project, _mm_mul_ps(delta, _mm_set1_ps(axis[channel])));
+		}
+
+		/** ũ   ȼ ּ, ִ 꿡   ʴ  ٲߴϴ. */
+		__m128 inside = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(mask >> (group * 4)), laneBits), laneBits));
+		minProject = _mm_min_ps(minProject, _mm_or_ps(_mm_and_ps(inside, project), _mm_andnot_ps(inside, _mm_set1_ps(FLT_MAX))));
+		maxProject = _mm_max_ps(maxProject, _mm_or_ps(_mm_and_ps(inside, project), _mm_andnot_ps(inside, _mm_set1_ps(-FLT_MAX))));
+	}
+
+	alignas(16) float minLanes[4];
+	alignas(16) float maxLanes[4];
+	_mm_store_ps(minLanes, minProject);
+	_mm_store_ps(maxLanes, maxProject);
+
+	minT = std::min(std::min(minLanes[0], minLanes[1]), std::min(minLanes[2], minLanes[3]));
+	maxT = std::max(std::max(maxLanes[0], maxLanes[1]), std::max(maxLanes[2], maxLanes[3]));
+#else
+	minT = FLT_MAX;
+	maxT = -FLT_MAX;
+
+	for (uint32_t index = 0; index < 16; ++index)
+	{
+		if (((mask >> index) & 0x1) == 0)
+		{
+			continue;
+		}
+
+		float project = 0.0f;
+		for (uint32_t channel = 0; channel < channelCount; ++channel)
+		{
+			project += (pixels.channels[channel][index] - mean[channel]) * axis[channel];
+		}
+
+		minT = std::min(minT, project);
+		maxT = std::max(maxT, project);
+	}
+#endif
+
+	if (minT > maxT)
+	{
+		minT = 0.0f;
+		maxT = 0.0f;
+	}
+
+	for (uint32_t channel = 0; channel < 4; ++channel)
+	{
+		outEndpoint0[channel] = std::clamp(mean[channel] + axis[channel] * minT, 0.0f, 255.0f);
+		outEndpoint1[channel] = std::clamp(mean[channel] + axis[channel] * maxT, 0.0f, 255.0f);
+	}
+}
+
+float BlockCodec::SelectIndices(const BlockPixels& pixels, uint32_t channelCount, const float palette[][4], uint32_t paletteCount, uint8_t outIndices[16], uint16_t mask)
+{
+	float totalError = 0.0f;
+
+#if defined(BLOCK_CODEC_SIMD)
+	for (uint32_t group = 0; group < 4; ++group)
+	{
+		__m128 values[4];
+		for (uint32_t channel = 0; channel < channelCount; ++channel)
+		{
+			values[channel] = _mm_load_ps(&pixels.channels[channel][group * 4]);
+		}
+
+		__m128 bestError = _mm_set1_ps(FLT_MAX);
+		__m128i bestIndex = _mm_setzero_si128();
+
+		for (uint32_t entry = 0; entry < paletteCount; ++entry)
+		{
+			__m128 error = _mm_setzero_ps();
+			for (uint32_t channel = 0; channel < channelCount; ++channel)
+			{
+				__m128 delta = _mm_sub_ps(values[channel], _mm_set1_ps(palette[entry][channel]));
+				error = _mm_add_ps(error, _mm_mul_ps(delta, delta));
+			}
+
+			__m128i mask = _mm_castps_si128(_mm_cmplt_ps(error, bestError));
+			bestError = _mm_min_ps(error, bestError);
+			bestIndex = _mm_or_si128(_mm_and_si128(mask, _mm_set1_epi32(static_cast<int32_t>(entry))), _mm_andnot_si128(mask, bestIndex));
+		}
+
+		alignas(16) float errorLanes[4];
+		alignas(16) int32_t indexLanes[4];
+		_mm_store_ps(errorLanes, bestError);
+		_mm_store_si128(reinterpret_cast<__m128i*>(indexLanes), bestIndex);
+
+		for (uint32_t lane = 0; lane < 4; ++lane)
+		{
+			if (((mask >> (group * 4 + lane)) & 0x1) == 0)
+			{
+				continue;
+			}
+
+			outIndices[group * 4 + lane] = static_cast<uint8_t>(indexLanes[lane]);
+			totalError += errorLanes[lane];
+		}
+	}
+#else
+	for (uint32_t index = 0; index < 16; ++index)
+	{
+		if (((mask >> index) & 0x1) == 0)
+		{
+			continue;
+		}
+
+		float bestError = FLT_MAX;
+		uint8_t bestIndex = 0;
+
+		for (uint32_t entry = 0; entry < paletteCount; ++entry)
+		{
+			float error = 0.0f;
+			for (uint32_t channel = 0; channel < channelCount; ++channel)
+			{
+				float delta = pixels.channels[channel][index] - palette[entry][channel];
+				error += delta * delta;
+			}
+
+			if (error < bestError)
+			{
+				bestError = error;
+				bestIndex = static_cast<uint8_t>(entry);
+			}
+		}
+
+		outIndices[index] = bestIndex;
+		totalError += bestError;
+	}
+#endif
+
+	return totalError;
+}
+
+bool BlockCodec::SolveEndpoints(const BlockPixels& pixels, uint32_t channelCount, const float weights[16], float outEndpoint0[4], float outEndpoint1[4], uint16_t mask)
+{
+	float a = 0.0f;
+	float b = 0.0f;
+	float c = 0.0f;
+	float rhs0[4] = {};
+	float rhs1[4] = {};
+
+	for (uint32_t index = 0; index < 16; ++index)
+	{
+		if (((mask >> index) & 0x1) == 0)
+		{
+			continue;
+		}
+
+		float t = weights[index];
+		float s = 1.0f - t;
+
+		a += s * s;
+		b += s * t;
+		c += t * t;
+
+		for (uint32_t channel = 0; channel < channelCount; ++channel)
+		{
+			rhs0[channel] += s * pixels.channels[channel][index];
+			rhs1[channel] += t * pixels.channels[channel][index];
+		}
+	}
+
+	float determinant = a * c - b * b;
+	if (std::fabs(determinant) <= FLT_EPSILON)
+	{
+		return false;
+	}
+
+	float invDeterminant = 1.0f / determinant;
+	for (uint32_t channel = 0; channel < channelCount; ++channel)
+	{
+		outEndpoint0[channel] = std::clamp((c * rhs0[channel] - b * rhs1[channel]) * invDeterminant, 0.0f, 255.0f);
+		outEndpoint1[channel] = std::clamp((a * rhs1[channel] - b * rhs0[channel]) * invDeterminant, 0.0f, 255.0f);
+	}
+
+	return true;
+}
+
+void BlockCodec::ParallelFor(uint32_t count, const std::function<void(uint32_t)>& func)
+{
+	uint32_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+	threadCount = std::min(threadCount, count);
+
+	std::atomic<uint32_t> next = 0;
+	auto worker = [&]()
+		{
+			for (uint32_t index = next.fetch_add(1); index < count; index = next.fetch_add(1))
+			{
+				func(index);
+			}
+		};
+
+	std::vector<std::thread> threads;
+	for (uint32_t index = 1; index < threadCount; ++index)
+	{
+		threads.emplace_back(worker);
+	}
+
+	worker();
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "BlockCompressUtils.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BLOCK_CODEC_SIMD
+#include <emmintrin.h>
+#endif
+
+
+/**
+ * @brief 4x4   BC ڴ ڴԴϴ.
+ *
+ * @note
+ * -  ȼ  켱  RGBA8 64ƮԴϴ.
+ * -  Ž ε  äκ и(SoA) ε Ҽ ȼ մϴ.
+ */
+namespace BlockCodec
+{
+	/**
+	 * @brief äκ и  ȼԴϴ.
+	 */
+	struct alignas(16) BlockPixels
+	{
+		float channels[4][16];
+	};
+
+
+	/**
+	 * @brief RGBA8  äκ и ε Ҽ ȼ ȯմϴ.
+	 *
+	 * @param rgba  켱  RGBA8 Դϴ.
+	 * @param outPixels ȯ ȼԴϴ.
+	 */
+	void LoadBlockPixels(const uint8_t* rgba, BlockPixels& outPixels);
+
+
+	/**
+	 * @brief  ȼ հ ּ  մϴ.
+	 *
+	 * @param pixels  ȼԴϴ.
+	 * @param channelCount 꿡   ä Դϴ.
+	 * @param outMean äκ Դϴ.
+	 * @param outAxis ȭ ּ Դϴ. ȼ  ٸ 0 Դϴ.
+	 * @param mask 꿡  ȼ Ʈ ũԴϴ. Ʈ i ȼ i մϴ.
+	 */
+	void ComputePrincipalAxis(const BlockPixels& pixels, uint32_t channelCount, float outMean[4], float outAxis[4], uint16_t mask = 0xFFFF);
+
+
+	/**
+	 * @brief ּ ࿡  ȼ κ   մϴ.
+	 *
+	 * @param pixels  ȼԴϴ.
+	 * @param channelCount 꿡   ä Դϴ.
+	 * @param outEndpoint0      Դϴ.
+	 * @param outEndpoint1    ū  Դϴ.
+	 * @param mask 꿡  ȼ Ʈ ũԴϴ. Ʈ i ȼ i մϴ.
+	 */
+	void ComputeAxisEndpoints(const BlockPixels& pixels, uint32_t channelCount, float outEndpoint0[4], float outEndpoint1[4], uint16_t mask = 0xFFFF);
+
+
+	/**
+	 * @brief  ȼ   ȷƮ ε մϴ.
+	 *
+	 * @param pixels  ȼԴϴ.
+	 * @param channelCount 񱳿   ä Դϴ.
+	 * @param palette ȷƮ Դϴ.
+	 * @param paletteCount ȷƮ  Դϴ. ִ 16Դϴ.
+	 * @param outIndices ȼ  εԴϴ. ũ   ȼ ε ٲ ʽϴ.
+	 * @param mask 꿡  ȼ Ʈ ũԴϴ. Ʈ i ȼ i մϴ.
+	 *
+	 * @return  ȷƮ  ȼ     ȯմϴ.
+	 */
+	float SelectIndices(const BlockPixels& pixels, uint32_t channelCount, const float palette[][4], uint32_t paletteCount, uint8_t outIndices[16], uint16_t mask = 0xFFFF);
+
+
+	/**
+	 * @brief ȼ  ġκ  ּ   ּ  մϴ.
+	 *
+	 * @param pixels  ȼԴϴ.
+	 * @param channelCount 꿡   ä Դϴ.
+	 * @param weights ȼ  °   ġԴϴ.  0.0 ~ 1.0Դϴ.
+	 * @param outEndpoint0  ù ° Դϴ.
+	 * @param outEndpoint1   ° Դϴ.
+	 * @param mask 꿡  ȼ Ʈ ũԴϴ. Ʈ i ȼ i մϴ.
+	 *
+	 * @return ذ ϳ ȴٸ true, ׷  false ȯմϴ.
+	 */
+	bool SolveEndpoints(const BlockPixels& pixels, uint32_t channelCount, const float weights[16], float outEndpoint0[4], float outEndpoint1[4], uint16_t mask = 0xFFFF);
+
+
+	/**
+	 * @brief BC1  ڵմϴ.
+	 *
+	 * @param rgba  켱  RGBA8 Դϴ.
+	 * @param outBlock ڵ 8Ʈ Դϴ.
+	 * @param quality  ǰԴϴ.
+	 *
+	 * @note  ä ϸ ׻ 4  ڵϹǷ BC3  ε   ֽϴ.
+	 */
+	void EncodeBC1(const uint8_t* rgba, uint8_t* outBlock, BlockCompressUtils::EQuality quality);
+
+
+	/**
+	 * @brief BC1  ڵմϴ.
+	 *
+	 * @param block 8Ʈ Դϴ.
+	 * @param outRGBA ڵ RGBA8 Դϴ.
+	 * @param bIsForceFourColor    4  ڵ Դϴ. BC3  ̶ trueԴϴ.
+	 */
+	void DecodeBC1(const uint8_t* block, uint8_t* outRGBA, bool bIsForceFourColor);
+
+
+	/**
+	 * @brief ä ϳ BC4  ڵմϴ.
+	 *
+	 * @param rgba  켱  RGBA8 Դϴ.
+	 * @param channel ڵ ä εԴϴ.
+	 * @param outBlock ڵ 8Ʈ Դϴ.
+	 */
+	void EncodeBC4(const uint8_t* rgba, uint32_t channel, uint8_t* outBlock);
+
+
+	/**
+	 * @brief BC4  ä ϳ ڵմϴ.
+	 *
+	 * @param block 8Ʈ Դϴ.
+	 * @param channel ڵ ä εԴϴ.
+	 * @param outRGBA ڵ RGBA8 Դϴ.
+	 */
+	void DecodeBC4(const uint8_t* block, uint32_t channel, uint8_t* outRGBA);
+
+
+	/**
+	 * @brief BC7  ڵմϴ.
+	 *
+	 * @param rgba  켱  RGBA8 Դϴ.
+	 * @param outBlock ڵ 16Ʈ Դϴ.
+	 * @param quality  ǰԴϴ.
+	 */
+	void EncodeBC7(const uint8_t* rgba, uint8_t* outBlock, BlockCompressUtils::EQuality quality);
+
+
+	/**
+	 * @brief BC7  ڵմϴ.
+	 *
+	 * @param block 16Ʈ Դϴ.
+	 * @param outRGBA ڵ RGBA8 Դϴ.
+	 *
+	 * @note ڴ ϴ  1, 3, 5, 6, 7 ڵϸ,    0 äϴ.
+	 */
+	void DecodeBC7(const uint8_t* block, uint8_t* outRGBA);
+
+
+	/**
+	 * @brief [0, count)  ϵ  ŭ  ķ óմϴ.
+	 *
+	 * @param count ó ׸ Դϴ.
+	 * @param func ׸ ϳ ó ԼԴϴ.
+	 *
+	 * @note ȣ 嵵 ۾ ϸ,  ׸ ó  ȯմϴ.
+	 */
+	void ParallelFor(uint32_t count, const std::function<void(uint32_t)>& func);
+}
\ No newline at end of file
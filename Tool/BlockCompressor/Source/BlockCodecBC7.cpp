@@ -0,0 +1,1037 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+#include "BlockCodec.h"
+
+/** @brief 2Ʈ ε  ġԴϴ. */
+static const int32_t WEIGHTS2[4] = { 0, 21, 43, 64 };
+
+/** @brief 3Ʈ ε  ġԴϴ. */
+static const int32_t WEIGHTS3[8] = { 0, 9, 18, 27, 37, 46, 55, 64 };
+
+/** @brief 4Ʈ ε  ġԴϴ. */
+static const int32_t WEIGHTS4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+/** @brief    Դϴ. Ʈ i 1̸ ȼ i  ° ¿ մϴ. */
+static const uint16_t PARTITIONS2[64] =
+{
+	0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+	0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+	0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+	0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+	0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+	0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+	0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+	0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22,
+};
+
+/** @brief   ҿ  °  Ŀ ȼ εԴϴ. ù °  Ŀ ׻ 0Դϴ. */
+static const uint8_t ANCHORS2[64] =
+{
+	15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15,
+	15,  2,  8,  2,  2,  8,  8, 15,
+	 2,  8,  2,  2,  8,  8,  2,  2,
+	15, 15,  6,  8,  2,  8, 15, 15,
+	 2,  8,  2,  2,  2, 15, 15,  6,
+	 6,  2,  6,  8, 15, 15,  2,  2,
+	15, 15, 15, 15, 15,  2,  2, 15,
+};
+
+/** @brief   (1, 3, 7) Ʈ Դϴ. */
+struct TwoSubsetMode
+{
+	uint32_t mode;
+	uint32_t channelCount; // 3̸ Ĵ ׻ 255
+	uint32_t endpointBits; // P Ʈ   Ʈ 
+	bool bIsSharedPBit;    //    P Ʈ ϳ ϴ 
+	uint32_t indexBits;
+};
+
+static const TwoSubsetMode MODE1 = { 1, 3, 6, true,  3 };
+static const TwoSubsetMode MODE3 = { 3, 3, 7, false, 2 };
+static const TwoSubsetMode MODE7 = { 7, 4, 5, false, 2 };
+
+/** @brief    ڵ Դϴ. */
+struct TwoSubsetBlock
+{
+	const TwoSubsetMode* mode = nullptr;
+	uint32_t partition = 0;
+	int32_t endpoints[2][2][4]; // [][][ä], P Ʈ  ȭ 
+	int32_t pbits[2][2];        // [][]
+	uint8_t indices[16];
+	float error = FLT_MAX;
+};
+
+/** @brief  6 ڵ Դϴ. */
+struct Mode6Block
+{
+	int32_t endpoints[2][4]; // 7Ʈ 
+	int32_t pbits[2];
+	uint8_t indices[16];
+	float error = FLT_MAX;
+};
+
+/** @brief  5 ڵ Դϴ. */
+struct Mode5Block
+{
+	int32_t colorEndpoints[2][3]; // 7Ʈ 
+	int32_t alphaEndpoints[2];
+	uint8_t colorIndices[16];
+	uint8_t alphaIndices[16];
+	float error = FLT_MAX;
+};
+
+/** @brief  Ʈ º LSB  Ʈ մϴ. */
+static void WriteBits(uint8_t* block, uint32_t& offset, uint32_t value, uint32_t count)
+{
+	for (uint32_t bit = 0; bit < count; ++bit, ++offset)
+	{
+		block[offset / 8] |= static_cast<uint8_t>(((value >> bit) & 0x1) << (offset % 8));
+	}
+}
+
+/** @brief  Ʈ º LSB  Ʈ нϴ. */
+static uint32_t ReadBits(const uint8_t* block, uint32_t& offset, uint32_t count)
+{
+	uint32_t value = 0;
+	for (uint32_t bit = 0; bit < count; ++bit, ++offset)
+	{
+		value |= ((block[offset / 8] >> (offset % 8)) & 0x1) << bit;
+	}
+
+	return value;
+}
+
+/** @brief   ̸ BC7 ġ մϴ. */
+static int32_t Interpolate(int32_t value0, int32_t value1, int32_t weight)
+{
+	return ((64 - weight) * value0 + weight * value1 + 32) >> 6;
+}
+
+/** @brief 0.0 ~ 255.0   P Ʈ Բ 7Ʈ ȭմϴ. */
+static int32_t QuantizeWithPBit(float value, int32_t pbit)
+{
+	return std::clamp(static_cast<int32_t>(std::lround((value - static_cast<float>(pbit)) * 0.5f)), 0, 127);
+}
+
+/** @brief P Ʈ  precision Ʈ  8Ʈ մϴ.  Ʈ  Ʈ ݺմϴ. */
+static int32_t Unquantize(int32_t value, uint32_t precision)
+{
+	return (value << (8 - precision)) | (value >> (2 * precision - 8));
+}
+
+/** @brief 0.0 ~ 255.0   P Ʈ Բ bits Ʈ ȭմϴ.      մϴ. */
+static int32_t QuantizeEndpoint(float value, uint32_t bits, int32_t pbit)
+{
+	int32_t maxValue = (1 << bits) - 1;
+	int32_t center = std::clamp(static_cast<int32_t>(std::lround((value * static_cast<float>((2 << bits) - 1) / 255.0f - static_cast<float>(pbit)) * 0.5f)), 0, maxValue);
+
+	int32_t best = center;
+	float bestError = FLT_MAX;
+	for (int32_t candidate = std::max(center - 1, 0); candidate <= std::min(center + 1, maxValue); ++candidate)
+	{
+		float error = std::fabs(static_cast<float>(Unquantize((candidate << 1) | pbit, bits + 1)) - value);
+		if (error < bestError)
+		{
+			best = candidate;
+			bestError = error;
+		}
+	}
+
+	return best;
+}
+
+/** @brief  ϳ ȭ   P Ʈ մϴ. */
+static int32_t SelectPBit(const float endpoint[4])
+{
+	float errors[2] = {};
+	for (int32_t pbit = 0; pbit < 2; ++pbit)
+	{
+		for (uint32_t channel = 0; channel < 4; ++channel)
+		{
+			float delta = static_cast<float>((QuantizeWithPBit(endpoint[channel], pbit) << 1) | pbit) - endpoint[channel];
+			errors[pbit] += delta * delta;
+		}
+	}
+
+	return errors[1] < errors[0] ? 1 : 0;
+}
+
+/** @brief  6 ȭ  ε  մϴ. */
+static void EvaluateMode6(const BlockCodec::BlockPixels& pixels, Mode6Block& block)
+{
+	int32_t values[2][4];
+	for (uint32_t endpoint = 0; endpoint < 2; ++endpoint)
+	{
+		for (uint32_t channel = 0; channel < 4; ++channel)
+		{
+			values[endpoint][channel] = (block.endpoints[endpoint][channel] << 1) | block.pbits[endpoint];
+		}
+	}
+
+	float palette[16][4];
+	for (uint32_t entry = 0; entry < 16; ++entry)
+	{
+		for (uint32_t channel = 0; channel < 4; ++channel)
+		{
+			palette[entry][channel] = static_cast<float>(Interpolate(values[0][channel], values[1][channel], WEIGHTS4[entry]));
+		}
+	}
+
+	block.error = BlockCodec::SelectIndices(pixels, 4, palette, 16, block.indices);
+}
+
+/** @brief ε Ҽ  ȭϿ  6  մϴ. P Ʈ   Ž  ֽϴ. */
+static Mode6Block QuantizeMode6(const BlockCodec::BlockPixels& pixels, const float endpoint0[4], const float endpoint1[4], bool bIsSearchPBits)
+{
+	Mode6Block best;
+
+	for (int32_t combination = 0; combination < 4; ++combination)
+	{
+		Mode6Block block;
+		if (bIsSearchPBits)
+		{
+			block.pbits[0] = combination & 0x1;
+			block.pbits[1] = (combination >> 1) & 0x1;
+		}
+		else
+		{
+			block.pbits[0] = SelectPBit(endpoint0);
+			block.pbits[1] = SelectPBit(endpoint1);
+		}
+
+		for (uint32_t channel = 0; channel < 4; ++channel)
+		{
+			block.endpoints[0][channel] = QuantizeWithPBit(endpoint0[channel], block.pbits[0]);
+			block.endpoints[1][channel] = QuantizeWithPBit(endpoint1[channel], block.pbits[1]);
+		}
+
+		EvaluateMode6(pixels, block);
+		if (block.error < best.error)
+		{
+			best = block;
+		}
+
+		if (!bIsSearchPBits)
+		{
+			break;
+		}
+	}
+
+	return best;
+}
+
+/** @brief  6  ڵմϴ. */
+static Mode6Block EncodeMode6(const BlockCodec::BlockPixels& pixels, BlockCompressUtils::EQuality quality)
+{
+	bool bIsSearchPBits = (quality != BlockCompressUtils::EQuality::Fast);
+	uint32_t refineCount = (quality == BlockCompressUtils::EQuality::Fast) ? 1 : 3;
+
+	float endpoint0[4];
+	float endpoint1[4];
+	BlockCodec::ComputeAxisEndpoints(pixels, 4, endpoint0, endpoint1);
+
+	Mode6Block best = QuantizeMode6(pixels, endpoint0, endpoint1, bIsSearchPBits);
+	for (uint32_t refine = 0; refine < refineCount; ++refine)
+	{
+		float weights[16];
+		for (uint32_t index = 0; index < 16; ++index)
+		{
+			weights[index] = static_cast<float>(WEIGHTS4[best.indices[index]]) / 64.0f;
+		}
+
+		if (!BlockCodec::SolveEndpoints(pixels, 4, weights, endpoint0, endpoint1))
+		{
+			break;
+		}
+
+		Mode6Block block = QuantizeMode6(pixels, endpoint0, endpoint1, bIsSearchPBits);
+		if (block.error >= best.error)
+		{
+			break;
+		}
+
+		best = block;
+	}
+
+	if (quality == BlockCompressUtils::EQuality::High)
+	{
+		bool bIsImproved = true;
+		for (uint32_t pass = 0; pass < 4 && bIsImproved; ++pass)
+		{
+			bIsImproved = false;
+
+			for (uint32_t candidate = 0; candidate < 16; ++candidate)
+			{
+				uint32_t endpoint = candidate / 8;
+				uint32_t channel = (candidate / 2) % 4;
+				int32_t step = (candidate % 2 == 0) ? -1 : 1;
+
+				Mode6Block block = best;
+				int32_t& value = block.endpoints[endpoint][channel];
+				if (value + step < 0 || value + step > 127)
+				{
+					continue;
+				}
+
+				value += step;
+				EvaluateMode6(pixels, block);
+				if (block.error < best.error)
+				{
+					best = block;
+					bIsImproved = true;
+				}
+			}
+		}
+	}
+
+	return best;
+}
+
+/** @brief  5   ε  մϴ. */
+static float EvaluateMode5Color(const BlockCodec::BlockPixels& pixels, const int32_t endpoints[2][3], uint8_t outIndices[16])
+{
+	float palette[4][4];
+	for (uint32_t entry = 0; entry < 4; ++entry)
+	{
+		for (uint32_t channel = 0; channel < 3; ++channel)
+		{
+			int32_t value0 = (endpoints[0][channel] << 1) | (endpoints[0][channel] >> 6);
+			int32_t value1 = (endpoints[1][channel] << 1) | (endpoints[1][channel] >> 6);
+			palette[entry][channel] = static_cast<float>(Interpolate(value0, value1, WEIGHTS2[entry]));
+		}
+	}
+
+	return BlockCodec::SelectIndices(pixels, 3, palette, 4, outIndices);
+}
+
+/** @brief  5   ε  մϴ. */
+static float EvaluateMode5Alpha(const BlockCodec::BlockPixels& alphaPixels, const int32_t endpoints[2], uint8_t outIndices[16])
+{
+	float palette[4][4];
+	for (uint32_t entry = 0; entry < 4; ++entry)
+	{
+		palette[entry][0] = static_cast<float>(Interpolate(endpoints[0], endpoints[1], WEIGHTS2[entry]));
+	}
+
+	return BlockCodec::SelectIndices(alphaPixels, 1, palette, 4, outIndices);
+}
+
+/** @brief  5  ڵմϴ.  ĸ   ε ڵմϴ. */
+static Mode5Block EncodeMode5(const BlockCodec::BlockPixels& pixels, BlockCompressUtils::EQuality quality)
+{
+	uint32_t refineCount = (quality == BlockCompressUtils::EQuality::High) ? 3 : 2;
+
+	Mode5Block block;
+
+	float endpoint0[4];
+	float endpoint1[4];
+	BlockCodec::ComputeAxisEndpoints(pixels, 3, endpoint0, endpoint1);
+
+	auto quantizeColor = [](const float value) { return std::clamp(static_cast<int32_t>(std::lround(value * 127.0f / 255.0f)), 0, 127); };
+	for (uint32_t channel = 0; channel < 3; ++channel)
+	{
+		block.colorEndpoints[0][channel] = quantizeColor(endpoint0[channel]);
+		block.colorEndpoints[1][channel] = quantizeColor(endpoint1[channel]);
+	}
+
+	float colorError = EvaluateMode5Color(pixels, block.colorEndpoints, block.colorIndices);
+	for (uint32_t refine = 0; refine < refineCount; ++refine)
+	{
+		float weights[16];
+		for (uint32_t index = 0; index < 16; ++index)
+		{
+			weights[index] = static_cast<float>(WEIGHTS2[block.colorIndices[index]]) / 64.0f;
+		}
+
+		if (!BlockCodec::SolveEndpoints(pixels, 3, weights, endpoint0, endpoint1))
+		{
+			break;
+		}
+
+		int32_t endpoints[2][3];
+		for (uint32_t channel = 0; channel < 3; ++channel)
+		{
+			endpoints[0][channel] = quantizeColor(endpoint0[channel]);
+			endpoints[1][channel] = quantizeColor(endpoint1[channel]);
+		}
+
+		uint8_t indices[16];
+		float error = EvaluateMode5Color(pixels, endpoints, indices);
+		if (error >= colorError)
+		{
+			break;
+		}
+
+		colorError = error;
+		std::memcpy(block.colorEndpoints, endpoints, sizeof(endpoints));
+		std::copy(indices, indices + 16, block.colorIndices);
+	}
+
+	BlockCodec::BlockPixels alphaPixels;
+	float minAlpha = 255.0f;
+	float maxAlpha = 0.0f;
+	for (uint32_t index = 0; index < 16; ++index)
+	{
+		alphaPixels.channels[0][index] = pixels.channels[3][index];
+		minAlpha = std::min(minAlpha, pixels.channels[3][index]);
+		maxAlpha = std::max(maxAlpha, pixels.channels[3][index]);
+	}
+
+	block.alphaEndpoints[0] = static_cast<int32_t>(minAlpha);
+	block.alphaEndpoints[1] = static_cast<int32_t>(maxAlpha);
+
+	float alphaError = EvaluateMode5Alpha(alphaPixels, block.alphaEndpoints, block.alphaIndices);
+	for (uint32_t refine = 0; refine < refineCount && alphaError > 0.0f; ++refine)
+	{
+		float weights[16];
+		for (uint32_t index = 0; index < 16; ++index)
+		{
+			weights[index] = static_cast<float>(WEIGHTS2[block.alphaIndices[index]]) / 64.0f;
+		}
+
+		if (!BlockCodec::SolveEndpoints(alphaPixels, 1, weights, endpoint0, endpoint1))
+		{
+			break;
+		}
+
+		int32_t endpoints[2] = { static_cast<int32_t>(std::lround(endpoint0[0])), static_cast<int32_t>(std::lround(endpoint1[0])) };
+		uint8_t indices[16];
+		float error = EvaluateMode5Alpha(alphaPixels, endpoints, indices);
+		if (error >= alphaError)
+		{
+			break;
+		}
+
+		alphaError = error;
+		block.alphaEndpoints[0] = endpoints[0];
+		block.alphaEndpoints[1] = endpoints[1];
+		std::copy(indices, indices + 16, block.alphaIndices);
+	}
+
+	block.error = colorError + alphaError;
+	return block;
+}
+
+/** @brief ε Ʈ  شϴ  ġ ϴ. */
+static const int32_t* GetWeights(uint32_t indexBits)
+{
+	return (indexBits == 2) ? WEIGHTS2 : ((indexBits == 3) ? WEIGHTS3 : WEIGHTS4);
+}
+
+/** @brief   忡  ϳ ȭ  ε  մϴ. */
+static float EvaluateSubset(const BlockCodec::BlockPixels& pixels, const TwoSubsetMode& mode, uint16_t mask, const int32_t endpoints[2][4], const int32_t pbits[2], uint8_t outIndices[16])
+{
+	const int32_t* weights = GetWeights(mode.indexBits);
+	uint32_t paletteCount = 1u << mode.indexBits;
+
+	float palette[8][4];
+	for (uint32_t channel = 0; channel < mode.channelCount; ++channel)
+	{
+		int32_t value0 = Unquantize((endpoints[0][channel] << 1) | pbits[0], mode.endpointBits + 1);
+		int32_t value1 = Unquantize((endpoints[1][channel] << 1) | pbits[1], mode.endpointBits + 1);
+		for (uint32_t entry = 0; entry < paletteCount; ++entry)
+		{
+			palette[entry][channel] = static_cast<float>(Interpolate(value0, value1, weights[entry]));
+		}
+	}
+
+	return BlockCodec::SelectIndices(pixels, mode.channelCount, palette, paletteCount, outIndices, mask);
+}
+
+/** @brief ε Ҽ  ȭϿ  ϳ մϴ.  P Ʈ   Žմϴ. */
+static float QuantizeSubset(const BlockCodec::BlockPixels& pixels, const TwoSubsetMode& mode, uint16_t mask, const float endpoint0[4], const float endpoint1[4], int32_t outEndpoints[2][4], int32_t outPBits[2], uint8_t outIndices[16])
+{
+	float bestError = FLT_MAX;
+
+	uint32_t combinationCount = mode.bIsSharedPBit ? 2 : 4;
+	for (uint32_t combination = 0; combination < combinationCount; ++combination)
+	{
+		int32_t pbits[2];
+		pbits[0] = combination & 0x1;
+		pbits[1] = mode.bIsSharedPBit ? pbits[0] : ((combination >> 1) & 0x1);
+
+		int32_t endpoints[2][4] = {};
+		for (uint32_t channel = 0; channel < mode.channelCount; ++channel)
+		{
+			endpoints[0][channel] = QuantizeEndpoint(endpoint0[channel], mode.endpointBits, pbits[0]);
+			endpoints[1][channel] = QuantizeEndpoint(endpoint1[channel], mode.endpointBits, pbits[1]);
+		}
+
+		uint8_t indices[16];
+		std::copy(outIndices, outIndices + 16, indices);
+
+		float error = EvaluateSubset(pixels, mode, mask, endpoints, pbits, indices);
+		if (error < bestError)
+		{
+			bestError = error;
+			std::memcpy(outEndpoints, endpoints, sizeof(endpoints));
+			outPBits[0] = pbits[0];
+			outPBits[1] = pbits[1];
+			std::copy(indices, indices + 16, outIndices);
+		}
+	}
+
+	return bestError;
+}
+
+/** @brief   忡  ϳ ڵմϴ. ּ   Ͽ ּ  ٵϴ. */
+static float EncodeSubset(const BlockCodec::BlockPixels& pixels, const TwoSubsetMode& mode, uint16_t mask, uint32_t refineCount, int32_t outEndpoints[2][4], int32_t outPBits[2], uint8_t outIndices[16])
+{
+	const int32_t* weights = GetWeights(mode.indexBits);
+
+	float endpoint0[4];
+	float endpoint1[4];
+	BlockCodec::ComputeAxisEndpoints(pixels, mode.channelCount, endpoint0, endpoint1, mask);
+
+	float bestError = QuantizeSubset(pixels, mode, mask, endpoint0, endpoint1, outEndpoints, outPBits, outIndices);
+	for (uint32_t refine = 0; refine < refineCount && bestError > 0.0f; ++refine)
+	{
+		float pixelWeights[16];
+		for (uint32_t index = 0; index < 16; ++index)
+		{
+			pixelWeights[index] = static_cast<float>(weights[outIndices[index]]) / 64.0f;
+		}
+
+		if (!BlockCodec::SolveEndpoints(pixels, mode.channelCount, pixelWeights, endpoint0, endpoint1, mask))
+		{
+			break;
+		}
+
+		int32_t endpoints[2][4];
+		int32_t pbits[2];
+		uint8_t indices[16];
+		std::copy(outIndices, outIndices + 16, indices);
+
+		float error = QuantizeSubset(pixels, mode, mask, endpoint0, endpoint1, endpoints, pbits, indices);
+		if (error >= bestError)
+		{
+			break;
+		}
+
+		bestError = error;
+		std::memcpy(outEndpoints, endpoints, sizeof(endpoints));
+		outPBits[0] = pbits[0];
+		outPBits[1] = pbits[1];
+		std::copy(indices, indices + 16, outIndices);
+	}
+
+	return bestError;
+}
+
+/** @brief      ϳ ڵմϴ. */
+static TwoSubsetBlock EncodeTwoSubset(const BlockCodec::BlockPixels& pixels, const TwoSubsetMode& mode, uint32_t partition, uint32_t refineCount)
+{
+	TwoSubsetBlock block;
+	block.mode = &mode;
+	block.partition = partition;
+	std::memset(block.endpoints, 0, sizeof(block.endpoints));
+	std::memset(block.indices, 0, sizeof(block.indices));
+
+	uint16_t masks[2] = { static_cast<uint16_t>(~PARTITIONS2[partition]), PARTITIONS2[partition] };
+
+	block.error = 0.0f;
+	for (uint32_t subset = 0; subset < 2; ++subset)
+	{
+		block.error += EncodeSubset(pixels, mode, masks[subset], refineCount, block.endpoints[subset], block.pbits[subset], block.indices);
+	}
+
+	return block;
+}
+
+/** @brief ȼ  ä  ä (Ī   ﰢ) Դϴ.  л   ֽϴ. */
+struct PixelMoments
+{
+	static const uint32_t COUNT = 14;
+
+	float values[COUNT] = {};
+};
+
+/** @brief   ȼ ึ 16 ȼ  Ʈ  ̸  ǥԴϴ. */
+struct BlockMoments
+{
+	PixelMoments rows[4][16];
+};
+
+/** @brief  ϳ ȼ ּ  ϳ ٻ     մϴ. л 밢տ ִ   Դϴ. */
+static float ComputeResidualError(const float sum[PixelMoments::COUNT], float count)
+{
+	if (count <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	static const uint32_t PRODUCTS[4][4] =
+	{
+		{ 4, 5,  6,  7 },
+		{ 5, 8,  9, 10 },
+		{ 6, 9, 11, 12 },
+		{ 7, 10, 12, 13 },
+	};
+
+	float invCount = 1.0f / count;
+	float covariance[4][4];
+	float trace = 0.0f;
+	for (uint32_t row = 0; row < 4; ++row)
+	{
+		for (uint32_t col = 0; col < 4; ++col)
+		{
+			covariance[row][col] = sum[PRODUCTS[row][col]] - sum[row] * sum[col] * invCount;
+		}
+
+		trace += covariance[row][row];
+	}
+
+	if (trace <= 1.0f)
+	{
+		return 0.0f;
+	}
+
+	/** 밢 ⿡ Ͽ ŵ ִ  ãϴ. */
+	float axis[4] = { covariance[0][0], covariance[1][1], covariance[2][2], covariance[3][3] };
+	float eigenValue = 0.0f;
+	for (uint32_t iteration = 0; iteration < 4; ++iteration)
+	{
+		float next[4];
+		float lengthSquare = 0.0f;
+		for (uint32_t row = 0; row < 4; ++row)
+		{
+			next[row] = covariance[row][0] * axis[0] + covariance[row][1] * axis[1] + covariance[row][2] * axis[2] + covariance[row][3] * axis[3];
+			lengthSquare += next[row] * next[row];
+		}
+
+		if (lengthSquare <= FLT_EPSILON)
+		{
+			return trace;
+		}
+
+		float invLength = 1.0f / std::sqrt(lengthSquare);
+		float axisLengthSquare = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2] + axis[3] * axis[3];
+		eigenValue = std::sqrt(lengthSquare / axisLengthSquare);
+		for (uint32_t channel = 0; channel < 4; ++channel)
+		{
+			axis[channel] = next[channel] * invLength;
+		}
+	}
+
+	return std::max(trace - eigenValue, 0.0f);
+}
+
+/**
+ * @brief     ּ  ϳ ٻ    մϴ.
+ *
+ * @note
+ * -   Ĵ л 0̹Ƿ ׻  äη մϴ.
+ * - ȼ ึ ̸  Ʈ ǥ ã  Ʈ մϴ.
+ */
+static float EstimatePartitionError(const BlockMoments& moments, uint32_t partition)
+{
+	uint32_t mask = PARTITIONS2[partition];
+
+	float sums[2][PixelMoments::COUNT] = {};
+	float count = 0.0f;
+	for (uint32_t row = 0; row < 4; ++row)
+	{
+		uint32_t pattern = (mask >> (row * 4)) & 0xF;
+		const float* subset0 = moments.rows[row][pattern ^ 0xF].values;
+		const float* subset1 = moments.rows[row][pattern].values;
+		for (uint32_t value = 0; value < PixelMoments::COUNT; ++value)
+		{
+			sums[0][value] += subset0[value];
+			sums[1][value] += subset1[value];
+		}
+
+		count += static_cast<float>(((pattern >> 0) & 0x1) + ((pattern >> 1) & 0x1) + ((pattern >> 2) & 0x1) + ((pattern >> 3) & 0x1));
+	}
+
+	return ComputeResidualError(sums[0], 16.0f - count) + ComputeResidualError(sums[1], count);
+}
+
+/** @brief     Ϻ candidateCount    ڵϿ    մϴ. */
+static TwoSubsetBlock EncodeBestTwoSubset(const BlockCodec::BlockPixels& pixels, const TwoSubsetMode* const modes[], uint32_t modeCount, uint32_t candidateCount, uint32_t refineCount)
+{
+	BlockMoments moments;
+	for (uint32_t row = 0; row < 4; ++row)
+	{
+		for (uint32_t column = 0; column < 4; ++column)
+		{
+			uint32_t index = row * 4 + column;
+
+			PixelMoments pixel;
+			for (uint32_t channel = 0; channel < 4; ++channel)
+			{
+				pixel.values[channel] = pixels.channels[channel][index];
+			}
+
+			uint32_t product = 4;
+			for (uint32_t channel0 = 0; channel0 < 4; ++channel0)
+			{
+				for (uint32_t channel1 = channel0; channel1 < 4; ++channel1)
+				{
+					pixel.values[product++] = pixel.values[channel0] * pixel.values[channel1];
+				}
+			}
+
+			/**  Ʈ  տ ȼ մϴ.  0  Դϴ. */
+			for (uint32_t pattern = 0; pattern < 16; ++pattern)
+			{
+				if ((pattern >> column) & 0x1)
+				{
+					for (uint32_t value = 0; value < PixelMoments::COUNT; ++value)
+					{
+						moments.rows[row][pattern].values[value] += pixel.values[value];
+					}
+				}
+			}
+		}
+	}
+
+	std::pair<float, uint32_t> estimates[64];
+	for (uint32_t partition = 0; partition < 64; ++partition)
+	{
+		estimates[partition] = { EstimatePartitionError(moments, partition), partition };
+	}
+
+	std::partial_sort(estimates, estimates + candidateCount, estimates + 64);
+
+	TwoSubsetBlock best;
+	for (uint32_t candidate = 0; candidate < candidateCount; ++candidate)
+	{
+		for (uint32_t mode = 0; mode < modeCount; ++mode)
+		{
+			TwoSubsetBlock block = EncodeTwoSubset(pixels, *modes[mode], estimates[candidate].second, refineCount);
+			if (block.error < best.error)
+			{
+				best = block;
+			}
+		}
+	}
+
+	return best;
+}
+
+/** @brief  6  մϴ. ù ° ε ֻ Ʈ 0 ǵ  ȯմϴ. */
+static void PackMode6(Mode6Block block, uint8_t* outBlock)
+{
+	if (block.indices[0] >= 8)
+	{
+		std::swap(block.endpoints[0], block.endpoints[1]);
+		std::swap(block.pbits[0], block.pbits[1]);
+		for (uint32_t index = 0; index < 16; ++index)
+		{
+			block.indices[index] = static_cast<uint8_t>(15 - block.indices[index]);
+		}
+	}
+
+	std::memset(outBlock, 0, 16);
+
+	uint32_t offset = 0;
+	WriteBits(outBlock, offset, 1 << 6, 7);
+	for (uint32_t channel = 0; channel < 4; ++channel)
+	{
+		WriteBits(outBlock, offset, block.endpoints[0][channel], 7);
+		WriteBits(outBlock, offset, block.endpoints[1][channel], 7);
+	}
+
+	WriteBits(outBlock, offset, block.pbits[0], 1);
+	WriteBits(outBlock, offset, block.pbits[1], 1);
+
+	for (uint32_t index = 0; index < 16; ++index)
+	{
+		WriteBits(outBlock, offset, block.indices[index], index == 0 ? 3 : 4);
+	}
+}
+
+/** @brief  5  մϴ.   ù ° ε ֻ Ʈ 0 ǵ  ȯմϴ. */
+static void PackMode5(Mode5Block block, uint8_t* outBlock)
+{
+	if (block.colorIndices[0] >= 2)
+	{
+		std::swap(block.colorEndpoints[0], block.colorEndpoints[1]);
+		for (uint32_t index = 0; index < 16; ++index)
+		{
+			block.colorIndices[index] = static_cast<uint8_t>(3 - block.colorIndices[index]);
+		}
+	}
+
+	if (block.alphaIndices[0] >= 2)
+	{
+		std::swap(block.alphaEndpoints[0], block.alphaEndpoints[1]);
+		for (uint32_t index = 0; index < 16; ++index)
+		{
+			block.alphaIndices[index] = static_cast<uint8_t>(3 - block.alphaIndices[index]);
+		}
+	}
+
+	std::memset(outBlock, 0, 16);
+
+	uint32_t offset = 0;
+	WriteBits(outBlock, offset, 1 << 5, 6);
+	WriteBits(outBlock, offset, 0, 2); // ä ȯ(Rotation) 
+	for (uint32_t channel = 0; channel < 3; ++channel)
+	{
+		WriteBits(outBlock, offset, block.colorEndpoints[0][channel], 7);
+		WriteBits(outBlock, offset, block.colorEndpoints[1][channel], 7);
+	}
+
+	WriteBits(outBlock, offset, block.alphaEndpoints[0], 8);
+	WriteBits(outBlock, offset, block.alphaEndpoints[1], 8);
+
+	for (uint32_t index = 0; index < 16; ++index)
+	{
+		WriteBits(outBlock, offset, block.colorIndices[index], index == 0 ? 1 : 2);
+	}
+
+	for (uint32_t index = 0; index < 16; ++index)
+	{
+		WriteBits(outBlock, offset, block.alphaIndices[index], index == 0 ? 1 : 2);
+	}
+}
+
+/** @brief     մϴ. ¸ Ŀ ε ֻ Ʈ 0 ǵ  ȯմϴ. */
+static void PackTwoSubset(TwoSubsetBlock block, uint8_t* outBlock)
+{
+	const TwoSubsetMode& mode = *block.mode;
+	uint16_t partitionMask = PARTITIONS2[block.partition];
+	uint32_t anchors[2] = { 0, ANCHORS2[block.partition] };
+	uint8_t maxIndex = static_cast<uint8_t>((1u << mode.indexBits) - 1);
+
+	for (uint32_t subset = 0; subset < 2; ++subset)
+	{
+		if (block.indices[anchors[subset]] <= maxIndex / 2)
+		{
+			continue;
+		}
+
+		std::swap(block.endpoints[subset][0], block.endpoints[subset][1]);
+		std::swap(block.pbits[subset][0], block.pbits[subset][1]);
+		for (uint32_t index = 0; index < 16; ++index)
+		{
+			if (((partitionMask >> index) & 0x1) == subset)
+			{
+				block.indices[index] = static_cast<uint8_t>(maxIndex - block.indices[index]);
+			}
+		}
+	}
+
+	std::memset(outBlock, 0, 16);
+
+	uint32_t offset = 0;
+	WriteBits(outBlock, offset, 1 << mode.mode, mode.mode + 1);
+	WriteBits(outBlock, offset, block.partition, 6);
+	for (uint32_t channel = 0; channel < mode.channelCount; ++channel)
+	{
+		for (uint32_t subset = 0; subset < 2; ++subset)
+		{
+			WriteBits(outBlock, offset, block.endpoints[subset][0][channel], mode.endpointBits);
+			WriteBits(outBlock, offset, block.endpoints[subset][1][channel], mode.endpointBits);
+		}
+	}
+
+	for (uint32_t subset = 0; subset < 2; ++subset)
+	{
+		WriteBits(outBlock, offset, block.pbits[subset][0], 1);
+		if (!mode.bIsSharedPBit)
+		{
+			WriteBits(outBlock, offset, block.pbits[subset][1], 1);
+		}
+	}
+
+	for (uint32_t index = 0; index < 16; ++index)
+	{
+		bool bIsAnchor = (index == anchors[0] || index == anchors[1]);
+		WriteBits(outBlock, offset, block.indices[index], bIsAnchor ? mode.indexBits - 1 : mode.indexBits);
+	}
+}
+
+void BlockCodec::EncodeBC7(const uint8_t* rgba, uint8_t* outBlock, BlockCompressUtils::EQuality quality)
+{
+	BlockPixels pixels;
+	LoadBlockPixels(rgba, pixels);
+
+	Mode6Block mode6 = EncodeMode6(pixels, quality);
+
+	/** İ ϴ  İ     Ƿ,  ĸ и  5 Žմϴ. */
+	bool bIsVaryingAlpha = false;
+	for (uint32_t index = 1; index < 16; ++index)
+	{
+		bIsVaryingAlpha |= (pixels.channels[3][index] != pixels.channels[3][0]);
+	}
+
+	/** Normal  6  ȼ äθ  1 ϶  Ž մϴ. */
+	bool bIsHigh = (quality == BlockCompressUtils::EQuality::High);
+	float skipError = bIsHigh ? 0.0f : 64.0f;
+	if (quality == BlockCompressUtils::EQuality::Fast || mode6.error <= skipError)
+	{
+		PackMode6(mode6, outBlock);
+		return;
+	}
+
+	Mode5Block mode5;
+	if (bIsVaryingAlpha)
+	{
+		mode5 = EncodeMode5(pixels, quality);
+	}
+
+	/**
+	 *  谡 ִ     ٻϱ Ƿ,   带 Žմϴ.
+	 *    1, 3, İ ִ   7 մϴ.
+	 * Normal      4  ϳ, High 8   ڵմϴ.
+	 */
+	bool bIsOpaque = true;
+	for (uint32_t index = 0; index < 16; ++index)
+	{
+		bIsOpaque &= (pixels.channels[3][index] == 255.0f);
+	}
+
+	static const TwoSubsetMode* const OPAQUE_MODES[] = { &MODE1, &MODE3 };
+	static const TwoSubsetMode* const ALPHA_MODES[] = { &MODE7 };
+
+	uint32_t candidateCount = bIsHigh ? 8 : 4;
+	uint32_t refineCount = bIsHigh ? 2 : 1;
+	uint32_t modeCount = (bIsOpaque && bIsHigh) ? 2 : 1;
+
+	TwoSubsetBlock twoSubset = EncodeBestTwoSubset(pixels, bIsOpaque ? OPAQUE_MODES : ALPHA_MODES, modeCount, candidateCount, refineCount);
+
+	if (twoSubset.error < mode6.error && twoSubset.error < mode5.error)
+	{
+		PackTwoSubset(twoSubset, outBlock);
+	}
+	else if (mode5.error < mode6.error)
+	{
+		PackMode5(mode5, outBlock);
+	}
+	else
+	{
+		PackMode6(mode6, outBlock);
+	}
+}
+
+void BlockCodec::DecodeBC7(const uint8_t* block, uint8_t* outRGBA)
+{
+	uint32_t mode = 0;
+	while (mode < 8 && ((block[0] >> mode) & 0x1) == 0)
+	{
+		++mode;
+	}
+
+	if (mode == 6)
+	{
+		uint32_t offset = 7;
+
+		int32_t endpoints[2][4];
+		for (uint32_t channel = 0; channel < 4; ++channel)
+		{
+			endpoints[0][channel] = static_cast<int32_t>(ReadBits(block, offset, 7));
+			endpoints[1][channel] = static_cast<int32_t>(ReadBits(block, offset, 7));
+		}
+
+		int32_t pbit0 = static_cast<int32_t>(ReadBits(block, offset, 1));
+		int32_t pbit1 = static_cast<int32_t>(ReadBits(block, offset, 1));
+
+		for (uint32_t index = 0; index < 16; ++index)
+		{
+			uint32_t entry = ReadBits(block, offset, index == 0 ? 3 : 4);
+			for (uint32_t channel = 0; channel < 4; ++channel)
+			{
+				int32_t value0 = (endpoints[0][channel] << 1) | pbit0;
+				int32_t value1 = (endpoints[1][channel] << 1) | pbit1;
+				outRGBA[index * 4 + channel] = static_cast<uint8_t>(Interpolate(value0, value1, WEIGHTS4[entry]));
+			}
+		}
+	}
+	else if (mode == 5)
+	{
+		uint32_t offset = 6;
+		uint32_t rotation = ReadBits(block, offset, 2);
+
+		int32_t endpoints[2][4];
+		for (uint32_t channel = 0; channel < 3; ++channel)
+		{
+			for (uint32_t endpoint = 0; endpoint < 2; ++endpoint)
+			{
+				int32_t value = static_cast<int32_t>(ReadBits(block, offset, 7));
+				endpoints[endpoint][channel] = (value << 1) | (value >> 6);
+			}
+		}
+
+		endpoints[0][3] = static_cast<int32_t>(ReadBits(block, offset, 8));
+		endpoints[1][3] = static_cast<int32_t>(ReadBits(block, offset, 8));
+
+		uint32_t alphaOffset = offset + 31;
+		for (uint32_t index = 0; index < 16; ++index)
+		{
+			uint32_t colorEntry = ReadBits(block, offset, index == 0 ? 1 : 2);
+			uint32_t alphaEntry = ReadBits(block, alphaOffset, index == 0 ? 1 : 2);
+
+			uint8_t* pixel = &outRGBA[index * 4];
+			for (uint32_t channel = 0; channel < 3; ++channel)
+			{
+				pixel[channel] = static_cast<uint8_t>(Interpolate(endpoints[0][channel], endpoints[1][channel], WEIGHTS2[colorEntry]));
+			}
+
+			pixel[3] = static_cast<uint8_t>(Interpolate(endpoints[0][3], endpoints[1][3], WEIGHTS2[alphaEntry]));
+			if (rotation != 0)
+			{
+				std::swap(pixel[3], pixel[rotation - 1]);
+			}
+		}
+	}
+	else if (mode == 1 || mode == 3 || mode == 7)
+	{
+		const TwoSubsetMode& info = (mode == 1) ? MODE1 : ((mode == 3) ? MODE3 : MODE7);
+		uint32_t offset = mode + 1;
+		uint32_t partition = ReadBits(block, offset, 6);
+
+		int32_t endpoints[2][2][4] = {};
+		for (uint32_t channel = 0; channel < info.channelCount; ++channel)
+		{
+			for (uint32_t subset = 0; subset < 2; ++subset)
+			{
+				endpoints[subset][0][channel] = static_cast<int32_t>(ReadBits(block, offset, info.endpointBits));
+				endpoints[subset][1][channel] = static_cast<int32_t>(ReadBits(block, offset, info.endpointBits));
+			}
+		}
+
+		int32_t pbits[2][2];
+		for (uint32_t subset = 0; subset < 2; ++subset)
+		{
+			pbits[subset][0] = static_cast<int32_t>(ReadBits(block, offset, 1));
+			pbits[subset][1] = info.bIsSharedPBit ? pbits[subset][0] : static_cast<int32_t>(ReadBits(block, offset, 1));
+		}
+
+		int32_t values[2][2][4];
+		for (uint32_t subset = 0; subset < 2; ++subset)
+		{
+			for (uint32_t endpoint = 0; endpoint < 2; ++endpoint)
+			{
+				for (uint32_t channel = 0; channel < 4; ++channel)
+				{
+					values[subset][endpoint][channel] = (channel < info.channelCount) ? Unquantize((endpoints[subset][endpoint][channel] << 1) | pbits[subset][endpoint], info.endpointBits + 1) : 255;
+				}
+			}
+		}
+
+		const int32_t* weights = GetWeights(info.indexBits);
+		uint32_t anchor = ANCHORS2[partition];
+		for (uint32_t index = 0; index < 16; ++index)
+		{
+			bool bIsAnchor = (index == 0 || index == anchor);
+			uint32_t entry = ReadBits(block, offset, bIsAnchor ? info.indexBits - 1 : info.indexBits);
+			uint32_t subset = (PARTITIONS2[partition] >> index) & 0x1;
+
+			for (uint32_t channel = 0; channel < 4; ++channel)
+			{
+				outRGBA[index * 4 + channel] = static_cast<uint8_t>(Interpolate(values[subset][0][channel], values[subset][1][channel], weights[entry]));
+			}
+		}
+	}
+	else
+	{
+		std::memset(outRGBA, 0, 64);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,348 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <utility>
+
+#include "BlockCodec.h"
+
+/** @brief ε  °   ġԴϴ. */
+static const float BC1_WEIGHTS[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+
+/** @brief ε  °   ġԴϴ. ε 0, 1   üԴϴ. */
+static const float BC4_WEIGHTS[8] = { 0.0f, 1.0f, 1.0f / 7.0f, 2.0f / 7.0f, 3.0f / 7.0f, 4.0f / 7.0f, 5.0f / 7.0f, 6.0f / 7.0f };
+
+/** @brief 0.0 ~ 255.0   RGB565 ȭմϴ. */
+static uint16_t PackColor565(const float color[4])
+{
+	uint32_t r = static_cast<uint32_t>(std::lround(color[0] * 31.0f / 255.0f));
+	uint32_t g = static_cast<uint32_t>(std::lround(color[1] * 63.0f / 255.0f));
+	uint32_t b = static_cast<uint32_t>(std::lround(color[2] * 31.0f / 255.0f));
+
+	return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+/** @brief RGB565  RGB8 Ȯմϴ. */
+static void UnpackColor565(uint16_t color, int32_t outColor[3])
+{
+	int32_t r = (color >> 11) & 0x1F;
+	int32_t g = (color >> 5) & 0x3F;
+	int32_t b = color & 0x1F;
+
+	outColor[0] = (r << 3) | (r >> 2);
+	outColor[1] = (g << 2) | (g >> 4);
+	outColor[2] = (b << 3) | (b >> 2);
+}
+
+/** @brief   4 ȷƮ մϴ. ڴ    մϴ. */
+static void BuildPaletteBC1(uint16_t color0, uint16_t color1, float outPalette[4][4])
+{
+	int32_t c0[3];
+	int32_t c1[3];
+	UnpackColor565(color0, c0);
+	UnpackColor565(color1, c1);
+
+	for (uint32_t channel = 0; channel < 3; ++channel)
+	{
+		outPalette[0][channel] = static_cast<float>(c0[channel]);
+		outPalette[1][channel] = static_cast<float>(c1[channel]);
+		outPalette[2][channel] = static_cast<float>((2 * c0[channel] + c1[channel]) / 3);
+		outPalette[3][channel] = static_cast<float>((c0[channel] + 2 * c1[channel]) / 3);
+	}
+
+	for (uint32_t entry = 0; entry < 4; ++entry)
+	{
+		outPalette[entry][3] = 255.0f;
+	}
+}
+
+/** @brief    ڵ  ε  մϴ. */
+static float EvaluateBC1(const BlockCodec::BlockPixels& pixels, uint16_t color0, uint16_t color1, uint8_t outIndices[16])
+{
+	float palette[4][4];
+	BuildPaletteBC1(color0, color1, palette);
+
+	return BlockCodec::SelectIndices(pixels, 3, palette, 4, outIndices);
+}
+
+/** @brief RGB565  ä ϳ  ܰ Դϴ.   false ȯմϴ. */
+static bool StepColor565(uint16_t color, uint32_t channel, int32_t step, uint16_t& outColor)
+{
+	static const uint32_t SHIFTS[3] = { 11, 5, 0 };
+	static const int32_t MASKS[3] = { 0x1F, 0x3F, 0x1F };
+
+	int32_t value = ((color >> SHIFTS[channel]) & MASKS[channel]) + step;
+	if (value < 0 || value > MASKS[channel])
+	{
+		return false;
+	}
+
+	outColor = static_cast<uint16_t>((color & ~(MASKS[channel] << SHIFTS[channel])) | (value << SHIFTS[channel]));
+	return true;
+}
+
+void BlockCodec::EncodeBC1(const uint8_t* rgba, uint8_t* outBlock, BlockCompressUtils::EQuality quality)
+{
+	BlockPixels pixels;
+	LoadBlockPixels(rgba, pixels);
+
+	float endpoint0[4];
+	float endpoint1[4];
+	ComputeAxisEndpoints(pixels, 3, endpoint1, endpoint0);
+
+	uint32_t refineCount = (quality == BlockCompressUtils::EQuality::Fast) ? 1 : 3;
+
+	uint16_t bestColor0 = PackColor565(endpoint0);
+	uint16_t bestColor1 = PackColor565(endpoint1);
+	uint8_t bestIndices[16];
+	float bestError = EvaluateBC1(pixels, bestColor0, bestColor1, bestIndices);
+
+	for (uint32_t refine = 0; refine < refineCount; ++refine)
+	{
+		float weights[16];
+		for (uint32_t index = 0; index < 16; ++index)
+		{
+			weights[index] = BC1_WEIGHTS[bestIndices[index]];
+		}
+
+		if (!SolveEndpoints(pixels, 3, weights, endpoint0, endpoint1))
+		{
+			break;
+		}
+
+		uint16_t color0 = PackColor565(endpoint0);
+		uint16_t color1 = PackColor565(endpoint1);
+		uint8_t indices[16];
+		float error = EvaluateBC1(pixels, color0, color1, indices);
+		if (error >= bestError)
+		{
+			break;
+		}
+
+		bestError = error;
+		bestColor0 = color0;
+		bestColor1 = color1;
+		std::copy(indices, indices + 16, bestIndices);
+	}
+
+	if (quality == BlockCompressUtils::EQuality::High)
+	{
+		bool bIsImproved = true;
+		for (uint32_t pass = 0; pass < 4 && bIsImproved; ++pass)
+		{
+			bIsImproved = false;
+
+			for (uint32_t candidate = 0; candidate < 12; ++candidate)
+			{
+				uint32_t endpoint = candidate / 6;
+				uint32_t channel = (candidate / 2) % 3;
+				int32_t step = (candidate % 2 == 0) ? -1 : 1;
+
+				uint16_t color0 = bestColor0;
+				uint16_t color1 = bestColor1;
+				if (!StepColor565(endpoint == 0 ? bestColor0 : bestColor1, channel, step, endpoint == 0 ? color0 : color1))
+				{
+					continue;
+				}
+
+				uint8_t indices[16];
+				float error = EvaluateBC1(pixels, color0, color1, indices);
+				if (error < bestError)
+				{
+					bestError = error;
+					bestColor0 = color0;
+					bestColor1 = color1;
+					std::copy(indices, indices + 16, bestIndices);
+					bIsImproved = true;
+				}
+			}
+		}
+	}
+
+	/** color0 > color1 ̾ 4  ڵ˴ϴ.  ٸ  ε color0 Ű մϴ. */
+	if (bestColor0 < bestColor1)
+	{
+		std::swap(bestColor0, bestColor1);
+		for (uint32_t index = 0; index < 16; ++index)
+		{
+			bestIndices[index] ^= 1;
+		}
+	}
+	else if (bestColor0 == bestColor1)
+	{
+		std::fill(bestIndices, bestIndices + 16, static_cast<uint8_t>(0));
+	}
+
+	uint32_t packedIndices = 0;
+	for (uint32_t index = 0; index < 16; ++index)
+	{
+		packedIndices |= static_cast<uint32_t>(bestIndices[index]) << (index * 2);
+	}
+
+	outBlock[0] = static_cast<uint8_t>(bestColor0 & 0xFF);
+	outBlock[1] = static_cast<uint8_t>(bestColor0 >> 8);
+	outBlock[2] = static_cast<uint8_t>(bestColor1 & 0xFF);
+	outBlock[3] = static_cast<uint8_t>(bestColor1 >> 8);
+	for (uint32_t index = 0; index < 4; ++index)
+	{
+		outBlock[4 + index] = static_cast<uint8_t>((packedIndices >> (index * 8)) & 0xFF);
+	}
+}
+
+void BlockCodec::DecodeBC1(const uint8_t* block, uint8_t* outRGBA, bool bIsForceFourColor)
+{
+	uint16_t color0 = static_cast<uint16_t>(block[0] | (block[1] << 8));
+	uint16_t color1 = static_cast<uint16_t>(block[2] | (block[3] << 8));
+
+	int32_t c0[3];
+	int32_t c1[3];
+	UnpackColor565(color0, c0);
+	UnpackColor565(color1, c1);
+
+	int32_t palette[4][4];
+	for (uint32_t channel = 0; channel < 3; ++channel)
+	{
+		palette[0][channel] = c0[channel];
+		palette[1][channel] = c1[channel];
+
+		if (color0 > color1 || bIsForceFourColor)
+		{
+			palette[2][channel] = (2 * c0[channel] + c1[channel]) / 3;
+			palette[3][channel] = (c0[channel] + 2 * c1[channel]) / 3;
+		}
+		else
+		{
+			palette[2][channel] = (c0[channel] + c1[channel]) / 2;
+			palette[3][channel] = 0;
+		}
+	}
+
+	palette[0][3] = 255;
+	palette[1][3] = 255;
+	palette[2][3] = 255;
+	palette[3][3] = (color0 > color1 || bIsForceFourColor) ? 255 : 0;
+
+	uint32_t packedIndices = block[4] | (block[5] << 8) | (block[6] << 16) | (static_cast<uint32_t>(block[7]) << 24);
+	for (uint32_t index = 0; index < 16; ++index)
+	{
+		uint32_t entry = (packedIndices >> (index * 2)) & 0x3;
+		for (uint32_t channel = 0; channel < 4; ++channel)
+		{
+			outRGBA[index * 4 + channel] = static_cast<uint8_t>(palette[entry][channel]);
+		}
+	}
+}
+
+/** @brief 8  BC4 ȷƮ մϴ. ڴ    մϴ. */
+static void BuildPaletteBC4(int32_t value0, int32_t value1, float outPalette[8][4])
+{
+	outPalette[0][0] = static_cast<float>(value0);
+	outPalette[1][0] = static_cast<float>(value1);
+	for (int32_t entry = 2; entry < 8; ++entry)
+	{
+		outPalette[entry][0] = static_cast<float>(((8 - entry) * value0 + (entry - 1) * value1 + 3) / 7);
+	}
+}
+
+void BlockCodec::EncodeBC4(const uint8_t* rgba, uint32_t channel, uint8_t* outBlock)
+{
+	BlockPixels pixels;
+	int32_t minValue = 255;
+	int32_t maxValue = 0;
+
+	for (uint32_t index = 0; index < 16; ++index)
+	{
+		int32_t value = rgba[index * 4 + channel];
+
+		pixels.channels[0][index] = static_cast<float>(value);
+		minValue = std::min(minValue, value);
+		maxValue = std::max(maxValue, value);
+	}
+
+	uint8_t bestIndices[16] = {};
+	int32_t bestValue0 = maxValue;
+	int32_t bestValue1 = minValue;
+
+	if (minValue != maxValue)
+	{
+		float palette[8][4];
+		BuildPaletteBC4(bestValue0, bestValue1, palette);
+		float bestError = SelectIndices(pixels, 1, palette, 8, bestIndices);
+
+		float weights[16];
+		for (uint32_t index = 0; index < 16; ++index)
+		{
+			weights[index] = BC4_WEIGHTS[bestIndices[index]];
+		}
+
+		float endpoint0[4];
+		float endpoint1[4];
+		if (SolveEndpoints(pixels, 1, weights, endpoint0, endpoint1))
+		{
+			int32_t value0 = static_cast<int32_t>(std::lround(endpoint0[0]));
+			int32_t value1 = static_cast<int32_t>(std::lround(endpoint1[0]));
+
+			if (value0 > value1)
+			{
+				uint8_t indices[16];
+				BuildPaletteBC4(value0, value1, palette);
+
+				float error = SelectIndices(pixels, 1, palette, 8, indices);
+				if (error < bestError)
+				{
+					bestValue0 = value0;
+					bestValue1 = value1;
+					std::copy(indices, indices + 16, bestIndices);
+				}
+			}
+		}
+	}
+
+	uint64_t packedIndices = 0;
+	for (uint32_t index = 0; index < 16; ++index)
+	{
+		packedIndices |= static_cast<uint64_t>(bestIndices[index]) << (index * 3);
+	}
+
+	outBlock[0] = static_cast<uint8_t>(bestValue0);
+	outBlock[1] = static_cast<uint8_t>(bestValue1);
+	for (uint32_t index = 0; index < 6; ++index)
+	{
+		outBlock[2 + index] = static_cast<uint8_t>((packedIndices >> (index * 8)) & 0xFF);
+	}
+}
+
+void BlockCodec::DecodeBC4(const uint8_t* block, uint32_t channel, uint8_t* outRGBA)
+{
+	int32_t value0 = block[0];
+	int32_t value1 = block[1];
+
+	int32_t palette[8] = { value0, value1 };
+	if (value0 > value1)
+	{
+		for (int32_t entry = 2; entry < 8; ++entry)
+		{
+			palette[entry] = ((8 - entry) * value0 + (entry - 1) * value1 + 3) / 7;
+		}
+	}
+	else
+	{
+		for (int32_t entry = 2; entry < 6; ++entry)
+		{
+			palette[entry] = ((6 - entry) * value0 + (entry - 1) * value1 + 2) / 5;
+		}
+
+		palette[6] = 0;
+		palette[7] = 255;
+	}
+
+	uint64_t packedIndices = 0;
+	for (uint32_t index = 0; index < 6; ++index)
+	{
+		packedIndices |= static_cast<uint64_t>(block[2 + index]) << (index * 8);
+	}
+
+	for (uint32_t index = 0; index < 16; ++index)
+	{
+		outRGBA[index * 4 + channel] = static_cast<uint8_t>(palette[(packedIndices >> (index * 3)) & 0x7]);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,270 @@
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+#include "BlockCodec.h"
+#include "BlockCompressUtils.h"
+
+/** @brief ̹ 4x4  нϴ. ̹   ȼ ڸ ȼ äϴ. */
+static void LoadBlock(const BlockCompressUtils::Image& image, int32_t blockX, int32_t blockY, uint8_t outRGBA[64])
+{
+	for (int32_t y = 0; y < 4; ++y)
+	{
+		int32_t sourceY = std::min(blockY * 4 + y, image.height - 1);
+		for (int32_t x = 0; x < 4; ++x)
+		{
+			int32_t sourceX = std::min(blockX * 4 + x, image.width - 1);
+			const uint8_t* source = &image.pixels[(sourceY * image.width + sourceX) * 4];
+			std::copy(source, source + 4, &outRGBA[(y * 4 + x) * 4]);
+		}
+	}
+}
+
+/** @brief 4x4  ̹ մϴ. ̹   ȼ ϴ. */
+static void StoreBlock(BlockCompressUtils::Image& image, int32_t blockX, int32_t blockY, const uint8_t rgba[64])
+{
+	for (int32_t y = 0; y < 4 && blockY * 4 + y < image.height; ++y)
+	{
+		for (int32_t x = 0; x < 4 && blockX * 4 + x < image.width; ++x)
+		{
+			uint8_t* target = &image.pixels[((blockY * 4 + y) * image.width + blockX * 4 + x) * 4];
+			std::copy(&rgba[(y * 4 + x) * 4], &rgba[(y * 4 + x) * 4] + 4, target);
+		}
+	}
+}
+
+uint32_t BlockCompressUtils::GetBlockSize(EFormat format)
+{
+	return (format == EFormat::BC1 || format == EFormat::BC4) ? 8 : 16;
+}
+
+std::vector<uint8_t> BlockCompressUtils::Compress(const Image& image, EFormat format, EQuality quality)
+{
+	int32_t blockCountX = (image.width + 3) / 4;
+	int32_t blockCountY = (image.height + 3) / 4;
+	uint32_t blockSize = GetBlockSize(format);
+
+	std::vector<uint8_t> blocks(static_cast<std::size_t>(blockCountX) * blockCountY * blockSize);
+	BlockCodec::ParallelFor(static_cast<uint32_t>(blockCountY), [&](uint32_t blockY)
+		{
+			uint8_t rgba[64];
+			for (int32_t blockX = 0; blockX < blockCountX; ++blockX)
+			{
+				LoadBlock(image, blockX, static_cast<int32_t>(blockY), rgba);
+
+				uint8_t* block = &blocks[(static_cast<std::size_t>(blockY) * blockCountX + blockX) * blockSize];
+				switch (format)
+				{
+				case EFormat::BC1:
+					BlockCodec::EncodeBC1(rgba, block, quality);
+					break;
+
+				case EFormat::BC3:
+					BlockCodec::EncodeBC4(rgba, 3, block);
+					BlockCodec::EncodeBC1(rgba, block + 8, quality);
+					break;
+
+				case EFormat::BC4:
+					BlockCodec::EncodeBC4(rgba, 0, block);
+					break;
+
+				case EFormat::BC5:
+					BlockCodec::EncodeBC4(rgba, 0, block);
+					BlockCodec::EncodeBC4(rgba, 1, block + 8);
+					break;
+
+				case EFormat::BC7:
+					BlockCodec::EncodeBC7(rgba, block, quality);
+					break;
+				}
+			}
+		});
+
+	return blocks;
+}
+
+BlockCompressUtils::Image BlockCompressUtils::Decompress(const std::vector<uint8_t>& blocks, int32_t width, int32_t height, EFormat format)
+{
+	Image image;
+	image.width = width;
+	image.height = height;
+	image.pixels.resize(static_cast<std::size_t>(width) * height * 4);
+
+	int32_t blockCountX = (width + 3) / 4;
+	int32_t blockCountY = (height + 3) / 4;
+	uint32_t blockSize = GetBlockSize(format);
+
+	for (int32_t blockY = 0; blockY < blockCountY; ++blockY)
+	{
+		for (int32_t blockX = 0; blockX < blockCountX; ++blockX)
+		{
+			const uint8_t* block = &blocks[(static_cast<std::size_t>(blockY) * blockCountX + blockX) * blockSize];
+
+			uint8_t rgba[64];
+			for (uint32_t index = 0; index < 16; ++index)
+			{
+				rgba[index * 4 + 0] = 0;
+				rgba[index * 4 + 1] = 0;
+				rgba[index * 4 + 2] = 0;
+				rgba[index * 4 + 3] = 255;
+			}
+
+			switch (format)
+			{
+			case EFormat::BC1:
+				BlockCodec::DecodeBC1(block, rgba, false);
+				break;
+
+			case EFormat::BC3:
+				BlockCodec::DecodeBC1(block + 8, rgba, true);
+				BlockCodec::DecodeBC4(block, 3, rgba);
+				break;
+
+			case EFormat::BC4:
+				BlockCodec::DecodeBC4(block, 0, rgba);
+				break;
+
+			case EFormat::BC5:
+				BlockCodec::DecodeBC4(block, 0, rgba);
+				BlockCodec::DecodeBC4(block + 8, 1, rgba);
+				break;
+
+			case EFormat::BC7:
+				BlockCodec::DecodeBC7(block, rgba);
+				break;
+			}
+
+			StoreBlock(image, blockX, blockY, rgba);
+		}
+	}
+
+	return image;
+}
+
+float BlockCompressUtils::ComputePSNR(const Image& reference, const Image& image, EFormat format)
+{
+	uint32_t channelCount = 4;
+	switch (format)
+	{
+	case EFormat::BC1:
+		channelCount = 3;
+		break;
+
+	case EFormat::BC4:
+		channelCount = 1;
+		break;
+
+	case EFormat::BC5:
+		channelCount = 2;
+		break;
+
+	default:
+		channelCount = 4;
+		break;
+	}
+
+	double squareErrorSum = 0.0;
+	std::size_t pixelCount = static_cast<std::size_t>(reference.width) * reference.height;
+	for (std::size_t index = 0; index < pixelCount; ++index)
+	{
+		for (uint32_t channel = 0; channel < channelCount; ++channel)
+		{
+			double delta = static_cast<double>(reference.pixels[index * 4 + channel]) - static_cast<double>(image.pixels[index * 4 + channel]);
+			squareErrorSum += delta * delta;
+		}
+	}
+
+	double meanSquareError = squareErrorSum / static_cast<double>(pixelCount * channelCount);
+	if (meanSquareError <= 0.0)
+	{
+		return 99.0f;
+	}
+
+	return static_cast<float>(10.0 * std::log10(255.0 * 255.0 / meanSquareError));
+}
+
+bool BlockCompressUtils::WriteDDS(const std::string& path, EFormat format, bool bIsSrgb, int32_t width, int32_t height, const std::vector<std::vector<uint8_t>>& levels)
+{
+	static const uint32_t DDS_MAGIC = 0x20534444; // "DDS "
+	static const uint32_t FOURCC_DX10 = 0x30315844; // "DX10"
+	static const uint32_t DDSD_FLAGS = 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000 | 0x80000; // CAPS | HEIGHT | WIDTH | PIXELFORMAT | MIPMAPCOUNT | LINEARSIZE
+	static const uint32_t DDPF_FOURCC = 0x4;
+	static const uint32_t DDSCAPS_COMPLEX = 0x8;
+	static const uint32_t DDSCAPS_TEXTURE = 0x1000;
+	static const uint32_t DDSCAPS_MIPMAP = 0x400000;
+	static const uint32_t DDS_DIMENSION_TEXTURE2D = 3;
+
+	uint32_t dxgiFormat = 0;
+	switch (format)
+	{
+	case EFormat::BC1:
+		dxgiFormat = bIsSrgb ? 72 : 71; // DXGI_FORMAT_BC1_UNORM_SRGB, DXGI_FORMAT_BC1_UNORM
+		break;
+
+	case EFormat::BC3:
+		dxgiFormat = bIsSrgb ? 78 : 77; // DXGI_FORMAT_BC3_UNORM_SRGB, DXGI_FORMAT_BC3_UNORM
+		break;
+
+	case EFormat::BC4:
+		dxgiFormat = 80; // DXGI_FORMAT_BC4_UNORM
+		break;
+
+	case EFormat::BC5:
+		dxgiFormat = 83; // DXGI_FORMAT_BC5_UNORM
+		break;
+
+	case EFormat::BC7:
+		dxgiFormat = bIsSrgb ? 99 : 98; // DXGI_FORMAT_BC7_UNORM_SRGB, DXGI_FORMAT_BC7_UNORM
+		break;
+	}
+
+	uint32_t levelCount = static_cast<uint32_t>(levels.size());
+	uint32_t caps = DDSCAPS_TEXTURE | (levelCount > 1 ? (DDSCAPS_COMPLEX | DDSCAPS_MIPMAP) : 0);
+
+	uint32_t header[32] = {};
+	header[0] = DDS_MAGIC;
+	header[1] = 124; // DDS_HEADER::size
+	header[2] = DDSD_FLAGS;
+	header[3] = static_cast<uint32_t>(height);
+	header[4] = static_cast<uint32_t>(width);
+	header[5] = levels.empty() ? 0 : static_cast<uint32_t>(levels.front().size());
+	header[7] = levelCount;
+	header[19] = 32; // DDS_PIXELFORMAT::size
+	header[20] = DDPF_FOURCC;
+	header[21] = FOURCC_DX10;
+	header[27] = caps;
+
+	uint32_t headerDX10[5] = { dxgiFormat, DDS_DIMENSION_TEXTURE2D, 0, 1, 0 };
+
+	std::ofstream file(path, std::ios::binary);
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	/** DDS Ʋ  Դϴ. */
+	auto writeWords = [&](const uint32_t* words, uint32_t count)
+		{
+			for (uint32_t index = 0; index < count; ++index)
+			{
+				char bytes[4] =
+				{
+					static_cast<char>(words[index] & 0xFF),
+					static_cast<char>((words[index] >> 8) & 0xFF),
+					static_cast<char>((words[index] >> 16) & 0xFF),
+					static_cast<char>((words[index] >> 24) & 0xFF),
+				};
+				file.write(bytes, 4);
+			}
+		};
+
+	writeWords(header, 32);
+	writeWords(headerDX10, 5);
+
+	for (const auto& level : levels)
+	{
+		file.write(reinterpret_cast<const char*>(level.data()), static_cast<std::streamsize>(level.size()));
+	}
+
+	return file.good();
+}
\ No newline at end of file
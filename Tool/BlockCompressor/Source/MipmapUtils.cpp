@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "BlockCodec.h"
+#include "MipmapUtils.h"
+
+/** @brief    sRGB ȯϴ ̺ ũԴϴ. */
+static const uint32_t LINEAR_TO_SRGB_TABLE_SIZE = 4096;
+
+/** @brief 8Ʈ sRGB  0.0 ~ 1.0     ȯϴ ̺ ϴ. */
+static const std::array<float, 256>& GetSrgbToLinearTable()
+{
+	static const std::array<float, 256> table = []()
+		{
+			std::array<float, 256> values;
+			for (uint32_t index = 0; index < 256; ++index)
+			{
+				float value = static_cast<float>(index) / 255.0f;
+				values[index] = (value <= 0.04045f) ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+			}
+
+			return values;
+		}();
+
+	return table;
+}
+
+/** @brief 0.0 ~ 1.0     8Ʈ sRGB  ȯϴ ̺ ϴ. */
+static const std::array<uint8_t, LINEAR_TO_SRGB_TABLE_SIZE>& GetLinearToSrgbTable()
+{
+	static const std::array<uint8_t, LINEAR_TO_SRGB_TABLE_SIZE> table = []()
+		{
+			std::array<uint8_t, LINEAR_TO_SRGB_TABLE_SIZE> values;
+			for (uint32_t index = 0; index < LINEAR_TO_SRGB_TABLE_SIZE; ++index)
+			{
+				float value = static_cast<float>(index) / static_cast<float>(LINEAR_TO_SRGB_TABLE_SIZE - 1);
+				float srgb = (value <= 0.0031308f) ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+				values[index] = static_cast<uint8_t>(std::clamp(std::lround(srgb * 255.0f), 0L, 255L));
+			}
+
+			return values;
+		}();
+
+	return table;
+}
+
+BlockCompressUtils::Image MipmapUtils::Downsample(const BlockCompressUtils::Image& image, bool bIsSrgb)
+{
+	BlockCompressUtils::Image result;
+	result.width = std::max(1, image.width / 2);
+	result.height = std::max(1, image.height / 2);
+	result.pixels.resize(static_cast<std::size_t>(result.width) * result.height * 4);
+
+	const std::array<float, 256>& srgbToLinear = GetSrgbToLinearTable();
+	const std::array<uint8_t, LINEAR_TO_SRGB_TABLE_SIZE>& linearToSrgb = GetLinearToSrgbTable();
+
+	/** äκ 0.0 ~ 1.0  ȯϴ ̺Դϴ.  ä ׻  Դϴ. */
+	std::array<float, 256> unorm;
+	for (uint32_t index = 0; index < 256; ++index)
+	{
+		unorm[index] = static_cast<float>(index) / 255.0f;
+	}
+
+	const std::array<float, 256>& colorTable = bIsSrgb ? srgbToLinear : unorm;
+
+	BlockCodec::ParallelFor(static_cast<uint32_t>(result.height), [&](uint32_t y)
+		{
+			int32_t y0 = std::min(static_cast<int32_t>(y) * 2, image.height - 1);
+			int32_t y1 = std::min(static_cast<int32_t>(y) * 2 + 1, image.height - 1);
+
+			for (int32_t x = 0; x < result.width; ++x)
+			{
+				int32_t x0 = std::min(x * 2, image.width - 1);
+				int32_t x1 = std::min(x * 2 + 1, image.width - 1);
+
+				const uint8_t* sources[4] =
+				{
+					&image.pixels[(y0 * image.width + x0) * 4],
+					&image.pixels[(y0 * image.width + x1) * 4],
+					&image.pixels[(y1 * image.width + x0) * 4],
+					&image.pixels[(y1 * image.width + x1) * 4],
+				};
+
+				alignas(16) float average[4];
+#if defined(BLOCK_CODEC_SIMD)
+				__m128 sum = _mm_setzero_ps();
+				for (const uint8_t* source : sources)
+				{
+					sum = _mm_add_ps(sum, _mm_set_ps(unorm[source[3]], colorTable[source[2]], colorTable[source[1]], colorTable[source[0]]));
+				}
+
+				__m128 scale = _mm_set1_ps(0.25f);
+				__m128 lower = _mm_setzero_ps();
+				__m128 upper = _mm_set1_ps(1.0f);
+				_mm_store_ps(average, _mm_min_ps(_mm_max_ps(_mm_mul_ps(sum, scale), lower), upper));
+#else
+				for (uint32_t channel = 0; channel < 4; ++channel)
+				{
+					const std::array<float, 256>& table = (channel == 3) ? unorm : colorTable;
+
+					float sum = 0.0f;
+					for (const uint8_t* source : sources)
+					{
+						sum += table[source[channel]];
+					}
+
+					average[channel] = std::clamp(sum * 0.25f, 0.0f, 1.0f);
+				}
+#endif
+
+				uint8_t* target = &result.pixels[(static_cast<std::size_t>(y) * result.width + x) * 4];
+				for (uint32_t channel = 0; channel < 3; ++channel)
+				{
+					if (bIsSrgb)
+					{
+						target[channel] = linearToSrgb[static_cast<uint32_t>(std::lround(average[channel] * static_cast<float>(LINEAR_TO_SRGB_TABLE_SIZE - 1)))];
+					}
+					else
+					{
+						target[channel] = static_cast<uint8_t>(std::lround(average[channel] * 255.0f));
+					}
+				}
+
+				target[3] = static_cast<uint8_t>(std::lround(average[3] * 255.0f));
+			}
+		});
+
+	return result;
+}
+
+std::vector<BlockCompressUtils::Image> MipmapUtils::GenerateMipChain(const BlockCompressUtils::Image& image, bool bIsSrgb)
+{
+	std::vector<BlockCompressUtils::Image> levels;
+	levels.push_back(image);
+
+	while (levels.back().width > 1 || levels.back().height > 1)
+	{
+		levels.push_back(Downsample(levels.back(), bIsSrgb));
+	}
+
+	return levels;
+}
\ No newline at end of file
@@ -0,0 +1,191 @@
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "BlockCompressUtils.h"
+
+/**
+ * @brief  ˻ Դϴ.
+ */
+static int32_t failCount = 0;
+
+/**
+ * @brief  ˻ϰ, ϸ ޽ մϴ.
+ */
+static void Check(bool bIsPassed, const char* message)
+{
+	if (!bIsPassed)
+	{
+		std::printf("[FAILED] %s\n", message);
+		failCount++;
+	}
+}
+
+/**
+ * @brief 0 ~ 255  ڸ 8Ʈ  ϴ.
+ */
+static uint8_t ToByte(float value)
+{
+	return static_cast<uint8_t>(value < 0.0f ? 0.0f : (value > 255.0f ? 255.0f : value));
+}
+
+/**
+ * @brief ε巯 ׶Ʈ,  ٸ  , ٹ, , ϴ ĸ  RGBA ̹ մϴ.
+ *
+ * @note  ϳ  谡   ־ BC7   Ž ǰ ̸ ϴ.
+ */
+static BlockCompressUtils::Image CreateTestImage(int32_t width, int32_t height)
+{
+	BlockCompressUtils::Image image;
+	image.width = width;
+	image.height = height;
+	image.pixels.resize(static_cast<std::size_t>(width) * height * 4);
+
+	uint32_t seed = 0x12345678u;
+	for (int32_t y = 0; y < height; ++y)
+	{
+		for (int32_t x = 0; x < width; ++x)
+		{
+			float u = static_cast<float>(x) / static_cast<float>(width);
+			float v = static_cast<float>(y) / static_cast<float>(height);
+
+			float r = 255.0f * u;
+			float g = 255.0f * v;
+			float b = 255.0f * (0.5f + 0.5f * std::sin(12.0f * u + 7.0f * v));
+			float a = 255.0f;
+
+			for (int32_t circle = 0; circle < 12; ++circle)
+			{
+				float dx = u - (0.1f + 0.07f * static_cast<float>(circle));
+				float dy = (v - (0.5f + 0.35f * std::sin(static_cast<float>(circle) * 1.7f))) * static_cast<float>(height) / static_cast<float>(width);
+				float radius = 0.04f + 0.01f * static_cast<float>(circle % 4);
+				if (dx * dx + dy * dy < radius * radius)
+				{
+					r = static_cast<float>((circle * 67) % 256);
+					g = static_cast<float>((circle * 151) % 256);
+					b = static_cast<float>((circle * 29 + 100) % 256);
+				}
+			}
+
+			if (v > 0.8f && ((x / 3) + (y / 5)) % 2 == 1)
+			{
+				r = 30.0f;
+				g = 200.0f;
+				b = 90.0f;
+			}
+
+			seed = seed * 1664525u + 1013904223u;
+			if (u > 0.75f && v < 0.3f)
+			{
+				float noise = static_cast<float>((seed >> 24) & 0x1F) - 16.0f;
+				r += noise;
+				g += noise;
+				b -= noise;
+			}
+
+			if (u < 0.5f && v < 0.25f)
+			{
+				a = 510.0f * u;
+			}
+
+			if (u > 0.5f && v > 0.4f && v < 0.6f)
+			{
+				a = ((x / 4 + y / 4) % 2 == 1) ? 255.0f : 64.0f + 100.0f * v;
+			}
+
+			uint8_t* pixel = &image.pixels[(static_cast<std::size_t>(y) * width + x) * 4];
+			pixel[0] = ToByte(r);
+			pixel[1] = ToByte(g);
+			pixel[2] = ToByte(b);
+			pixel[3] = ToByte(a);
+		}
+	}
+
+	return image;
+}
+
+/**
+ * @brief ̹ ϰ Ͽ PSNR մϴ.   ũ⵵ ˻մϴ.
+ */
+static float CompressPSNR(const BlockCompressUtils::Image& image, BlockCompressUtils::EFormat format, BlockCompressUtils::EQuality quality)
+{
+	std::vector<uint8_t> blocks = BlockCompressUtils::Compress(image, format, quality);
+
+	std::size_t blockCount = static_cast<std::size_t>((image.width + 3) / 4) * ((image.height + 3) / 4);
+	Check(blocks.size() == blockCount * BlockCompressUtils::GetBlockSize(format), "compressed size must match block count");
+
+	BlockCompressUtils::Image decoded = BlockCompressUtils::Decompress(blocks, image.width, image.height, format);
+	return BlockCompressUtils::ComputePSNR(image, decoded, format);
+}
+
+int main(void)
+{
+	using EFormat = BlockCompressUtils::EFormat;
+	using EQuality = BlockCompressUtils::EQuality;
+
+	/** , ΰ 4  ƴϹǷ ڸ  ä Բ ˻մϴ. */
+	BlockCompressUtils::Image image = CreateTestImage(258, 194);
+
+	struct Threshold
+	{
+		EFormat format;
+		const char* name;
+		float minPSNR;
+	};
+
+	/**   ǰ ܰ迡 Ѿ ϴ 亰 PSNR Դϴ. */
+	static const Threshold thresholds[] =
+	{
+		{ EFormat::BC1, "bc1", 38.0f },
+		{ EFormat::BC3, "bc3", 39.0f },
+		{ EFormat::BC4, "bc4", 53.0f },
+		{ EFormat::BC5, "bc5", 50.0f },
+		{ EFormat::BC7, "bc7", 41.0f },
+	};
+
+	static const char* qualityNames[] = { "fast", "normal", "high" };
+
+	float bc7PSNRs[3] = {};
+	for (const auto& threshold : thresholds)
+	{
+		for (int32_t quality = 0; quality < 3; ++quality)
+		{
+			float psnr = CompressPSNR(image, threshold.format, static_cast<EQuality>(quality));
+			std::printf("%s %-6s : PSNR %6.2f dB (min %.2f dB)\n", threshold.name, qualityNames[quality], psnr, threshold.minPSNR);
+
+			Check(psnr >= threshold.minPSNR, "PSNR must not be below the format threshold");
+			if (threshold.format == EFormat::BC7)
+			{
+				bc7PSNRs[quality] = psnr;
+			}
+		}
+	}
+
+	/** BC7 ǰ ܰ  ٸ    ŽϹǷ PSNR ̰ иؾ մϴ. */
+	Check(bc7PSNRs[1] >= bc7PSNRs[0] + 2.0f, "bc7 normal must be at least 2 dB better than fast");
+	Check(bc7PSNRs[2] >= bc7PSNRs[1] + 0.5f, "bc7 high must be at least 0.5 dB better than normal");
+
+	/**  ϳ   信  ս  Ǿ մϴ. */
+	BlockCompressUtils::Image flat;
+	flat.width = 8;
+	flat.height = 8;
+	for (int32_t index = 0; index < flat.width * flat.height; ++index)
+	{
+		flat.pixels.insert(flat.pixels.end(), { 200, 100, 50, 255 });
+	}
+
+	for (const auto& threshold : thresholds)
+	{
+		Check(CompressPSNR(flat, threshold.format, EQuality::Normal) >= 40.0f, "flat image must be reconstructed almost exactly");
+	}
+
+	if (failCount > 0)
+	{
+		std::printf("%d check(s) failed.\n", failCount);
+		return 1;
+	}
+
+	std::printf("all checks passed.\n");
+	return 0;
+}
\ No newline at end of file